@@ -52,6 +52,7 @@ ifeq ($(strip $(AUDIO_ENABLE)), yes)
             OPT_DEFS += -DAUDIO_DRIVER_DAC
         else ifeq ($(strip $(AUDIO_DRIVER)), dac_additive)
             OPT_DEFS += -DAUDIO_DRIVER_DAC
+            SRC += $(QUANTUM_DIR)/audio/synth.c
         ## stm32f2 and above have a usable DAC unit, f1 do not, and need to use pwm instead
         else ifeq ($(strip $(AUDIO_DRIVER)), pwm_software)
             OPT_DEFS += -DAUDIO_DRIVER_PWM
@@ -69,6 +70,7 @@ ifeq ($(strip $(AUDIO_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/process_keycode/process_audio.c
     SRC += $(QUANTUM_DIR)/process_keycode/process_clicky.c
     SRC += $(QUANTUM_DIR)/audio/audio.c ## common audio code, hardware agnostic
+    SRC += $(QUANTUM_DIR)/audio/song_stream.c
     SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)/audio_$(strip $(AUDIO_DRIVER)).c
     SRC += $(QUANTUM_DIR)/audio/voices.c
     SRC += $(QUANTUM_DIR)/audio/luts.c
@@ -87,6 +89,7 @@ ifeq ($(strip $(MIDI_ENABLE)), yes)
     COMMON_VPATH += $(QUANTUM_PATH)/midi
     SRC += $(QUANTUM_DIR)/midi/midi.c
     SRC += $(QUANTUM_DIR)/midi/midi_device.c
+    SRC += $(QUANTUM_DIR)/midi/midi_output_queue.c
     SRC += $(QUANTUM_DIR)/midi/qmk_midi.c
     SRC += $(QUANTUM_DIR)/midi/sysex_tools.c
     SRC += $(QUANTUM_DIR)/midi/bytequeue/bytequeue.c
@@ -131,7 +134,9 @@ endif
 ifeq ($(strip $(MOUSEKEY_ENABLE)), yes)
     OPT_DEFS += -DMOUSEKEY_ENABLE
     MOUSE_ENABLE := yes
+    COMMON_VPATH += $(QUANTUM_PATH)/mousekey
     SRC += $(QUANTUM_DIR)/mousekey.c
+    SRC += $(QUANTUM_DIR)/mousekey/mousekey_motion.c
 endif
 
 VALID_POINTING_DEVICE_DRIVER_TYPES := adns5050 adns9800 analog_joystick cirque_pinnacle_i2c cirque_pinnacle_spi paw3204 pmw3320 pmw3360 pmw3389 pimoroni_trackball custom
@@ -145,6 +150,7 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_drivers.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_subpixel.c
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -725,6 +731,8 @@ ifeq ($(strip $(HAPTIC_ENABLE)),yes)
         $(call CATASTROPHIC_ERROR,Invalid HAPTIC_DRIVER,HAPTIC_DRIVER="$(HAPTIC_DRIVER)" is not a valid Haptic driver)
     else
         COMMON_VPATH += $(DRIVER_PATH)/haptic
+        COMMON_VPATH += $(QUANTUM_PATH)/haptic
+        SRC += $(QUANTUM_DIR)/haptic/haptic_queue.c
 
         ifeq ($(strip $(HAPTIC_DRIVER)), drv2605l)
             SRC += drv2605l.c
@@ -822,6 +830,10 @@ ifeq ($(strip $(SEND_STRING_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/send_string/send_string.c
 endif
 
+ifeq ($(strip $(AUTOCORRECT_ENABLE)), yes)
+    SRC += $(QUANTUM_DIR)/process_keycode/autocorrect_dictionary.c
+endif
+
 ifeq ($(strip $(AUTO_SHIFT_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/process_keycode/process_auto_shift.c
     OPT_DEFS += -DAUTO_SHIFT_ENABLE
@@ -142,16 +142,16 @@ void aw20216_init(pin_t cs_pin, pin_t en_pin) {
 }
 
 void aw20216_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    aw_led led;
-    memcpy_P(&led, (&g_aw_leds[index]), sizeof(led));
+    aw_led        led_buffer;
+    const aw_led *led = pgm_read_struct(&led_buffer, &g_aw_leds[index]);
 
-    if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
+    if (g_pwm_buffer[led->driver][led->r] == red && g_pwm_buffer[led->driver][led->g] == green && g_pwm_buffer[led->driver][led->b] == blue) {
         return;
     }
-    g_pwm_buffer[led.driver][led.r]          = red;
-    g_pwm_buffer[led.driver][led.g]          = green;
-    g_pwm_buffer[led.driver][led.b]          = blue;
-    g_pwm_buffer_update_required[led.driver] = true;
+    g_pwm_buffer[led->driver][led->r]         = red;
+    g_pwm_buffer[led->driver][led->g]         = green;
+    g_pwm_buffer[led->driver][led->b]         = blue;
+    g_pwm_buffer_update_required[led->driver] = true;
 }
 
 void aw20216_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -147,15 +147,15 @@ void ckled2001_init(uint8_t addr) {
 }
 
 void ckled2001_set_value(int index, uint8_t value) {
-    ckled2001_led led;
+    ckled2001_led led_buffer;
     if (index >= 0 && index < LED_MATRIX_LED_COUNT) {
-        memcpy_P(&led, (&g_ckled2001_leds[index]), sizeof(led));
+        const ckled2001_led *led = pgm_read_struct(&led_buffer, &g_ckled2001_leds[index]);
 
-        if (g_pwm_buffer[led.driver][led.v] == value) {
+        if (g_pwm_buffer[led->driver][led->v] == value) {
             return;
         }
-        g_pwm_buffer[led.driver][led.v]          = value;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led->driver][led->v]         = value;
+        g_pwm_buffer_update_required[led->driver] = true;
     }
 }
 
@@ -166,19 +166,19 @@ void ckled2001_set_value_all(uint8_t value) {
 }
 
 void ckled2001_set_led_control_register(uint8_t index, bool value) {
-    ckled2001_led led;
-    memcpy_P(&led, (&g_ckled2001_leds[index]), sizeof(led));
+    ckled2001_led        led_buffer;
+    const ckled2001_led *led = pgm_read_struct(&led_buffer, &g_ckled2001_leds[index]);
 
-    uint8_t control_register = led.v / 8;
-    uint8_t bit_value        = led.v % 8;
+    uint8_t control_register = led->v / 8;
+    uint8_t bit_value        = led->v % 8;
 
     if (value) {
-        g_led_control_registers[led.driver][control_register] |= (1 << bit_value);
+        g_led_control_registers[led->driver][control_register] |= (1 << bit_value);
     } else {
-        g_led_control_registers[led.driver][control_register] &= ~(1 << bit_value);
+        g_led_control_registers[led->driver][control_register] &= ~(1 << bit_value);
     }
 
-    g_led_control_registers_update_required[led.driver] = true;
+    g_led_control_registers_update_required[led->driver] = true;
 }
 
 void ckled2001_update_pwm_buffers(uint8_t addr, uint8_t index) {
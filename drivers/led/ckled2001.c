@@ -146,17 +146,17 @@ void ckled2001_init(uint8_t addr) {
 }
 
 void ckled2001_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ckled2001_led led;
+    ckled2001_led led_buffer;
     if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
-        memcpy_P(&led, (&g_ckled2001_leds[index]), sizeof(led));
+        const ckled2001_led *led = pgm_read_struct(&led_buffer, &g_ckled2001_leds[index]);
 
-        if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
+        if (g_pwm_buffer[led->driver][led->r] == red && g_pwm_buffer[led->driver][led->g] == green && g_pwm_buffer[led->driver][led->b] == blue) {
             return;
         }
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led->driver][led->r]         = red;
+        g_pwm_buffer[led->driver][led->g]         = green;
+        g_pwm_buffer[led->driver][led->b]         = blue;
+        g_pwm_buffer_update_required[led->driver] = true;
     }
 }
 
@@ -167,33 +167,33 @@ void ckled2001_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ckled2001_set_led_control_register(uint8_t index, bool red, bool green, bool blue) {
-    ckled2001_led led;
-    memcpy_P(&led, (&g_ckled2001_leds[index]), sizeof(led));
+    ckled2001_led        led_buffer;
+    const ckled2001_led *led = pgm_read_struct(&led_buffer, &g_ckled2001_leds[index]);
 
-    uint8_t control_register_r = led.r / 8;
-    uint8_t control_register_g = led.g / 8;
-    uint8_t control_register_b = led.b / 8;
-    uint8_t bit_r              = led.r % 8;
-    uint8_t bit_g              = led.g % 8;
-    uint8_t bit_b              = led.b % 8;
+    uint8_t control_register_r = led->r / 8;
+    uint8_t control_register_g = led->g / 8;
+    uint8_t control_register_b = led->b / 8;
+    uint8_t bit_r              = led->r % 8;
+    uint8_t bit_g              = led->g % 8;
+    uint8_t bit_b              = led->b % 8;
 
     if (red) {
-        g_led_control_registers[led.driver][control_register_r] |= (1 << bit_r);
+        g_led_control_registers[led->driver][control_register_r] |= (1 << bit_r);
     } else {
-        g_led_control_registers[led.driver][control_register_r] &= ~(1 << bit_r);
+        g_led_control_registers[led->driver][control_register_r] &= ~(1 << bit_r);
     }
     if (green) {
-        g_led_control_registers[led.driver][control_register_g] |= (1 << bit_g);
+        g_led_control_registers[led->driver][control_register_g] |= (1 << bit_g);
     } else {
-        g_led_control_registers[led.driver][control_register_g] &= ~(1 << bit_g);
+        g_led_control_registers[led->driver][control_register_g] &= ~(1 << bit_g);
     }
     if (blue) {
-        g_led_control_registers[led.driver][control_register_b] |= (1 << bit_b);
+        g_led_control_registers[led->driver][control_register_b] |= (1 << bit_b);
     } else {
-        g_led_control_registers[led.driver][control_register_b] &= ~(1 << bit_b);
+        g_led_control_registers[led->driver][control_register_b] &= ~(1 << bit_b);
     }
 
-    g_led_control_registers_update_required[led.driver] = true;
+    g_led_control_registers_update_required[led->driver] = true;
 }
 
 void ckled2001_update_pwm_buffers(uint8_t addr, uint8_t index) {
@@ -191,17 +191,17 @@ void is31fl3731_init(uint8_t addr) {
 }
 
 void is31fl3731_set_value(int index, uint8_t value) {
-    is31_led led;
+    is31_led led_buffer;
     if (index >= 0 && index < LED_MATRIX_LED_COUNT) {
-        memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
+        const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[index]);
 
         // Subtract 0x24 to get the second index of g_pwm_buffer
 
-        if (g_pwm_buffer[led.driver][led.v - 0x24] == value) {
+        if (g_pwm_buffer[led->driver][led->v - 0x24] == value) {
             return;
         }
-        g_pwm_buffer[led.driver][led.v - 0x24]   = value;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led->driver][led->v - 0x24]  = value;
+        g_pwm_buffer_update_required[led->driver] = true;
     }
 }
 
@@ -212,19 +212,19 @@ void is31fl3731_set_value_all(uint8_t value) {
 }
 
 void is31fl3731_set_led_control_register(uint8_t index, bool value) {
-    is31_led led;
-    memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
+    is31_led        led_buffer;
+    const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[index]);
 
-    uint8_t control_register = (led.v - 0x24) / 8;
-    uint8_t bit_value        = (led.v - 0x24) % 8;
+    uint8_t control_register = (led->v - 0x24) / 8;
+    uint8_t bit_value        = (led->v - 0x24) % 8;
 
     if (value) {
-        g_led_control_registers[led.driver][control_register] |= (1 << bit_value);
+        g_led_control_registers[led->driver][control_register] |= (1 << bit_value);
     } else {
-        g_led_control_registers[led.driver][control_register] &= ~(1 << bit_value);
+        g_led_control_registers[led->driver][control_register] &= ~(1 << bit_value);
     }
 
-    g_led_control_registers_update_required[led.driver] = true;
+    g_led_control_registers_update_required[led->driver] = true;
 }
 
 void is31fl3731_update_pwm_buffers(uint8_t addr, uint8_t index) {
@@ -179,18 +179,18 @@ void is31fl3731_init(uint8_t addr) {
 }
 
 void is31fl3731_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    is31_led led;
+    is31_led led_buffer;
     if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
-        memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
+        const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[index]);
 
         // Subtract 0x24 to get the second index of g_pwm_buffer
-        if (g_pwm_buffer[led.driver][led.r - 0x24] == red && g_pwm_buffer[led.driver][led.g - 0x24] == green && g_pwm_buffer[led.driver][led.b - 0x24] == blue) {
+        if (g_pwm_buffer[led->driver][led->r - 0x24] == red && g_pwm_buffer[led->driver][led->g - 0x24] == green && g_pwm_buffer[led->driver][led->b - 0x24] == blue) {
             return;
         }
-        g_pwm_buffer[led.driver][led.r - 0x24]   = red;
-        g_pwm_buffer[led.driver][led.g - 0x24]   = green;
-        g_pwm_buffer[led.driver][led.b - 0x24]   = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led->driver][led->r - 0x24]  = red;
+        g_pwm_buffer[led->driver][led->g - 0x24]  = green;
+        g_pwm_buffer[led->driver][led->b - 0x24]  = blue;
+        g_pwm_buffer_update_required[led->driver] = true;
     }
 }
 
@@ -201,33 +201,33 @@ void is31fl3731_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void is31fl3731_set_led_control_register(uint8_t index, bool red, bool green, bool blue) {
-    is31_led led;
-    memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
+    is31_led        led_buffer;
+    const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[index]);
 
-    uint8_t control_register_r = (led.r - 0x24) / 8;
-    uint8_t control_register_g = (led.g - 0x24) / 8;
-    uint8_t control_register_b = (led.b - 0x24) / 8;
-    uint8_t bit_r              = (led.r - 0x24) % 8;
-    uint8_t bit_g              = (led.g - 0x24) % 8;
-    uint8_t bit_b              = (led.b - 0x24) % 8;
+    uint8_t control_register_r = (led->r - 0x24) / 8;
+    uint8_t control_register_g = (led->g - 0x24) / 8;
+    uint8_t control_register_b = (led->b - 0x24) / 8;
+    uint8_t bit_r              = (led->r - 0x24) % 8;
+    uint8_t bit_g              = (led->g - 0x24) % 8;
+    uint8_t bit_b              = (led->b - 0x24) % 8;
 
     if (red) {
-        g_led_control_registers[led.driver][control_register_r] |= (1 << bit_r);
+        g_led_control_registers[led->driver][control_register_r] |= (1 << bit_r);
     } else {
-        g_led_control_registers[led.driver][control_register_r] &= ~(1 << bit_r);
+        g_led_control_registers[led->driver][control_register_r] &= ~(1 << bit_r);
     }
     if (green) {
-        g_led_control_registers[led.driver][control_register_g] |= (1 << bit_g);
+        g_led_control_registers[led->driver][control_register_g] |= (1 << bit_g);
     } else {
-        g_led_control_registers[led.driver][control_register_g] &= ~(1 << bit_g);
+        g_led_control_registers[led->driver][control_register_g] &= ~(1 << bit_g);
     }
     if (blue) {
-        g_led_control_registers[led.driver][control_register_b] |= (1 << bit_b);
+        g_led_control_registers[led->driver][control_register_b] |= (1 << bit_b);
     } else {
-        g_led_control_registers[led.driver][control_register_b] &= ~(1 << bit_b);
+        g_led_control_registers[led->driver][control_register_b] &= ~(1 << bit_b);
     }
 
-    g_led_control_registers_update_required[led.driver] = true;
+    g_led_control_registers_update_required[led->driver] = true;
 }
 
 void is31fl3731_update_pwm_buffers(uint8_t addr, uint8_t index) {
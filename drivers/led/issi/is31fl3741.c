@@ -176,17 +176,17 @@ void is31fl3741_init(uint8_t addr) {
 }
 
 void is31fl3741_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    is31_led led;
+    is31_led led_buffer;
     if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
-        memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
+        const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[index]);
 
-        if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
+        if (g_pwm_buffer[led->driver][led->r] == red && g_pwm_buffer[led->driver][led->g] == green && g_pwm_buffer[led->driver][led->b] == blue) {
             return;
         }
-        g_pwm_buffer_update_required[led.driver] = true;
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
+        g_pwm_buffer_update_required[led->driver] = true;
+        g_pwm_buffer[led->driver][led->r]         = red;
+        g_pwm_buffer[led->driver][led->g]         = green;
+        g_pwm_buffer[led->driver][led->b]         = blue;
     }
 }
 
@@ -197,28 +197,28 @@ void is31fl3741_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void is31fl3741_set_led_control_register(uint8_t index, bool red, bool green, bool blue) {
-    is31_led led;
-    memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
+    is31_led        led_buffer;
+    const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[index]);
 
     if (red) {
-        g_scaling_registers[led.driver][led.r] = 0xFF;
+        g_scaling_registers[led->driver][led->r] = 0xFF;
     } else {
-        g_scaling_registers[led.driver][led.r] = 0x00;
+        g_scaling_registers[led->driver][led->r] = 0x00;
     }
 
     if (green) {
-        g_scaling_registers[led.driver][led.g] = 0xFF;
+        g_scaling_registers[led->driver][led->g] = 0xFF;
     } else {
-        g_scaling_registers[led.driver][led.g] = 0x00;
+        g_scaling_registers[led->driver][led->g] = 0x00;
     }
 
     if (blue) {
-        g_scaling_registers[led.driver][led.b] = 0xFF;
+        g_scaling_registers[led->driver][led->b] = 0xFF;
     } else {
-        g_scaling_registers[led.driver][led.b] = 0x00;
+        g_scaling_registers[led->driver][led->b] = 0x00;
     }
 
-    g_scaling_registers_update_required[led.driver] = true;
+    g_scaling_registers_update_required[led->driver] = true;
 }
 
 void is31fl3741_update_pwm_buffers(uint8_t addr, uint8_t index) {
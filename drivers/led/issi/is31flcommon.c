@@ -133,31 +133,31 @@ void IS31FL_common_update_pwm_register(uint8_t addr, uint8_t index) {
 
 #ifdef ISSI_MANUAL_SCALING
 void IS31FL_set_manual_scaling_buffer(void) {
-    is31_led led;
+    is31_led led_buffer;
     is31_led scale;
     for (int i = 0; i < ISSI_MANUAL_SCALING; i++) {
         memcpy_P(&scale, (&g_is31_scaling[i]), sizeof(scale));
 
 #    ifdef RGB_MATRIX_ENABLE
         if (scale.driver >= 0 && scale.driver < RGB_MATRIX_LED_COUNT) {
-            memcpy_P(&led, (&g_is31_leds[scale.driver]), sizeof(led));
+            const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[scale.driver]);
 
-            if (g_scaling_buffer[led.driver][led.r] = scale.r && g_scaling_buffer[led.driver][led.g] = scale.g && g_scaling_buffer[led.driver][led.b] = scale.b) {
+            if (g_scaling_buffer[led->driver][led->r] = scale.r && g_scaling_buffer[led->driver][led->g] = scale.g && g_scaling_buffer[led->driver][led->b] = scale.b) {
                 return;
             }
-            g_scaling_buffer[led.driver][led.r] = scale.r;
-            g_scaling_buffer[led.driver][led.g] = scale.g;
-            g_scaling_buffer[led.driver][led.b] = scale.b;
+            g_scaling_buffer[led->driver][led->r] = scale.r;
+            g_scaling_buffer[led->driver][led->g] = scale.g;
+            g_scaling_buffer[led->driver][led->b] = scale.b;
 #    elif defined(LED_MATRIX_ENABLE)
         if (scale.driver >= 0 && scale.driver < LED_MATRIX_LED_COUNT) {
-            memcpy_P(&led, (&g_is31_leds[scale.driver]), sizeof(led));
+            const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[scale.driver]);
 
-            if (g_scaling_buffer[led.driver][led.v] == scale.v) {
+            if (g_scaling_buffer[led->driver][led->v] == scale.v) {
                 return;
             }
-            g_scaling_buffer[led.driver][led.v] = scale.v;
+            g_scaling_buffer[led->driver][led->v] = scale.v;
 #    endif
-            g_scaling_buffer_update_required[led.driver] = true;
+            g_scaling_buffer_update_required[led->driver] = true;
         }
     }
 }
@@ -178,13 +178,13 @@ void IS31FL_common_update_scaling_register(uint8_t addr, uint8_t index) {
 // Colour is set by adjusting PWM register
 void IS31FL_RGB_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
-        is31_led led;
-        memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
+        is31_led        led_buffer;
+        const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[index]);
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led->driver][led->r]         = red;
+        g_pwm_buffer[led->driver][led->g]         = green;
+        g_pwm_buffer[led->driver][led->b]         = blue;
+        g_pwm_buffer_update_required[led->driver] = true;
     }
 }
 
@@ -196,46 +196,46 @@ void IS31FL_RGB_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 
 // Setup Scaling register that decides the peak current of each LED
 void IS31FL_RGB_set_scaling_buffer(uint8_t index, bool red, bool green, bool blue) {
-    is31_led led;
-    memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
+    is31_led        led_buffer;
+    const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[index]);
     if (red) {
-        g_scaling_buffer[led.driver][led.r] = ISSI_SCAL_RED;
+        g_scaling_buffer[led->driver][led->r] = ISSI_SCAL_RED;
     } else {
-        g_scaling_buffer[led.driver][led.r] = ISSI_SCAL_RED_OFF;
+        g_scaling_buffer[led->driver][led->r] = ISSI_SCAL_RED_OFF;
     }
     if (green) {
-        g_scaling_buffer[led.driver][led.g] = ISSI_SCAL_GREEN;
+        g_scaling_buffer[led->driver][led->g] = ISSI_SCAL_GREEN;
     } else {
-        g_scaling_buffer[led.driver][led.g] = ISSI_SCAL_GREEN_OFF;
+        g_scaling_buffer[led->driver][led->g] = ISSI_SCAL_GREEN_OFF;
     }
     if (blue) {
-        g_scaling_buffer[led.driver][led.b] = ISSI_SCAL_BLUE;
+        g_scaling_buffer[led->driver][led->b] = ISSI_SCAL_BLUE;
     } else {
-        g_scaling_buffer[led.driver][led.b] = ISSI_SCAL_BLUE_OFF;
+        g_scaling_buffer[led->driver][led->b] = ISSI_SCAL_BLUE_OFF;
     }
-    g_scaling_buffer_update_required[led.driver] = true;
+    g_scaling_buffer_update_required[led->driver] = true;
 }
 
 #elif defined(LED_MATRIX_ENABLE)
 // LED Matrix Specific scripts
 void IS31FL_simple_set_scaling_buffer(uint8_t index, bool value) {
-    is31_led led;
-    memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
+    is31_led        led_buffer;
+    const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[index]);
     if (value) {
-        g_scaling_buffer[led.driver][led.v] = ISSI_SCAL_LED;
+        g_scaling_buffer[led->driver][led->v] = ISSI_SCAL_LED;
     } else {
-        g_scaling_buffer[led.driver][led.v] = ISSI_SCAL_LED_OFF;
+        g_scaling_buffer[led->driver][led->v] = ISSI_SCAL_LED_OFF;
     }
-    g_scaling_buffer_update_required[led.driver] = true;
+    g_scaling_buffer_update_required[led->driver] = true;
 }
 
 void IS31FL_simple_set_brightness(int index, uint8_t value) {
     if (index >= 0 && index < LED_MATRIX_LED_COUNT) {
-        is31_led led;
-        memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
+        is31_led        led_buffer;
+        const is31_led *led = pgm_read_struct(&led_buffer, &g_is31_leds[index]);
 
-        g_pwm_buffer[led.driver][led.v] = value;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led->driver][led->v] = value;
+        g_pwm_buffer_update_required[led->driver] = true;
     }
 }
 
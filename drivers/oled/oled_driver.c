@@ -165,6 +165,22 @@ uint32_t oled_scroll_timeout;
 #if OLED_UPDATE_INTERVAL > 0
 uint16_t oled_update_timeout;
 #endif
+#if defined(OLED_BLOCK_HASHING)
+// Hash of each block's contents as last sent to the display, used to skip blocks that were dirtied but are unchanged
+static uint32_t        oled_block_hash[OLED_BLOCK_COUNT];
+static OLED_BLOCK_TYPE oled_block_hash_valid = 0;
+#endif
+#if defined(OLED_ROTATION_CACHE)
+// Copy of the display buffer already rotated by 90 degrees, in the order each block is sent to the display
+static uint8_t oled_rotated_buffer[OLED_MATRIX_SIZE];
+// Offset within a rotated block of each 8 byte column of source data, derived from OLED_SOURCE_MAP/OLED_TARGET_MAP
+static uint8_t oled_rotated_offset[OLED_BLOCK_SIZE / 8];
+// Dirty blocks which only the driver has written to since they were last sent, so their rotated copy is up to date
+static OLED_BLOCK_TYPE oled_rotated_tracked = 0;
+// Cleared once oled_read_raw() has handed out a pointer into the display buffer, which may have been written through
+static bool oled_rotated_trusted = true;
+static void oled_rotated_rebuild(void);
+#endif
 
 #if defined(OLED_TRANSPORT_SPI)
 #    ifndef OLED_DC_PIN
@@ -204,6 +220,8 @@ __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
     i2c_status_t status = i2c_transmit((OLED_DISPLAY_ADDRESS << 1), data, size, OLED_I2C_TIMEOUT);
 
     return (status == I2C_STATUS_SUCCESS);
+#else
+    return false;
 #endif
 }
 
@@ -255,6 +273,8 @@ __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
 #elif defined(OLED_TRANSPORT_I2C)
     i2c_status_t status = i2c_writeReg((OLED_DISPLAY_ADDRESS << 1), I2C_DATA, data, size, OLED_I2C_TIMEOUT);
     return (status == I2C_STATUS_SUCCESS);
+#else
+    return false;
 #endif
 }
 
@@ -368,6 +388,12 @@ bool oled_init(oled_rotation_t rotation) {
 #endif
 
     oled_clear();
+#if defined(OLED_ROTATION_CACHE)
+    oled_rotated_rebuild();
+#endif
+#if defined(OLED_BLOCK_HASHING)
+    oled_block_hash_valid = 0;
+#endif
     oled_initialized = true;
     oled_active      = true;
     oled_scrolling   = false;
@@ -383,6 +409,11 @@ __attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
 
 void oled_clear(void) {
     memset(oled_buffer, 0, sizeof(oled_buffer));
+#if defined(OLED_ROTATION_CACHE)
+    memset(oled_rotated_buffer, 0, sizeof(oled_rotated_buffer));
+    oled_rotated_tracked = OLED_ALL_BLOCKS_MASK;
+    oled_rotated_trusted = true;
+#endif
     oled_cursor = &oled_buffer[0];
     oled_dirty  = OLED_ALL_BLOCKS_MASK;
 }
@@ -451,6 +482,81 @@ static void rotate_90(const uint8_t *src, uint8_t *dest) {
     }
 }
 
+#if defined(OLED_ROTATION_CACHE)
+// Regenerates one block of the rotated buffer from the display buffer
+static void oled_rotated_rebuild_block(uint8_t block) {
+    const static uint8_t source_map[] = OLED_SOURCE_MAP;
+    const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+    uint16_t start = OLED_BLOCK_SIZE * block;
+    memset(&oled_rotated_buffer[start], 0, OLED_BLOCK_SIZE);
+    for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+        rotate_90(&oled_buffer[start + source_map[i]], &oled_rotated_buffer[start + target_map[i]]);
+    }
+}
+
+// Regenerates the whole rotated buffer from the display buffer
+static void oled_rotated_rebuild(void) {
+    const static uint8_t source_map[] = OLED_SOURCE_MAP;
+    const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+    for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+        oled_rotated_offset[source_map[i] / 8] = target_map[i];
+    }
+    for (uint8_t block = 0; block < OLED_BLOCK_COUNT; ++block) {
+        oled_rotated_rebuild_block(block);
+    }
+    oled_rotated_tracked = OLED_ALL_BLOCKS_MASK;
+    oled_rotated_trusted = true;
+}
+
+// Updates the single bit of each of the 8 rotated bytes that a byte of the display buffer maps to
+static void oled_rotated_update(uint16_t index) {
+    uint8_t  offset = index % OLED_BLOCK_SIZE;
+    uint8_t *dest   = &oled_rotated_buffer[index - offset + oled_rotated_offset[offset / 8]];
+    uint8_t  mask   = 0x80 >> (offset % 8);
+    uint8_t  data   = oled_buffer[index];
+    for (uint8_t i = 0; i < 8; ++i, data >>= 1) {
+        if (data & 1) {
+            dest[i] |= mask;
+        } else {
+            dest[i] &= ~mask;
+        }
+    }
+}
+#endif
+
+#if defined(OLED_BLOCK_HASHING)
+// FNV-1a hash of a block of the display buffer
+static uint32_t oled_block_hash_compute(uint8_t block) {
+    const uint8_t *data = &oled_buffer[OLED_BLOCK_SIZE * block];
+    uint32_t       hash = 2166136261UL;
+    for (uint16_t i = 0; i < OLED_BLOCK_SIZE; ++i) {
+        hash = (hash ^ data[i]) * 16777619UL;
+    }
+    return hash;
+}
+#endif
+
+// Writes a byte to the display buffer, marking its block as dirty if it changed
+static void oled_buffer_set(uint16_t index, uint8_t data) {
+    if (oled_buffer[index] == data) {
+        return;
+    }
+    oled_buffer[index] = data;
+    OLED_BLOCK_TYPE dirty_bit = (OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE);
+#if defined(OLED_ROTATION_CACHE)
+    if (HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        oled_rotated_update(index);
+    }
+    // A block someone else already marked dirty may hold writes the rotated copy doesn't know about
+    if (!(oled_dirty & dirty_bit)) {
+        oled_rotated_tracked |= dirty_bit;
+    }
+#endif
+    oled_dirty |= dirty_bit;
+}
+
 void oled_render(void) {
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
@@ -461,20 +567,51 @@ void oled_render(void) {
     // Turn on display if it is off
     oled_on();
 
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+#else
+    static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#endif
+#if OLED_UPDATE_BUDGET_US > 0
+    const uint32_t block_cost_ns = (uint32_t)(ARRAY_SIZE(display_start) + OLED_BLOCK_SIZE) * (OLED_TRANSFER_NS_PER_BYTE);
+    uint32_t       spent_ns      = 0;
+#endif
+
     uint8_t update_start  = 0;
     uint8_t num_processed = 0;
-    while (oled_dirty && num_processed++ < OLED_UPDATE_PROCESS_LIMIT) { // render all dirty blocks (up to the configured limit)
+    while (oled_dirty) { // render all dirty blocks (up to the configured limit)
         // Find next dirty block
         while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
             ++update_start;
         }
 
-        // Set column & page position
-#if OLED_IC_HAS_HORIZONTAL_MODE
-        static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+#if defined(OLED_BLOCK_HASHING)
+        // Blocks that were overwritten with the same contents don't need sending, nor do they count towards the limit
+        uint32_t hash = oled_block_hash_compute(update_start);
+        if ((oled_block_hash_valid & ((OLED_BLOCK_TYPE)1 << update_start)) && oled_block_hash[update_start] == hash) {
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#    if defined(OLED_ROTATION_CACHE)
+            oled_rotated_tracked &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#    endif
+            continue;
+        }
+        oled_block_hash_valid &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#endif
+
+#if OLED_UPDATE_BUDGET_US > 0
+        // Stop once the next block would exceed the time budget, but always make progress
+        if (num_processed > 0 && spent_ns + block_cost_ns > (uint32_t)OLED_UPDATE_BUDGET_US * 1000) {
+            break;
+        }
+        spent_ns += block_cost_ns;
 #else
-        static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+        if (num_processed >= OLED_UPDATE_PROCESS_LIMIT) {
+            break;
+        }
 #endif
+        ++num_processed;
+
+        // Set column & page position
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
             calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
         } else {
@@ -494,6 +631,13 @@ void oled_render(void) {
                 return;
             }
         } else {
+#if defined(OLED_ROTATION_CACHE)
+            // Blocks are rotated as the display buffer is written, unless it may have been modified directly
+            if (!oled_rotated_trusted || !(oled_rotated_tracked & ((OLED_BLOCK_TYPE)1 << update_start))) {
+                oled_rotated_rebuild_block(update_start);
+            }
+            const uint8_t *temp_buffer = &oled_rotated_buffer[OLED_BLOCK_SIZE * update_start];
+#else
             // Rotate the render chunks
             const static uint8_t source_map[] = OLED_SOURCE_MAP;
             const static uint8_t target_map[] = OLED_TARGET_MAP;
@@ -503,6 +647,7 @@ void oled_render(void) {
             for (uint8_t i = 0; i < sizeof(source_map); ++i) {
                 rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
             }
+#endif
 
 #if OLED_IC_HAS_HORIZONTAL_MODE
             // Send render data chunk after rotating
@@ -532,8 +677,16 @@ void oled_render(void) {
 #endif
         }
 
+#if defined(OLED_BLOCK_HASHING)
+        oled_block_hash[update_start] = hash;
+        oled_block_hash_valid |= ((OLED_BLOCK_TYPE)1 << update_start);
+#endif
+
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#if defined(OLED_ROTATION_CACHE)
+        oled_rotated_tracked &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#endif
     }
 }
 
@@ -602,32 +755,29 @@ void oled_write_char(const char data, bool invert) {
         return;
     }
 
-    // copy the current render buffer to check for dirty after
+    // render the glyph separately, so only bytes that change are written and dirtied
     static uint8_t oled_temp_buffer[OLED_FONT_WIDTH];
-    memcpy(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH);
 
     _Static_assert(sizeof(font) >= ((OLED_FONT_END + 1 - OLED_FONT_START) * OLED_FONT_WIDTH), "OLED_FONT_END references outside array");
 
     // set the reder buffer data
     uint8_t cast_data = (uint8_t)data; // font based on unsigned type for index
     if (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) {
-        memset(oled_cursor, 0x00, OLED_FONT_WIDTH);
+        memset(oled_temp_buffer, 0x00, OLED_FONT_WIDTH);
     } else {
         const uint8_t *glyph = &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH];
-        memcpy_P(oled_cursor, glyph, OLED_FONT_WIDTH);
+        memcpy_P(oled_temp_buffer, glyph, OLED_FONT_WIDTH);
     }
 
     // Invert if needed
     if (invert) {
-        InvertCharacter(oled_cursor);
+        InvertCharacter(oled_temp_buffer);
     }
 
-    // Dirty check
-    if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
-        uint16_t index = oled_cursor - &oled_buffer[0];
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
-        // Edgecase check if the written data spans the 2 chunks
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((index + OLED_FONT_WIDTH - 1) / OLED_BLOCK_SIZE));
+    // Copy into the display buffer, which handles the case where the written data spans 2 chunks
+    uint16_t index = oled_cursor - &oled_buffer[0];
+    for (uint8_t i = 0; i < OLED_FONT_WIDTH && index + i < OLED_MATRIX_SIZE; ++i) {
+        oled_buffer_set(index + i, oled_temp_buffer[i]);
     }
 
     // Finally move to the next char
@@ -662,11 +812,20 @@ void oled_pan(bool left) {
             }
         }
     }
+#if defined(OLED_ROTATION_CACHE)
+    if (HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        oled_rotated_rebuild();
+    }
+#endif
     oled_dirty = OLED_ALL_BLOCKS_MASK;
 }
 
 oled_buffer_reader_t oled_read_raw(uint16_t start_index) {
     if (start_index > OLED_MATRIX_SIZE) start_index = OLED_MATRIX_SIZE;
+#if defined(OLED_ROTATION_CACHE)
+    // The caller may write through the returned pointer, so blocks are rotated as they are sent until the next clear
+    oled_rotated_trusted = false;
+#endif
     oled_buffer_reader_t ret_reader;
     ret_reader.current_element         = &oled_buffer[start_index];
     ret_reader.remaining_element_count = OLED_MATRIX_SIZE - start_index;
@@ -674,20 +833,15 @@ oled_buffer_reader_t oled_read_raw(uint16_t start_index) {
 }
 
 void oled_write_raw_byte(const char data, uint16_t index) {
-    if (index > OLED_MATRIX_SIZE) index = OLED_MATRIX_SIZE;
-    if (oled_buffer[index] == data) return;
-    oled_buffer[index] = data;
-    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+    if (index >= OLED_MATRIX_SIZE) return;
+    oled_buffer_set(index, data);
 }
 
 void oled_write_raw(const char *data, uint16_t size) {
     uint16_t cursor_start_index = oled_cursor - &oled_buffer[0];
     if ((size + cursor_start_index) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - cursor_start_index;
     for (uint16_t i = cursor_start_index; i < cursor_start_index + size; i++) {
-        uint8_t c = *data++;
-        if (oled_buffer[i] == c) continue;
-        oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        oled_buffer_set(i, *data++);
     }
 }
 
@@ -705,10 +859,7 @@ void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
     } else {
         data &= ~(1 << (y % 8));
     }
-    if (oled_buffer[index] != data) {
-        oled_buffer[index] = data;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
-    }
+    oled_buffer_set(index, data);
 }
 
 #if defined(__AVR__)
@@ -729,10 +880,7 @@ void oled_write_raw_P(const char *data, uint16_t size) {
     uint16_t cursor_start_index = oled_cursor - &oled_buffer[0];
     if ((size + cursor_start_index) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - cursor_start_index;
     for (uint16_t i = cursor_start_index; i < cursor_start_index + size; i++) {
-        uint8_t c = pgm_read_byte(data++);
-        if (oled_buffer[i] == c) continue;
-        oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        oled_buffer_set(i, pgm_read_byte(data++));
     }
 }
 #endif // defined(__AVR__)
@@ -883,6 +1031,10 @@ bool oled_scroll_off(void) {
         }
         oled_scrolling = false;
         oled_dirty     = OLED_ALL_BLOCKS_MASK;
+#if defined(OLED_BLOCK_HASHING)
+        // Scrolling moves the contents of the display's memory
+        oled_block_hash_valid = 0;
+#endif
     }
     return !oled_scrolling;
 }
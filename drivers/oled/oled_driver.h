@@ -321,6 +321,20 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_UPDATE_PROCESS_LIMIT 1
 #endif
 
+// Time budget per render pass in microseconds, replacing OLED_UPDATE_PROCESS_LIMIT when non-zero
+#if !defined(OLED_UPDATE_BUDGET_US)
+#    define OLED_UPDATE_BUDGET_US 0
+#endif
+
+// Estimated time to transmit one byte to the display, used to apply OLED_UPDATE_BUDGET_US
+#if !defined(OLED_TRANSFER_NS_PER_BYTE)
+#    if defined(OLED_TRANSPORT_SPI)
+#        define OLED_TRANSFER_NS_PER_BYTE 1000
+#    else
+#        define OLED_TRANSFER_NS_PER_BYTE 22500 // 9 clocks per byte at 400kHz
+#    endif
+#endif
+
 typedef struct __attribute__((__packed__)) {
     uint8_t *current_element;
     uint16_t remaining_element_count;
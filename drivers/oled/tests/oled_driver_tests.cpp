@@ -0,0 +1,238 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <random>
+
+extern "C" {
+#include "oled_driver.h"
+
+extern uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+extern OLED_BLOCK_TYPE oled_dirty;
+}
+
+namespace {
+
+// Emulated SSD1306 display memory, in horizontal addressing mode
+uint8_t  gram[OLED_DISPLAY_HEIGHT / 8][OLED_DISPLAY_WIDTH];
+uint8_t  col_start, col_end, page_start, page_end, col, page;
+uint32_t data_bytes;
+uint32_t cmd_bytes;
+
+} // namespace
+
+extern "C" {
+bool oled_send_cmd(const uint8_t *data, uint16_t size) {
+    cmd_bytes += size;
+    // Only the addressing commands sent while rendering affect where data ends up
+    if (size == 7 && data[1] == 0x21 && data[4] == 0x22) {
+        col = col_start = data[2];
+        col_end         = data[3];
+        page = page_start = data[5];
+        page_end          = data[6];
+    }
+    return true;
+}
+
+bool oled_send_data(const uint8_t *data, uint16_t size) {
+    data_bytes += size;
+    for (uint16_t i = 0; i < size; ++i) {
+        gram[page][col] = data[i];
+        if (col++ == col_end) {
+            col = col_start;
+            page = page == page_end ? page_start : page + 1;
+        }
+    }
+    return true;
+}
+
+void oled_driver_init(void) {}
+}
+
+namespace {
+
+// Renders until there's nothing left to send, returning the number of passes needed
+int render_all() {
+    int passes = 0;
+    while (oled_dirty) {
+        oled_render();
+        ++passes;
+    }
+    return passes;
+}
+
+bool physical_pixel(uint8_t x, uint8_t y) {
+    return gram[y / 8][x] & (1 << (y % 8));
+}
+
+// Checks every pixel of a display rotated by 90 degrees: logical (x, y) is physical (y, HEIGHT - 1 - x)
+::testing::AssertionResult rotated_display_matches() {
+    for (uint8_t x = 0; x < OLED_DISPLAY_HEIGHT; ++x) {
+        for (uint8_t y = 0; y < OLED_DISPLAY_WIDTH; ++y) {
+            bool logical = oled_buffer[x + (y / 8) * OLED_DISPLAY_HEIGHT] & (1 << (y % 8));
+            if (physical_pixel(y, OLED_DISPLAY_HEIGHT - 1 - x) != logical) {
+                return ::testing::AssertionFailure() << "mismatch at " << (int)x << "," << (int)y;
+            }
+        }
+    }
+    return ::testing::AssertionSuccess();
+}
+
+// A typical status screen, redrawn from scratch every time
+void status_screen(const char *layer, int wpm, bool caps) {
+    char line[32];
+    oled_clear();
+    oled_write_ln("Layer:", false);
+    oled_write_ln(layer, true);
+    snprintf(line, sizeof(line), "WPM: %03d", wpm);
+    oled_write_ln(line, false);
+    oled_write_ln(caps ? "CAPS" : "    ", caps);
+}
+
+} // namespace
+
+class OledDriver : public ::testing::Test {
+   protected:
+    void init(oled_rotation_t rotation) {
+        memset(gram, 0xAA, sizeof(gram));
+        ASSERT_TRUE(oled_init(rotation));
+        render_all();
+        data_bytes = cmd_bytes = 0;
+    }
+};
+
+TEST_F(OledDriver, RenderedDisplayMatchesBuffer) {
+    init(OLED_ROTATION_0);
+    std::mt19937 rng(1234);
+    for (int n = 0; n < 20; ++n) {
+        for (int i = 0; i < 50; ++i) {
+            oled_write_raw_byte(rng(), rng() % OLED_MATRIX_SIZE);
+        }
+        oled_set_cursor(rng() % oled_max_chars(), rng() % oled_max_lines());
+        oled_write("QMK", n & 1);
+        render_all();
+        EXPECT_EQ(memcmp(gram, oled_buffer, OLED_MATRIX_SIZE), 0);
+    }
+}
+
+TEST_F(OledDriver, RotatedDisplayMatchesPixels) {
+    init(OLED_ROTATION_90);
+    std::mt19937 rng(5678);
+    for (int n = 0; n < 20; ++n) {
+        for (int i = 0; i < 100; ++i) {
+            oled_write_pixel(rng() % OLED_DISPLAY_HEIGHT, rng() % OLED_DISPLAY_WIDTH, rng() & 1);
+        }
+        oled_set_cursor(rng() % oled_max_chars(), rng() % oled_max_lines());
+        oled_write("QMK", n & 1);
+        if (n == 10) {
+            oled_pan(n & 2);
+        }
+        render_all();
+        ASSERT_TRUE(rotated_display_matches()) << "frame " << n;
+    }
+}
+
+TEST_F(OledDriver, RotatedDisplayShowsDirectBufferWrites) {
+    init(OLED_ROTATION_90);
+    oled_write("QMK", false);
+    render_all();
+
+    // Writes made directly to the buffer, marking their blocks dirty, as some user code does
+    for (uint16_t i = 0; i < OLED_BLOCK_SIZE; ++i) {
+        oled_buffer[OLED_BLOCK_SIZE + i] = (uint8_t)(i * 37);
+    }
+    oled_dirty |= (OLED_BLOCK_TYPE)1 << 1;
+    render_all();
+    EXPECT_TRUE(rotated_display_matches());
+
+    // Writes through the pointer returned by oled_read_raw(), into a block the driver also writes to
+    oled_set_cursor(0, 0);
+    oled_write("qmk", false);
+    oled_buffer_reader_t reader = oled_read_raw(0);
+    for (uint16_t i = OLED_FONT_WIDTH * 3; i < OLED_BLOCK_SIZE; ++i) {
+        reader.current_element[i] = 0xA5;
+    }
+    render_all();
+    EXPECT_TRUE(rotated_display_matches());
+}
+
+TEST_F(OledDriver, UnchangedStatusScreenSendsNothing) {
+    init(OLED_ROTATION_0);
+    status_screen("Base", 42, false);
+    render_all();
+#if defined(OLED_BLOCK_HASHING)
+    // Blocks left blank are already blank on the display
+    uint32_t blocks = 0;
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i += OLED_BLOCK_SIZE) {
+        uint8_t blank[OLED_BLOCK_SIZE] = {0};
+        blocks += memcmp(&oled_buffer[i], blank, OLED_BLOCK_SIZE) != 0;
+    }
+    EXPECT_LT(blocks, (uint32_t)OLED_BLOCK_COUNT);
+    EXPECT_EQ(data_bytes, blocks * OLED_BLOCK_SIZE);
+#else
+    EXPECT_EQ(data_bytes, (uint32_t)OLED_MATRIX_SIZE);
+#endif
+
+    // Clearing and redrawing the same content dirties every block
+    data_bytes = 0;
+    status_screen("Base", 42, false);
+    render_all();
+#if defined(OLED_BLOCK_HASHING)
+    EXPECT_EQ(data_bytes, 0u);
+#else
+    EXPECT_EQ(data_bytes, (uint32_t)OLED_MATRIX_SIZE);
+#endif
+
+    // Only the WPM digits actually change
+    data_bytes = 0;
+    status_screen("Base", 43, false);
+    render_all();
+#if defined(OLED_BLOCK_HASHING)
+    EXPECT_EQ(data_bytes, (uint32_t)OLED_BLOCK_SIZE);
+#else
+    EXPECT_EQ(data_bytes, (uint32_t)OLED_MATRIX_SIZE);
+#endif
+    EXPECT_EQ(memcmp(gram, oled_buffer, OLED_MATRIX_SIZE), 0);
+}
+
+TEST_F(OledDriver, IncrementalWritesOnlySendChangedBlocks) {
+    init(OLED_ROTATION_0);
+    oled_set_cursor(0, 0);
+    oled_write("Layer: Base", false);
+    render_all();
+
+    data_bytes = 0;
+    oled_set_cursor(0, 0);
+    oled_write("Layer: Base", false);
+    EXPECT_EQ(oled_dirty, 0);
+
+    // Toggling a pixel and back leaves the block dirty, but with the same contents
+    oled_write_pixel(100, 20, true);
+    oled_write_pixel(100, 20, false);
+    render_all();
+#if defined(OLED_BLOCK_HASHING)
+    EXPECT_EQ(data_bytes, 0u);
+#else
+    EXPECT_EQ(data_bytes, (uint32_t)OLED_BLOCK_SIZE);
+#endif
+}
+
+TEST_F(OledDriver, BlocksPerPass) {
+    init(OLED_ROTATION_0);
+    char data[OLED_MATRIX_SIZE];
+    memset(data, 0x55, sizeof(data));
+    oled_set_cursor(0, 0);
+    oled_write_raw(data, sizeof(data));
+    oled_render();
+#if OLED_UPDATE_BUDGET_US > 0
+    // Each block costs 7 command bytes and OLED_BLOCK_SIZE data bytes at OLED_TRANSFER_NS_PER_BYTE
+    uint32_t block_ns = (7 + OLED_BLOCK_SIZE) * OLED_TRANSFER_NS_PER_BYTE;
+    uint32_t per_pass = OLED_UPDATE_BUDGET_US * 1000 / block_ns;
+#else
+    uint32_t per_pass = OLED_UPDATE_PROCESS_LIMIT;
+#endif
+    EXPECT_EQ(data_bytes, per_pass * OLED_BLOCK_SIZE);
+    EXPECT_EQ(1 + render_all(), (int)((OLED_BLOCK_COUNT + per_pass - 1) / per_pass));
+}
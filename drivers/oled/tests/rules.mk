@@ -0,0 +1,15 @@
+oled_driver_DEFS := -DNO_DEBUG -DNO_PRINT -DOLED_ENABLE -DOLED_TRANSPORT_CUSTOM
+oled_driver_INC := $(DRIVER_PATH)/oled
+
+oled_driver_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/oled/tests/oled_driver_tests.cpp \
+	$(DRIVER_PATH)/oled/oled_driver.c
+
+oled_driver_optimized_DEFS := -DNO_DEBUG -DNO_PRINT -DOLED_ENABLE -DOLED_TRANSPORT_CUSTOM -DOLED_BLOCK_HASHING -DOLED_ROTATION_CACHE -DOLED_UPDATE_BUDGET_US=2000
+oled_driver_optimized_INC := $(DRIVER_PATH)/oled
+
+oled_driver_optimized_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/oled/tests/oled_driver_tests.cpp \
+	$(DRIVER_PATH)/oled/oled_driver.c
@@ -0,0 +1,3 @@
+TEST_LIST += \
+	oled_driver \
+	oled_driver_optimized
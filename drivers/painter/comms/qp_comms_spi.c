@@ -5,6 +5,7 @@
 
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
+#    include "qp_comms.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
@@ -45,6 +46,15 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+bool qp_comms_spi_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    if (byte_count > UINT16_MAX) {
+        return false;
+    }
+    return spi_transmit_async((const uint8_t *)data, byte_count, qp_comms_async_complete) == SPI_STATUS_SUCCESS;
+}
+#    endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+
 void qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -57,6 +67,9 @@ const painter_comms_vtable_t spi_comms_vtable = {
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+    .comms_send_async = qp_comms_spi_send_data_async,
+#    endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +110,15 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     return qp_comms_spi_send_data(device, data, byte_count);
 }
 
+#        ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+bool qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t *              driver       = (painter_driver_t *)device;
+    qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    writePinHigh(comms_config->dc_pin);
+    return qp_comms_spi_send_data_async(device, data, byte_count);
+}
+#        endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
@@ -127,6 +149,9 @@ const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+#        ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+            .comms_send_async = qp_comms_spi_dc_reset_send_data_async,
+#        endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
@@ -10,6 +10,11 @@
 #    include "gpio.h"
 #    include "qp_internal.h"
 
+// Asynchronous transfers are only available where the SPI driver supports them
+#    if QUANTUM_PAINTER_ASYNC_PIXDATA && defined(PROTOCOL_CHIBIOS)
+#        define QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+#    endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
 
@@ -25,6 +30,10 @@ bool     qp_comms_spi_start(painter_device_t device);
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void* data, uint32_t byte_count);
 void     qp_comms_spi_stop(painter_device_t device);
 
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+bool qp_comms_spi_send_data_async(painter_device_t device, const void* data, uint32_t byte_count);
+#    endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+
 extern const painter_comms_vtable_t spi_comms_vtable;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,6 +51,10 @@ void     qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd
 uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void* data, uint32_t byte_count);
 void     qp_comms_spi_dc_reset_bulk_command_sequence(painter_device_t device, const uint8_t* sequence, size_t sequence_len);
 
+#        ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+bool qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void* data, uint32_t byte_count);
+#        endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+
 extern const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable;
 
 #    endif // QUANTUM_PAINTER_SPI_DC_RESET_ENABLE
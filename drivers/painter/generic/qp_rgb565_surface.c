@@ -7,6 +7,14 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Common
 
+// Dirty rectangle, inclusive coordinates
+typedef struct surface_dirty_rect_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_rect_t;
+
 // Device definition
 typedef struct rgb565_surface_painter_device_t {
     painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
@@ -24,13 +32,17 @@ typedef struct rgb565_surface_painter_device_t {
     uint16_t pixdata_x;
     uint16_t pixdata_y;
 
-    // Maintain a dirty region so we can stream only what we need
+    // Maintain a dirty region for the current viewport, committed to the dirty list on the next viewport or draw
     bool     is_dirty;
     uint16_t dirty_l;
     uint16_t dirty_t;
     uint16_t dirty_r;
     uint16_t dirty_b;
 
+    // Committed dirty regions, so we can stream only what we need
+    uint8_t              dirty_count;
+    surface_dirty_rect_t dirty_rects[RGB565_SURFACE_DIRTY_RECTS];
+
 } rgb565_surface_painter_device_t;
 
 // Driver storage
@@ -80,6 +92,67 @@ static inline void setpixel(rgb565_surface_painter_device_t *surface, uint16_t x
     }
 }
 
+static inline bool rects_touch(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    // Overlapping or directly adjacent rectangles can be merged without transferring any extra pixels in between
+    return a->l <= b->r + 1 && b->l <= a->r + 1 && a->t <= b->b + 1 && b->t <= a->b + 1;
+}
+
+static inline void rect_union(surface_dirty_rect_t *target, const surface_dirty_rect_t *other) {
+    target->l = QP_MIN(target->l, other->l);
+    target->t = QP_MIN(target->t, other->t);
+    target->r = QP_MAX(target->r, other->r);
+    target->b = QP_MAX(target->b, other->b);
+}
+
+static inline uint32_t rect_area(const surface_dirty_rect_t *rect) {
+    return (uint32_t)(rect->r - rect->l + 1) * (rect->b - rect->t + 1);
+}
+
+static void add_dirty_rect(rgb565_surface_painter_device_t *surface, surface_dirty_rect_t rect) {
+    while (true) {
+        // Absorb any existing rectangles which touch the new one
+        for (uint8_t i = 0; i < surface->dirty_count;) {
+            if (rects_touch(&rect, &surface->dirty_rects[i])) {
+                rect_union(&rect, &surface->dirty_rects[i]);
+                surface->dirty_rects[i] = surface->dirty_rects[--surface->dirty_count];
+                i                       = 0; // the enlarged rectangle may now touch earlier entries
+            } else {
+                ++i;
+            }
+        }
+
+        if (surface->dirty_count < RGB565_SURFACE_DIRTY_RECTS) {
+            break;
+        }
+
+        // List is full, so merge with whichever existing rectangle adds the fewest extra pixels
+        uint8_t  best_index = 0;
+        uint32_t best_cost  = UINT32_MAX;
+        for (uint8_t i = 0; i < surface->dirty_count; ++i) {
+            surface_dirty_rect_t merged = rect;
+            rect_union(&merged, &surface->dirty_rects[i]);
+            uint32_t cost = rect_area(&merged) - rect_area(&surface->dirty_rects[i]);
+            if (cost < best_cost) {
+                best_cost  = cost;
+                best_index = i;
+            }
+        }
+        rect_union(&rect, &surface->dirty_rects[best_index]);
+        surface->dirty_rects[best_index] = surface->dirty_rects[--surface->dirty_count];
+    }
+
+    surface->dirty_rects[surface->dirty_count++] = rect;
+}
+
+static void commit_dirty_region(rgb565_surface_painter_device_t *surface) {
+    if (surface->is_dirty) {
+        add_dirty_rect(surface, (surface_dirty_rect_t){.l = surface->dirty_l, .t = surface->dirty_t, .r = surface->dirty_r, .b = surface->dirty_b});
+        surface->dirty_l = surface->dirty_t = UINT16_MAX;
+        surface->dirty_r = surface->dirty_b = 0;
+        surface->is_dirty                   = false;
+    }
+}
+
 static inline void append_pixel(rgb565_surface_painter_device_t *surface, uint16_t rgb565) {
     setpixel(surface, surface->pixdata_x, surface->pixdata_y, rgb565);
     increment_pixdata_location(surface);
@@ -118,6 +191,7 @@ static bool qp_rgb565_surface_flush(painter_device_t device) {
     surface->dirty_l = surface->dirty_t = UINT16_MAX;
     surface->dirty_r = surface->dirty_b = 0;
     surface->is_dirty                   = false;
+    surface->dirty_count                = 0;
     return true;
 }
 
@@ -125,6 +199,9 @@ static bool qp_rgb565_surface_viewport(painter_device_t device, uint16_t left, u
     painter_driver_t *               driver  = (painter_driver_t *)device;
     rgb565_surface_painter_device_t *surface = (rgb565_surface_painter_device_t *)driver;
 
+    // Anything drawn within the previous viewport becomes its own dirty rectangle
+    commit_dirty_region(surface);
+
     // Set the viewport locations
     surface->viewport_l = left;
     surface->viewport_t = top;
@@ -224,6 +301,10 @@ painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_hei
             driver->base.offset_x              = 0;
             driver->base.offset_y              = 0;
             driver->buffer                     = (uint16_t *)buffer;
+            driver->dirty_l = driver->dirty_t = UINT16_MAX;
+            driver->dirty_r = driver->dirty_b = 0;
+            driver->is_dirty                  = false;
+            driver->dirty_count               = 0;
             return (painter_device_t)driver;
         }
     }
@@ -233,31 +314,37 @@ painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_hei
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Drawing routine to copy out the dirty region and send it to another device
 
-bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
-    painter_driver_t *               surface_driver = (painter_driver_t *)surface;
-    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
-
-    // If we're not dirty... we're done.
-    if (!surface_handle->is_dirty) {
-        return true;
-    }
-
+static bool qp_rgb565_surface_draw_rect(rgb565_surface_painter_device_t *surface_handle, painter_device_t display, uint16_t x, uint16_t y, const surface_dirty_rect_t *rect) {
     // Set the target drawing area
-    bool ok = qp_viewport(display, x + surface_handle->dirty_l, y + surface_handle->dirty_t, x + surface_handle->dirty_r, y + surface_handle->dirty_b);
+    bool ok = qp_viewport(display, x + rect->l, y + rect->t, x + rect->r, y + rect->b);
     if (!ok) {
         return false;
     }
 
     // Housekeeping of the amount of pixels to transfer
-    uint32_t  total_pixel_count = QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / sizeof(uint16_t);
+    uint32_t  total_pixel_count = QP_PIXDATA_BUFFER_SIZE / sizeof(uint16_t);
     uint32_t  pixel_counter     = 0;
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
+    uint16_t  panel_width       = surface_handle->base.panel_width;
+
+    // Full-width regions are contiguous in the buffer, so they can be copied as a single run
+    uint32_t row_count  = rect->b - rect->t + 1;
+    uint32_t row_length = rect->r - rect->l + 1;
+    if (row_length == panel_width) {
+        row_length *= row_count;
+        row_count = 1;
+    }
 
-    // Fill the global pixdata area so that we can start transferring to the panel
-    for (uint16_t y = surface_handle->dirty_t; y <= surface_handle->dirty_b; ++y) {
-        for (uint16_t x = surface_handle->dirty_l; x <= surface_handle->dirty_r; ++x) {
-            // Update the target buffer
-            target_buffer[pixel_counter++] = surface_handle->buffer[y * surface_handle->base.panel_width + x];
+    // Fill the global pixdata area a row at a time so that we can start transferring to the panel
+    for (uint32_t row = 0; row < row_count; ++row) {
+        const uint16_t *source    = &surface_handle->buffer[(rect->t + row) * panel_width + rect->l];
+        uint32_t        remaining = row_length;
+        while (remaining > 0) {
+            uint32_t count = QP_MIN(remaining, total_pixel_count - pixel_counter);
+            memcpy(&target_buffer[pixel_counter], source, count * sizeof(uint16_t));
+            pixel_counter += count;
+            source += count;
+            remaining -= count;
 
             // If we've accumulated enough data, send it
             if (pixel_counter == total_pixel_count) {
@@ -265,8 +352,10 @@ bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display,
                 if (!ok) {
                     return false;
                 }
-                // Reset the counter
+                // Reset the counter, and carry on in the other half of the buffer if it's double-buffered
                 pixel_counter = 0;
+                qp_internal_swap_pixdata_buffer();
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
             }
         }
     }
@@ -279,6 +368,28 @@ bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display,
         }
     }
 
+    return true;
+}
+
+bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
+    painter_driver_t *               surface_driver = (painter_driver_t *)surface;
+    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
+
+    // Include anything drawn since the last viewport change
+    commit_dirty_region(surface_handle);
+
+    // If we're not dirty... we're done.
+    if (surface_handle->dirty_count == 0) {
+        return true;
+    }
+
+    // Stream each dirty region with its own viewport
+    for (uint8_t i = 0; i < surface_handle->dirty_count; ++i) {
+        if (!qp_rgb565_surface_draw_rect(surface_handle, display, x, y, &surface_handle->dirty_rects[i])) {
+            return false;
+        }
+    }
+
     // Clear the dirty info for the surface
     return qp_flush(surface);
 }
@@ -13,6 +13,19 @@
 #    define RGB565_SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef RGB565_SURFACE_DIRTY_RECTS
+/**
+ * @def This controls the maximum number of separate dirty regions tracked by each surface. Each region is transferred
+ *      with its own viewport when drawing to the target device. When more regions are drawn than can be tracked, the
+ *      closest regions are merged. The default of 1 tracks a single bounding box of everything drawn.
+ */
+#    define RGB565_SURFACE_DIRTY_RECTS 1
+#endif
+
+#if RGB565_SURFACE_DIRTY_RECTS < 1 || RGB565_SURFACE_DIRTY_RECTS > 255
+#    error RGB565_SURFACE_DIRTY_RECTS must be between 1 and 255
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
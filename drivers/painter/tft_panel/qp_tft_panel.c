@@ -80,9 +80,9 @@ bool qp_tft_panel_viewport(painter_device_t device, uint16_t left, uint16_t top,
 
 // Stream pixel data to the current write position in GRAM
 bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
-    painter_driver_t *driver = (painter_driver_t *)device;
-    qp_comms_send(device, pixel_data, native_pixel_count * driver->native_bits_per_pixel / 8);
-    return true;
+    painter_driver_t *driver     = (painter_driver_t *)device;
+    uint32_t          byte_count = native_pixel_count * driver->native_bits_per_pixel / 8;
+    return qp_comms_send(device, pixel_data, byte_count) == byte_count;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
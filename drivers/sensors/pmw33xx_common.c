@@ -209,7 +209,7 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
 
     spi_stop();
 
-    pd_dprintf("PMW33XX (%d): motion: 0x%x dx: %i dy: %i\n", sensor, report.motion.w, report.delta_x, report.delta_y);
+    pd_dprintf("PMW33XX (%d): motion: 0x%x dx: %i dy: %i squal: %u\n", sensor, report.motion.w, report.delta_x, report.delta_y, report.squal);
 
     report.delta_x *= -1;
     report.delta_y *= -1;
@@ -36,9 +36,10 @@ typedef struct __attribute__((packed)) {
     uint8_t observation;
     int16_t delta_x; // displacement on x directions. Unit: Count. (CPI * Count = Inch value)
     int16_t delta_y; // displacement on y directions.
+    uint8_t squal;   // surface quality, the number of valid features visible to the sensor divided by 8
 } pmw33xx_report_t;
 
-_Static_assert(sizeof(pmw33xx_report_t) == 6, "pmw33xx_report_t must be 6 bytes in size");
+_Static_assert(sizeof(pmw33xx_report_t) == 7, "pmw33xx_report_t must be 7 bytes in size");
 _Static_assert(sizeof((pmw33xx_report_t){0}.motion) == 1, "pmw33xx_report_t.motion must be 1 byte in size");
 
 #if !defined(PMW33XX_CLOCK_SPEED)
@@ -142,8 +143,8 @@ void pmw33xx_set_cpi(uint8_t sensor, uint16_t cpi);
 void pmw33xx_set_cpi_all_sensors(uint16_t cpi);
 
 /**
- * @brief Reads and clears the current delta, and motion register values on the
- * given sensor.
+ * @brief Reads and clears the current delta, and reads the motion and surface
+ * quality register values on the given sensor, in a single burst transfer.
  *
  * @param sensor Index of the sensors chip select pin
  * @return pmw33xx_report_t Current values of the sensor, if errors occurred all
@@ -41,6 +41,25 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_erase_range(uint32_t address, size_t length) {
+    // Refuse ranges which start or end part way through a block, erasing it would clobber data outside the range
+    if (address % (EXTERNAL_FLASH_BLOCK_SIZE) != 0 || length % (EXTERNAL_FLASH_BLOCK_SIZE) != 0) {
+        return false;
+    }
+
+    bool     ret   = true;
+    uint32_t first = address / (EXTERNAL_FLASH_BLOCK_SIZE);
+    uint32_t last  = (address + length - 1) / (EXTERNAL_FLASH_BLOCK_SIZE);
+    for (uint32_t i = first; i <= last; ++i) {
+        flash_status_t status = flash_erase_block(((WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) + i) * (EXTERNAL_FLASH_BLOCK_SIZE));
+        if (status != FLASH_STATUS_SUCCESS) {
+            ret = false;
+            break;
+        }
+    }
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
@@ -24,6 +24,10 @@
 #endif
 
 // The space allocated by the block
+#ifndef BACKING_STORE_ERASE_SIZE
+#    define BACKING_STORE_ERASE_SIZE (EXTERNAL_FLASH_BLOCK_SIZE)
+#endif
+
 #ifndef WEAR_LEVELING_BACKING_SIZE
 #    define WEAR_LEVELING_BACKING_SIZE ((EXTERNAL_FLASH_BLOCK_SIZE) * (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_COUNT))
 #endif // WEAR_LEVELING_BACKING_SIZE
@@ -13,7 +13,8 @@
 # limitations under the License.
 """Python program to make autocorrect_data.h.
 This program reads from a prepared dictionary file and generates a C source file
-"autocorrect_data.h" with a serialized trie embedded as an array. Run this
+"autocorrect_data.h" with a serialized directed acyclic word graph (or, with
+--format trie, the original reversed trie) embedded as an array. Run this
 program and pass it as the first argument like:
 $ qmk generate-autocorrect-data autocorrect_dict.txt
 Each line of the dict file defines one typo and its correction with the syntax
@@ -165,6 +166,118 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
+def correction_data(typo: str, correction: str) -> List[int]:
+    """Makes the serialized correction for a typo: the number of backspaces
+  (with the high bit set) followed by the NUL-terminated replacement text.
+  """
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    return [backspaces + 128] + list(bytes(correction[i:], 'ascii')) + [0]
+
+
+def make_dawg(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
+    """Makes a directed acyclic word graph from the typos, in typing order.
+  Nodes with identical outgoing edges and corrections are merged, so typos
+  which end the same way share their tails.
+  Args:
+    autocorrections: List of (typo, correction) tuples.
+  Returns:
+    Dict of dict, representing the graph. Merged nodes are the same object.
+  """
+    trie = {}
+    for typo, correction in autocorrections:
+        node = trie
+        for letter in typo:
+            node = node.setdefault(letter, {})
+        node['LEAF'] = tuple(correction_data(typo, correction))
+
+    registry = {}
+
+    def merge(node):
+        if 'LEAF' in node:
+            signature = ('LEAF', node['LEAF'])
+        else:
+            for c in node:
+                node[c] = merge(node[c])
+            signature = tuple(sorted((c, id(child)) for c, child in node.items()))
+        return registry.setdefault(signature, node)
+
+    return merge(trie)
+
+
+def serialize_dawg(dawg: Dict[str, Any], min_link_bytes: int = 2) -> Tuple[List[int], int]:
+    """Serializes the word graph in a form readable by the C code.
+  Nodes are laid out depth first, so that a node with a single child not yet
+  laid out elsewhere can be followed directly by that child. Links are two
+  bytes wide, or three if the graph does not fit within 64KB.
+  Args:
+    dawg: Dict of dicts, as made by make_dawg().
+    min_link_bytes: Int, the narrowest link width to use.
+  Returns:
+    Tuple of the list of ints in the range 0-255, and the link width in bytes.
+  """
+    def edges(node):
+        return sorted(node.items(), key=lambda e: TYPO_CHARS[e[0]])
+
+    # Lay out the nodes, deciding which can be chained to their only child.
+    order = []
+    chained = set()
+    placed = set()
+
+    def place(node):
+        placed.add(id(node))
+        order.append(node)
+        if 'LEAF' in node:
+            return
+        children = edges(node)
+        if len(children) == 1 and id(children[0][1]) not in placed:
+            chained.add(id(node))
+        for _, child in children:
+            if id(child) not in placed:
+                place(child)
+
+    place(dawg)
+
+    def node_size(node, link_bytes):
+        if 'LEAF' in node:
+            return len(node['LEAF'])
+        if id(node) in chained:
+            return 1
+        return 1 + len(node) * (1 + link_bytes)
+
+    # Use the narrowest links which can reach every node.
+    for link_bytes in range(min_link_bytes, 4):
+        offsets = {}
+        byte_offset = 0
+        for node in order:
+            offsets[id(node)] = byte_offset
+            byte_offset += node_size(node, link_bytes)
+
+        if byte_offset < (1 << (8 * link_bytes)):
+            break
+    else:
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 16MB limit. Try reducing the autocorrection dict to fewer entries.')
+        sys.exit(1)
+
+    data = []
+    for node in order:
+        if 'LEAF' in node:  # Handle a correction node.
+            data += node['LEAF']
+        elif id(node) in chained:  # Handle a chain link, followed by its child.
+            data += [TYPO_CHARS[c] for c, _ in edges(node)]
+        else:  # Handle a branch node.
+            data += [64 | len(node)]
+            for c, child in edges(node):
+                data += [TYPO_CHARS[c]] + list(offsets[id(child)].to_bytes(link_bytes, 'little'))
+
+    return data, link_bytes
+
+
 def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
     """Serializes trie and correction data in a form readable by the C code.
   Args:
@@ -178,19 +291,7 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     # Traverse trie in depth first order.
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
+            entry = {'data': correction_data(*trie_node['LEAF']), 'links': [], 'byte_offset': 0}
             table.append(entry)
         elif len(trie_node) == 1:  # Handle trie node with a single child.
             c, trie_node = next(iter(trie_node.items()))
@@ -254,11 +355,14 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('--format', arg_only=True, default='dawg', choices=['dawg', 'trie'], help='Dictionary format: "dawg" (default) shares common typo endings and supports large dictionaries, "trie" is the original format.')
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
-    trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.format == 'dawg':
+        data, link_bytes = serialize_dawg(make_dawg(autocorrections))
+    else:
+        data, link_bytes = serialize_trie(autocorrections, make_trie(autocorrections)), None
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -281,6 +385,8 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
+    if link_bytes:
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_DAWG_LINK_BYTES {link_bytes}')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
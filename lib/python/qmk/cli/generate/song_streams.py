@@ -0,0 +1,308 @@
+"""Generate song_list_streams.h, the songs of song_list.h in the compressed song stream format.
+
+Every note of a SONG() array takes eight bytes of flash, two floats. A song stream stores the same notes as a semitone
+index and a duration in 64ths of a beat, usually in one or two bytes, and plays consecutive repetitions of a passage
+from a single copy. See quantum/audio/song_stream.h for the format, which has to match the constants below.
+"""
+import re
+import textwrap
+from typing import Dict, List, Optional, Tuple
+
+from milc import cli
+
+from qmk.commands import dump_lines
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, QMK_FIRMWARE
+from qmk.path import normpath
+
+SONG_STREAM_REST = 0x00
+SONG_STREAM_NOTES = 108
+SONG_STREAM_REPEAT = 0x7E
+SONG_STREAM_END = 0x7F
+SONG_STREAM_SAME_DURATION = 0x80
+SONG_STREAM_LONG_DURATION = 0x00
+SONG_STREAM_MAX_REPEATS = 255
+
+MUSICAL_NOTES_H = QMK_FIRMWARE / 'quantum' / 'audio' / 'musical_notes.h'
+SONG_LIST_H = QMK_FIRMWARE / 'quantum' / 'audio' / 'song_list.h'
+
+Define = Tuple[Optional[List[str]], List[str]]
+Note = Tuple[int, int]
+
+
+def _tokenize(text: str) -> List[str]:
+    return re.findall(r'##|[A-Za-z_]\w*|\d+(?:\.\d*)?f?|\.\.\.|\S', text)
+
+
+def parse_defines(file_name) -> Dict[str, Define]:
+    """Collects the #defines of a header, regardless of the conditionals around them.
+
+    Returns a dict from name to (parameters, body tokens), the parameters being None for object-like macros.
+    """
+    text = file_name.read_text(encoding='utf-8')
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.DOTALL)
+    text = re.sub(r'//[^\n]*', '', text)
+    text = text.replace('\\\n', ' ')
+
+    defines = {}
+    for match in re.finditer(r'^\s*#\s*define\s+(\w+)(\([^)]*\))?(.*)$', text, flags=re.MULTILINE):
+        name, params, body = match.groups()
+        if params is not None:
+            params = [p.strip() for p in params[1:-1].split(',') if p.strip()]
+        defines[name] = (params, _tokenize(body))
+    return defines
+
+
+def _collect_args(tokens: List[str], i: int) -> Tuple[List[List[str]], int]:
+    """Splits the arguments of a macro call, tokens[i] being the first token after the opening parenthesis.
+    """
+    args = [[]]
+    depth = 0
+    while i < len(tokens):
+        token = tokens[i]
+        i += 1
+        if token == '(':
+            depth += 1
+        elif token == ')':
+            if depth == 0:
+                return args, i
+            depth -= 1
+        elif token == ',' and depth == 0:
+            args.append([])
+            continue
+        args[-1].append(token)
+    raise ValueError('Unterminated macro call')
+
+
+def _substitute(params: List[str], body: List[str], args: List[List[str]], defines: Dict[str, Define], hidden: frozenset) -> List[str]:
+    values = {}
+    for index, param in enumerate(params):
+        if param.endswith('...'):
+            rest = []
+            for arg in args[index:]:
+                rest += ([','] if rest else []) + arg
+            values[param[:-3] or '__VA_ARGS__'] = rest
+            break
+        values[param] = args[index] if index < len(args) else []
+
+    result = []
+    for i, token in enumerate(body):
+        if token in values:
+            pasted = (i > 0 and body[i - 1] == '##') or (i + 1 < len(body) and body[i + 1] == '##')
+            result += values[token] if pasted else expand(values[token], defines, hidden)
+        else:
+            result.append(token)
+
+    # Token pasting, the only operator the song macros use
+    while '##' in result:
+        i = result.index('##')
+        result[i - 1:i + 2] = [result[i - 1] + result[i + 1]]
+    return result
+
+
+def expand(tokens: List[str], defines: Dict[str, Define], hidden: frozenset = frozenset()) -> List[str]:
+    """Expands the macros in a token list, leaving the NOTE_ names alone so that notes can be told apart.
+    """
+    result = []
+    i = 0
+    while i < len(tokens):
+        token = tokens[i]
+        if token in defines and token not in hidden and not token.startswith('NOTE_'):
+            params, body = defines[token]
+            if params is None:
+                result += expand(body, defines, hidden | {token})
+                i += 1
+                continue
+            if i + 1 < len(tokens) and tokens[i + 1] == '(':
+                args, i = _collect_args(tokens, i + 2)
+                result += expand(_substitute(params, body, args, defines, hidden), defines, hidden | {token})
+                continue
+        result.append(token)
+        i += 1
+    return result
+
+
+def note_indexes(defines: Dict[str, Define]) -> Dict[str, int]:
+    """Numbers the NOTE_ frequencies of musical_notes.h from 1 (C0) upwards, flat aliases taking the number of their sharp.
+    """
+    indexes = {'NOTE_REST': SONG_STREAM_REST}
+    for name, (params, body) in defines.items():
+        if name.startswith('NOTE_') and name != 'NOTE_REST' and len(body) == 1 and body[0][0].isdigit():
+            indexes[name] = len(indexes)
+    if len(indexes) != SONG_STREAM_NOTES + 1:
+        raise ValueError(f'Expected {SONG_STREAM_NOTES} notes in musical_notes.h, found {len(indexes) - 1}')
+
+    for name, (params, body) in defines.items():
+        if name.startswith('NOTE_') and name not in indexes and len(body) == 1 and body[0] in indexes:
+            indexes[name] = indexes[body[0]]
+    return indexes
+
+
+def parse_song(tokens: List[str], indexes: Dict[str, int]) -> Optional[List[Note]]:
+    """Reads the notes of an expanded song macro, or returns None if it is not a song.
+    """
+    text = ' '.join(tokens)
+    notes = []
+    position = 0
+    for match in re.finditer(r'\{\s*\(\s*(NOTE_\w+)\s*\)\s*,\s*([\d\s+*()-]+)\}\s*,?\s*', text):
+        if match.start() != position or match.group(1) not in indexes:
+            return None
+        notes.append((indexes[match.group(1)], eval(match.group(2))))
+        position = match.end()
+    if text[position:].strip(' ,'):
+        return None
+    return notes
+
+
+def encode_note(note: Note, duration: Optional[int]) -> List[int]:
+    """Encodes one note, leaving its duration out when it is the same as the one of the previous note.
+    """
+    pitch, length = note
+    if length == duration:
+        return [pitch | SONG_STREAM_SAME_DURATION]
+    if 0 < length <= 0xFF:
+        return [pitch, length]
+    return [pitch, SONG_STREAM_LONG_DURATION, length & 0xFF, length >> 8]
+
+
+def encode_notes(notes: List[Note], duration: Optional[int]) -> List[int]:
+    data = []
+    for note in notes:
+        data += encode_note(note, duration)
+        duration = note[1]
+    return data
+
+
+def encode_song(notes: List[Note]) -> List[int]:
+    """Encodes a song, replacing consecutive repetitions of a passage by a repeat marker where that is shorter.
+
+    The first note of a repeated passage always carries its duration, since the passage is played again after its own
+    last note. Repeated passages are not nested.
+    """
+    data = []
+    duration = None
+    i = 0
+    while i < len(notes):
+        best = None
+        for length in range(1, (len(notes) - i) // 2 + 1):
+            block = notes[i:i + length]
+            count = 1
+            while count <= SONG_STREAM_MAX_REPEATS and notes[i + count * length:i + (count + 1) * length] == block:
+                count += 1
+            if count < 2:
+                continue
+            plain = len(encode_notes(notes[i:i + count * length], duration))
+            repeated = len(encode_notes(block, None)) + 4
+            if plain - repeated > (best[0] if best else 0):
+                best = (plain - repeated, block, count)
+
+        if best is None:
+            data += encode_note(notes[i], duration)
+            duration = notes[i][1]
+            i += 1
+            continue
+
+        _, block, count = best
+        start = len(data)
+        data += encode_notes(block, None)
+        offset = len(data) - start
+        data += [SONG_STREAM_REPEAT, count - 1, offset & 0xFF, offset >> 8]
+        duration = block[-1][1]
+        i += count * len(block)
+
+    return data + [SONG_STREAM_END]
+
+
+def decode_song(data: List[int]) -> List[Note]:
+    """Decodes a song stream the way song_stream_next() does, to check the encoder.
+    """
+    notes = []
+    duration = None
+    position = 0
+    marker, repeats = None, 0
+    while data[position] != SONG_STREAM_END:
+        code = data[position]
+        if code == SONG_STREAM_REPEAT:
+            if marker != position:
+                marker, repeats = position, data[position + 1]
+            if repeats > 0:
+                repeats -= 1
+                position -= data[position + 2] | data[position + 3] << 8
+            else:
+                marker = None
+                position += 4
+            continue
+        position += 1
+        if not code & SONG_STREAM_SAME_DURATION:
+            duration = data[position]
+            position += 1
+            if duration == SONG_STREAM_LONG_DURATION:
+                duration = data[position] | data[position + 1] << 8
+                position += 2
+        notes.append((code & ~SONG_STREAM_SAME_DURATION, duration))
+    return notes
+
+
+def load_songs(files) -> Dict[str, List[Note]]:
+    """Reads the songs defined in the given headers, in order of definition.
+
+    The songs of song_list.h can be used in them, but are only returned when song_list.h itself is one of the files.
+    """
+    defines = parse_defines(MUSICAL_NOTES_H)
+    indexes = note_indexes(defines)
+    if SONG_LIST_H not in files:
+        defines.update(parse_defines(SONG_LIST_H))
+
+    song_names = []
+    for file_name in files:
+        file_defines = parse_defines(file_name)
+        song_names += [(name, file_name == SONG_LIST_H) for name, (params, _) in file_defines.items() if params is None]
+        defines.update(file_defines)
+
+    # Empty songs are only kept from song_list.h, which defines the removed songs as empty for compatibility
+    songs = {}
+    for name, keep_empty in song_names:
+        notes = parse_song(expand(defines[name][1], defines, frozenset({name})), indexes)
+        if notes is not None and (notes or keep_empty) and name not in songs:
+            songs[name] = notes
+    return songs
+
+
+def to_hex(b: int) -> str:
+    return f'0x{b:02X}'
+
+
+@cli.argument('-i', '--input', arg_only=True, type=normpath, action='append', help='Header with more songs to encode instead of song_list.h, such as a user_song_list.h. May be passed several times.')
+@cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.subcommand('Generates song_list_streams.h, the songs of song_list.h in the compressed song stream format.')
+def generate_song_streams(cli):
+    """Generates a header defining <SONG>_STREAM for every song, the bytes to initialise a song stream array with.
+    """
+    files = cli.args.input or [SONG_LIST_H]
+    songs = load_songs(files)
+
+    song_streams_h_lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '', '// clang-format off']
+
+    listed = []
+    for name, notes in songs.items():
+        data = encode_song(notes)
+        if decode_song(data) != notes:
+            cli.log.error(f'{name} does not decode to its own notes!')
+            return False
+
+        song_streams_h_lines.append('')
+        song_streams_h_lines.append(f'// {len(notes)} notes, {len(data)} bytes instead of {8 * len(notes)}')
+        song_streams_h_lines.append(f'#define {name}_STREAM \\')
+        song_streams_h_lines.append(textwrap.fill(', '.join(map(to_hex, data)), width=116, initial_indent='    ', subsequent_indent='    ').replace('\n', ' \\\n'))
+        song_streams_h_lines.append(f'#define {name}_STREAM_NOTE_COUNT {len(notes)}')
+        if notes:
+            listed.append(name)
+
+    # X macro over the songs with notes, for the tests comparing them with their SONG() arrays
+    if not cli.args.input:
+        song_streams_h_lines.append('')
+        song_streams_h_lines.append('#define SONG_STREAM_LIST(X) \\')
+        song_streams_h_lines.append(' \\\n'.join(f'    X({name})' for name in listed))
+
+    # Show the results
+    dump_lines(cli.args.output, song_streams_h_lines, cli.args.quiet)
@@ -89,6 +89,17 @@ class QFFFontDescriptor:
         else:
             self.flags &= ~0x01
 
+    @property
+    def has_sorted_unicode_table(self):
+        return (self.flags & 0x04) == 0x04
+
+    @has_sorted_unicode_table.setter
+    def has_sorted_unicode_table(self, val):
+        if val:
+            self.flags |= 0x04
+        else:
+            self.flags &= ~0x04
+
 
 ########################################################################################################################
 
@@ -364,6 +375,7 @@ class QFFFont:
         font_descriptor.has_ascii_table = include_ascii_glyphs
         font_descriptor.unicode_glyph_count = len(unicode_table.glyphs.keys())
         font_descriptor.is_transparent = False
+        font_descriptor.has_sorted_unicode_table = True  # unicode table is always written in code point order
         font_descriptor.format = format['image_format_byte']
         font_descriptor.compression = 0x01 if use_rle else 0x00
 
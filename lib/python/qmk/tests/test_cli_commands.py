@@ -264,6 +264,14 @@ def test_generate_rgb_breathe_table():
     assert 'Breathing max:    127' in result.stdout
 
 
+def test_generate_song_streams():
+    result = check_subcommand('generate-song-streams')
+    check_returncode(result)
+    assert '#define STARTUP_SOUND_STREAM' in result.stdout
+    assert '#define STARTUP_SOUND_STREAM_NOTE_COUNT 3' in result.stdout
+    assert 'X(ODE_TO_JOY)' in result.stdout
+
+
 def test_generate_config_h():
     result = check_subcommand('generate-config-h', '-kb', 'handwired/pytest/basic')
     check_returncode(result)
@@ -17,7 +17,7 @@
 
 #include "audio.h"
 #include "gpio.h"
-#include <math.h>
+#include "synth.h"
 #include "util.h"
 
 // Need to disable GCC's "tautological-compare" warning for this file, as it causes issues when running `KEEP_INTERMEDIATES=yes`. Corresponding pop at the end of the file.
@@ -31,7 +31,7 @@
 
   it is also possible to have a custom sample-LUT by implementing/overriding 'dac_value_generate'
 
-  this driver allows for multiple simultaneous tones to be played through one single channel by doing additive wave-synthesis
+  this driver allows for multiple simultaneous tones to be played through one single channel by doing additive wave-synthesis, with the integer phase accumulators of synth.c
 */
 
 #if !defined(AUDIO_PIN)
@@ -46,6 +46,10 @@
 #    define AUDIO_PIN_ALT PAL_NOLINE
 #endif
 
+_Static_assert(AUDIO_DAC_BUFFER_SIZE == SYNTH_WAVETABLE_SIZE, "The sample buffers double as the wavetables of the synthesizer");
+_Static_assert(AUDIO_MAX_SIMULTANEOUS_TONES <= SYNTH_MAX_TONES, "AUDIO_MAX_SIMULTANEOUS_TONES is larger than the synthesizer supports");
+_Static_assert(sizeof(dacsample_t) == sizeof(uint16_t), "The synthesizer renders 16-bit samples");
+
 #if !defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE) && !defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE) && !defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE) && !defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
 #    define AUDIO_DAC_SAMPLE_WAVEFORM_SINE
 #endif
@@ -86,11 +90,25 @@ static const dacsample_t dac_buffer_trapezoid[AUDIO_DAC_BUFFER_SIZE] = {0x0,   0
 
 static dacsample_t dac_buffer_empty[AUDIO_DAC_BUFFER_SIZE] = {AUDIO_DAC_OFF_VALUE};
 
-/* keep track of the sample position for for each frequency */
-static float dac_if[AUDIO_MAX_SIMULTANEOUS_TONES] = {0.0};
+#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
+#    define DAC_WAVETABLE dac_buffer_sine
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
+#    define DAC_WAVETABLE dac_buffer_triangle
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
+#    define DAC_WAVETABLE dac_buffer_trapezoid
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
+#    define DAC_WAVETABLE dac_buffer_square
+#endif
+
+/* phase accumulators for each frequency
+ *
+ * Note: the gpt timer runs with 3*AUDIO_DAC_SAMPLE_RATE, and the DAC callback
+ *       is called twice per conversion, so samples are generated at 3/2 of
+ *       AUDIO_DAC_SAMPLE_RATE (as measured with an oscilloscope)
+ */
+static synth_t dac_synth;
 
-static float   active_tones_snapshot[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
-static uint8_t active_tones_snapshot_length                        = 0;
+static uint8_t active_tones_snapshot_length = 0;
 
 typedef enum {
     OUTPUT_SHOULD_START,
@@ -119,51 +137,12 @@ __attribute__((weak)) uint16_t dac_value_generate(void) {
     }
 
     /* doing additive wave synthesis over all currently playing tones = adding up
-     * sine-wave-samples for each frequency, scaled by the number of active tones
+     * wavetable-samples for each frequency, scaled by the number of active tones
+     *
+     * Note: a user implementation does not have to rely on the synthesizer, but
+     * could directly query the active frequencies through audio_get_processed_frequency
      */
-    uint16_t value     = 0;
-    float    frequency = 0.0f;
-
-    for (uint8_t i = 0; i < active_tones_snapshot_length; i++) {
-        /* Note: a user implementation does not have to rely on the active_tones_snapshot, but
-         * could directly query the active frequencies through audio_get_processed_frequency */
-        frequency = active_tones_snapshot[i];
-
-        dac_if[i] = dac_if[i] + ((frequency * AUDIO_DAC_BUFFER_SIZE) / AUDIO_DAC_SAMPLE_RATE) * 2 / 3;
-        /*Note: the 2/3 are necessary to get the correct frequencies on the
-         *      DAC output (as measured with an oscilloscope), since the gpt
-         *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
-         *      is called twice per conversion.*/
-
-        dac_if[i] = fmodf(dac_if[i], AUDIO_DAC_BUFFER_SIZE);
-
-        // Wavetable generation/lookup
-        uint16_t dac_i = (uint16_t)dac_if[i];
-
-#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-        value += dac_buffer_trapezoid[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length;
-#endif
-        /*
-        // SINE
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length / 3;
-        // TRIANGLE
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length / 3;
-        // SQUARE
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length / 3;
-        //NOTE: combination of these three wave-forms is more exemplary - and doesn't sound particularly good :-P
-        */
-
-        // STAIRS (mostly usefully as test-pattern)
-        // value_avg = dac_buffer_staircase[dac_i] / active_tones_snapshot_length;
-    }
-
-    return value;
+    return synth_sample(&dac_synth);
 }
 
 /**
@@ -219,16 +198,17 @@ static void dac_end(DACDriver *dacp) {
         }
 
         if ((OUTPUT_SHOULD_START == state) || (OUTPUT_REACHED_ZERO_BEFORE_OFF == state) || (OUTPUT_REACHED_ZERO_BEFORE_TONE_CHANGE == state)) {
-            uint8_t active_tones         = MIN(AUDIO_MAX_SIMULTANEOUS_TONES, audio_get_number_of_active_tones());
-            active_tones_snapshot_length = 0;
+            uint8_t active_tones = MIN(AUDIO_MAX_SIMULTANEOUS_TONES, audio_get_number_of_active_tones());
             // update the snapshot - once, and only on occasion that something changed;
-            // -> saves cpu cycles (?)
+            // the phase increments are computed here, so that generating samples needs no floating point
+            synth_clear_tones(&dac_synth);
             for (uint8_t i = 0; i < active_tones; i++) {
                 float freq = audio_get_processed_frequency(i);
                 if (freq > 0) { // disregard 'rest' notes, with valid frequency 0.0f; which would only lower the resulting waveform volume during the additive synthesis step
-                    active_tones_snapshot[active_tones_snapshot_length++] = freq;
+                    synth_add_tone(&dac_synth, freq);
                 }
             }
+            active_tones_snapshot_length = dac_synth.count;
 
             if ((0 == active_tones_snapshot_length) && (OUTPUT_REACHED_ZERO_BEFORE_OFF == state)) {
                 state = OUTPUT_OFF;
@@ -333,10 +313,7 @@ void audio_driver_stop(void) {
 void audio_driver_start(void) {
     gptStartContinuous(&GPTD6, 2U);
 
-    for (uint8_t i = 0; i < AUDIO_MAX_SIMULTANEOUS_TONES; i++) {
-        dac_if[i]                = 0.0f;
-        active_tones_snapshot[i] = 0.0f;
-    }
+    synth_init(&dac_synth, DAC_WAVETABLE, AUDIO_DAC_SAMPLE_RATE * 3 / 2);
     active_tones_snapshot_length = 0;
     state                        = OUTPUT_SHOULD_START;
 }
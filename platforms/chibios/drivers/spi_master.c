@@ -26,6 +26,17 @@ static SPIConfig spiConfig = {NULL, 0, 0, 0};
 static SPIConfig spiConfig = {false, NULL, 0, 0, 0, 0};
 #endif
 
+static volatile spi_async_callback_t asyncCallback = NULL;
+
+static void spi_async_end_cb(SPIDriver *spip) {
+    // Also invoked for synchronous transfers, which have no callback registered
+    spi_async_callback_t callback = asyncCallback;
+    if (callback != NULL) {
+        asyncCallback = NULL;
+        callback();
+    }
+}
+
 __attribute__((weak)) void spi_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -252,6 +263,7 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     spiConfig.sspad  = PAL_PAD(slavePin);
 
     setPinOutput(slavePin);
+    spiConfig.end_cb = spi_async_end_cb;
     spiStart(&SPI_DRIVER, &spiConfig);
     spiSelect(&SPI_DRIVER);
 
@@ -277,6 +289,12 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_async_callback_t callback) {
+    asyncCallback = callback;
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
@@ -72,6 +72,8 @@ typedef int16_t spi_status_t;
 #define SPI_TIMEOUT_IMMEDIATE (0)
 #define SPI_TIMEOUT_INFINITE (0xFFFF)
 
+typedef void (*spi_async_callback_t)(void);
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -85,6 +87,8 @@ spi_status_t spi_read(void);
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_async_callback_t callback);
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
 void spi_stop(void);
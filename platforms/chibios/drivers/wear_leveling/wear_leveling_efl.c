@@ -117,6 +117,41 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_erase_range(uint32_t address, size_t length) {
+    // Refuse ranges which start or end part way through a sector, erasing it would clobber data outside the range
+    for (int i = 0; i < sector_count; ++i) {
+        uint32_t sector_start = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        uint32_t sector_end   = sector_start + flashGetSectorSize(flash, first_sector + i);
+        if ((sector_start < address && address < sector_end) || (sector_start < address + length && address + length < sector_end)) {
+            bs_dprintf("Erase range %08lx+%lx is not sector aligned\n", (unsigned long)address, (unsigned long)length);
+            return false;
+        }
+    }
+
+    bool          ret = true;
+    flash_error_t status;
+    for (int i = 0; i < sector_count; ++i) {
+        // Only erase sectors within the requested range
+        uint32_t sector_start = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        if (sector_start < address || sector_start >= address + length) {
+            continue;
+        }
+
+        // Kick off the sector erase
+        status = flashStartEraseSector(flash, first_sector + i);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+
+        // Wait for the erase to complete
+        status = flashWaitErase(flash);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+    }
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = (base_offset + address);
     bs_dprintf("Write ");
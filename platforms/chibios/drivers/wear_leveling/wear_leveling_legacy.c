@@ -36,6 +36,23 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_erase_range(uint32_t address, size_t length) {
+    // Refuse ranges which start or end part way through a page, erasing it would clobber data outside the range
+    if (address % (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE) != 0 || length % (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE) != 0) {
+        return false;
+    }
+
+    bool         ret = true;
+    FLASH_Status status;
+    for (uint32_t i = address / (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE); i <= (address + length - 1) / (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE); ++i) {
+        status = FLASH_ErasePage(WEAR_LEVELING_LEGACY_EMULATION_BASE_PAGE_ADDRESS + (i * (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)));
+        if (status != FLASH_COMPLETE) {
+            ret = false;
+        }
+    }
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = ((WEAR_LEVELING_LEGACY_EMULATION_BASE_PAGE_ADDRESS) + address);
     bs_dprintf("Write ");
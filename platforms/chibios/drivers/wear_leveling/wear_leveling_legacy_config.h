@@ -53,6 +53,10 @@
 #endif
 
 // The amount of space to use for the entire set of emulation
+#ifndef BACKING_STORE_ERASE_SIZE
+#    define BACKING_STORE_ERASE_SIZE (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)
+#endif
+
 #ifndef WEAR_LEVELING_BACKING_SIZE
 #    if defined(QMK_MCU_STM32F042) || defined(QMK_MCU_STM32F070) || defined(QMK_MCU_STM32F072)
 #        define WEAR_LEVELING_BACKING_SIZE 2048
@@ -187,6 +187,19 @@ bool backing_store_erase(void) {
     return true;
 }
 
+bool backing_store_erase_range(uint32_t address, size_t length) {
+    // Refuse ranges which start or end part way through a sector, erasing it would clobber data outside the range
+    if (address % (FLASH_SECTOR_SIZE) != 0 || length % (FLASH_SECTOR_SIZE) != 0) {
+        bs_dprintf("Erase range %08lx+%lx is not sector aligned\n", (unsigned long)address, (unsigned long)length);
+        return false;
+    }
+
+    interrupts = save_and_disable_interrupts();
+    flash_range_erase((WEAR_LEVELING_RP2040_FLASH_BASE) + address, length);
+    restore_interrupts(interrupts);
+    return true;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
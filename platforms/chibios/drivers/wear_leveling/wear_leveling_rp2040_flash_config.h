@@ -12,6 +12,10 @@
 #endif
 
 // 64kB backing space allocated
+#ifndef BACKING_STORE_ERASE_SIZE
+#    define BACKING_STORE_ERASE_SIZE (FLASH_SECTOR_SIZE)
+#endif
+
 #ifndef WEAR_LEVELING_BACKING_SIZE
 #    define WEAR_LEVELING_BACKING_SIZE 8192
 #endif // WEAR_LEVELING_BACKING_SIZE
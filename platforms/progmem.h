@@ -1,7 +1,16 @@
 #pragma once
 
+/**
+ * pgm_read_struct(buffer, src)
+ *
+ * Gives read access to a PROGMEM struct, returning a pointer to it. Where flash is memory mapped the pointer is `src`
+ * itself and nothing is copied; on AVR the whole struct is copied into `buffer` with a single bulk read, and a pointer
+ * to `buffer` is returned.
+ */
+
 #if defined(__AVR__)
 #    include <avr/pgmspace.h>
+#    define pgm_read_struct(buffer, src) ((const __typeof__(*(buffer))*)memcpy_P((buffer), (src), sizeof(*(buffer))))
 #else
 #    include <string.h>
 #    define PROGMEM
@@ -15,4 +24,5 @@
 #    define strcmp_P(s1, s2) strcmp(s1, s2)
 #    define strcpy_P(dest, src) strcpy(dest, src)
 #    define strlen_P(src) strlen(src)
+#    define pgm_read_struct(buffer, src) ((void)(buffer), (const __typeof__(*(buffer))*)(src))
 #endif
@@ -0,0 +1,344 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <vector>
+
+extern "C" {
+#include "host_report_queue.h"
+}
+
+/* Mock host driver, recording every report it is given */
+static bool                           driver_ready;
+static int                            ready_after_polls; // When non-zero, a busy endpoint accepts one report after this many polls
+static std::vector<report_keyboard_t> sent_keyboard;
+static std::vector<report_mouse_t>    sent_mouse;
+static std::vector<report_extra_t>    sent_extra;
+
+static uint8_t mock_keyboard_leds(void) {
+    return 0;
+}
+static void mock_send_keyboard(report_keyboard_t *report) {
+    sent_keyboard.push_back(*report);
+}
+static void mock_send_mouse(report_mouse_t *report) {
+    sent_mouse.push_back(*report);
+}
+static void mock_send_extra(report_extra_t *report) {
+    sent_extra.push_back(*report);
+}
+static bool mock_report_ready(host_report_type_t type) {
+    if (ready_after_polls > 0 && --ready_after_polls == 0) {
+        return true;
+    }
+    return driver_ready;
+}
+
+static host_driver_t mock_driver     = {mock_keyboard_leds, mock_send_keyboard, mock_send_mouse, mock_send_extra, mock_report_ready};
+static host_driver_t blocking_driver = {mock_keyboard_leds, mock_send_keyboard, mock_send_mouse, mock_send_extra, nullptr};
+
+static report_keyboard_t keyboard_report(uint8_t mods, std::initializer_list<uint8_t> keys) {
+    report_keyboard_t report = {};
+    report.mods              = mods;
+    uint8_t i                = 0;
+    for (auto key : keys) {
+        report.keys[i++] = key;
+    }
+    return report;
+}
+
+#ifdef NKRO_ENABLE
+static report_keyboard_t nkro_report(uint8_t mods, std::initializer_list<uint8_t> keys) {
+    report_keyboard_t report = {};
+    report.nkro.mods         = mods;
+    for (auto key : keys) {
+        report.nkro.bits[key >> 3] |= 1 << (key & 7);
+    }
+    return report;
+}
+#endif
+
+static bool operator==(const report_keyboard_t &a, const report_keyboard_t &b) {
+    return std::memcmp(&a, &b, sizeof(report_keyboard_t)) == 0;
+}
+
+class HostReportQueue : public testing::Test {
+   protected:
+    void SetUp() override {
+        host_report_queue_clear();
+        driver_ready      = true;
+        ready_after_polls = 0;
+        sent_keyboard.clear();
+        sent_mouse.clear();
+        sent_extra.clear();
+    }
+
+    void send(report_keyboard_t report, bool nkro = false) {
+        host_report_queue_keyboard(&mock_driver, &report, nkro);
+    }
+
+    const host_report_queue_stats_t *keyboard_stats() {
+        return host_report_queue_get_stats(HOST_REPORT_KEYBOARD);
+    }
+};
+
+TEST_F(HostReportQueue, DriverWithoutReadyCallbackSendsImmediately) {
+    auto report = keyboard_report(0, {0x04});
+    host_report_queue_keyboard(&blocking_driver, &report, false);
+    ASSERT_EQ(sent_keyboard.size(), 1);
+    EXPECT_TRUE(sent_keyboard[0] == report);
+    EXPECT_TRUE(host_report_queue_is_empty());
+}
+
+TEST_F(HostReportQueue, BusyEndpointDoesNotBlock) {
+    driver_ready = false;
+    send(keyboard_report(0, {0x04}));
+    EXPECT_EQ(sent_keyboard.size(), 0);
+    EXPECT_EQ(keyboard_stats()->depth, 1);
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_keyboard.size(), 1);
+    EXPECT_TRUE(sent_keyboard[0] == keyboard_report(0, {0x04}));
+    EXPECT_EQ(keyboard_stats()->depth, 0);
+    EXPECT_EQ(keyboard_stats()->sent, 1);
+}
+
+TEST_F(HostReportQueue, PressesAreNotCoalesced) {
+    driver_ready = false;
+    send(keyboard_report(0, {0x04}));
+    send(keyboard_report(0, {0x04, 0x05}));
+    send(keyboard_report(0, {0x04, 0x05, 0x06}));
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_keyboard.size(), 3);
+    EXPECT_TRUE(sent_keyboard[0] == keyboard_report(0, {0x04}));
+    EXPECT_TRUE(sent_keyboard[1] == keyboard_report(0, {0x04, 0x05}));
+    EXPECT_TRUE(sent_keyboard[2] == keyboard_report(0, {0x04, 0x05, 0x06}));
+    EXPECT_EQ(keyboard_stats()->coalesced, 0);
+    EXPECT_EQ(keyboard_stats()->max_depth, 3);
+}
+
+TEST_F(HostReportQueue, TapIsNotCoalesced) {
+    driver_ready = false;
+    send(keyboard_report(0, {0x04}));
+    send(keyboard_report(0, {}));
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_keyboard.size(), 2);
+    EXPECT_TRUE(sent_keyboard[0] == keyboard_report(0, {0x04}));
+    EXPECT_TRUE(sent_keyboard[1] == keyboard_report(0, {}));
+}
+
+TEST_F(HostReportQueue, ConsecutiveReleasesAreCoalesced) {
+    send(keyboard_report(0x02, {0x04, 0x05}));
+    ASSERT_EQ(sent_keyboard.size(), 1);
+
+    driver_ready = false;
+    send(keyboard_report(0x02, {0x05}));
+    send(keyboard_report(0, {0x05}));
+    send(keyboard_report(0, {}));
+    EXPECT_EQ(keyboard_stats()->depth, 1);
+    EXPECT_EQ(keyboard_stats()->coalesced, 2);
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_keyboard.size(), 2);
+    EXPECT_TRUE(sent_keyboard[1] == keyboard_report(0, {}));
+}
+
+TEST_F(HostReportQueue, ModifierThenKeyIsCoalesced) {
+    driver_ready = false;
+    send(keyboard_report(0x02, {}));
+    send(keyboard_report(0x02, {0x04}));
+    EXPECT_EQ(keyboard_stats()->depth, 1);
+
+    /* A release following the press must not be merged into it */
+    send(keyboard_report(0x02, {}));
+    EXPECT_EQ(keyboard_stats()->depth, 2);
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_keyboard.size(), 2);
+    EXPECT_TRUE(sent_keyboard[0] == keyboard_report(0x02, {0x04}));
+    EXPECT_TRUE(sent_keyboard[1] == keyboard_report(0x02, {}));
+}
+
+TEST_F(HostReportQueue, DuplicateReportsAreCoalesced) {
+    driver_ready = false;
+    send(keyboard_report(0, {0x04}));
+    send(keyboard_report(0, {0x04}));
+    EXPECT_EQ(keyboard_stats()->depth, 1);
+    EXPECT_EQ(keyboard_stats()->coalesced, 1);
+}
+
+#ifdef NKRO_ENABLE
+TEST_F(HostReportQueue, NkroReleasesAreCoalesced) {
+    send(nkro_report(0, {0x04, 0x30, 0x50}), true);
+
+    driver_ready = false;
+    send(nkro_report(0, {0x30, 0x50}), true);
+    send(nkro_report(0, {0x50}), true);
+    /* Press after release is kept separate */
+    send(nkro_report(0, {0x50, 0x31}), true);
+    EXPECT_EQ(keyboard_stats()->depth, 2);
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_keyboard.size(), 3);
+    EXPECT_TRUE(sent_keyboard[1] == nkro_report(0, {0x50}));
+    EXPECT_TRUE(sent_keyboard[2] == nkro_report(0, {0x50, 0x31}));
+}
+
+TEST_F(HostReportQueue, NkroPressesAndTapsAreNotCoalesced) {
+    driver_ready = false;
+    /* Keys in different bytes of the bitmap */
+    send(nkro_report(0, {0x04}), true);
+    send(nkro_report(0, {0x04, 0x3A}), true);
+    send(nkro_report(0, {0x3A}), true);
+    send(nkro_report(0, {0x3A, 0x04}), true);
+    EXPECT_EQ(keyboard_stats()->depth, 4);
+    EXPECT_EQ(keyboard_stats()->coalesced, 0);
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_keyboard.size(), 4);
+    EXPECT_TRUE(sent_keyboard[2] == nkro_report(0, {0x3A}));
+}
+
+TEST_F(HostReportQueue, NkroModifierThenKeyIsCoalesced) {
+    send(nkro_report(0, {}), true);
+
+    driver_ready = false;
+    send(nkro_report(0x02, {}), true);
+    send(nkro_report(0x02, {0x04, 0x70}), true);
+    EXPECT_EQ(keyboard_stats()->depth, 1);
+
+    /* Releasing the modifier after the press must not be merged into it */
+    send(nkro_report(0, {0x04, 0x70}), true);
+    EXPECT_EQ(keyboard_stats()->depth, 2);
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_keyboard.size(), 3);
+    EXPECT_TRUE(sent_keyboard[1] == nkro_report(0x02, {0x04, 0x70}));
+    EXPECT_TRUE(sent_keyboard[2] == nkro_report(0, {0x04, 0x70}));
+}
+
+TEST_F(HostReportQueue, NkroAndBootReportsAreNotCoalesced) {
+    driver_ready = false;
+    send(keyboard_report(0, {0x04}), false);
+    send(nkro_report(0, {}), true);
+    EXPECT_EQ(keyboard_stats()->depth, 2);
+}
+#endif
+
+TEST_F(HostReportQueue, FullQueueKeepsQueuedTaps) {
+    driver_ready = false;
+    /* Fill the queue with taps, which are never coalesced */
+    for (uint8_t i = 0; i < HOST_REPORT_QUEUE_SIZE; i++) {
+        send(keyboard_report(0, {(uint8_t)(i % 2 == 0 ? 0x04 + i : 0)}));
+    }
+    EXPECT_EQ(keyboard_stats()->depth, HOST_REPORT_QUEUE_SIZE);
+
+    /* The next report is held back, and one which cannot be merged into it waits for the endpoint */
+    send(keyboard_report(0, {0x30}));
+    EXPECT_EQ(keyboard_stats()->stalled, 0);
+    ready_after_polls = 5;
+    send(keyboard_report(0, {}));
+    EXPECT_EQ(keyboard_stats()->stalled, 1);
+    EXPECT_EQ(sent_keyboard.size(), 1);
+    EXPECT_EQ(keyboard_stats()->depth, HOST_REPORT_QUEUE_SIZE);
+    EXPECT_FALSE(host_report_queue_is_empty());
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_keyboard.size(), HOST_REPORT_QUEUE_SIZE + 2);
+    for (uint8_t i = 0; i < HOST_REPORT_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(sent_keyboard[i] == keyboard_report(0, {(uint8_t)(i % 2 == 0 ? 0x04 + i : 0)})) << "report " << (int)i;
+    }
+    /* so the tap made while the queue was full still reaches the host */
+    EXPECT_TRUE(sent_keyboard[HOST_REPORT_QUEUE_SIZE] == keyboard_report(0, {0x30}));
+    EXPECT_TRUE(sent_keyboard[HOST_REPORT_QUEUE_SIZE + 1] == keyboard_report(0, {}));
+    EXPECT_EQ(keyboard_stats()->queued, HOST_REPORT_QUEUE_SIZE + 2);
+    EXPECT_TRUE(host_report_queue_is_empty());
+}
+
+TEST_F(HostReportQueue, FullQueueCoalescesHeldBackReleases) {
+    driver_ready = false;
+    /* Fill the queue with presses, which are never coalesced */
+    std::vector<uint8_t> keys;
+    for (uint8_t i = 0; i < HOST_REPORT_QUEUE_SIZE; i++) {
+        keys.push_back(0x04 + i);
+        report_keyboard_t report = {};
+        std::copy(keys.begin(), keys.end(), report.keys);
+        send(report);
+    }
+
+    /* Releases while the queue is full are merged into the held back report, without waiting */
+    send(keyboard_report(0, {0x04, 0x05}));
+    send(keyboard_report(0, {0x04}));
+    send(keyboard_report(0, {0x04}));
+    EXPECT_EQ(keyboard_stats()->coalesced, 2);
+    EXPECT_EQ(keyboard_stats()->stalled, 0);
+    EXPECT_TRUE(sent_keyboard.empty());
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_keyboard.size(), HOST_REPORT_QUEUE_SIZE + 1);
+    EXPECT_TRUE(sent_keyboard.back() == keyboard_report(0, {0x04}));
+}
+
+TEST_F(HostReportQueue, MouseMotionIsSummed) {
+    driver_ready = false;
+    report_mouse_t report = {};
+    report.x              = 10;
+    report.y              = -5;
+    host_report_queue_mouse(&mock_driver, &report);
+    report.x = 20;
+    report.y = -5;
+    report.v = 1;
+    host_report_queue_mouse(&mock_driver, &report);
+    EXPECT_EQ(host_report_queue_get_stats(HOST_REPORT_MOUSE)->depth, 1);
+
+    /* Button changes are never merged */
+    report.buttons = 1;
+    host_report_queue_mouse(&mock_driver, &report);
+    EXPECT_EQ(host_report_queue_get_stats(HOST_REPORT_MOUSE)->depth, 2);
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_mouse.size(), 2);
+    EXPECT_EQ(sent_mouse[0].x, 30);
+    EXPECT_EQ(sent_mouse[0].y, -10);
+    EXPECT_EQ(sent_mouse[0].v, 1);
+    EXPECT_EQ(sent_mouse[1].buttons, 1);
+}
+
+TEST_F(HostReportQueue, MouseMotionOverflowIsNotSummed) {
+    driver_ready = false;
+    report_mouse_t report = {};
+    report.x              = 100;
+    host_report_queue_mouse(&mock_driver, &report);
+    host_report_queue_mouse(&mock_driver, &report);
+    EXPECT_EQ(host_report_queue_get_stats(HOST_REPORT_MOUSE)->depth, 2);
+}
+
+TEST_F(HostReportQueue, ExtraDuplicatesAreCoalesced) {
+    driver_ready = false;
+    report_extra_t report = {.report_id = 3, .usage = 0xE9};
+    host_report_queue_extra(&mock_driver, &report);
+    host_report_queue_extra(&mock_driver, &report);
+    report.usage = 0;
+    host_report_queue_extra(&mock_driver, &report);
+
+    driver_ready = true;
+    host_report_queue_flush(&mock_driver);
+    ASSERT_EQ(sent_extra.size(), 2);
+    EXPECT_EQ(sent_extra[0].usage, 0xE9);
+    EXPECT_EQ(sent_extra[1].usage, 0);
+}
@@ -0,0 +1,88 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include <stdint.h>
+#include <string.h>
+#include "progmem.h"
+}
+
+typedef struct {
+    uint8_t  driver;
+    uint8_t  r;
+    uint8_t  g;
+    uint8_t  b;
+    uint16_t flags;
+} test_led_t;
+
+static const test_led_t PROGMEM test_leds[] = {
+    {0, 0x10, 0x20, 0x30, 0x0001},
+    {1, 0x11, 0x21, 0x31, 0x0102},
+    {2, 0x12, 0x22, 0x32, 0x0204},
+};
+
+TEST(Progmem, ReadStructMatchesTable) {
+    for (size_t i = 0; i < sizeof(test_leds) / sizeof(test_leds[0]); ++i) {
+        test_led_t        led_buffer;
+        const test_led_t *led = pgm_read_struct(&led_buffer, &test_leds[i]);
+
+        EXPECT_EQ(led->driver, test_leds[i].driver);
+        EXPECT_EQ(led->r, test_leds[i].r);
+        EXPECT_EQ(led->g, test_leds[i].g);
+        EXPECT_EQ(led->b, test_leds[i].b);
+        EXPECT_EQ(led->flags, test_leds[i].flags);
+    }
+}
+
+TEST(Progmem, ReadStructDoesNotCopyMappedFlash) {
+    test_led_t led_buffer = {0xFF, 0xFF, 0xFF, 0xFF, 0xFFFF};
+
+    // Flash is memory mapped off AVR, so the table entry is used in place and the buffer is left untouched
+    EXPECT_EQ(pgm_read_struct(&led_buffer, &test_leds[1]), &test_leds[1]);
+    EXPECT_EQ(led_buffer.driver, 0xFF);
+    EXPECT_EQ(led_buffer.flags, 0xFFFF);
+}
+
+extern "C" {
+#include "ckled2001.h"
+#include "i2c_master.h"
+
+extern uint8_t g_pwm_buffer[DRIVER_COUNT][192];
+extern bool    g_pwm_buffer_update_required[DRIVER_COUNT];
+extern uint8_t g_led_control_registers[DRIVER_COUNT][24];
+
+const ckled2001_led PROGMEM g_ckled2001_leds[RGB_MATRIX_LED_COUNT] = {
+    {0, A_1, B_1, C_1},
+    {1, A_2, B_2, C_2},
+    {1, L_16, K_16, J_16},
+};
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    return I2C_STATUS_SUCCESS;
+}
+}
+
+TEST(Progmem, DriverSetColorReadsLedMap) {
+    memset(g_pwm_buffer, 0, sizeof(g_pwm_buffer));
+    memset(g_pwm_buffer_update_required, 0, sizeof(g_pwm_buffer_update_required));
+
+    ckled2001_set_color(2, 0x40, 0x50, 0x60);
+
+    EXPECT_EQ(g_pwm_buffer[1][L_16], 0x40);
+    EXPECT_EQ(g_pwm_buffer[1][K_16], 0x50);
+    EXPECT_EQ(g_pwm_buffer[1][J_16], 0x60);
+    EXPECT_FALSE(g_pwm_buffer_update_required[0]);
+    EXPECT_TRUE(g_pwm_buffer_update_required[1]);
+}
+
+TEST(Progmem, DriverControlRegisterReadsLedMap) {
+    memset(g_led_control_registers, 0, sizeof(g_led_control_registers));
+
+    ckled2001_set_led_control_register(0, true, false, true);
+
+    EXPECT_EQ(g_led_control_registers[0][A_1 / 8], 1 << (A_1 % 8));
+    EXPECT_EQ(g_led_control_registers[0][B_1 / 8] & (1 << (B_1 % 8)), 0);
+    EXPECT_EQ(g_led_control_registers[0][C_1 / 8], 1 << (C_1 % 8));
+}
@@ -23,3 +23,24 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+host_report_queue_DEFS := -DHOST_REPORT_QUEUE_SIZE=4
+host_report_queue_INC := \
+	$(TMK_PATH)/protocol
+host_report_queue_SRC := \
+	$(TMK_PATH)/protocol/host_report_queue.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/host_report_queue_tests.cpp
+
+# The arm_atsam endpoint sizes give an NKRO report layout without pulling in a USB stack
+host_report_queue_nkro_DEFS := $(host_report_queue_DEFS) -DNKRO_ENABLE -DPROTOCOL_ARM_ATSAM
+host_report_queue_nkro_INC := $(host_report_queue_INC)
+host_report_queue_nkro_SRC := $(host_report_queue_SRC)
+
+# The ckled2001 driver stands in for the LED drivers that read their map through pgm_read_struct
+progmem_DEFS := -DRGB_MATRIX_LED_COUNT=3 -DDRIVER_COUNT=2
+progmem_INC := \
+	$(DRIVER_PATH)/led \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers
+progmem_SRC := \
+	$(DRIVER_PATH)/led/ckled2001.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/progmem_tests.cpp
@@ -1 +1 @@
-TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large
+TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large host_report_queue host_report_queue_nkro progmem
@@ -73,12 +73,15 @@ bool playing_note   = false; // or (possibly multiple simultaneous) tones
 bool state_changed  = false; // global flag, which is set if anything changes with the active_tones
 
 // melody/SONG related state variables
-float (*notes_pointer)[][2];                           // SONG, an array of MUSICAL_NOTEs
-uint16_t notes_count;                                  // length of the notes_pointer array
-bool     notes_repeat;                                 // PLAY_SONG or PLAY_LOOP?
+float (*notes_pointer)[][2];                           // SONG, an array of MUSICAL_NOTEs; NULL while playing a song stream
+uint16_t      notes_count;                             // length of the notes_pointer array
+song_stream_t notes_stream;                            // position in the song stream, when notes_pointer is NULL
+bool          notes_repeat;                            // PLAY_SONG or PLAY_LOOP?
 uint16_t melody_current_note_duration = 0;             // duration of the currently playing note from the active melody, in ms
 uint8_t  note_tempo                   = TEMPO_DEFAULT; // beats-per-minute
-uint16_t current_note                 = 0;             // index into the array at notes_pointer
+uint16_t current_note                 = 0;             // index into the array at notes_pointer of the next note to play
+float    melody_pitch                 = 0.0f;          // frequency of the current note of the melody
+uint16_t melody_duration              = 0;             // duration of the current note of the melody, in 64ths of a beat
 bool     note_resting                 = false;         // if a short pause was introduced between two notes with the same frequency while playing a melody
 uint16_t last_timestamp               = 0;
 
@@ -96,18 +99,28 @@ extern bool     glissando;
 extern bool     vibrato;
 extern uint16_t voices_timer;
 
-#ifndef STARTUP_SONG
-#    define STARTUP_SONG SONG(STARTUP_SOUND)
+// the default songs are played from their song stream, songs set in config.h keep the SONG() format
+#ifdef STARTUP_SONG
+float startup_song[][2] = STARTUP_SONG;
+#    define PLAY_STARTUP_SONG() PLAY_SONG(startup_song)
+#else
+static const uint8_t startup_song[] PROGMEM = SONG_STREAM(STARTUP_SOUND);
+#    define PLAY_STARTUP_SONG() PLAY_SONG_STREAM(startup_song)
 #endif
-#ifndef AUDIO_ON_SONG
-#    define AUDIO_ON_SONG SONG(AUDIO_ON_SOUND)
+#ifdef AUDIO_ON_SONG
+float audio_on_song[][2] = AUDIO_ON_SONG;
+#    define PLAY_AUDIO_ON_SONG() PLAY_SONG(audio_on_song)
+#else
+static const uint8_t audio_on_song[] PROGMEM = SONG_STREAM(AUDIO_ON_SOUND);
+#    define PLAY_AUDIO_ON_SONG() PLAY_SONG_STREAM(audio_on_song)
 #endif
-#ifndef AUDIO_OFF_SONG
-#    define AUDIO_OFF_SONG SONG(AUDIO_OFF_SOUND)
-#endif
-float startup_song[][2]   = STARTUP_SONG;
-float audio_on_song[][2]  = AUDIO_ON_SONG;
+#ifdef AUDIO_OFF_SONG
 float audio_off_song[][2] = AUDIO_OFF_SONG;
+#    define PLAY_AUDIO_OFF_SONG() PLAY_SONG(audio_off_song)
+#else
+static const uint8_t audio_off_song[] PROGMEM = SONG_STREAM(AUDIO_OFF_SOUND);
+#    define PLAY_AUDIO_OFF_SONG() PLAY_SONG_STREAM(audio_off_song)
+#endif
 
 static bool    audio_initialized    = false;
 static bool    audio_driver_stopped = true;
@@ -151,7 +164,7 @@ void audio_init(void) {
 
 void audio_startup(void) {
     if (audio_config.enable) {
-        PLAY_SONG(startup_song);
+        PLAY_STARTUP_SONG();
     }
 
     last_timestamp = timer_read();
@@ -174,11 +187,11 @@ void audio_on(void) {
     audio_config.enable = 1;
     eeconfig_update_audio(audio_config.raw);
     audio_on_user();
-    PLAY_SONG(audio_on_song);
+    PLAY_AUDIO_ON_SONG();
 }
 
 void audio_off(void) {
-    PLAY_SONG(audio_off_song);
+    PLAY_AUDIO_OFF_SONG();
     audio_off_user();
     wait_ms(100);
     audio_stop_all();
@@ -305,16 +318,43 @@ void audio_play_tone(float pitch) {
     audio_play_note(pitch, 0xffff);
 }
 
-void audio_play_melody(float (*np)[][2], uint16_t n_count, bool n_repeat) {
-    if (!audio_config.enable) {
-        audio_stop_all();
-        return;
+/**
+ * Positions the melody on its first note.
+ */
+static void melody_rewind(void) {
+    if (notes_pointer) {
+        current_note = 0;
+    } else {
+        song_stream_begin(&notes_stream, notes_stream.data);
     }
+}
 
-    if (n_count == 0) {
-        return;
+/**
+ * Reads the next note of the melody into melody_pitch and melody_duration.
+ *
+ * Returns false, leaving them untouched, at the end of the melody.
+ */
+static bool melody_next_note(void) {
+    if (notes_pointer) {
+        if (current_note >= notes_count) {
+            return false;
+        }
+        melody_pitch    = (*notes_pointer)[current_note][0];
+        melody_duration = (*notes_pointer)[current_note][1];
+        current_note++;
+        return true;
     }
 
+    song_note_t note;
+    if (!song_stream_next(&notes_stream, &note)) {
+        return false;
+    }
+    melody_pitch    = song_stream_frequency(note.pitch);
+    melody_duration = note.duration;
+    return true;
+}
+
+static void melody_start(bool n_repeat) {
     if (!audio_initialized) {
         audio_init();
     }
@@ -322,20 +362,46 @@ void audio_play_melody(float (*np)[][2], uint16_t n_count, bool n_repeat) {
     // Cancel note if a note is playing
     if (playing_note) audio_stop_all();
 
+    notes_repeat = n_repeat;
+    melody_rewind();
+    if (!melody_next_note()) {
+        return;
+    }
+
     playing_melody = true;
     note_resting   = false;
 
+    // start first note manually, which also starts the audio_driver
+    // all following/remaining notes are played by 'audio_update_state'
+    melody_current_note_duration = audio_duration_to_ms(melody_duration);
+    audio_play_note(melody_pitch, melody_current_note_duration);
+    last_timestamp = timer_read();
+}
+
+void audio_play_melody(float (*np)[][2], uint16_t n_count, bool n_repeat) {
+    if (!audio_config.enable) {
+        audio_stop_all();
+        return;
+    }
+
+    if (n_count == 0) {
+        return;
+    }
+
     notes_pointer = np;
     notes_count   = n_count;
-    notes_repeat  = n_repeat;
+    melody_start(n_repeat);
+}
 
-    current_note = 0; // note in the melody-array/list at note_pointer
+void audio_play_song_stream(const uint8_t *song, bool repeat) {
+    if (!audio_config.enable) {
+        audio_stop_all();
+        return;
+    }
 
-    // start first note manually, which also starts the audio_driver
-    // all following/remaining notes are played by 'audio_update_state'
-    audio_play_note((*notes_pointer)[current_note][0], audio_duration_to_ms((*notes_pointer)[current_note][1]));
-    last_timestamp               = timer_read();
-    melody_current_note_duration = audio_duration_to_ms((*notes_pointer)[current_note][1]);
+    notes_pointer     = NULL;
+    notes_stream.data = song;
+    melody_start(repeat);
 }
 
 float click[2][2];
@@ -411,33 +477,35 @@ bool audio_update_state(void) {
     if (playing_melody) {
         goto_next_note = timer_elapsed(last_timestamp) >= melody_current_note_duration;
         if (goto_next_note) {
-            uint16_t delta         = timer_elapsed(last_timestamp) - melody_current_note_duration;
-            last_timestamp         = current_time;
-            uint16_t previous_note = current_note;
-            current_note++;
-            voices_timer = timer_read(); // reset to zero, for the effects added by voices.c
-
-            if (current_note >= notes_count) {
-                if (notes_repeat) {
-                    current_note = 0;
-                } else {
-                    audio_stop_all();
-                    return false;
-                }
-            }
+            uint16_t delta = timer_elapsed(last_timestamp) - melody_current_note_duration;
+            last_timestamp = current_time;
+            voices_timer   = timer_read(); // reset to zero, for the effects added by voices.c
 
-            if (!note_resting && (*notes_pointer)[previous_note][0] == (*notes_pointer)[current_note][0]) {
-                note_resting = true;
+            if (note_resting) {
+                // the pause is over, play the note it separated from the previous one
+                note_resting = false;
+            } else {
+                float previous_pitch = melody_pitch;
+                if (!melody_next_note()) {
+                    if (notes_repeat) {
+                        melody_rewind();
+                        melody_next_note();
+                    } else {
+                        audio_stop_all();
+                        return false;
+                    }
+                }
 
                 // special handling for successive notes of the same frequency:
                 // insert a short pause to separate them audibly
+                note_resting = (melody_pitch == previous_pitch);
+            }
+
+            if (note_resting) {
                 audio_play_note(0.0f, audio_duration_to_ms(2));
-                current_note                 = previous_note;
                 melody_current_note_duration = audio_duration_to_ms(2);
 
             } else {
-                note_resting = false;
-
                 // TODO: handle glissando here (or remember previous and current tone)
                 /* there would need to be a freq(here we are) -> freq(next note)
                  * and do slide/glissando in between problem here is to know which
@@ -450,13 +518,12 @@ bool audio_update_state(void) {
 
                 // '- delta': Skip forward in the next note's length if we've over shot
                 //            the last, so the overall length of the song is the same
-                uint16_t duration = audio_duration_to_ms((*notes_pointer)[current_note][1]);
+                uint16_t duration = audio_duration_to_ms(melody_duration);
 
                 // Skip forward past any completely missed notes
-                while (delta > duration && current_note < notes_count - 1) {
+                while (delta > duration && melody_next_note()) {
                     delta -= duration;
-                    current_note++;
-                    duration = audio_duration_to_ms((*notes_pointer)[current_note][1]);
+                    duration = audio_duration_to_ms(melody_duration);
                 }
 
                 if (delta < duration) {
@@ -467,7 +534,7 @@ bool audio_update_state(void) {
                     duration = 1;
                 }
 
-                audio_play_note((*notes_pointer)[current_note][0], duration);
+                audio_play_note(melody_pitch, duration);
                 melody_current_note_duration = duration;
             }
         }
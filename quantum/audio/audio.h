@@ -20,6 +20,7 @@
 #include <stdbool.h>
 #include "musical_notes.h"
 #include "song_list.h"
+#include "song_stream.h"
 #include "voices.h"
 
 #if defined(AUDIO_DRIVER_PWM)
@@ -138,6 +139,17 @@ void audio_stop_tone(float pitch);
  */
 void audio_play_melody(float (*np)[][2], uint16_t n_count, bool n_repeat);
 
+/**
+ * @brief play a melody from a song stream
+ *
+ * @details starts playback of a melody encoded with SONG_STREAM, see
+ *          song_stream.h; the notes are decoded one at a time while playing
+ *
+ * @param[in] song the song stream, usually in PROGMEM
+ * @param[in] repeat false for onetime, true for looped playback
+ */
+void audio_play_song_stream(const uint8_t *song, bool repeat);
+
 /**
  * @brief play a short tone of a specific frequency to emulate a 'click'
  *
@@ -184,6 +196,12 @@ bool audio_is_playing_melody(void);
  */
 #define PLAY_LOOP(note_array) audio_play_melody(&note_array, NOTE_ARRAY_SIZE((note_array)), true)
 
+/**
+ * @brief convenience macros, to play a song stream once or in a loop
+ */
+#define PLAY_SONG_STREAM(song) audio_play_song_stream(song, false)
+#define PLAY_LOOP_STREAM(song) audio_play_song_stream(song, true)
+
 // Tone-Multiplexing functions
 // this feature only makes sense for hardware setups which can't do proper
 // audio-wave synthesis = have no DAC and need to use PWM for tone generation
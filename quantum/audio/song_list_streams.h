@@ -0,0 +1,504 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// clang-format off
+
+// 0 notes, 1 bytes instead of 0
+#define NO_SOUND_STREAM \
+    0x7F
+#define NO_SOUND_STREAM_NOTE_COUNT 0
+
+// 15 notes, 20 bytes instead of 120
+#define ODE_TO_JOY_STREAM \
+    0x35, 0x10, 0xB5, 0xB6, 0xB8, 0xB8, 0xB6, 0xB5, 0xB3, 0xB1, 0xB1, 0xB3, 0xB5, 0x35, 0x18, 0x33, 0x08, 0x33, \
+    0x20, 0x7F
+#define ODE_TO_JOY_STREAM_NOTE_COUNT 15
+
+// 9 notes, 19 bytes instead of 72
+#define ROCK_A_BYE_BABY_STREAM \
+    0x3C, 0x18, 0x33, 0x08, 0x48, 0x10, 0x46, 0x20, 0x44, 0x10, 0x3C, 0x18, 0x3F, 0x08, 0x44, 0x10, 0x43, 0x20, 0x7F
+#define ROCK_A_BYE_BABY_STREAM_NOTE_COUNT 9
+
+// 8 notes, 10 bytes instead of 64
+#define CLUEBOARD_SOUND_STREAM \
+    0x25, 0x30, 0xA7, 0xA9, 0xAA, 0xAC, 0xBA, 0xBC, 0xB1, 0x7F
+#define CLUEBOARD_SOUND_STREAM_NOTE_COUNT 8
+
+// 3 notes, 6 bytes instead of 24
+#define STARTUP_SOUND_STREAM \
+    0x4D, 0x08, 0xD2, 0x59, 0x0C, 0x7F
+#define STARTUP_SOUND_STREAM_NOTE_COUNT 3
+
+// 3 notes, 6 bytes instead of 24
+#define GOODBYE_SOUND_STREAM \
+    0x59, 0x08, 0xD2, 0x4D, 0x0C, 0x7F
+#define GOODBYE_SOUND_STREAM_NOTE_COUNT 3
+
+// 5 notes, 9 bytes instead of 40
+#define PLANCK_SOUND_STREAM \
+    0x59, 0x0C, 0x56, 0x08, 0xCD, 0xD2, 0x56, 0x14, 0x7F
+#define PLANCK_SOUND_STREAM_NOTE_COUNT 5
+
+// 4 notes, 9 bytes instead of 32
+#define PREONIC_SOUND_STREAM \
+    0x48, 0x14, 0x54, 0x08, 0x4C, 0x14, 0x54, 0x08, 0x7F
+#define PREONIC_SOUND_STREAM_NOTE_COUNT 4
+
+// 4 notes, 8 bytes instead of 32
+#define QWERTY_SOUND_STREAM \
+    0x51, 0x08, 0xD2, 0x00, 0x04, 0x59, 0x10, 0x7F
+#define QWERTY_SOUND_STREAM_NOTE_COUNT 4
+
+// 6 notes, 12 bytes instead of 48
+#define COLEMAK_SOUND_STREAM \
+    0x51, 0x08, 0xD2, 0x00, 0x04, 0x59, 0x0C, 0x00, 0x04, 0x5D, 0x0C, 0x7F
+#define COLEMAK_SOUND_STREAM_NOTE_COUNT 6
+
+// 8 notes, 16 bytes instead of 64
+#define DVORAK_SOUND_STREAM \
+    0x51, 0x08, 0xD2, 0x00, 0x04, 0x59, 0x08, 0x00, 0x04, 0x5B, 0x08, 0x00, 0x04, 0x59, 0x08, 0x7F
+#define DVORAK_SOUND_STREAM_NOTE_COUNT 8
+
+// 9 notes, 16 bytes instead of 72
+#define WORKMAN_SOUND_STREAM \
+    0x51, 0x08, 0xD2, 0x00, 0x04, 0x7E, 0x01, 0x05, 0x00, 0x5B, 0x0C, 0x00, 0x04, 0x5E, 0x0C, 0x7F
+#define WORKMAN_SOUND_STREAM_NOTE_COUNT 9
+
+// 6 notes, 12 bytes instead of 48
+#define PLOVER_SOUND_STREAM \
+    0x51, 0x08, 0xD2, 0x00, 0x04, 0x59, 0x0C, 0x00, 0x04, 0x5E, 0x0C, 0x7F
+#define PLOVER_SOUND_STREAM_NOTE_COUNT 6
+
+// 6 notes, 12 bytes instead of 48
+#define PLOVER_GOODBYE_SOUND_STREAM \
+    0x51, 0x08, 0xD2, 0x00, 0x04, 0x5E, 0x0C, 0x00, 0x04, 0x59, 0x0C, 0x7F
+#define PLOVER_GOODBYE_SOUND_STREAM_NOTE_COUNT 6
+
+// 8 notes, 10 bytes instead of 64
+#define MUSIC_ON_SOUND_STREAM \
+    0x46, 0x08, 0xC8, 0xCA, 0xCB, 0xCD, 0xCF, 0xD1, 0xD2, 0x7F
+#define MUSIC_ON_SOUND_STREAM_NOTE_COUNT 8
+
+// 2 notes, 4 bytes instead of 16
+#define AUDIO_ON_SOUND_STREAM \
+    0x46, 0x08, 0xD2, 0x7F
+#define AUDIO_ON_SOUND_STREAM_NOTE_COUNT 2
+
+// 2 notes, 4 bytes instead of 16
+#define AUDIO_OFF_SOUND_STREAM \
+    0x52, 0x08, 0xC6, 0x7F
+#define AUDIO_OFF_SOUND_STREAM_NOTE_COUNT 2
+
+// 8 notes, 10 bytes instead of 64
+#define MUSIC_SCALE_SOUND_STREAM \
+    0x46, 0x08, 0xC8, 0xCA, 0xCB, 0xCD, 0xCF, 0xD1, 0xD2, 0x7F
+#define MUSIC_SCALE_SOUND_STREAM_NOTE_COUNT 8
+
+// 8 notes, 10 bytes instead of 64
+#define MUSIC_OFF_SOUND_STREAM \
+    0x52, 0x08, 0xD1, 0xCF, 0xCD, 0xCB, 0xCA, 0xC8, 0xC6, 0x7F
+#define MUSIC_OFF_SOUND_STREAM_NOTE_COUNT 8
+
+// 4 notes, 6 bytes instead of 32
+#define VOICE_CHANGE_SOUND_STREAM \
+    0x46, 0x10, 0xCA, 0xCD, 0xD2, 0x7F
+#define VOICE_CHANGE_SOUND_STREAM_NOTE_COUNT 4
+
+// 5 notes, 7 bytes instead of 40
+#define CHROMATIC_SOUND_STREAM \
+    0x46, 0x10, 0xC7, 0xC8, 0xC9, 0xCA, 0x7F
+#define CHROMATIC_SOUND_STREAM_NOTE_COUNT 5
+
+// 5 notes, 7 bytes instead of 40
+#define MAJOR_SOUND_STREAM \
+    0x46, 0x10, 0xC8, 0xCA, 0xCB, 0xCD, 0x7F
+#define MAJOR_SOUND_STREAM_NOTE_COUNT 5
+
+// 5 notes, 7 bytes instead of 40
+#define MINOR_SOUND_STREAM \
+    0x46, 0x10, 0xC8, 0xC9, 0xCB, 0xCD, 0x7F
+#define MINOR_SOUND_STREAM_NOTE_COUNT 5
+
+// 4 notes, 6 bytes instead of 32
+#define GUITAR_SOUND_STREAM \
+    0x41, 0x10, 0xC6, 0xCB, 0xD0, 0x7F
+#define GUITAR_SOUND_STREAM_NOTE_COUNT 4
+
+// 4 notes, 6 bytes instead of 32
+#define VIOLIN_SOUND_STREAM \
+    0x44, 0x10, 0xCB, 0xD2, 0xD9, 0x7F
+#define VIOLIN_SOUND_STREAM_NOTE_COUNT 4
+
+// 2 notes, 4 bytes instead of 16
+#define CAPS_LOCK_ON_SOUND_STREAM \
+    0x2E, 0x08, 0xB0, 0x7F
+#define CAPS_LOCK_ON_SOUND_STREAM_NOTE_COUNT 2
+
+// 2 notes, 4 bytes instead of 16
+#define CAPS_LOCK_OFF_SOUND_STREAM \
+    0x30, 0x08, 0xAE, 0x7F
+#define CAPS_LOCK_OFF_SOUND_STREAM_NOTE_COUNT 2
+
+// 2 notes, 4 bytes instead of 16
+#define SCROLL_LOCK_ON_SOUND_STREAM \
+    0x33, 0x08, 0xB5, 0x7F
+#define SCROLL_LOCK_ON_SOUND_STREAM_NOTE_COUNT 2
+
+// 2 notes, 4 bytes instead of 16
+#define SCROLL_LOCK_OFF_SOUND_STREAM \
+    0x35, 0x08, 0xB3, 0x7F
+#define SCROLL_LOCK_OFF_SOUND_STREAM_NOTE_COUNT 2
+
+// 2 notes, 4 bytes instead of 16
+#define NUM_LOCK_ON_SOUND_STREAM \
+    0x3F, 0x08, 0xC1, 0x7F
+#define NUM_LOCK_ON_SOUND_STREAM_NOTE_COUNT 2
+
+// 2 notes, 4 bytes instead of 16
+#define NUM_LOCK_OFF_SOUND_STREAM \
+    0x41, 0x08, 0xBF, 0x7F
+#define NUM_LOCK_OFF_SOUND_STREAM_NOTE_COUNT 2
+
+// 2 notes, 4 bytes instead of 16
+#define AG_NORM_SOUND_STREAM \
+    0x46, 0x08, 0xC6, 0x7F
+#define AG_NORM_SOUND_STREAM_NOTE_COUNT 2
+
+// 4 notes, 6 bytes instead of 32
+#define AG_SWAP_SOUND_STREAM \
+    0x48, 0x06, 0xC6, 0xC8, 0xC6, 0x7F
+#define AG_SWAP_SOUND_STREAM_NOTE_COUNT 4
+
+// 2 notes, 5 bytes instead of 16
+#define UNICODE_WINDOWS_STREAM \
+    0x48, 0x08, 0x4D, 0x04, 0x7F
+#define UNICODE_WINDOWS_STREAM_NOTE_COUNT 2
+
+// 2 notes, 5 bytes instead of 16
+#define UNICODE_LINUX_STREAM \
+    0x4D, 0x08, 0x48, 0x04, 0x7F
+#define UNICODE_LINUX_STREAM_NOTE_COUNT 2
+
+// 1 notes, 3 bytes instead of 8
+#define TERMINAL_SOUND_STREAM \
+    0x3D, 0x08, 0x7F
+#define TERMINAL_SOUND_STREAM_NOTE_COUNT 1
+
+// 110 notes, 179 bytes instead of 880
+#define CAMPANELLA_STREAM \
+    0x34, 0x10, 0x34, 0x08, 0xC0, 0x40, 0x10, 0x40, 0x08, 0xCC, 0x7E, 0x01, 0x05, 0x00, 0x3E, 0x10, 0x3E, 0x08, \
+    0xCC, 0x3C, 0x10, 0x3C, 0x08, 0xCC, 0x7E, 0x01, 0x05, 0x00, 0x3B, 0x10, 0x3B, 0x08, 0xCC, 0x39, 0x10, 0x39, \
+    0x08, 0xCC, 0x38, 0x10, 0x38, 0x08, 0xCC, 0x39, 0x10, 0x39, 0x08, 0xCC, 0x3B, 0x10, 0x3B, 0x08, 0xCC, 0x34, \
+    0x10, 0x34, 0x08, 0xCC, 0x40, 0x10, 0x40, 0x08, 0xCC, 0x41, 0x10, 0x41, 0x08, 0xCC, 0x40, 0x10, 0x40, 0x08, \
+    0xCC, 0x3E, 0x10, 0x3E, 0x08, 0xCC, 0x3C, 0x10, 0x3C, 0x08, 0xCC, 0x7E, 0x01, 0x05, 0x00, 0x3B, 0x10, 0x3B, \
+    0x08, 0xCC, 0x39, 0x10, 0x39, 0x08, 0xCC, 0x38, 0x10, 0x38, 0x08, 0xCC, 0x39, 0x10, 0x39, 0x08, 0xCC, 0x3B, \
+    0x10, 0x3B, 0x08, 0xCC, 0x34, 0x10, 0x34, 0x08, 0xC0, 0x40, 0x10, 0x40, 0x08, 0xCC, 0x4C, 0x10, 0x4C, 0x08, \
+    0xD8, 0x7E, 0x01, 0x05, 0x00, 0x4A, 0x10, 0x4A, 0x08, 0xD8, 0x48, 0x10, 0x48, 0x08, 0xD8, 0x7E, 0x01, 0x05, \
+    0x00, 0x47, 0x10, 0x47, 0x08, 0xD8, 0x45, 0x10, 0x45, 0x08, 0xD8, 0x44, 0x10, 0x44, 0x08, 0xD8, 0x45, 0x10, \
+    0x45, 0x08, 0xD8, 0x47, 0x10, 0x47, 0x08, 0xD8, 0x40, 0x10, 0x40, 0x08, 0xD8, 0x4C, 0x40, 0xC5, 0x7F
+#define CAMPANELLA_STREAM_NOTE_COUNT 110
+
+// 110 notes, 102 bytes instead of 880
+#define FANTASIE_IMPROMPTU_STREAM \
+    0x39, 0x08, 0xBA, 0xB9, 0x80, 0xB9, 0xBE, 0xC1, 0xC0, 0xBE, 0xC0, 0xBE, 0xBD, 0xBE, 0xC1, 0xC5, 0x7E, 0x01, \
+    0x10, 0x00, 0xBA, 0xBE, 0xC0, 0xC3, 0xC6, 0xCA, 0xCC, 0xD4, 0xD2, 0xD1, 0xCF, 0xCD, 0xCC, 0xCF, 0xCA, 0xBD, \
+    0xCC, 0xC6, 0xC5, 0xC3, 0xC6, 0xC1, 0xC0, 0xC3, 0xBE, 0xBD, 0xC0, 0xBA, 0xB9, 0xBC, 0xBA, 0xBA, 0xB9, 0xBA, \
+    0xB9, 0x80, 0xB9, 0xBE, 0xC1, 0xC0, 0xBE, 0xC0, 0xBE, 0xBD, 0xBE, 0xC1, 0xC5, 0xB9, 0xBB, 0xB9, 0x80, 0xB9, \
+    0xBE, 0xC1, 0xC0, 0xBE, 0xC0, 0xBE, 0xBD, 0xBE, 0xC1, 0xC5, 0xC0, 0xC1, 0xC0, 0x80, 0xC0, 0xC8, 0xC7, 0xC5, \
+    0x80, 0xCD, 0xCC, 0xCA, 0xC8, 0xC7, 0xC5, 0x80, 0xC7, 0x45, 0x60, 0x7F
+#define FANTASIE_IMPROMPTU_STREAM_NOTE_COUNT 110
+
+// 75 notes, 94 bytes instead of 600
+#define NOCTURNE_OP_9_NO_1_STREAM \
+    0x47, 0x20, 0xC9, 0xCA, 0xC6, 0xC7, 0xC3, 0x42, 0x40, 0xC2, 0xC2, 0xC2, 0x43, 0x20, 0xC2, 0xC0, 0xBD, 0x3E, \
+    0x80, 0x3B, 0x40, 0x47, 0x10, 0xC9, 0xCA, 0xC6, 0xC7, 0xC6, 0xC5, 0xC6, 0xC9, 0xC7, 0xC3, 0xC2, 0xC3, 0xC1, \
+    0xC2, 0xC7, 0xC6, 0xC5, 0xC4, 0xC3, 0xC2, 0xC1, 0xC0, 0xBF, 0xBE, 0xBD, 0xBE, 0xBD, 0xBC, 0xBD, 0xC2, 0xC1, \
+    0xC0, 0x3E, 0x80, 0x3B, 0x40, 0xC7, 0xC7, 0xC7, 0x45, 0xC0, 0x3E, 0x40, 0x3B, 0x20, 0xBD, 0xBE, 0xC3, 0xC3, \
+    0x42, 0xC0, 0x40, 0x40, 0x42, 0x20, 0xC0, 0xBE, 0xBA, 0x39, 0x80, 0x3E, 0x40, 0xC0, 0x42, 0x20, 0xC0, 0xBE, \
+    0xC0, 0x42, 0xC0, 0x7F
+#define NOCTURNE_OP_9_NO_1_STREAM_NOTE_COUNT 75
+
+// 23 notes, 41 bytes instead of 184
+#define USSR_ANTHEM_STREAM \
+    0x50, 0x80, 0xD5, 0x50, 0x40, 0x52, 0x20, 0x54, 0x80, 0x4D, 0x40, 0xCD, 0x52, 0x80, 0x50, 0x40, 0x4E, 0x20, \
+    0x50, 0x80, 0x49, 0x40, 0xC9, 0x4B, 0x80, 0x4B, 0x40, 0xCD, 0x4B, 0x80, 0x4B, 0x40, 0xD0, 0x4E, 0x80, 0x50, \
+    0x40, 0xD2, 0x54, 0x80, 0x7F
+#define USSR_ANTHEM_STREAM_NOTE_COUNT 23
+
+// 62 notes, 55 bytes instead of 496
+#define TOS_HYMN_RISEN_STREAM \
+    0x3F, 0x20, 0xC1, 0x42, 0x30, 0xC2, 0x42, 0x20, 0x3F, 0x30, 0x41, 0x08, 0xC1, 0x3D, 0x20, 0x3F, 0x10, 0xBF, \
+    0x41, 0x20, 0xBD, 0x44, 0x10, 0xC2, 0x7E, 0x01, 0x18, 0x00, 0x3F, 0x20, 0xBD, 0x3F, 0x40, 0xC1, 0x3A, 0x10, \
+    0x3A, 0x20, 0x41, 0x10, 0xC1, 0xC2, 0xC1, 0xBF, 0xC4, 0xBC, 0xBF, 0xBD, 0x42, 0x50, 0x7E, 0x01, 0x16, 0x00, 0x7F
+#define TOS_HYMN_RISEN_STREAM_NOTE_COUNT 62
+
+// 0 notes, 1 bytes instead of 0
+#define CLOSE_ENCOUNTERS_5_NOTE_STREAM \
+    0x7F
+#define CLOSE_ENCOUNTERS_5_NOTE_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define DOE_A_DEER_STREAM \
+    0x7F
+#define DOE_A_DEER_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define IN_LIKE_FLINT_STREAM \
+    0x7F
+#define IN_LIKE_FLINT_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define IMPERIAL_MARCH_STREAM \
+    0x7F
+#define IMPERIAL_MARCH_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define BASKET_CASE_STREAM \
+    0x7F
+#define BASKET_CASE_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define COIN_SOUND_STREAM \
+    0x7F
+#define COIN_SOUND_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define ONE_UP_SOUND_STREAM \
+    0x7F
+#define ONE_UP_SOUND_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define SONIC_RING_STREAM \
+    0x7F
+#define SONIC_RING_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define ZELDA_PUZZLE_STREAM \
+    0x7F
+#define ZELDA_PUZZLE_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define ZELDA_TREASURE_STREAM \
+    0x7F
+#define ZELDA_TREASURE_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define OVERWATCH_THEME_STREAM \
+    0x7F
+#define OVERWATCH_THEME_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define MARIO_THEME_STREAM \
+    0x7F
+#define MARIO_THEME_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define MARIO_GAMEOVER_STREAM \
+    0x7F
+#define MARIO_GAMEOVER_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define MARIO_MUSHROOM_STREAM \
+    0x7F
+#define MARIO_MUSHROOM_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define E1M1_DOOM_STREAM \
+    0x7F
+#define E1M1_DOOM_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define DISNEY_SONG_STREAM \
+    0x7F
+#define DISNEY_SONG_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define NUMBER_ONE_STREAM \
+    0x7F
+#define NUMBER_ONE_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define CABBAGE_SONG_STREAM \
+    0x7F
+#define CABBAGE_SONG_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define OLD_SPICE_STREAM \
+    0x7F
+#define OLD_SPICE_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define VICTORY_FANFARE_SHORT_STREAM \
+    0x7F
+#define VICTORY_FANFARE_SHORT_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define ALL_STAR_STREAM \
+    0x7F
+#define ALL_STAR_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define RICK_ROLL_STREAM \
+    0x7F
+#define RICK_ROLL_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define FF_PRELUDE_STREAM \
+    0x7F
+#define FF_PRELUDE_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define TO_BOLDLY_GO_STREAM \
+    0x7F
+#define TO_BOLDLY_GO_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define KATAWARE_DOKI_STREAM \
+    0x7F
+#define KATAWARE_DOKI_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define MEGALOVANIA_STREAM \
+    0x7F
+#define MEGALOVANIA_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define MICHISHIRUBE_STREAM \
+    0x7F
+#define MICHISHIRUBE_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define LIEBESLEID_STREAM \
+    0x7F
+#define LIEBESLEID_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define MELODIES_OF_LIFE_STREAM \
+    0x7F
+#define MELODIES_OF_LIFE_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define EYES_ON_ME_STREAM \
+    0x7F
+#define EYES_ON_ME_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define SONG_OF_THE_ANCIENTS_STREAM \
+    0x7F
+#define SONG_OF_THE_ANCIENTS_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define NIER_AMUSEMENT_PARK_STREAM \
+    0x7F
+#define NIER_AMUSEMENT_PARK_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define COPIED_CITY_STREAM \
+    0x7F
+#define COPIED_CITY_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define VAGUE_HOPE_COLD_RAIN_STREAM \
+    0x7F
+#define VAGUE_HOPE_COLD_RAIN_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define KAINE_SALVATION_STREAM \
+    0x7F
+#define KAINE_SALVATION_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define WEIGHT_OF_THE_WORLD_STREAM \
+    0x7F
+#define WEIGHT_OF_THE_WORLD_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define ISABELLAS_LULLABY_STREAM \
+    0x7F
+#define ISABELLAS_LULLABY_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define TERRAS_THEME_STREAM \
+    0x7F
+#define TERRAS_THEME_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define RENAI_CIRCULATION_STREAM \
+    0x7F
+#define RENAI_CIRCULATION_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define PLATINUM_DISCO_STREAM \
+    0x7F
+#define PLATINUM_DISCO_STREAM_NOTE_COUNT 0
+
+// 0 notes, 1 bytes instead of 0
+#define LP_NUMB_STREAM \
+    0x7F
+#define LP_NUMB_STREAM_NOTE_COUNT 0
+
+#define SONG_STREAM_LIST(X) \
+    X(ODE_TO_JOY) \
+    X(ROCK_A_BYE_BABY) \
+    X(CLUEBOARD_SOUND) \
+    X(STARTUP_SOUND) \
+    X(GOODBYE_SOUND) \
+    X(PLANCK_SOUND) \
+    X(PREONIC_SOUND) \
+    X(QWERTY_SOUND) \
+    X(COLEMAK_SOUND) \
+    X(DVORAK_SOUND) \
+    X(WORKMAN_SOUND) \
+    X(PLOVER_SOUND) \
+    X(PLOVER_GOODBYE_SOUND) \
+    X(MUSIC_ON_SOUND) \
+    X(AUDIO_ON_SOUND) \
+    X(AUDIO_OFF_SOUND) \
+    X(MUSIC_SCALE_SOUND) \
+    X(MUSIC_OFF_SOUND) \
+    X(VOICE_CHANGE_SOUND) \
+    X(CHROMATIC_SOUND) \
+    X(MAJOR_SOUND) \
+    X(MINOR_SOUND) \
+    X(GUITAR_SOUND) \
+    X(VIOLIN_SOUND) \
+    X(CAPS_LOCK_ON_SOUND) \
+    X(CAPS_LOCK_OFF_SOUND) \
+    X(SCROLL_LOCK_ON_SOUND) \
+    X(SCROLL_LOCK_OFF_SOUND) \
+    X(NUM_LOCK_ON_SOUND) \
+    X(NUM_LOCK_OFF_SOUND) \
+    X(AG_NORM_SOUND) \
+    X(AG_SWAP_SOUND) \
+    X(UNICODE_WINDOWS) \
+    X(UNICODE_LINUX) \
+    X(TERMINAL_SOUND) \
+    X(CAMPANELLA) \
+    X(FANTASIE_IMPROMPTU) \
+    X(NOCTURNE_OP_9_NO_1) \
+    X(USSR_ANTHEM) \
+    X(TOS_HYMN_RISEN)
@@ -0,0 +1,71 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "song_stream.h"
+#include "musical_notes.h"
+#include "progmem.h"
+
+/* The highest octave, the lower ones are derived by halving, which keeps them within 0.01Hz of their NOTE_ value */
+static const float top_octave[12] PROGMEM = {NOTE_C8, NOTE_CS8, NOTE_D8, NOTE_DS8, NOTE_E8, NOTE_F8, NOTE_FS8, NOTE_G8, NOTE_GS8, NOTE_A8, NOTE_AS8, NOTE_B8};
+
+static uint8_t read_byte(const song_stream_t *stream, uint16_t position) {
+    return pgm_read_byte(&stream->data[position]);
+}
+
+static uint16_t read_word(const song_stream_t *stream, uint16_t position) {
+    return read_byte(stream, position) | (uint16_t)read_byte(stream, position + 1) << 8;
+}
+
+void song_stream_begin(song_stream_t *stream, const uint8_t *data) {
+    stream->data          = data;
+    stream->position      = 0;
+    stream->duration      = 0;
+    stream->repeat_marker = UINT16_MAX;
+    stream->repeats       = 0;
+}
+
+bool song_stream_next(song_stream_t *stream, song_note_t *note) {
+    for (;;) {
+        uint8_t code = read_byte(stream, stream->position);
+        if (code == SONG_STREAM_END) {
+            return false;
+        }
+
+        if (code == SONG_STREAM_REPEAT) {
+            if (stream->repeat_marker != stream->position) {
+                stream->repeat_marker = stream->position;
+                stream->repeats       = read_byte(stream, stream->position + 1);
+            }
+            if (stream->repeats > 0) {
+                stream->repeats--;
+                stream->position -= read_word(stream, stream->position + 2);
+            } else {
+                stream->repeat_marker = UINT16_MAX;
+                stream->position += 4;
+            }
+            continue;
+        }
+
+        stream->position++;
+        if (!(code & SONG_STREAM_SAME_DURATION)) {
+            stream->duration = read_byte(stream, stream->position++);
+            if (stream->duration == SONG_STREAM_LONG_DURATION) {
+                stream->duration = read_word(stream, stream->position);
+                stream->position += 2;
+            }
+        }
+        note->pitch    = code & ~SONG_STREAM_SAME_DURATION;
+        note->duration = stream->duration;
+        return true;
+    }
+}
+
+float song_stream_frequency(uint8_t pitch) {
+    if (pitch == SONG_STREAM_REST || pitch > SONG_STREAM_NOTES) {
+        return NOTE_REST;
+    }
+    uint8_t semitone = pitch - 1;
+    float   top;
+    memcpy_P(&top, &top_octave[semitone % 12], sizeof(top));
+    return top / (1 << (8 - semitone / 12));
+}
@@ -0,0 +1,73 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "progmem.h"
+#include "song_list_streams.h"
+
+/* Song streams: a compact encoding of SONGs, decoded one note at a time while playing
+ *
+ * A song stream is a byte array, usually in PROGMEM, made of:
+ *
+ * - notes: the pitch as a semitone index, 0 for a rest and 1 (C0) to 108 (B8) for NOTE_C0 to NOTE_B8, followed by the
+ *   duration in 64ths of a beat in one byte. A duration of 0 is followed by the actual duration in two bytes, little
+ *   endian, for the rare notes that are longer than 255 or have no duration at all. When bit 7 of the pitch is set,
+ *   the duration is left out and is the same as the one of the previous note.
+ * - SONG_STREAM_REPEAT, followed by a count and a two byte little endian offset: the passage starting offset bytes
+ *   before the marker is played count more times. The first note of the passage always has its duration. Repeated
+ *   passages are not nested.
+ * - SONG_STREAM_END, after the last note.
+ *
+ * `qmk generate-song-streams` encodes every song of song_list.h into song_list_streams.h, as <SONG>_STREAM.
+ */
+
+#define SONG_STREAM_REST 0x00
+#define SONG_STREAM_NOTES 108
+#define SONG_STREAM_REPEAT 0x7E
+#define SONG_STREAM_END 0x7F
+#define SONG_STREAM_SAME_DURATION 0x80
+#define SONG_STREAM_LONG_DURATION 0x00
+
+/**
+ * @brief initialiser of a song stream array, e.g. `const uint8_t my_song[] PROGMEM = SONG_STREAM(STARTUP_SOUND);`
+ *
+ * @details the stream holds the notes generated from song_list.h, so a sound overriding one of its #ifndef guarded songs
+ *          is checked against the generated note count: a mismatch fails the build with a negative array size
+ */
+#define SONG_STREAM(sound) \
+    { sound##_STREAM + 0 * sizeof(char[sizeof((float[][2]){{0}, sound}) == (sound##_STREAM_NOTE_COUNT + 1) * sizeof(float[2]) ? 1 : -1]) }
+
+typedef struct {
+    uint8_t  pitch;    // semitone index, SONG_STREAM_REST or 1 (C0) to SONG_STREAM_NOTES (B8)
+    uint16_t duration; // in 64ths of a beat
+} song_note_t;
+
+typedef struct {
+    const uint8_t *data;          // first byte of the song
+    uint16_t       position;      // offset of the next byte to decode
+    uint16_t       duration;      // of the last note decoded, for the notes leaving theirs out
+    uint16_t       repeat_marker; // offset of the repeat marker being followed, UINT16_MAX if none
+    uint8_t        repeats;       // plays of the repeated passage left
+} song_stream_t;
+
+/**
+ * @brief positions a stream on the first note of a song
+ */
+void song_stream_begin(song_stream_t *stream, const uint8_t *data);
+
+/**
+ * @brief decodes the next note, following repeat markers
+ *
+ * @return false at the end of the song, which further calls keep returning
+ */
+bool song_stream_next(song_stream_t *stream, song_note_t *note);
+
+/**
+ * @brief frequency of a semitone index, within 0.01Hz of the matching NOTE_ definition
+ *
+ * @return in Hz, 0 for a rest
+ */
+float song_stream_frequency(uint8_t pitch);
@@ -0,0 +1,53 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "synth.h"
+
+_Static_assert(SYNTH_WAVETABLE_SIZE == 256, "The top byte of the phase indexes the wavetable");
+
+void synth_init(synth_t *synth, const uint16_t *wavetable, uint32_t sample_rate) {
+    synth->wavetable   = wavetable;
+    synth->sample_rate = sample_rate;
+    synth_clear_tones(synth);
+    synth_reset_phases(synth);
+}
+
+uint32_t synth_phase_increment(float frequency, uint32_t sample_rate) {
+    // 2^32 / sample_rate is exact enough in single precision, the product stays below 2^31 for frequencies under Nyquist
+    return (uint32_t)(frequency * (4294967296.0f / sample_rate));
+}
+
+void synth_clear_tones(synth_t *synth) {
+    synth->count = 0;
+    synth->gain  = 0;
+}
+
+bool synth_add_tone(synth_t *synth, float frequency) {
+    if (synth->count >= SYNTH_MAX_TONES) {
+        return false;
+    }
+    synth->increment[synth->count++] = synth_phase_increment(frequency, synth->sample_rate);
+    synth->gain                      = (1UL << 16) / synth->count;
+    return true;
+}
+
+void synth_reset_phases(synth_t *synth) {
+    for (uint8_t i = 0; i < SYNTH_MAX_TONES; i++) {
+        synth->phase[i] = 0;
+    }
+}
+
+uint16_t synth_sample(synth_t *synth) {
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < synth->count; i++) {
+        synth->phase[i] += synth->increment[i];
+        sum += synth->wavetable[synth->phase[i] >> 24];
+    }
+    return (sum * synth->gain) >> 16;
+}
+
+void synth_render(synth_t *synth, uint16_t *buffer, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) {
+        buffer[i] = synth_sample(synth);
+    }
+}
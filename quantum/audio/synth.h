@@ -0,0 +1,82 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Number of samples in one period of a wavetable. The phase of each tone is a 32-bit fraction of a period, so the top
+ * eight bits index the wavetable directly.
+ */
+#define SYNTH_WAVETABLE_SIZE 256
+
+/**
+ * Largest number of tones mixed together.
+ */
+#ifndef SYNTH_MAX_TONES
+#    define SYNTH_MAX_TONES 8
+#endif
+
+/**
+ * Integer additive synthesizer: one phase accumulator per tone, all reading the same wavetable.
+ *
+ * Everything that needs floating point or a division is done when the tones change, rendering a sample only takes
+ * additions, table lookups, one multiplication and a shift.
+ */
+typedef struct {
+    const uint16_t *wavetable;                  // SYNTH_WAVETABLE_SIZE samples, one period
+    uint32_t        sample_rate;                // in Hz
+    uint32_t        phase[SYNTH_MAX_TONES];     // fraction of the current period, 2^32 is a full period
+    uint32_t        increment[SYNTH_MAX_TONES]; // phase advance per sample
+    uint32_t        gain;                       // Q16 scale applied to the sum of the tones
+    uint8_t         count;                      // number of tones playing
+} synth_t;
+
+/**
+ * @brief Sets up a synthesizer without any tones
+ *
+ * @param wavetable SYNTH_WAVETABLE_SIZE samples, one period of the waveform to play
+ * @param sample_rate rate at which samples will be rendered, in Hz
+ */
+void synth_init(synth_t *synth, const uint16_t *wavetable, uint32_t sample_rate);
+
+/**
+ * @brief Phase advance per sample of a tone
+ *
+ * @param frequency in Hz, below half the sample rate
+ * @param sample_rate in Hz
+ * @return fraction of a period, 2^32 being a full period
+ */
+uint32_t synth_phase_increment(float frequency, uint32_t sample_rate);
+
+/**
+ * @brief Removes all tones, keeping their phases so that tones added back continue smoothly
+ */
+void synth_clear_tones(synth_t *synth);
+
+/**
+ * @brief Adds a tone to the mix
+ *
+ * @param frequency in Hz
+ * @return false if SYNTH_MAX_TONES are already playing
+ */
+bool synth_add_tone(synth_t *synth, float frequency);
+
+/**
+ * @brief Restarts all tones at the beginning of their period
+ */
+void synth_reset_phases(synth_t *synth);
+
+/**
+ * @brief Renders the next sample: the average of the wavetable at the phase of each tone
+ *
+ * @return 0 if no tone is playing
+ */
+uint16_t synth_sample(synth_t *synth);
+
+/**
+ * @brief Renders consecutive samples into a buffer
+ */
+void synth_render(synth_t *synth, uint16_t *buffer, uint16_t length);
@@ -0,0 +1,11 @@
+audio_synth_INC := $(QUANTUM_PATH)/audio
+
+audio_synth_SRC := \
+	$(QUANTUM_PATH)/audio/tests/synth_tests.cpp \
+	$(QUANTUM_PATH)/audio/synth.c
+
+audio_song_stream_INC := $(QUANTUM_PATH)/audio
+
+audio_song_stream_SRC := \
+	$(QUANTUM_PATH)/audio/tests/song_stream_tests.cpp \
+	$(QUANTUM_PATH)/audio/song_stream.c
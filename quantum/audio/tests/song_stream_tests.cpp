@@ -0,0 +1,113 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "song_stream.h"
+#include "musical_notes.h"
+#include "song_list.h"
+}
+
+namespace {
+
+struct shipped_song {
+    std::string           name;
+    std::vector<float>    pitches;
+    std::vector<uint16_t> durations;
+    std::vector<uint8_t>  stream;
+};
+
+// sound##_STREAM rather than SONG_STREAM(sound), which would get the notes of the already expanded argument
+#define SHIPPED_SONG(sound)                                     \
+    [] {                                                        \
+        float         song[][2] = SONG(sound);                  \
+        const uint8_t stream[]  = {sound##_STREAM};             \
+        shipped_song  shipped   = {#sound, {}, {}, {}};         \
+        for (auto &note : song) {                               \
+            shipped.pitches.push_back(note[0]);                 \
+            shipped.durations.push_back(note[1]);               \
+        }                                                       \
+        shipped.stream.assign(stream, stream + sizeof(stream)); \
+        return shipped;                                         \
+    }(),
+
+const std::vector<shipped_song> shipped_songs = {SONG_STREAM_LIST(SHIPPED_SONG)};
+
+std::vector<song_note_t> decode(const uint8_t *data) {
+    song_stream_t            stream;
+    song_note_t              note;
+    std::vector<song_note_t> notes;
+    song_stream_begin(&stream, data);
+    while (song_stream_next(&stream, &note)) {
+        notes.push_back(note);
+    }
+    return notes;
+}
+
+} // namespace
+
+TEST(SongStream, FrequenciesMatchNotes) {
+    const float notes[] = {NOTE_C0, NOTE_CS0, NOTE_D0, NOTE_DS0, NOTE_E0, NOTE_F0, NOTE_FS0, NOTE_G0, NOTE_GS0, NOTE_A0, NOTE_AS0, NOTE_B0, NOTE_C1, NOTE_CS1, NOTE_D1, NOTE_DS1, NOTE_E1, NOTE_F1, NOTE_FS1, NOTE_G1, NOTE_GS1, NOTE_A1, NOTE_AS1, NOTE_B1, NOTE_C2, NOTE_CS2, NOTE_D2, NOTE_DS2, NOTE_E2, NOTE_F2, NOTE_FS2, NOTE_G2, NOTE_GS2, NOTE_A2, NOTE_AS2, NOTE_B2, NOTE_C3, NOTE_CS3, NOTE_D3, NOTE_DS3, NOTE_E3, NOTE_F3, NOTE_FS3, NOTE_G3, NOTE_GS3, NOTE_A3, NOTE_AS3, NOTE_B3, NOTE_C4, NOTE_CS4, NOTE_D4, NOTE_DS4, NOTE_E4, NOTE_F4, NOTE_FS4, NOTE_G4, NOTE_GS4, NOTE_A4, NOTE_AS4, NOTE_B4, NOTE_C5, NOTE_CS5, NOTE_D5, NOTE_DS5, NOTE_E5, NOTE_F5, NOTE_FS5, NOTE_G5, NOTE_GS5, NOTE_A5, NOTE_AS5, NOTE_B5, NOTE_C6, NOTE_CS6, NOTE_D6, NOTE_DS6, NOTE_E6, NOTE_F6, NOTE_FS6, NOTE_G6, NOTE_GS6, NOTE_A6, NOTE_AS6, NOTE_B6, NOTE_C7, NOTE_CS7, NOTE_D7, NOTE_DS7, NOTE_E7, NOTE_F7, NOTE_FS7, NOTE_G7, NOTE_GS7, NOTE_A7, NOTE_AS7, NOTE_B7, NOTE_C8, NOTE_CS8, NOTE_D8, NOTE_DS8, NOTE_E8, NOTE_F8, NOTE_FS8, NOTE_G8, NOTE_GS8, NOTE_A8, NOTE_AS8, NOTE_B8};
+    static_assert(sizeof(notes) / sizeof(notes[0]) == SONG_STREAM_NOTES, "one frequency per semitone index");
+
+    EXPECT_EQ(song_stream_frequency(SONG_STREAM_REST), NOTE_REST);
+    for (int pitch = 1; pitch <= SONG_STREAM_NOTES; pitch++) {
+        EXPECT_NEAR(song_stream_frequency(pitch), notes[pitch - 1], 0.01) << "semitone " << pitch;
+    }
+    EXPECT_EQ(song_stream_frequency(SONG_STREAM_NOTES), NOTE_B8);
+    EXPECT_EQ(song_stream_frequency(58), NOTE_A4);
+}
+
+TEST(SongStream, DecodesFormat) {
+    const uint8_t data[] = {
+        // C4 for a quarter, a rest with the same duration, then E4 for longer than 255
+        49, 16, SONG_STREAM_REST | SONG_STREAM_SAME_DURATION, 53, SONG_STREAM_LONG_DURATION, 0x2C, 0x01,
+        // A4 and B4 eighths, played three times in total
+        58, 8, 60 | SONG_STREAM_SAME_DURATION, SONG_STREAM_REPEAT, 2, 3, 0,
+        // the eighth of the last repetition carries on
+        61 | SONG_STREAM_SAME_DURATION, SONG_STREAM_END};
+
+    auto notes = decode(data);
+    std::vector<std::pair<uint8_t, uint16_t>> expected = {{49, 16}, {0, 16}, {53, 300}, {58, 8}, {60, 8}, {58, 8}, {60, 8}, {58, 8}, {60, 8}, {61, 8}};
+    ASSERT_EQ(notes.size(), expected.size());
+    for (size_t i = 0; i < notes.size(); i++) {
+        EXPECT_EQ(notes[i].pitch, expected[i].first) << "note " << i;
+        EXPECT_EQ(notes[i].duration, expected[i].second) << "note " << i;
+    }
+}
+
+TEST(SongStream, EndIsSticky) {
+    const uint8_t data[] = {49, 16, SONG_STREAM_END};
+    song_stream_t stream;
+    song_note_t   note;
+
+    song_stream_begin(&stream, data);
+    EXPECT_TRUE(song_stream_next(&stream, &note));
+    EXPECT_FALSE(song_stream_next(&stream, &note));
+    EXPECT_FALSE(song_stream_next(&stream, &note));
+
+    song_stream_begin(&stream, data);
+    EXPECT_TRUE(song_stream_next(&stream, &note));
+    EXPECT_EQ(note.pitch, 49);
+}
+
+TEST(SongStream, ShippedSongsDecodeIdentically) {
+    ASSERT_FALSE(shipped_songs.empty());
+    for (auto &song : shipped_songs) {
+        SCOPED_TRACE(song.name);
+        auto notes = decode(song.stream.data());
+        ASSERT_EQ(notes.size(), song.pitches.size());
+        for (size_t i = 0; i < notes.size(); i++) {
+            EXPECT_EQ(notes[i].duration, song.durations[i]) << "note " << i;
+            EXPECT_NEAR(song_stream_frequency(notes[i].pitch), song.pitches[i], 0.01) << "note " << i;
+            // same frequency in the SONG array, same semitone in the stream, which the player relies on
+            if (i > 0) {
+                EXPECT_EQ(notes[i].pitch == notes[i - 1].pitch, song.pitches[i] == song.pitches[i - 1]) << "note " << i;
+            }
+        }
+        EXPECT_LT(song.stream.size(), sizeof(float[2]) * song.pitches.size());
+    }
+}
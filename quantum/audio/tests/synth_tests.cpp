@@ -0,0 +1,146 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <cmath>
+#include <vector>
+
+extern "C" {
+#include "synth.h"
+}
+
+namespace {
+
+// Same rate as the DAC additive driver with its default sample rate
+constexpr uint32_t sample_rate = 16384 * 3 / 2;
+constexpr uint16_t sample_max  = 4095;
+
+// One period of a 12-bit sine, starting at 0 like the DAC driver's table
+struct sine_table {
+    uint16_t samples[SYNTH_WAVETABLE_SIZE];
+    sine_table() {
+        for (int i = 0; i < SYNTH_WAVETABLE_SIZE; i++) {
+            samples[i] = std::lround((1 - std::cos(2 * M_PI * i / SYNTH_WAVETABLE_SIZE)) * sample_max / 2);
+        }
+    }
+} const sine;
+
+// Amplitude of one frequency in a buffer, by correlation with a complex exponential
+double magnitude(const std::vector<uint16_t> &buffer, double frequency) {
+    double re = 0, im = 0;
+    for (size_t n = 0; n < buffer.size(); n++) {
+        double angle = 2 * M_PI * frequency * n / sample_rate;
+        re += buffer[n] * std::cos(angle);
+        im -= buffer[n] * std::sin(angle);
+    }
+    return 2 * std::hypot(re, im) / buffer.size();
+}
+
+// One second of audio, so that every integer frequency falls exactly on a bin
+std::vector<uint16_t> render(const std::vector<float> &frequencies) {
+    synth_t synth;
+    synth_init(&synth, sine.samples, sample_rate);
+    for (float frequency : frequencies) {
+        EXPECT_TRUE(synth_add_tone(&synth, frequency));
+    }
+    std::vector<uint16_t> buffer(sample_rate);
+    synth_render(&synth, buffer.data(), buffer.size());
+    return buffer;
+}
+
+// The floating point synthesis the DAC additive driver used to do, as a reference
+std::vector<uint16_t> render_float_reference(const std::vector<float> &frequencies) {
+    std::vector<float>    index(frequencies.size(), 0.0f);
+    std::vector<uint16_t> buffer(sample_rate);
+    for (auto &sample : buffer) {
+        uint16_t value = 0;
+        for (size_t i = 0; i < frequencies.size(); i++) {
+            index[i] = std::fmod(index[i] + frequencies[i] * SYNTH_WAVETABLE_SIZE / sample_rate, (float)SYNTH_WAVETABLE_SIZE);
+            value += sine.samples[(uint16_t)index[i]] / frequencies.size();
+        }
+        sample = value;
+    }
+    return buffer;
+}
+
+} // namespace
+
+TEST(AudioSynth, PhaseIncrementIsAccurate) {
+    for (float frequency : {27.5f, 440.0f, 1046.5f, 7902.13f}) {
+        double played = (double)synth_phase_increment(frequency, sample_rate) * sample_rate / 4294967296.0;
+        EXPECT_NEAR(played, frequency, 0.01) << frequency << " Hz";
+    }
+}
+
+TEST(AudioSynth, SilentWithoutTones) {
+    synth_t synth;
+    synth_init(&synth, sine.samples, sample_rate);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(synth_sample(&synth), 0);
+    }
+}
+
+TEST(AudioSynth, SingleToneSpectrum) {
+    auto buffer = render({440});
+
+    double peak = magnitude(buffer, 440);
+    EXPECT_NEAR(peak, sample_max / 2, sample_max / 100);
+    for (double other : {220.0, 430.0, 450.0, 880.0, 1320.0, 3000.0}) {
+        EXPECT_LT(magnitude(buffer, other), peak / 100) << other << " Hz";
+    }
+}
+
+TEST(AudioSynth, ChordSpectrum) {
+    auto buffer = render({440, 554, 659});
+
+    for (double tone : {440.0, 554.0, 659.0}) {
+        EXPECT_NEAR(magnitude(buffer, tone), sample_max / 2 / 3.0, sample_max / 100) << tone << " Hz";
+    }
+    for (double other : {220.0, 500.0, 600.0, 880.0, 1108.0}) {
+        EXPECT_LT(magnitude(buffer, other), sample_max / 200) << other << " Hz";
+    }
+}
+
+TEST(AudioSynth, MatchesFloatReference) {
+    for (auto frequencies : std::vector<std::vector<float>>{{261}, {440, 880}, {330, 415, 494, 659}}) {
+        auto buffer    = render(frequencies);
+        auto reference = render_float_reference(frequencies);
+        for (double tone = 100; tone < 2000; tone += 7) {
+            EXPECT_NEAR(magnitude(buffer, tone), magnitude(reference, tone), sample_max / 200) << tone << " Hz";
+        }
+    }
+}
+
+TEST(AudioSynth, MixingNeverClips) {
+    synth_t synth;
+    synth_init(&synth, sine.samples, sample_rate);
+    for (int i = 0; i < SYNTH_MAX_TONES; i++) {
+        EXPECT_TRUE(synth_add_tone(&synth, 110.0f * (i + 1)));
+    }
+    EXPECT_FALSE(synth_add_tone(&synth, 1000.0f));
+
+    uint16_t highest = 0;
+    for (int i = 0; i < (int)sample_rate; i++) {
+        highest = std::max(highest, synth_sample(&synth));
+    }
+    EXPECT_LE(highest, sample_max);
+    EXPECT_GT(highest, sample_max / 2);
+}
+
+TEST(AudioSynth, ChangingTonesKeepsPhase) {
+    synth_t synth;
+    synth_init(&synth, sine.samples, sample_rate);
+    synth_add_tone(&synth, 440);
+    for (int i = 0; i < 1000; i++) {
+        synth_sample(&synth);
+    }
+    uint32_t phase = synth.phase[0];
+
+    synth_clear_tones(&synth);
+    synth_add_tone(&synth, 440);
+    synth_add_tone(&synth, 660);
+    EXPECT_EQ(synth.phase[0], phase);
+
+    synth_reset_phases(&synth);
+    EXPECT_EQ(synth.phase[0], 0);
+}
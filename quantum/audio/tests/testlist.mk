@@ -0,0 +1 @@
+TEST_LIST += audio_synth audio_song_stream
@@ -47,16 +47,22 @@ void voice_deiterate(void) {
 }
 
 #ifdef AUDIO_VOICES
-float mod(float a, int b) {
-    float r = fmod(a, b);
-    return r < 0 ? r + b : r;
-}
+// vibrato_lut raised to the power of vibrato_strength, only recomputed when the strength changes
+static float vibrato_strength_lut[VIBRATO_LUT_LENGTH];
+static float vibrato_strength_lut_strength = -1;
 
 // Effect: 'vibrate' a given target frequency slightly above/below its initial value
 float voice_add_vibrato(float average_freq) {
-    float vibrato_counter = mod(timer_read() / (100 * vibrato_rate), VIBRATO_LUT_LENGTH);
+    if (vibrato_strength != vibrato_strength_lut_strength) {
+        for (uint8_t i = 0; i < VIBRATO_LUT_LENGTH; i++) {
+            vibrato_strength_lut[i] = pow(vibrato_lut[i], vibrato_strength);
+        }
+        vibrato_strength_lut_strength = vibrato_strength;
+    }
+
+    uint32_t vibrato_counter = (uint32_t)(timer_read() / (100 * vibrato_rate)) % VIBRATO_LUT_LENGTH;
 
-    return average_freq * pow(vibrato_lut[(int)vibrato_counter], vibrato_strength);
+    return average_freq * vibrato_strength_lut[vibrato_counter];
 }
 
 // Effect: 'slides' the 'frequency' from the starting-point, to the target frequency
@@ -204,7 +210,8 @@ float voice_envelope(float frequency) {
                     break;
 
                 case 20 ... 200:
-                    note_timbre = 12 - (uint8_t)(pow(((float)compensated_index - 20) / (200 - 20), 2) * 12.5);
+                    // 12.5 * ((compensated_index - 20) / (200 - 20))^2, in integers
+                    note_timbre = 12 - (uint8_t)((uint32_t)(compensated_index - 20) * (compensated_index - 20) * 25 / (2UL * (200 - 20) * (200 - 20)));
                     break;
 
                 default:
@@ -266,7 +273,7 @@ float voice_envelope(float frequency) {
                     break;
                 default:
                     // TODO: merge/replace with voice_add_vibrato above
-                    frequency = frequency * vibrato_lut[(int)fmod((((float)compensated_index - (VOICE_VIBRATO_DELAY + 1)) / 1000 * VOICE_VIBRATO_SPEED), VIBRATO_LUT_LENGTH)];
+                    frequency = frequency * vibrato_lut[(compensated_index - (VOICE_VIBRATO_DELAY + 1)) * VOICE_VIBRATO_SPEED / 1000 % VIBRATO_LUT_LENGTH];
                     break;
             }
             break;
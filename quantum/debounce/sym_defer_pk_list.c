@@ -0,0 +1,176 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key algorithm with the same timing as sym_defer_pk, using statically sized storage.
+When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+
+Only keys which are currently bouncing are tracked, in a list of up to DEBOUNCE_ACTIVE_KEYS
+entries holding the time at which each key expires. The earliest expiry is cached, so a scan
+with no matrix changes returns immediately until something is due, and otherwise the work per
+scan is proportional to the number of bouncing keys rather than the size of the matrix.
+
+If more keys are bouncing than the list can hold, the remainder share a single timer which is
+restarted whenever another of them changes, in the same manner as sym_defer_g.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#ifndef DEBOUNCE_ACTIVE_KEYS
+#    define DEBOUNCE_ACTIVE_KEYS 16
+#endif
+
+#if DEBOUNCE_ACTIVE_KEYS > UINT8_MAX
+#    error DEBOUNCE_ACTIVE_KEYS must be no more than 255
+#endif
+
+typedef struct {
+    matrix_row_t mask;
+    fast_timer_t expiry;
+    uint8_t      row;
+} debounce_active_key_t;
+
+#if DEBOUNCE > 0
+static debounce_active_key_t active_keys[DEBOUNCE_ACTIVE_KEYS];
+static uint8_t               active_count;
+static matrix_row_t          active_mask[MATRIX_ROWS];
+static matrix_row_t          overflow_mask[MATRIX_ROWS];
+static bool                  overflow_pending;
+static fast_timer_t          overflow_expiry;
+static fast_timer_t          next_expiry;
+static bool                  cooked_changed;
+
+static void transfer_expired_keys(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, fast_timer_t now);
+static void start_debounce_timers(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, fast_timer_t now);
+static void update_next_expiry(void);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        active_mask[row]   = 0;
+        overflow_mask[row] = 0;
+    }
+    active_count     = 0;
+    overflow_pending = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    cooked_changed = false;
+
+    // Nothing is bouncing, or nothing is due yet
+    if (!changed && (!(active_count || overflow_pending) || !timer_expired_fast(timer_read_fast(), next_expiry))) {
+        return false;
+    }
+
+    fast_timer_t now = timer_read_fast();
+    if (active_count || overflow_pending) {
+        transfer_expired_keys(raw, cooked, num_rows, now);
+    }
+
+    if (changed) {
+        start_debounce_timers(raw, cooked, num_rows, now);
+    }
+
+    update_next_expiry();
+    return cooked_changed;
+}
+
+static void transfer_key(matrix_row_t raw[], matrix_row_t cooked[], uint8_t row, matrix_row_t mask) {
+    matrix_row_t cooked_next = (cooked[row] & ~mask) | (raw[row] & mask);
+    cooked_changed |= cooked[row] ^ cooked_next;
+    cooked[row] = cooked_next;
+}
+
+static void transfer_expired_keys(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, fast_timer_t now) {
+    for (uint8_t i = 0; i < active_count;) {
+        debounce_active_key_t *key = &active_keys[i];
+        if (timer_expired_fast(now, key->expiry)) {
+            transfer_key(raw, cooked, key->row, key->mask);
+            active_mask[key->row] &= ~key->mask;
+            // Order is unimportant, so fill the gap with the last entry
+            *key = active_keys[--active_count];
+        } else {
+            i++;
+        }
+    }
+
+    if (overflow_pending && timer_expired_fast(now, overflow_expiry)) {
+        for (uint8_t row = 0; row < num_rows; row++) {
+            if (overflow_mask[row]) {
+                transfer_key(raw, cooked, row, overflow_mask[row]);
+                overflow_mask[row] = 0;
+            }
+        }
+        overflow_pending = false;
+    }
+}
+
+static void start_debounce_timers(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, fast_timer_t now) {
+    // Keys which have returned to their debounced state stop bouncing
+    for (uint8_t i = 0; i < active_count;) {
+        debounce_active_key_t *key = &active_keys[i];
+        if (!((raw[key->row] ^ cooked[key->row]) & key->mask)) {
+            active_mask[key->row] &= ~key->mask;
+            *key = active_keys[--active_count];
+        } else {
+            i++;
+        }
+    }
+
+    bool overflow_remaining = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t delta = raw[row] ^ cooked[row];
+        overflow_mask[row] &= delta;
+
+        // Keys which differ start bouncing if they weren't already
+        matrix_row_t start = delta & ~(active_mask[row] | overflow_mask[row]);
+        while (start) {
+            // Isolate the lowest set bit
+            matrix_row_t mask = start & (~start + 1);
+            start &= ~mask;
+
+            if (active_count < DEBOUNCE_ACTIVE_KEYS) {
+                active_keys[active_count++] = (debounce_active_key_t){.mask = mask, .expiry = now + DEBOUNCE, .row = row};
+                active_mask[row] |= mask;
+            } else {
+                overflow_mask[row] |= mask;
+                overflow_expiry = now + DEBOUNCE;
+            }
+        }
+
+        if (overflow_mask[row]) {
+            overflow_remaining = true;
+        }
+    }
+    overflow_pending = overflow_remaining;
+}
+
+static void update_next_expiry(void) {
+    bool found = false;
+    for (uint8_t i = 0; i < active_count; i++) {
+        if (!found || timer_expired_fast(next_expiry, active_keys[i].expiry)) {
+            next_expiry = active_keys[i].expiry;
+            found       = true;
+        }
+    }
+    if (overflow_pending && (!found || timer_expired_fast(next_expiry, overflow_expiry))) {
+        next_expiry = overflow_expiry;
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,166 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key algorithm using vertical counters, with the same timing as sym_defer_pk.
+When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+
+Rather than an 8-bit counter per key, each row has DEBOUNCE_COUNTER_BITS bitplanes of
+matrix_row_t. Bit n of plane i is bit i of the counter for column n, so the counters for
+an entire row are updated with a handful of bitwise operations, independent of the number
+of columns. No memory is allocated at runtime.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Number of bitplanes needed to hold a counter value of DEBOUNCE
+#if DEBOUNCE < 4
+#    define DEBOUNCE_COUNTER_BITS 2
+#elif DEBOUNCE < 8
+#    define DEBOUNCE_COUNTER_BITS 3
+#elif DEBOUNCE < 16
+#    define DEBOUNCE_COUNTER_BITS 4
+#elif DEBOUNCE < 32
+#    define DEBOUNCE_COUNTER_BITS 5
+#elif DEBOUNCE < 64
+#    define DEBOUNCE_COUNTER_BITS 6
+#elif DEBOUNCE < 128
+#    define DEBOUNCE_COUNTER_BITS 7
+#else
+#    define DEBOUNCE_COUNTER_BITS 8
+#endif
+
+// Expands bit `bit` of `value` into a full row mask
+#define PLANE_MASK(value, bit) ((((value) >> (bit)) & 1) ? (matrix_row_t)~(matrix_row_t)0 : (matrix_row_t)0)
+
+#if DEBOUNCE > 0
+static matrix_row_t debounce_planes[MATRIX_ROWS][DEBOUNCE_COUNTER_BITS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        for (uint8_t i = 0; i < DEBOUNCE_COUNTER_BITS; i++) {
+            debounce_planes[row][i] = 0;
+        }
+    }
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *planes = debounce_planes[row];
+        matrix_row_t  active = 0;
+        for (uint8_t i = 0; i < DEBOUNCE_COUNTER_BITS; i++) {
+            active |= planes[i];
+        }
+        if (!active) {
+            continue;
+        }
+
+        matrix_row_t expired;
+        if (elapsed_time >= DEBOUNCE) {
+            // Every running counter is at most DEBOUNCE
+            expired = active;
+        } else {
+            // Subtract elapsed_time from every running counter in the row, tracking borrows per column
+            matrix_row_t borrow    = 0;
+            matrix_row_t remaining = 0;
+            for (uint8_t i = 0; i < DEBOUNCE_COUNTER_BITS; i++) {
+                matrix_row_t a = planes[i];
+                matrix_row_t e = PLANE_MASK(elapsed_time, i) & active;
+                matrix_row_t d = a ^ e ^ borrow;
+                borrow         = (~a & e) | (~(a ^ e) & borrow);
+                planes[i]      = d;
+                remaining |= d;
+            }
+            // Counters which reached or passed zero have expired
+            expired = active & (borrow | ~remaining);
+        }
+
+        if (expired) {
+            for (uint8_t i = 0; i < DEBOUNCE_COUNTER_BITS; i++) {
+                planes[i] &= ~expired;
+            }
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+        if (active & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *planes = debounce_planes[row];
+        matrix_row_t  delta  = raw[row] ^ cooked[row];
+        matrix_row_t  active = 0;
+        for (uint8_t i = 0; i < DEBOUNCE_COUNTER_BITS; i++) {
+            active |= planes[i];
+        }
+
+        // Keys which differ start counting if they weren't already, all others are reset
+        matrix_row_t start = delta & ~active;
+        for (uint8_t i = 0; i < DEBOUNCE_COUNTER_BITS; i++) {
+            planes[i] = (planes[i] & delta) | (start & PLANE_MASK(DEBOUNCE, i));
+        }
+        if (delta) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,388 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+extern "C" {
+#include "debounce.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+TEST_F(DebounceTest, OneKeyShort1) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        /* 0ms delay (fast scan rate) */
+        {5, {{0, 1, UP}}, {}},
+
+        {10, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyShort2) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        /* 1ms delay */
+        {6, {{0, 1, UP}}, {}},
+
+        {11, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyShort3) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        /* 2ms delay */
+        {7, {{0, 1, UP}}, {}},
+
+        {12, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyTooQuick1) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        /* Release key exactly on the debounce time */
+        {5, {{0, 1, UP}}, {}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyTooQuick2) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        {6, {{0, 1, UP}}, {}},
+
+        /* Press key exactly on the debounce time */
+        {11, {{0, 1, DOWN}}, {}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyBouncing1) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {1, {{0, 1, UP}}, {}},
+        {2, {{0, 1, DOWN}}, {}},
+        {3, {{0, 1, UP}}, {}},
+        {4, {{0, 1, DOWN}}, {}},
+        {5, {{0, 1, UP}}, {}},
+        {6, {{0, 1, DOWN}}, {}},
+        {11, {}, {{0, 1, DOWN}}}, /* 5ms after DOWN at time 7 */
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyBouncing2) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {5, {}, {{0, 1, DOWN}}},
+        {6, {{0, 1, UP}}, {}},
+        {7, {{0, 1, DOWN}}, {}},
+        {8, {{0, 1, UP}}, {}},
+        {9, {{0, 1, DOWN}}, {}},
+        {10, {{0, 1, UP}}, {}},
+        {15, {}, {{0, 1, UP}}}, /* 5ms after UP at time 10 */
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyLong) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+
+        {25, {{0, 1, UP}}, {}},
+
+        {30, {}, {{0, 1, UP}}},
+
+        {50, {{0, 1, DOWN}}, {}},
+
+        {55, {}, {{0, 1, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, TwoKeysShort) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {1, {{0, 2, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        {6, {}, {{0, 2, DOWN}}},
+
+        {7, {{0, 1, UP}}, {}},
+        {8, {{0, 2, UP}}, {}},
+
+        {12, {}, {{0, 1, UP}}},
+        {13, {}, {{0, 2, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, TwoKeysSimultaneous1) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}, {0, 2, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}, {0, 2, DOWN}}},
+        {6, {{0, 1, UP}, {0, 2, UP}}, {}},
+
+        {11, {}, {{0, 1, UP}, {0, 2, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, TwoKeysSimultaneous2) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {1, {{0, 2, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        {6, {{0, 1, UP}}, {{0, 2, DOWN}}},
+        {7, {{0, 2, UP}}, {}},
+
+        {11, {}, {{0, 1, UP}}},
+        {12, {}, {{0, 2, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyDelayedScan1) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+
+        /* Processing is very late */
+        {300, {}, {{0, 1, DOWN}}},
+        /* Immediately release key */
+        {300, {{0, 1, UP}}, {}},
+
+        {305, {}, {{0, 1, UP}}},
+    });
+    time_jumps_ = true;
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyDelayedScan2) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+
+        /* Processing is very late */
+        {300, {}, {{0, 1, DOWN}}},
+        /* Release key after 1ms */
+        {301, {{0, 1, UP}}, {}},
+
+        {306, {}, {{0, 1, UP}}},
+    });
+    time_jumps_ = true;
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyDelayedScan3) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+
+        /* Release key before debounce expires */
+        {300, {{0, 1, UP}}, {}},
+    });
+    time_jumps_ = true;
+    runEvents();
+}
+
+TEST_F(DebounceTest, OneKeyDelayedScan4) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+
+        /* Processing is a bit late */
+        {50, {}, {{0, 1, DOWN}}},
+        /* Release key after 1ms */
+        {51, {{0, 1, UP}}, {}},
+
+        {56, {}, {{0, 1, UP}}},
+    });
+    time_jumps_ = true;
+    runEvents();
+}
+
+/* Reference model of the sym_defer_pk per-key counters, used to check equivalence */
+class SymDeferPkModel {
+   public:
+    void init() {
+        for (auto &row : counters_) {
+            std::fill(std::begin(row), std::end(row), 0);
+        }
+        need_update_ = false;
+    }
+
+    bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+        bool updated_last = false;
+        bool cooked_changed = false;
+
+        if (need_update_) {
+            fast_timer_t now     = timer_read_fast();
+            fast_timer_t elapsed = std::min<fast_timer_t>(TIMER_DIFF_FAST(now, last_time_), UINT8_MAX);
+
+            last_time_   = now;
+            updated_last = true;
+            if (elapsed > 0) {
+                need_update_ = false;
+                for (int row = 0; row < MATRIX_ROWS; row++) {
+                    for (int col = 0; col < MATRIX_COLS; col++) {
+                        uint8_t &counter = counters_[row][col];
+                        if (counter == 0) {
+                            continue;
+                        }
+                        if (counter <= elapsed) {
+                            counter                  = 0;
+                            matrix_row_t mask        = (matrix_row_t)1 << col;
+                            matrix_row_t cooked_next = (cooked[row] & ~mask) | (raw[row] & mask);
+                            cooked_changed |= cooked[row] != cooked_next;
+                            cooked[row] = cooked_next;
+                        } else {
+                            counter -= elapsed;
+                            need_update_ = true;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (changed) {
+            if (!updated_last) {
+                last_time_ = timer_read_fast();
+            }
+            for (int row = 0; row < MATRIX_ROWS; row++) {
+                matrix_row_t delta = raw[row] ^ cooked[row];
+                for (int col = 0; col < MATRIX_COLS; col++) {
+                    uint8_t &counter = counters_[row][col];
+                    if (delta & ((matrix_row_t)1 << col)) {
+                        if (counter == 0) {
+                            counter      = DEBOUNCE;
+                            need_update_ = true;
+                        }
+                    } else {
+                        counter = 0;
+                    }
+                }
+            }
+        }
+
+        return cooked_changed;
+    }
+
+   private:
+    uint8_t      counters_[MATRIX_ROWS][MATRIX_COLS];
+    fast_timer_t last_time_;
+    bool         need_update_;
+};
+
+/* Randomly bouncing keys with irregular scan intervals must produce identical output to sym_defer_pk */
+TEST(DebounceVerticalCounter, EquivalentToSymDeferPk) {
+    std::mt19937                            rng(0x5eed);
+    std::uniform_int_distribution<int>      percent(0, 99);
+    std::uniform_int_distribution<int>      row_dist(0, MATRIX_ROWS - 1);
+    std::uniform_int_distribution<int>      col_dist(0, MATRIX_COLS - 1);
+    std::uniform_int_distribution<uint32_t> delay(0, DEBOUNCE + 2);
+
+    SymDeferPkModel model;
+    matrix_row_t    input[MATRIX_ROWS]        = {0};
+    matrix_row_t    raw[MATRIX_ROWS]          = {0};
+    matrix_row_t    cooked[MATRIX_ROWS]       = {0};
+    matrix_row_t    model_cooked[MATRIX_ROWS] = {0};
+
+    set_time(7777);
+    debounce_init(MATRIX_ROWS);
+    model.init();
+
+    for (int i = 0; i < 200000; i++) {
+        bool changed = false;
+        if (percent(rng) < 30) {
+            /* Toggle one or more keys, sometimes several in the same row */
+            int flips = 1 + percent(rng) / 40;
+            for (int f = 0; f < flips; f++) {
+                input[row_dist(rng)] ^= (matrix_row_t)1 << col_dist(rng);
+            }
+            changed = true;
+        }
+
+        std::copy(std::begin(input), std::end(input), std::begin(raw));
+        bool model_changed = model.debounce(raw, model_cooked, changed);
+        bool actual        = debounce(raw, cooked, MATRIX_ROWS, changed);
+
+        ASSERT_EQ(actual, model_changed) << "cooked_changed mismatch at iteration " << i;
+        for (int row = 0; row < MATRIX_ROWS; row++) {
+            ASSERT_EQ(cooked[row], model_cooked[row]) << "cooked matrix mismatch at iteration " << i << " row " << row;
+        }
+
+        /* Mostly 1ms scans, with occasional repeated scans and long stalls */
+        int p = percent(rng);
+        advance_time(p < 10 ? 0 : p < 95 ? 1 : p < 99 ? delay(rng) : 300);
+    }
+
+    debounce_free();
+}
+
+/* Compare the cost of a matrix scan with several keys bouncing against the per-key counter loop */
+TEST(DebounceVerticalCounter, Benchmark) {
+    constexpr int iterations = 1000000;
+    matrix_row_t  raw[MATRIX_ROWS];
+    matrix_row_t  cooked[MATRIX_ROWS] = {0};
+
+    auto run = [&](auto &&fn) {
+        set_time(7777);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            /* Keep a few keys permanently bouncing so the counters are always running */
+            for (int row = 0; row < MATRIX_ROWS; row++) {
+                raw[row] = (i & 2) ? (matrix_row_t)0x5 << row : 0;
+            }
+            fn(raw, cooked, (i & 1) == 0);
+            advance_time(1);
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+    };
+
+    debounce_init(MATRIX_ROWS);
+    double vertical = run([](matrix_row_t raw[], matrix_row_t cooked[], bool changed) { debounce(raw, cooked, MATRIX_ROWS, changed); });
+    debounce_free();
+
+    SymDeferPkModel model;
+    model.init();
+    std::fill(std::begin(cooked), std::end(cooked), 0);
+    double per_key = run([&model](matrix_row_t raw[], matrix_row_t cooked[], bool changed) { model.debounce(raw, cooked, changed); });
+
+    std::cout << "[ BENCHMARK] " << MATRIX_ROWS << "x" << MATRIX_COLS << " matrix: vertical counters " << vertical << " ns/scan, per-key counters " << per_key << " ns/scan" << std::endl;
+}
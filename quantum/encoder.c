@@ -19,6 +19,7 @@
 #include "keyboard.h"
 #include "action.h"
 #include "keycodes.h"
+#include "timer.h"
 #include "wait.h"
 
 #ifdef SPLIT_KEYBOARD
@@ -33,6 +34,27 @@
 #    define ENCODER_MAP_KEY_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef ENCODER_MAP_ENABLE
+#    ifndef ENCODER_MAP_QUEUE_SIZE
+#        define ENCODER_MAP_QUEUE_SIZE 16
+#    endif
+#    if ENCODER_MAP_QUEUE_SIZE > 127
+#        error "ENCODER_MAP_QUEUE_SIZE must not exceed 127"
+#    endif
+#    if defined(ENCODER_MAP_ACCELERATION_TERM) && !defined(ENCODER_MAP_ACCELERATION_STEPS)
+#        define ENCODER_MAP_ACCELERATION_STEPS 2
+#    endif
+#endif
+
+#ifdef ENCODER_INTERRUPT_QUEUE
+#    ifndef ENCODER_INTERRUPT_QUEUE_SIZE
+#        define ENCODER_INTERRUPT_QUEUE_SIZE 16
+#    endif
+#    if ENCODER_INTERRUPT_QUEUE_SIZE > 128 || (ENCODER_INTERRUPT_QUEUE_SIZE & (ENCODER_INTERRUPT_QUEUE_SIZE - 1)) != 0
+#        error "ENCODER_INTERRUPT_QUEUE_SIZE must be a power of two, no larger than 128"
+#    endif
+#endif
+
 #if !defined(ENCODER_RESOLUTIONS) && !defined(ENCODER_RESOLUTION)
 #    define ENCODER_RESOLUTION 4
 #endif
@@ -59,9 +81,25 @@ static uint8_t encoder_resolutions[NUM_ENCODERS] = ENCODER_RESOLUTIONS;
 #endif
 static int8_t encoder_LUT[] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
 
-static uint8_t encoder_state[NUM_ENCODERS]            = {0};
-static int8_t  encoder_pulses[NUM_ENCODERS]           = {0};
-static bool    encoder_interrupt_update[NUM_ENCODERS] = {false};
+static uint8_t encoder_state[NUM_ENCODERS]  = {0};
+static int8_t  encoder_pulses[NUM_ENCODERS] = {0};
+
+#ifdef ENCODER_INTERRUPT_QUEUE
+// Pin states captured by encoder_interrupt_read(), waiting to be decoded by encoder_read(). Each queue has a single
+// producer (the encoder's pin-change interrupt) and a single consumer (the main loop), so no locking is needed: the
+// interrupt only ever writes `head`, the main loop only ever writes `tail`, and both are free-running counters.
+typedef struct encoder_interrupt_queue_t {
+    volatile uint8_t states[ENCODER_INTERRUPT_QUEUE_SIZE];
+    volatile uint8_t head;      // written by the interrupt
+    volatile uint8_t tail;      // written by the main loop
+    volatile uint8_t overflows; // states dropped because the queue was full, saturating
+    uint8_t          last;      // last state seen, only used by the interrupt
+} encoder_interrupt_queue_t;
+
+static encoder_interrupt_queue_t encoder_interrupt_queue[NUM_ENCODERS_MAX_PER_SIDE];
+#else
+static bool encoder_interrupt_update[NUM_ENCODERS] = {false};
+#endif // ENCODER_INTERRUPT_QUEUE
 
 // encoder counts
 static uint8_t thisCount;
@@ -74,6 +112,22 @@ static uint8_t thatCount;
 
 static uint8_t encoder_value[NUM_ENCODERS] = {0};
 
+#ifdef ENCODER_MAP_ENABLE
+typedef struct encoder_queue_t {
+    int8_t   steps;     // steps still to be sent, positive for clockwise
+    bool     pressed;   // whether the encoder's key is currently held
+    bool     released;  // whether the delay after the last release is still running
+    bool     clockwise; // direction of the key held
+    uint16_t timer;     // time of the last press or release
+#    ifdef ENCODER_MAP_ACCELERATION_TERM
+    int8_t   last_direction; // direction of the last detent, or 0 for none yet
+    uint16_t last_detent;    // time of the last detent
+#    endif
+} encoder_queue_t;
+
+static encoder_queue_t encoder_queue[NUM_ENCODERS] = {0};
+#endif // ENCODER_MAP_ENABLE
+
 __attribute__((weak)) void encoder_wait_pullup_charge(void) {
     wait_us(100);
 }
@@ -130,6 +184,9 @@ void encoder_init(void) {
     memset(encoder_value, 0, sizeof(encoder_value));
     memset(encoder_state, 0, sizeof(encoder_state));
     memset(encoder_pulses, 0, sizeof(encoder_pulses));
+#    ifdef ENCODER_MAP_ENABLE
+    memset(encoder_queue, 0, sizeof(encoder_queue));
+#    endif
     static const pin_t encoders_pad_a_left[] = ENCODERS_PAD_A;
     static const pin_t encoders_pad_b_left[] = ENCODERS_PAD_B;
     for (uint8_t i = 0; i < thisCount; i++) {
@@ -169,21 +226,66 @@ void encoder_init(void) {
     encoder_wait_pullup_charge();
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_state[i] = (readPin(encoders_pad_a[i]) << 0) | (readPin(encoders_pad_b[i]) << 1);
+#ifdef ENCODER_INTERRUPT_QUEUE
+        encoder_interrupt_queue[i].head      = 0;
+        encoder_interrupt_queue[i].tail      = 0;
+        encoder_interrupt_queue[i].overflows = 0;
+        encoder_interrupt_queue[i].last      = encoder_state[i];
+#endif // ENCODER_INTERRUPT_QUEUE
     }
 }
 
 #ifdef ENCODER_MAP_ENABLE
+// Detents are only queued here, the key events are sent by encoder_exec_queue() so that scanning never blocks.
 static void encoder_exec_mapping(uint8_t index, bool clockwise) {
-    // The delays below cater for Windows and its wonderful requirements.
-    action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
-#    if ENCODER_MAP_KEY_DELAY > 0
-    wait_ms(ENCODER_MAP_KEY_DELAY);
-#    endif // ENCODER_MAP_KEY_DELAY > 0
+    encoder_queue_t *queue = &encoder_queue[index];
+    int8_t           steps = 1;
+
+#    ifdef ENCODER_MAP_ACCELERATION_TERM
+    // Spinning quickly in one direction sends several steps per detent
+    int8_t direction = clockwise ? 1 : -1;
+    if (queue->last_direction == direction && timer_elapsed(queue->last_detent) < ENCODER_MAP_ACCELERATION_TERM) {
+        steps = ENCODER_MAP_ACCELERATION_STEPS;
+    }
+    queue->last_direction = direction;
+    queue->last_detent    = timer_read();
+#    endif // ENCODER_MAP_ACCELERATION_TERM
+
+    // Steps in the opposite direction cancel out any that have not been sent yet, and a full queue drops the excess so
+    // that the knob never lags far behind once it stops.
+    int16_t queued = queue->steps + (clockwise ? steps : -steps);
+    queue->steps   = MAX(-ENCODER_MAP_QUEUE_SIZE, MIN(queued, ENCODER_MAP_QUEUE_SIZE));
+}
 
-    action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
+static void encoder_exec_queue(void) {
+    for (uint8_t index = 0; index < NUM_ENCODERS; index++) {
+        encoder_queue_t *queue = &encoder_queue[index];
+
+        // The delays below cater for Windows and its wonderful requirements.
+        if (queue->pressed || queue->released) {
 #    if ENCODER_MAP_KEY_DELAY > 0
-    wait_ms(ENCODER_MAP_KEY_DELAY);
+            if (timer_elapsed(queue->timer) < ENCODER_MAP_KEY_DELAY) {
+                continue;
+            }
 #    endif // ENCODER_MAP_KEY_DELAY > 0
+            if (queue->pressed) {
+                action_exec(queue->clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
+                queue->pressed  = false;
+                queue->released = true;
+                queue->timer    = timer_read();
+                continue;
+            }
+            queue->released = false;
+        }
+
+        if (queue->steps != 0) {
+            queue->clockwise = queue->steps > 0;
+            queue->steps += queue->clockwise ? -1 : 1;
+            action_exec(queue->clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
+            queue->pressed = true;
+            queue->timer   = timer_read();
+        }
+    }
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -248,6 +350,17 @@ static bool encoder_update(uint8_t index, uint8_t state) {
 bool encoder_read(void) {
     bool changed = false;
     for (uint8_t i = 0; i < thisCount; i++) {
+#ifdef ENCODER_INTERRUPT_QUEUE
+        // Decode every transition captured since the last call, however long the main loop took
+        encoder_interrupt_queue_t *queue = &encoder_interrupt_queue[i];
+        const uint8_t              head  = queue->head;
+        while (queue->tail != head) {
+            encoder_state[i] <<= 2;
+            encoder_state[i] |= queue->states[queue->tail % ENCODER_INTERRUPT_QUEUE_SIZE];
+            queue->tail++;
+            changed |= encoder_update(i, encoder_state[i]);
+        }
+#else
         uint8_t new_status = (readPin(encoders_pad_a[i]) << 0) | (readPin(encoders_pad_b[i]) << 1);
         if ((encoder_state[i] & 0x3) != new_status || encoder_interrupt_update[i]) {
             encoder_state[i] <<= 2;
@@ -255,16 +368,48 @@ bool encoder_read(void) {
             changed |= encoder_update(i, encoder_state[i]);
             encoder_interrupt_update[i] = false;
         }
+#endif // ENCODER_INTERRUPT_QUEUE
     }
+#ifdef ENCODER_MAP_ENABLE
+    encoder_exec_queue();
+#endif // ENCODER_MAP_ENABLE
     return changed;
 }
 
+#ifdef ENCODER_INTERRUPT_QUEUE
+void encoder_interrupt_read(uint8_t index) {
+    encoder_interrupt_queue_t *queue = &encoder_interrupt_queue[index];
+    uint8_t                    state = (readPin(encoders_pad_a[index]) << 0) | (readPin(encoders_pad_b[index]) << 1);
+
+    // Interrupts for bounces that have already settled carry no transition
+    if (state == queue->last) {
+        return;
+    }
+
+    queue->last = state;
+    if ((uint8_t)(queue->head - queue->tail) >= ENCODER_INTERRUPT_QUEUE_SIZE) {
+        if (queue->overflows < UINT8_MAX) {
+            queue->overflows++;
+        }
+        return;
+    }
+
+    // The state must be stored before `head` is advanced, which the volatile accesses guarantee
+    queue->states[queue->head % ENCODER_INTERRUPT_QUEUE_SIZE] = state;
+    queue->head++;
+}
+
+uint8_t encoder_interrupt_overflows(uint8_t index) {
+    return encoder_interrupt_queue[index].overflows;
+}
+#else
 void encoder_interrupt_read(uint8_t index) {
     encoder_state[index] <<= 2;
     encoder_state[index] |= (readPin(encoders_pad_a[index]) << 0) | (readPin(encoders_pad_b[index]) << 1);
     encoder_pulses[index] += encoder_LUT[encoder_state[index] & 0xF];
     encoder_interrupt_update[index] = true;
 }
+#endif // ENCODER_INTERRUPT_QUEUE
 
 #ifdef SPLIT_KEYBOARD
 void last_encoder_activity_trigger(void);
@@ -29,6 +29,15 @@ bool encoder_update_kb(uint8_t index, bool clockwise);
 bool encoder_update_user(uint8_t index, bool clockwise);
 void encoder_interrupt_read(uint8_t index);
 
+#ifdef ENCODER_INTERRUPT_QUEUE
+/**
+ * @brief Number of pin states dropped by encoder_interrupt_read() because the encoder's queue was full
+ *
+ * Saturates at 255. A non-zero count means ENCODER_INTERRUPT_QUEUE_SIZE is too small for the time the main loop takes.
+ */
+uint8_t encoder_interrupt_overflows(uint8_t index);
+#endif // ENCODER_INTERRUPT_QUEUE
+
 #ifdef SPLIT_KEYBOARD
 
 void encoder_state_raw(uint8_t* slave_state);
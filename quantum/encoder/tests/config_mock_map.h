@@ -0,0 +1,27 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 1
+#define MATRIX_COLS 1
+
+/* Here, "pins" from 0 to 31 are allowed. */
+#define ENCODERS_PAD_A \
+    { 0, 2 }
+#define ENCODERS_PAD_B \
+    { 1, 3 }
+
+#define ENCODER_MAP_KEY_DELAY 10
+#define ENCODER_MAP_QUEUE_SIZE 8
+#define ENCODER_MAP_ACCELERATION_TERM 15
+#define ENCODER_MAP_ACCELERATION_STEPS 3
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock.h"
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,139 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <random>
+
+extern "C" {
+#include "encoder.h"
+#include "encoder/tests/mock.h"
+}
+
+// NUM_ENCODERS relies on ARRAY_SIZE, which is not available in C++
+#define NUM_TEST_ENCODERS 2
+
+int cw_steps[NUM_TEST_ENCODERS];
+int ccw_steps[NUM_TEST_ENCODERS];
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    (clockwise ? cw_steps : ccw_steps)[index]++;
+    return true;
+}
+
+// Quadrature states of pins A and B in the order the encoder passes through them when turned clockwise
+const uint8_t gray[4] = {0b00, 0b01, 0b11, 0b10};
+
+class EncoderInterruptTest : public ::testing::Test {
+   protected:
+    int position[NUM_TEST_ENCODERS];
+
+    void SetUp() override {
+        for (uint8_t i = 0; i < NUM_TEST_ENCODERS; i++) {
+            cw_steps[i]  = 0;
+            ccw_steps[i] = 0;
+            // The pins are pulled high, so the encoders start out resting in the last state
+            position[i] = 2;
+        }
+        encoder_init();
+    }
+
+    // Moves an encoder one quadrature transition, firing the pin-change interrupt for the pin that changed
+    void transition(uint8_t index, bool clockwise) {
+        position[index] += clockwise ? 1 : -1;
+        uint8_t state = gray[position[index] & 3];
+        setPin(index * 2, state & 1);
+        setPin(index * 2 + 1, state & 2);
+        encoder_interrupt_read(index);
+    }
+
+    // Every transition must have been decoded: the steps reported account for the position to within one detent
+    void expect_lossless(uint8_t index) {
+        int steps = cw_steps[index] - ccw_steps[index];
+        EXPECT_LT(abs(position[index] - 2 - 4 * steps), 4) << "encoder " << (int)index;
+        EXPECT_EQ(encoder_interrupt_overflows(index), 0) << "encoder " << (int)index;
+    }
+};
+
+TEST_F(EncoderInterruptTest, TestOneDetent) {
+    for (int i = 0; i < 4; i++) {
+        transition(0, true);
+    }
+    // Nothing is decoded until the main loop runs
+    EXPECT_EQ(cw_steps[0], 0);
+    EXPECT_TRUE(encoder_read());
+    EXPECT_EQ(cw_steps[0], 1);
+    EXPECT_EQ(ccw_steps[0], 0);
+    EXPECT_FALSE(encoder_read());
+}
+
+TEST_F(EncoderInterruptTest, TestSpuriousInterruptsAreIgnored) {
+    for (int i = 0; i < 4; i++) {
+        transition(0, false);
+        // Bounces that settle before the interrupt reads the pins leave nothing to decode
+        encoder_interrupt_read(0);
+        encoder_interrupt_read(0);
+    }
+    EXPECT_TRUE(encoder_read());
+    EXPECT_EQ(ccw_steps[0], 1);
+    expect_lossless(0);
+}
+
+TEST_F(EncoderInterruptTest, TestOverflowIsCounted) {
+    for (int i = 0; i < 8 + 5; i++) {
+        transition(1, true);
+    }
+    EXPECT_EQ(encoder_interrupt_overflows(1), 5);
+    EXPECT_EQ(encoder_interrupt_overflows(0), 0);
+
+    // The eight states that fit in the queue are still decoded
+    encoder_read();
+    EXPECT_EQ(cw_steps[1], 2);
+}
+
+TEST_F(EncoderInterruptTest, TestRandomTransitionsAreLossless) {
+    std::mt19937 rng(42);
+    for (int round = 0; round < 2000; round++) {
+        // The main loop runs late, but never so late that a queue fills up
+        int pending[NUM_TEST_ENCODERS] = {0};
+        int count                 = rng() % 24;
+        for (int i = 0; i < count; i++) {
+            uint8_t index = rng() % NUM_TEST_ENCODERS;
+            if (pending[index] == 8) {
+                continue;
+            }
+            pending[index]++;
+            // Mostly keep turning the same way, with the odd reversal and jitter
+            transition(index, (rng() % 8 != 0) == (round % 2 == 0));
+            if (rng() % 4 == 0) {
+                encoder_interrupt_read(index);
+            }
+        }
+        encoder_read();
+    }
+
+    for (uint8_t i = 0; i < NUM_TEST_ENCODERS; i++) {
+        expect_lossless(i);
+        EXPECT_GT(cw_steps[i] + ccw_steps[i], 100);
+    }
+}
+
+TEST_F(EncoderInterruptTest, TestOverflowRecovers) {
+    std::mt19937 rng(7);
+    // Spin far too fast for the main loop, dropping transitions
+    for (int i = 0; i < 40; i++) {
+        transition(0, true);
+    }
+    encoder_read();
+    EXPECT_GT(encoder_interrupt_overflows(0), 0);
+
+    // Once the main loop keeps up again, decoding carries on from where the queue left off
+    int steps = cw_steps[0] - ccw_steps[0];
+    int start = position[0];
+    for (int round = 0; round < 500; round++) {
+        for (int i = rng() % 8; i > 0; i--) {
+            transition(0, rng() % 2);
+        }
+        encoder_read();
+    }
+    EXPECT_LT(abs((position[0] - start) - 4 * (cw_steps[0] - ccw_steps[0] - steps)), 8);
+}
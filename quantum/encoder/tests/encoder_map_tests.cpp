@@ -0,0 +1,163 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <vector>
+
+extern "C" {
+#include "keyboard.h"
+#include "timer.h"
+#include "encoder/tests/mock.h"
+
+// encoder.h declares the encoder map using ARRAY_SIZE, which is not available in C++
+void encoder_init(void);
+bool encoder_read(void);
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct event {
+    uint8_t  index;
+    bool     clockwise;
+    bool     pressed;
+    uint16_t time;
+};
+
+std::vector<event> events;
+
+extern "C" void action_exec(keyevent_t event) {
+    events.push_back({event.key.col, event.type == ENCODER_CW_EVENT, event.pressed, event.time});
+}
+
+// Turns an encoder by one detent, reading the pins after each pulse
+void detent(uint8_t index, bool clockwise) {
+    pin_t first  = clockwise ? index * 2 : index * 2 + 1;
+    pin_t second = clockwise ? index * 2 + 1 : index * 2;
+    setPin(first, false);
+    encoder_read();
+    setPin(second, false);
+    encoder_read();
+    setPin(first, true);
+    encoder_read();
+    setPin(second, true);
+    encoder_read();
+}
+
+// Runs the scan loop every millisecond for the given time
+void scan(uint32_t ms) {
+    for (uint32_t i = 0; i < ms; i++) {
+        advance_time(1);
+        encoder_read();
+    }
+}
+
+class EncoderMapTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        events.clear();
+        set_time(1000);
+        encoder_init();
+    }
+};
+
+TEST_F(EncoderMapTest, TestOneDetentTaps) {
+    detent(0, true);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].index, 0);
+    EXPECT_EQ(events[0].clockwise, true);
+    EXPECT_EQ(events[0].pressed, true);
+
+    scan(9);
+    EXPECT_EQ(events.size(), 1);
+    scan(1);
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[1].clockwise, true);
+    EXPECT_EQ(events[1].pressed, false);
+    EXPECT_EQ(events[1].time - events[0].time, 10);
+}
+
+TEST_F(EncoderMapTest, TestDetentsDoNotBlock) {
+    // Detents arrive faster than taps can be sent, reading the encoder never waits for them
+    for (int i = 0; i < 4; i++) {
+        uint32_t before = timer_read32();
+        detent(0, false);
+        EXPECT_EQ(timer_read32(), before);
+        advance_time(16);
+    }
+    EXPECT_LT(events.size(), 8);
+
+    scan(100);
+    ASSERT_EQ(events.size(), 8);
+    for (size_t i = 0; i < events.size(); i++) {
+        EXPECT_EQ(events[i].clockwise, false);
+        EXPECT_EQ(events[i].pressed, i % 2 == 0);
+        if (i > 0) {
+            EXPECT_GE((uint16_t)(events[i].time - events[i - 1].time), 10);
+        }
+    }
+}
+
+TEST_F(EncoderMapTest, TestEncodersAreIndependent) {
+    detent(0, true);
+    detent(1, false);
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].index, 0);
+    EXPECT_EQ(events[0].clockwise, true);
+    EXPECT_EQ(events[1].index, 1);
+    EXPECT_EQ(events[1].clockwise, false);
+
+    scan(10);
+    ASSERT_EQ(events.size(), 4);
+    EXPECT_EQ(events[2].index, 0);
+    EXPECT_EQ(events[2].pressed, false);
+    EXPECT_EQ(events[3].index, 1);
+    EXPECT_EQ(events[3].pressed, false);
+}
+
+TEST_F(EncoderMapTest, TestAcceleration) {
+    // Slow turning sends a single step per detent
+    detent(0, true);
+    advance_time(20);
+    detent(0, true);
+    scan(100);
+    EXPECT_EQ(events.size(), 4);
+
+    // Quick turning in the same direction sends several
+    events.clear();
+    detent(0, true);
+    advance_time(5);
+    detent(0, true);
+    scan(200);
+    EXPECT_EQ(events.size(), 2 * (1 + 3));
+}
+
+TEST_F(EncoderMapTest, TestOppositeStepsCoalesce) {
+    // One step is sent straight away, then a quick spin queues three more
+    detent(0, true);
+    advance_time(5);
+    detent(0, true);
+    // Turning back quickly cancels out the queued steps, leaving one counter-clockwise step
+    advance_time(1);
+    detent(0, false);
+    advance_time(1);
+    detent(0, false);
+    scan(200);
+
+    ASSERT_EQ(events.size(), 4);
+    EXPECT_EQ(events[0].clockwise, true);
+    EXPECT_EQ(events[1].clockwise, true);
+    EXPECT_EQ(events[2].clockwise, false);
+    EXPECT_EQ(events[3].clockwise, false);
+}
+
+TEST_F(EncoderMapTest, TestQueueIsBounded) {
+    // A fast spin queues far more steps than the queue holds
+    for (int i = 0; i < 20; i++) {
+        detent(0, false);
+        advance_time(1);
+    }
+    scan(1000);
+    // The first step was sent straight away, the rest are capped at 8
+    EXPECT_EQ(events.size(), 2 * (1 + 8));
+}
@@ -66,3 +66,21 @@ encoder_split_role_SRC := \
 	$(QUANTUM_PATH)/encoder/tests/mock_split.c \
 	$(QUANTUM_PATH)/encoder/tests/encoder_tests_split_role.cpp \
 	$(QUANTUM_PATH)/encoder.c
+
+encoder_interrupt_DEFS := -DENCODER_TESTS -DENCODER_ENABLE -DENCODER_MOCK_SINGLE
+encoder_interrupt_CONFIG := $(QUANTUM_PATH)/encoder/tests/config_mock_interrupt.h
+
+encoder_interrupt_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/encoder/tests/mock.c \
+	$(QUANTUM_PATH)/encoder/tests/encoder_interrupt_tests.cpp \
+	$(QUANTUM_PATH)/encoder.c
+
+encoder_map_DEFS := -DENCODER_TESTS -DENCODER_ENABLE -DENCODER_MAP_ENABLE -DENCODER_MOCK_SINGLE -DNO_DEBUG -DNO_PRINT
+encoder_map_CONFIG := $(QUANTUM_PATH)/encoder/tests/config_mock_map.h
+
+encoder_map_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/encoder/tests/mock.c \
+	$(QUANTUM_PATH)/encoder/tests/encoder_map_tests.cpp \
+	$(QUANTUM_PATH)/encoder.c
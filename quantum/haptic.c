@@ -16,10 +16,12 @@
  */
 
 #include "haptic.h"
+#include "haptic_queue.h"
 #include "eeconfig.h"
 #include "debug.h"
 #include "usb_device_state.h"
 #include "gpio.h"
+#include "timer.h"
 
 #ifdef HAPTIC_DRV2605L
 #    include "drv2605l.h"
@@ -30,10 +32,13 @@
 
 #if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
 extern uint8_t split_haptic_play;
+extern uint8_t split_haptic_play_priority;
 #endif
 
 haptic_config_t haptic_config;
 
+static haptic_queue_t haptic_queue;
+
 static void update_haptic_enable_gpios(void) {
     if (haptic_config.enable && ((!HAPTIC_OFF_IN_LOW_POWER) || (usb_device_state == USB_DEVICE_STATE_CONFIGURED))) {
 #if defined(HAPTIC_ENABLE_PIN)
@@ -88,6 +93,7 @@ void haptic_init(void) {
     drv2605l_init();
     dprintf("DRV2605 driver initialized\n");
 #endif
+    haptic_queue_init(&haptic_queue);
     eeconfig_debug_haptic();
 #ifdef HAPTIC_ENABLE_PIN
     setPinOutput(HAPTIC_ENABLE_PIN);
@@ -97,7 +103,29 @@ void haptic_init(void) {
 #endif
 }
 
+static void haptic_play_now(haptic_event_t event) {
+#ifdef HAPTIC_DRV2605L
+    drv2605l_pulse(event.effect);
+#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
+    split_haptic_play = event.effect;
+#    endif
+#endif
+#ifdef HAPTIC_SOLENOID
+    solenoid_fire_handler();
+#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
+    split_haptic_play = 1;
+#    endif
+#endif
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
+    split_haptic_play_priority = event.priority;
+#endif
+}
+
 void haptic_task(void) {
+    haptic_event_t event;
+    if (haptic_queue_pop(&haptic_queue, timer_read32(), &event)) {
+        haptic_play_now(event);
+    }
 #ifdef HAPTIC_SOLENOID
     solenoid_check();
 #endif
@@ -321,23 +349,17 @@ void haptic_cont_decrease(void) {
 }
 
 void haptic_play(void) {
-#ifdef HAPTIC_DRV2605L
-    uint8_t play_eff = 0;
-    play_eff         = haptic_config.mode;
-    drv2605l_pulse(play_eff);
-#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
-    split_haptic_play = haptic_config.mode;
-#    endif
-#endif
-#ifdef HAPTIC_SOLENOID
-    solenoid_fire_handler();
-#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
-    split_haptic_play = 1;
-#    endif
-#endif
+    haptic_play_effect(haptic_config.mode, HAPTIC_DEFAULT_PRIORITY);
+}
+
+void haptic_play_effect(uint8_t effect, uint8_t priority) {
+    if (!haptic_queue_push(&haptic_queue, effect, priority)) {
+        dprintf("haptic effect %u dropped\n", effect);
+    }
 }
 
 void haptic_shutdown(void) {
+    haptic_queue_init(&haptic_queue);
 #ifdef HAPTIC_SOLENOID
     solenoid_shutdown();
 #endif
@@ -26,6 +26,9 @@
 #ifndef HAPTIC_DEFAULT_MODE
 #    define HAPTIC_DEFAULT_MODE DRV2605L_DEFAULT_MODE
 #endif
+#ifndef HAPTIC_DEFAULT_PRIORITY
+#    define HAPTIC_DEFAULT_PRIORITY 0
+#endif
 
 /* EEPROM config settings */
 typedef union {
@@ -77,6 +80,7 @@ void    haptic_cont_increase(void);
 void    haptic_cont_decrease(void);
 
 void haptic_play(void);
+void haptic_play_effect(uint8_t effect, uint8_t priority);
 void haptic_shutdown(void);
 void haptic_notify_usb_device_state_change(void);
 
@@ -0,0 +1,68 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "haptic_queue.h"
+#include <string.h>
+
+_Static_assert(HAPTIC_QUEUE_SIZE > 0 && HAPTIC_QUEUE_SIZE <= 255, "HAPTIC_QUEUE_SIZE must be 1..255");
+
+static void remove_event(haptic_queue_t* queue, uint8_t index) {
+    memmove(&queue->events[index], &queue->events[index + 1], (queue->length - index - 1) * sizeof(haptic_event_t));
+    queue->length--;
+}
+
+// index of the oldest of the waiting effects with the lowest or the highest priority
+static uint8_t find_by_priority(const haptic_queue_t* queue, bool highest) {
+    uint8_t found = 0;
+    for (uint8_t i = 1; i < queue->length; i++) {
+        uint8_t priority = queue->events[i].priority;
+        if (highest ? priority > queue->events[found].priority : priority < queue->events[found].priority) {
+            found = i;
+        }
+    }
+    return found;
+}
+
+void haptic_queue_init(haptic_queue_t* queue) {
+    memset(queue, 0, sizeof(haptic_queue_t));
+}
+
+bool haptic_queue_push(haptic_queue_t* queue, uint8_t effect, uint8_t priority) {
+    for (uint8_t i = 0; i < queue->length; i++) {
+        if (queue->events[i].effect == effect) {
+            if (priority > queue->events[i].priority) {
+                queue->events[i].priority = priority;
+            }
+            queue->coalesced++;
+            return true;
+        }
+    }
+
+    if (queue->length == HAPTIC_QUEUE_SIZE) {
+        queue->dropped++;
+        uint8_t lowest = find_by_priority(queue, false);
+        if (priority <= queue->events[lowest].priority) {
+            return false;
+        }
+        remove_event(queue, lowest);
+    }
+
+    queue->events[queue->length++] = (haptic_event_t){.effect = effect, .priority = priority};
+    return true;
+}
+
+bool haptic_queue_pop(haptic_queue_t* queue, uint32_t now, haptic_event_t* event) {
+    if (queue->length == 0) {
+        return false;
+    }
+    if (queue->played && now - queue->last_played < HAPTIC_QUEUE_MIN_INTERVAL) {
+        return false;
+    }
+
+    uint8_t next = find_by_priority(queue, true);
+    *event       = queue->events[next];
+    remove_event(queue, next);
+    queue->played      = true;
+    queue->last_played = now;
+    return true;
+}
@@ -0,0 +1,77 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/**
+ * @file
+ * @brief Queue of the haptic effects waiting to be played
+ *
+ * haptic_play and haptic_play_effect only queue their effect, haptic_task then
+ * plays the waiting effects one at a time, so that the I2C writes of the
+ * DRV2605L stay out of the keypress path.
+ *
+ * An effect which is already waiting is not queued twice: the waiting one keeps
+ * the higher of the two priorities instead. When the queue is full, a new effect
+ * takes the place of the oldest waiting one of lower priority, or is dropped.
+ *
+ * Effects are played highest priority first, oldest first between equal
+ * priorities, and no sooner than HAPTIC_QUEUE_MIN_INTERVAL milliseconds after
+ * the previous one.
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef HAPTIC_QUEUE_SIZE
+#    define HAPTIC_QUEUE_SIZE 4
+#endif
+
+#ifndef HAPTIC_QUEUE_MIN_INTERVAL
+#    define HAPTIC_QUEUE_MIN_INTERVAL 20
+#endif
+
+typedef struct {
+    uint8_t effect;
+    uint8_t priority;
+} haptic_event_t;
+
+typedef struct {
+    haptic_event_t events[HAPTIC_QUEUE_SIZE]; // waiting effects, oldest first
+    uint8_t        length;
+    bool           played; // whether last_played holds the time of a played effect
+    uint32_t       last_played;
+    // effects merged into a waiting one, and effects dropped or pushed out of a full queue
+    uint16_t coalesced;
+    uint16_t dropped;
+} haptic_queue_t;
+
+/**
+ * @brief Empty a queue, forget the last played effect and clear the counters
+ */
+void haptic_queue_init(haptic_queue_t* queue);
+
+/**
+ * @brief Queue an effect, or merge it into the same waiting effect
+ *
+ * @param priority effects of a higher priority are played first
+ * @return false if the effect was dropped, the queue being full of effects of the same or a higher priority
+ */
+bool haptic_queue_push(haptic_queue_t* queue, uint8_t effect, uint8_t priority);
+
+/**
+ * @brief Take the next effect to play off the queue
+ *
+ * @param now the current time, in milliseconds
+ * @param event where to store the effect and its priority
+ * @return false if the queue is empty, or if the previous effect was played less than HAPTIC_QUEUE_MIN_INTERVAL ago
+ */
+bool haptic_queue_pop(haptic_queue_t* queue, uint32_t now, haptic_event_t* event);
+
+#ifdef __cplusplus
+}
+#endif
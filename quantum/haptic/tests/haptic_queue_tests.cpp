@@ -0,0 +1,120 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <vector>
+
+extern "C" {
+#include "haptic_queue.h"
+}
+
+namespace {
+
+class HapticQueue : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        haptic_queue_init(&queue);
+    }
+
+    // pops every effect which is due, one per millisecond, for the given time
+    std::vector<uint8_t> play_for(uint32_t duration) {
+        std::vector<uint8_t> played;
+        for (uint32_t i = 0; i < duration; i++, now++) {
+            haptic_event_t event;
+            if (haptic_queue_pop(&queue, now, &event)) {
+                played.push_back(event.effect);
+            }
+        }
+        return played;
+    }
+
+    haptic_queue_t queue;
+    uint32_t       now = 1000;
+};
+
+} // namespace
+
+TEST_F(HapticQueue, PlaysRightAway) {
+    haptic_event_t event;
+    EXPECT_FALSE(haptic_queue_pop(&queue, now, &event));
+
+    EXPECT_TRUE(haptic_queue_push(&queue, 7, 3));
+    ASSERT_TRUE(haptic_queue_pop(&queue, now, &event));
+    EXPECT_EQ(event.effect, 7);
+    EXPECT_EQ(event.priority, 3);
+    EXPECT_EQ(queue.length, 0);
+}
+
+TEST_F(HapticQueue, LimitsTheRate) {
+    haptic_queue_push(&queue, 1, 0);
+    haptic_queue_push(&queue, 2, 0);
+    haptic_queue_push(&queue, 3, 0);
+
+    EXPECT_EQ(play_for(1), std::vector<uint8_t>{1});
+    EXPECT_EQ(play_for(HAPTIC_QUEUE_MIN_INTERVAL - 1), std::vector<uint8_t>{});
+    EXPECT_EQ(play_for(1), std::vector<uint8_t>{2});
+    EXPECT_EQ(play_for(HAPTIC_QUEUE_MIN_INTERVAL), std::vector<uint8_t>{3});
+
+    // an effect coming after a pause plays right away
+    play_for(100);
+    haptic_queue_push(&queue, 4, 0);
+    EXPECT_EQ(play_for(1), std::vector<uint8_t>{4});
+}
+
+TEST_F(HapticQueue, LimitsTheRateAcrossTimerWrap) {
+    now = UINT32_MAX - 5;
+    haptic_queue_push(&queue, 1, 0);
+    haptic_queue_push(&queue, 2, 0);
+    EXPECT_EQ(play_for(HAPTIC_QUEUE_MIN_INTERVAL), std::vector<uint8_t>{1});
+    EXPECT_EQ(play_for(1), std::vector<uint8_t>{2});
+}
+
+TEST_F(HapticQueue, CoalescesWaitingEffects) {
+    // a burst of keypresses while an effect is playing ends up as one more effect
+    haptic_queue_push(&queue, 5, 0);
+    play_for(1);
+    for (uint8_t i = 0; i < 10; i++) {
+        EXPECT_TRUE(haptic_queue_push(&queue, 5, 0));
+    }
+    EXPECT_EQ(queue.length, 1);
+    EXPECT_EQ(queue.coalesced, 9);
+    EXPECT_EQ(play_for(100), std::vector<uint8_t>{5});
+
+    // the merged effect keeps the higher priority
+    haptic_queue_push(&queue, 5, 0);
+    haptic_queue_push(&queue, 6, 1);
+    haptic_queue_push(&queue, 5, 2);
+    EXPECT_EQ(queue.events[0].priority, 2);
+    EXPECT_EQ(play_for(100), (std::vector<uint8_t>{5, 6}));
+}
+
+TEST_F(HapticQueue, PlaysHigherPrioritiesFirst) {
+    haptic_queue_push(&queue, 1, 0);
+    play_for(1);
+    haptic_queue_push(&queue, 2, 0);
+    haptic_queue_push(&queue, 3, 1);
+    haptic_queue_push(&queue, 4, 0);
+    haptic_queue_push(&queue, 5, 1);
+    EXPECT_EQ(play_for(100), (std::vector<uint8_t>{3, 5, 2, 4}));
+}
+
+TEST_F(HapticQueue, DropsLowerPrioritiesWhenFull) {
+    haptic_queue_push(&queue, 100, 0);
+    play_for(1);
+    for (uint8_t i = 0; i < HAPTIC_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(haptic_queue_push(&queue, i, i == 1 ? 1 : 0));
+    }
+
+    // the same priority waits its turn
+    EXPECT_FALSE(haptic_queue_push(&queue, 50, 0));
+    // a higher one pushes out the oldest of the lowest
+    EXPECT_TRUE(haptic_queue_push(&queue, 51, 2));
+    EXPECT_EQ(queue.dropped, 2);
+    EXPECT_EQ(queue.length, HAPTIC_QUEUE_SIZE);
+
+    std::vector<uint8_t> expected = {51, 1};
+    for (uint8_t i = 2; i < HAPTIC_QUEUE_SIZE; i++) {
+        expected.push_back(i);
+    }
+    EXPECT_EQ(play_for(100), expected);
+}
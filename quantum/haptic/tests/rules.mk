@@ -0,0 +1,5 @@
+haptic_queue_INC := $(QUANTUM_PATH)/haptic
+
+haptic_queue_SRC := \
+	$(QUANTUM_PATH)/haptic/tests/haptic_queue_tests.cpp \
+	$(QUANTUM_PATH)/haptic/haptic_queue.c
@@ -138,6 +138,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_BANKED)
+#    include "wear_leveling.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -636,6 +639,10 @@ void quantum_task(void) {
 #ifdef SECURE_ENABLE
     secure_task();
 #endif
+
+#ifdef STENO_ENABLE
+    steno_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
@@ -726,5 +733,15 @@ void keyboard_task(void) {
     bluetooth_task();
 #endif
 
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_BANKED)
+    // background wear-leveling consolidation
+    wear_leveling_task();
+#endif
+
+#ifdef HOST_REPORT_QUEUE_ENABLE
+    // send any reports which were waiting on a busy endpoint
+    host_task();
+#endif
+
     led_task();
 }
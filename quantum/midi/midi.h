@@ -60,6 +60,17 @@ void midi_device_init(MidiDevice* device); // [implementation in midi_device.c]
  */
 void midi_device_process(MidiDevice* device); // [implementation in midi_device.c]
 
+/**
+ * @brief Send the queued output data
+ *
+ * Only does something if MIDI_OUTPUT_QUEUE is defined, in which case the send
+ * functions queue their messages until this is called. midi_device_process
+ * calls it, you only need to if you want the messages out sooner.
+ *
+ * @param device the device to flush
+ */
+void midi_device_flush(MidiDevice* device); // [implementation in midi_device.c]
+
 /**@}*/
 
 /**
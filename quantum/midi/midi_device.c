@@ -31,6 +31,10 @@ void midi_device_init(MidiDevice* device) {
     device->input_state = IDLE;
     device->input_count = 0;
     bytequeue_init(&device->input_queue, device->input_queue_data, MIDI_INPUT_QUEUE_LENGTH);
+#ifdef MIDI_OUTPUT_QUEUE
+    midi_output_queue_init(&device->output_queue);
+#endif
+    device->send_batch_func = NULL;
 
     // three byte funcs
     device->input_cc_callback           = NULL;
@@ -68,6 +72,34 @@ void midi_device_set_send_func(MidiDevice* device, midi_var_byte_func_t send_fun
     device->send_func = send_func;
 }
 
+void midi_device_set_send_batch_func(MidiDevice* device, midi_event_batch_func_t send_batch_func) {
+    device->send_batch_func = send_batch_func;
+}
+
+void midi_device_send(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+#ifdef MIDI_OUTPUT_QUEUE
+    midi_output_queue_push(&device->output_queue, cnt, byte0, byte1, byte2);
+#else
+    device->send_func(device, cnt, byte0, byte1, byte2);
+#endif
+}
+
+void midi_device_flush(MidiDevice* device) {
+#ifdef MIDI_OUTPUT_QUEUE
+    midi_event_t events[MIDI_OUTPUT_BATCH_SIZE];
+    uint8_t      count;
+    while ((count = midi_output_queue_pop(&device->output_queue, events, MIDI_OUTPUT_BATCH_SIZE)) > 0) {
+        if (device->send_batch_func) {
+            device->send_batch_func(device, count, events);
+        } else {
+            for (uint8_t i = 0; i < count; i++) {
+                device->send_func(device, events[i].count, events[i].data[0], events[i].data[1], events[i].data[2]);
+            }
+        }
+    }
+#endif
+}
+
 void midi_device_set_pre_input_process_func(MidiDevice* device, midi_no_byte_func_t pre_process_func) {
     device->pre_input_process_callback = pre_process_func;
 }
@@ -85,6 +117,9 @@ void midi_device_process(MidiDevice* device) {
         midi_process_byte(device, val);
         bytequeue_remove(&device->input_queue, 1);
     }
+
+    // send what was queued, including any replies of the input callbacks
+    midi_device_flush(device);
 }
 
 void midi_process_byte(MidiDevice* device, uint8_t input) {
@@ -48,6 +48,9 @@ extern "C" {
 
 #include "midi_function_types.h"
 #include "bytequeue/bytequeue.h"
+#ifdef MIDI_OUTPUT_QUEUE
+#    include "midi_output_queue.h"
+#endif
 #define MIDI_INPUT_QUEUE_LENGTH 192
 
 typedef enum { IDLE, ONE_BYTE_MESSAGE = 1, TWO_BYTE_MESSAGE = 2, THREE_BYTE_MESSAGE = 3, SYSEX_MESSAGE } input_state_t;
@@ -67,6 +70,8 @@ typedef void (*midi_no_byte_func_t)(MidiDevice* device);
 struct _midi_device {
     // output send function
     midi_var_byte_func_t send_func;
+    // optional, sends a batch of the output queue at once
+    midi_event_batch_func_t send_batch_func;
 
     //********input callbacks
     // three byte funcs
@@ -104,6 +109,11 @@ struct _midi_device {
     // for queueing data between the input and the processing functions
     uint8_t     input_queue_data[MIDI_INPUT_QUEUE_LENGTH];
     byteQueue_t input_queue;
+
+#ifdef MIDI_OUTPUT_QUEUE
+    // for batching output data until the next midi_device_process
+    midi_output_queue_t output_queue;
+#endif
 };
 
 /**
@@ -130,6 +140,26 @@ void midi_device_input(MidiDevice* device, uint8_t cnt, uint8_t* input);
  */
 void midi_device_set_send_func(MidiDevice* device, midi_var_byte_func_t send_func);
 
+/**
+ * @brief Set the callback function that will be used for sending several
+ * messages at once when flushing the output queue, for instance in a single
+ * USB transfer. Without one, the send function is called for each message.
+ *
+ * \param device the midi device to associate this callback with
+ * \param send_batch_func the callback function that will do the sending
+ */
+void midi_device_set_send_batch_func(MidiDevice* device, midi_event_batch_func_t send_batch_func);
+
+/**
+ * @brief Send a message through the device: queue it if MIDI_OUTPUT_QUEUE is
+ * defined, otherwise pass it to the send function right away. The midi send
+ * functions all go through here.
+ *
+ * \param device the midi device to send with
+ * \param cnt the number of bytes of the message
+ */
+void midi_device_send(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2);
+
 /**
  * @brief Set a callback which is called at the beginning of the
  * midi_device_process call.  This can be used to poll for input
@@ -39,6 +39,15 @@ typedef void (*midi_three_byte_func_t)(MidiDevice *device, uint8_t byte0, uint8_
 // all bytes after count bytes should be ignored
 typedef void (*midi_var_byte_func_t)(MidiDevice *device, uint16_t count, uint8_t byte0, uint8_t byte1, uint8_t byte2);
 
+// a message as passed to a midi_var_byte_func_t, count being 1..3
+typedef struct {
+    uint8_t count;
+    uint8_t data[3];
+} midi_event_t;
+
+// sends several messages at once, in order
+typedef void (*midi_event_batch_func_t)(MidiDevice *device, uint8_t count, const midi_event_t *events);
+
 // the start byte tells you how far into the sysex message you are, the data_length tells you how many bytes data is
 typedef void (*midi_sysex_func_t)(MidiDevice *device, uint16_t start_byte, uint8_t data_length, uint8_t *data);
 
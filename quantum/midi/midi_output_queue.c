@@ -0,0 +1,144 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "midi_output_queue.h"
+#include "midi.h"
+#include <string.h>
+
+_Static_assert(MIDI_OUTPUT_QUEUE_LENGTH > 0 && MIDI_OUTPUT_QUEUE_LENGTH <= 255, "MIDI_OUTPUT_QUEUE_LENGTH must be 1..255");
+
+#define NO_VALUE UINT8_MAX
+
+static uint8_t get(const midi_output_queue_t* queue, uint16_t index) {
+    return queue->data[(queue->start + index) % MIDI_OUTPUT_QUEUE_LENGTH];
+}
+
+static void set(midi_output_queue_t* queue, uint16_t index, uint8_t byte) {
+    queue->data[(queue->start + index) % MIDI_OUTPUT_QUEUE_LENGTH] = byte;
+}
+
+static void append(midi_output_queue_t* queue, uint8_t byte) {
+    set(queue, queue->length++, byte);
+}
+
+// reads the message at index, returning its size in the queue and updating the running status
+static uint8_t read_message(const midi_output_queue_t* queue, uint8_t index, uint8_t* status, midi_event_t* event) {
+    memset(event, 0, sizeof(midi_event_t));
+
+    uint8_t first = get(queue, index);
+    if (first == MIDI_OUTPUT_QUEUE_RAW) {
+        event->count = get(queue, index + 1);
+        for (uint8_t i = 0; i < event->count; i++) {
+            event->data[i] = get(queue, index + 2 + i);
+        }
+        return 2 + event->count;
+    }
+
+    uint8_t size = 0;
+    if (midi_is_statusbyte(first)) {
+        *status = first;
+        size++;
+    }
+    event->count   = midi_packet_length(*status);
+    event->data[0] = *status;
+    for (uint8_t i = 1; i < event->count; i++) {
+        event->data[i] = get(queue, index + size++);
+    }
+    return size;
+}
+
+static bool is_channel_message(uint16_t count, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+    return byte0 >= MIDI_NOTEOFF && byte0 < SYSEX_BEGIN && count == midi_packet_length(byte0) && !midi_is_statusbyte(byte1) && (count < 3 || !midi_is_statusbyte(byte2));
+}
+
+// whether later values of a controller can replace earlier ones: bank select (0, 32), data entry (6, 38, 96, 97) and
+// parameter numbers (98-101) only make sense in the order sent, switches (64-69) would lose presses and mode messages
+// (120-127) are commands
+static bool is_continuous_cc(uint8_t num) {
+    switch (num) {
+        case 0:
+        case 6:
+        case 32:
+        case 38:
+        case 64 ... 69:
+        case 96 ... 101:
+        case 120 ... 127:
+            return false;
+        default:
+            return true;
+    }
+}
+
+// merges a CC into the last queued message, if that is a CC for the same channel and controller
+static bool coalesce_cc(midi_output_queue_t* queue, uint8_t status, uint8_t num, uint8_t val) {
+    if (!is_continuous_cc(num)) {
+        return false;
+    }
+
+    uint8_t      running = queue->head_status;
+    uint8_t      value   = NO_VALUE;
+    uint8_t      index   = 0;
+    midi_event_t event;
+    while (index < queue->length) {
+        bool    raw  = get(queue, index) == MIDI_OUTPUT_QUEUE_RAW;
+        uint8_t size = read_message(queue, index, &running, &event);
+        value        = !raw && event.data[0] == status && event.data[1] == num ? index + size - 1 : NO_VALUE;
+        index += size;
+    }
+
+    if (value == NO_VALUE) {
+        return false;
+    }
+    set(queue, value, val);
+    queue->coalesced++;
+    return true;
+}
+
+void midi_output_queue_init(midi_output_queue_t* queue) {
+    memset(queue, 0, sizeof(midi_output_queue_t));
+}
+
+bool midi_output_queue_push(midi_output_queue_t* queue, uint16_t count, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+    uint8_t bytes[3] = {byte0, byte1, byte2};
+
+    if (is_channel_message(count, byte0, byte1, byte2)) {
+        if ((byte0 & 0xF0) == MIDI_CC && coalesce_cc(queue, byte0, byte1, byte2)) {
+            return true;
+        }
+
+        uint8_t skip = byte0 == queue->tail_status ? 1 : 0;
+        if (count - skip > MIDI_OUTPUT_QUEUE_LENGTH - queue->length) {
+            queue->overflows++;
+            return false;
+        }
+        for (uint8_t i = skip; i < count; i++) {
+            append(queue, bytes[i]);
+        }
+        queue->tail_status = byte0;
+        return true;
+    }
+
+    if (count < 1 || count > 3) {
+        return false;
+    }
+    if (2 + count > MIDI_OUTPUT_QUEUE_LENGTH - queue->length) {
+        queue->overflows++;
+        return false;
+    }
+    append(queue, MIDI_OUTPUT_QUEUE_RAW);
+    append(queue, count);
+    for (uint8_t i = 0; i < count; i++) {
+        append(queue, bytes[i]);
+    }
+    return true;
+}
+
+uint8_t midi_output_queue_pop(midi_output_queue_t* queue, midi_event_t* events, uint8_t max) {
+    uint8_t count = 0;
+    while (count < max && queue->length > 0) {
+        uint8_t size = read_message(queue, 0, &queue->head_status, &events[count++]);
+        queue->start = (queue->start + size) % MIDI_OUTPUT_QUEUE_LENGTH;
+        queue->length -= size;
+    }
+    return count;
+}
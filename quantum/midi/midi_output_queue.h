@@ -0,0 +1,81 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/**
+ * @file
+ * @brief Output queue, batching the messages sent through a device
+ *
+ * With MIDI_OUTPUT_QUEUE defined, the midi send functions queue their
+ * messages instead of handing each of them to the device's send function
+ * right away. midi_device_process then flushes the queue, up to
+ * MIDI_OUTPUT_BATCH_SIZE messages at a time, so that a chord or a CC sweep
+ * goes out in a few USB transfers rather than one per message.
+ *
+ * Channel messages are queued with running status: the status byte is left
+ * out when it is the same as the one of the previous channel message. Other
+ * messages (system, realtime, sysex chunks) are queued as they were sent, after
+ * a MIDI_OUTPUT_QUEUE_RAW byte and their length.
+ *
+ * A CC for a channel and controller which already has one waiting, with only
+ * other CCs queued since, replaces the value of the waiting one instead of
+ * being queued.
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include "midi_function_types.h"
+
+#ifndef MIDI_OUTPUT_QUEUE_LENGTH
+#    define MIDI_OUTPUT_QUEUE_LENGTH 64
+#endif
+
+// how many 4 byte USB-MIDI event packets fit in a 64 byte endpoint
+#ifndef MIDI_OUTPUT_BATCH_SIZE
+#    define MIDI_OUTPUT_BATCH_SIZE 16
+#endif
+
+// undefined system common status, marking the messages queued without running status
+#define MIDI_OUTPUT_QUEUE_RAW 0xF5
+
+typedef struct {
+    uint8_t data[MIDI_OUTPUT_QUEUE_LENGTH];
+    uint8_t start;  // offset of the first queued byte
+    uint8_t length; // number of queued bytes
+    // running status in effect at the first and after the last queued byte
+    uint8_t head_status;
+    uint8_t tail_status;
+    // messages dropped because they did not fit, and CCs merged into the one queued right before them
+    uint16_t overflows;
+    uint16_t coalesced;
+} midi_output_queue_t;
+
+/**
+ * @brief Empty a queue and clear its counters
+ */
+void midi_output_queue_init(midi_output_queue_t* queue);
+
+/**
+ * @brief Queue a message, with the arguments of a midi_var_byte_func_t
+ *
+ * @return false if the message was dropped, the queue being full or the count being out of 1..3
+ */
+bool midi_output_queue_push(midi_output_queue_t* queue, uint16_t count, uint8_t byte0, uint8_t byte1, uint8_t byte2);
+
+/**
+ * @brief Take the oldest messages off the queue, with their status restored
+ *
+ * @param events where to store the messages
+ * @param max how many messages events has room for
+ * @return how many messages were taken, 0 if the queue is empty
+ */
+uint8_t midi_output_queue_pop(midi_output_queue_t* queue, midi_event_t* events, uint8_t max);
+
+#ifdef __cplusplus
+}
+#endif
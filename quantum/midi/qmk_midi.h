@@ -6,5 +6,6 @@
 extern MidiDevice midi_device;
 void              setup_midi(void);
 void              send_midi_packet(MIDI_EventPacket_t* event);
+void              send_midi_packets(MIDI_EventPacket_t* events, uint8_t count);
 bool              recv_midi_packet(MIDI_EventPacket_t* const event);
 #endif
@@ -0,0 +1,244 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <vector>
+
+extern "C" {
+#include "midi.h"
+#include "midi_output_queue.h"
+#include "bytequeue/interrupt_setting.h"
+
+interrupt_setting_t store_and_clear_interrupt(void) {
+    return 0;
+}
+
+void restore_interrupt_setting(interrupt_setting_t setting) {}
+}
+
+namespace {
+
+struct message {
+    uint16_t count;
+    uint8_t  byte0, byte1, byte2;
+
+    bool operator==(const message &other) const {
+        return count == other.count && byte0 == other.byte0 && byte1 == other.byte1 && byte2 == other.byte2;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const message &m) {
+    return os << m.count << ": " << std::hex << (int)m.byte0 << " " << (int)m.byte1 << " " << (int)m.byte2 << std::dec;
+}
+
+std::vector<message> sent;
+std::vector<size_t>  batches;
+
+void fake_send(MidiDevice *device, uint16_t count, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+    sent.push_back({count, byte0, byte1, byte2});
+}
+
+void fake_send_batch(MidiDevice *device, uint8_t count, const midi_event_t *events) {
+    batches.push_back(count);
+    for (uint8_t i = 0; i < count; i++) {
+        sent.push_back({events[i].count, events[i].data[0], events[i].data[1], events[i].data[2]});
+    }
+}
+
+class MidiOutputQueue : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        sent.clear();
+        batches.clear();
+        midi_device_init(&device);
+        midi_device_set_send_func(&device, fake_send);
+        midi_device_set_send_batch_func(&device, fake_send_batch);
+    }
+
+    MidiDevice device;
+};
+
+} // namespace
+
+TEST_F(MidiOutputQueue, SendsWhenProcessed) {
+    midi_send_noteon(&device, 0, 60, 100);
+    midi_send_noteoff(&device, 0, 60, 0);
+    EXPECT_TRUE(sent.empty());
+
+    midi_device_process(&device);
+    std::vector<message> expected = {{3, 0x90, 60, 100}, {3, 0x80, 60, 0}};
+    EXPECT_EQ(sent, expected);
+    EXPECT_EQ(batches, std::vector<size_t>{2});
+
+    midi_device_process(&device);
+    EXPECT_EQ(sent.size(), 2);
+}
+
+TEST_F(MidiOutputQueue, UsesRunningStatus) {
+    // a four note chord takes one status byte and two data bytes per note
+    for (uint8_t note = 60; note < 64; note++) {
+        midi_send_noteon(&device, 2, note, 90);
+    }
+    EXPECT_EQ(device.output_queue.length, 1 + 4 * 2);
+
+    // and keeps it across a clock and a flush
+    midi_send_clock(&device);
+    midi_send_noteon(&device, 2, 64, 90);
+    EXPECT_EQ(device.output_queue.length, 1 + 4 * 2 + 3 + 2);
+    midi_device_flush(&device);
+    midi_send_noteon(&device, 2, 65, 90);
+    EXPECT_EQ(device.output_queue.length, 2);
+
+    midi_device_flush(&device);
+    std::vector<message> expected = {{3, 0x92, 60, 90}, {3, 0x92, 61, 90}, {3, 0x92, 62, 90}, {3, 0x92, 63, 90}, {1, MIDI_CLOCK, 0, 0}, {3, 0x92, 64, 90}, {3, 0x92, 65, 90}};
+    EXPECT_EQ(sent, expected);
+}
+
+TEST_F(MidiOutputQueue, BatchesPacketsWorth) {
+    for (uint8_t note = 0; note < 20; note++) {
+        midi_send_noteon(&device, 0, note, 127);
+    }
+    midi_device_process(&device);
+    ASSERT_EQ(sent.size(), 20);
+    EXPECT_EQ(batches, (std::vector<size_t>{MIDI_OUTPUT_BATCH_SIZE, 20 - MIDI_OUTPUT_BATCH_SIZE}));
+    for (uint8_t note = 0; note < 20; note++) {
+        EXPECT_EQ(sent[note], (message{3, 0x90, note, 127}));
+    }
+}
+
+TEST_F(MidiOutputQueue, FallsBackToSendFunc) {
+    midi_device_set_send_batch_func(&device, NULL);
+    midi_send_programchange(&device, 3, 5);
+    midi_send_pitchbend(&device, 3, 0);
+    midi_device_process(&device);
+    std::vector<message> expected = {{2, 0xC3, 5, 0}, {3, 0xE3, 0, 0x40}};
+    EXPECT_EQ(sent, expected);
+    EXPECT_TRUE(batches.empty());
+}
+
+TEST_F(MidiOutputQueue, CoalescesCCs) {
+    // a sweep of one controller ends up as its last value
+    for (uint8_t value = 0; value < 10; value++) {
+        midi_send_cc(&device, 0, 1, value);
+    }
+    // another channel is another controller
+    midi_send_cc(&device, 1, 1, 42);
+    EXPECT_EQ(device.output_queue.coalesced, 9);
+
+    midi_device_flush(&device);
+    std::vector<message> expected = {{3, 0xB0, 1, 9}, {3, 0xB1, 1, 42}};
+    EXPECT_EQ(sent, expected);
+}
+
+TEST_F(MidiOutputQueue, KeepsInterleavedCCsInOrder) {
+    // only a CC queued right before is merged, so sweeps of two controllers stay as sent
+    for (uint8_t value = 0; value < 3; value++) {
+        midi_send_cc(&device, 0, 1, value);
+        midi_send_cc(&device, 0, 11, 100 + value);
+    }
+    EXPECT_EQ(device.output_queue.coalesced, 0);
+
+    midi_device_flush(&device);
+    std::vector<message> expected = {{3, 0xB0, 1, 0}, {3, 0xB0, 11, 100}, {3, 0xB0, 1, 1}, {3, 0xB0, 11, 101}, {3, 0xB0, 1, 2}, {3, 0xB0, 11, 102}};
+    EXPECT_EQ(sent, expected);
+}
+
+TEST_F(MidiOutputQueue, KeepsRPNWrites) {
+    // pitch bend range, then fine tuning: merging the selects or the data would write to the wrong parameter
+    midi_send_cc(&device, 0, 101, 0);
+    midi_send_cc(&device, 0, 100, 0);
+    midi_send_cc(&device, 0, 6, 12);
+    midi_send_cc(&device, 0, 38, 0);
+    midi_send_cc(&device, 0, 101, 0);
+    midi_send_cc(&device, 0, 100, 1);
+    midi_send_cc(&device, 0, 6, 64);
+    midi_send_cc(&device, 0, 38, 0);
+    // increments repeat on purpose
+    midi_send_cc(&device, 0, 96, 1);
+    midi_send_cc(&device, 0, 96, 1);
+    // as does bank select followed by another bank select
+    midi_send_cc(&device, 0, 0, 1);
+    midi_send_cc(&device, 0, 0, 2);
+    EXPECT_EQ(device.output_queue.coalesced, 0);
+
+    midi_device_flush(&device);
+    std::vector<message> expected = {
+        {3, 0xB0, 101, 0}, {3, 0xB0, 100, 0}, {3, 0xB0, 6, 12}, {3, 0xB0, 38, 0}, {3, 0xB0, 101, 0}, {3, 0xB0, 100, 1}, {3, 0xB0, 6, 64}, {3, 0xB0, 38, 0}, {3, 0xB0, 96, 1}, {3, 0xB0, 96, 1}, {3, 0xB0, 0, 1}, {3, 0xB0, 0, 2},
+    };
+    EXPECT_EQ(sent, expected);
+}
+
+TEST_F(MidiOutputQueue, KeepsSwitchPresses) {
+    // a sustain pedal tapped within one loop is still a press and a release
+    midi_send_cc(&device, 0, 64, 127);
+    midi_send_cc(&device, 0, 64, 0);
+    EXPECT_EQ(device.output_queue.coalesced, 0);
+
+    midi_device_flush(&device);
+    std::vector<message> expected = {{3, 0xB0, 64, 127}, {3, 0xB0, 64, 0}};
+    EXPECT_EQ(sent, expected);
+}
+
+TEST_F(MidiOutputQueue, KeepsCCsAroundOtherMessages) {
+    // modulation, note, modulation: merging would change what the note starts with
+    midi_send_cc(&device, 0, 1, 127);
+    midi_send_noteon(&device, 0, 60, 100);
+    midi_send_cc(&device, 0, 1, 0);
+    EXPECT_EQ(device.output_queue.coalesced, 0);
+
+    midi_device_flush(&device);
+    std::vector<message> expected = {{3, 0xB0, 1, 127}, {3, 0x90, 60, 100}, {3, 0xB0, 1, 0}};
+    EXPECT_EQ(sent, expected);
+
+    // nor into a CC which was already sent
+    midi_send_cc(&device, 0, 1, 127);
+    midi_device_flush(&device);
+    EXPECT_EQ(sent.size(), 4);
+}
+
+TEST_F(MidiOutputQueue, CountsOverflows) {
+    // one status byte, then two bytes per note
+    const uint8_t fitting = (MIDI_OUTPUT_QUEUE_LENGTH - 1) / 2;
+    for (uint8_t note = 0; note < fitting + 3; note++) {
+        midi_send_noteon(&device, 0, note, 1);
+    }
+    midi_send_start(&device);
+    EXPECT_EQ(device.output_queue.overflows, 4);
+
+    midi_device_flush(&device);
+    ASSERT_EQ(sent.size(), fitting);
+    EXPECT_EQ(sent.back(), (message{3, 0x90, (uint8_t)(fitting - 1), 1}));
+
+    // there is room again
+    midi_send_noteon(&device, 0, 100, 1);
+    midi_device_flush(&device);
+    EXPECT_EQ(sent.back(), (message{3, 0x90, 100, 1}));
+    EXPECT_EQ(device.output_queue.overflows, 4);
+}
+
+TEST_F(MidiOutputQueue, KeepsSysexChunks) {
+    uint8_t sysex[] = {SYSEX_BEGIN, 0x7D, 0x01, 0x02, 0x03, SYSEX_END};
+    midi_send_noteon(&device, 0, 60, 100);
+    midi_send_array(&device, sizeof(sysex), sysex);
+    midi_send_noteon(&device, 0, 62, 100);
+    midi_device_flush(&device);
+
+    std::vector<message> expected = {{3, 0x90, 60, 100}, {3, SYSEX_BEGIN, 0x7D, 0x01}, {3, 0x02, 0x03, SYSEX_END}, {3, 0x90, 62, 100}};
+    EXPECT_EQ(sent, expected);
+}
+
+TEST(MidiOutputQueueRaw, RejectsBadCounts) {
+    midi_output_queue_t queue;
+    midi_event_t        events[2];
+    midi_output_queue_init(&queue);
+    EXPECT_FALSE(midi_output_queue_push(&queue, 0, MIDI_CLOCK, 0, 0));
+    EXPECT_FALSE(midi_output_queue_push(&queue, 4, SYSEX_BEGIN, 0, 0));
+    EXPECT_EQ(queue.overflows, 0);
+
+    // a channel status with the wrong count is queued as it was sent
+    EXPECT_TRUE(midi_output_queue_push(&queue, 2, 0x90, 60, 0));
+    ASSERT_EQ(midi_output_queue_pop(&queue, events, 2), 1);
+    EXPECT_EQ(events[0].count, 2);
+    EXPECT_EQ(events[0].data[0], 0x90);
+    EXPECT_EQ(events[0].data[1], 60);
+}
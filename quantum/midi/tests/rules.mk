@@ -0,0 +1,10 @@
+midi_output_queue_DEFS := -DMIDI_OUTPUT_QUEUE
+
+midi_output_queue_INC := $(QUANTUM_PATH)/midi
+
+midi_output_queue_SRC := \
+	$(QUANTUM_PATH)/midi/tests/midi_output_queue_tests.cpp \
+	$(QUANTUM_PATH)/midi/midi.c \
+	$(QUANTUM_PATH)/midi/midi_device.c \
+	$(QUANTUM_PATH)/midi/midi_output_queue.c \
+	$(QUANTUM_PATH)/midi/bytequeue/bytequeue.c
@@ -23,6 +23,7 @@
 #include "print.h"
 #include "debug.h"
 #include "mousekey.h"
+#include "mousekey_motion.h"
 
 static inline int8_t times_inv_sqrt2(int8_t x) {
     // 181/256 (0.70703125) is used as an approximation for 1/sqrt(2)
@@ -52,6 +53,11 @@ static int8_t  mousekey_y_inertia = 0; // ...
 #ifdef MK_KINETIC_SPEED
 static uint16_t mouse_timer = 0;
 #endif
+#ifdef MOUSEKEY_MOTION_ENGINE
+static mousekey_motion_t mousekey_cursor_motion = {0}; // sub-pixel position and ramp of the cursor
+static mousekey_motion_t mousekey_wheel_motion  = {0}; // ... and of the wheel, with x and y as h and v
+static uint16_t          mousekey_motion_timer  = 0;   // last time the motion was integrated
+#endif
 
 #ifndef MK_3_SPEED
 
@@ -72,8 +78,13 @@ uint8_t mk_interval = MOUSEKEY_INTERVAL;
 uint8_t mk_max_speed = MOUSEKEY_MAX_SPEED;
 /* number of events (count) accelerating to steady speed (0-255) */
 uint8_t mk_time_to_max = MOUSEKEY_TIME_TO_MAX;
+#    ifdef MOUSEKEY_MOTION_ENGINE
+/* ramp used to reach maximum pointer speed (enum mousekey_curve) */
+uint8_t mk_curve = MOUSEKEY_MOTION_CURVE;
+#    else
 /* ramp used to reach maximum pointer speed (NOT SUPPORTED) */
 // int8_t mk_curve = 0;
+#    endif
 /* wheel params */
 /* milliseconds between the initial key press and first repeated motion event (0-2550) */
 uint8_t mk_wheel_delay = MOUSEKEY_WHEEL_DELAY / 10;
@@ -86,7 +97,78 @@ uint8_t mk_wheel_interval = MOUSEKEY_WHEEL_INTERVAL;
 uint8_t mk_wheel_max_speed   = MOUSEKEY_WHEEL_MAX_SPEED;
 uint8_t mk_wheel_time_to_max = MOUSEKEY_WHEEL_TIME_TO_MAX;
 
-#    ifndef MK_COMBINED
+#    if defined(MOUSEKEY_MOTION_ENGINE)
+
+/*
+ * Motion engine
+ *
+ *  A tap moves by a single step, a held key moves the cursor along a speed
+ *  curve integrated every millisecond in Q16 fixed point. Reports are only
+ *  sent when the integrated position reaches a whole pixel.
+ */
+
+static uint8_t move_unit(void) {
+    return MOUSEKEY_MOVE_DELTA;
+}
+
+static uint8_t wheel_unit(void) {
+    return MOUSEKEY_WHEEL_DELTA;
+}
+
+static mousekey_motion_profile_t cursor_profile(void) {
+    mousekey_motion_profile_t profile = {MOUSEKEY_INITIAL_SPEED, MOUSEKEY_BASE_SPEED, mk_delay * 10, MOUSEKEY_MOTION_TIME_TO_MAX, mk_curve};
+    if (mousekey_accel & (1 << 0)) {
+        profile.initial_speed = profile.max_speed = MOUSEKEY_DECELERATED_SPEED;
+    } else if (mousekey_accel & (1 << 1)) {
+        profile.initial_speed = profile.max_speed;
+    } else if (mousekey_accel & (1 << 2)) {
+        profile.initial_speed = profile.max_speed = MOUSEKEY_ACCELERATED_SPEED;
+    }
+    return profile;
+}
+
+static mousekey_motion_profile_t wheel_profile(void) {
+    mousekey_motion_profile_t profile = {MOUSEKEY_WHEEL_INITIAL_MOVEMENTS, MOUSEKEY_WHEEL_BASE_MOVEMENTS, mk_wheel_delay * 10, MOUSEKEY_MOTION_WHEEL_TIME_TO_MAX, mk_curve};
+    if (mousekey_accel & (1 << 0)) {
+        profile.initial_speed = profile.max_speed = MOUSEKEY_WHEEL_DECELERATED_MOVEMENTS;
+    } else if (mousekey_accel & (1 << 1)) {
+        profile.initial_speed = profile.max_speed;
+    } else if (mousekey_accel & (1 << 2)) {
+        profile.initial_speed = profile.max_speed = MOUSEKEY_WHEEL_ACCELERATED_MOVEMENTS;
+    }
+    return profile;
+}
+
+static inline int8_t direction_of(int8_t value) {
+    return value > 0 ? 1 : (value < 0 ? -1 : 0);
+}
+
+/* Integrates held keys up to now, filling the report with the whole pixels travelled */
+static void motion_task(report_mouse_t *held) {
+    uint16_t now = timer_read();
+    uint16_t ms  = TIMER_DIFF_16(now, mousekey_motion_timer);
+    mousekey_motion_timer = now;
+
+    if (held->x || held->y) {
+        mousekey_motion_profile_t profile = cursor_profile();
+        mousekey_motion_integrate(&mousekey_cursor_motion, &profile, direction_of(held->x), direction_of(held->y), ms);
+        mouse_report.x = mousekey_motion_take(&mousekey_cursor_motion.x, MOUSEKEY_MOVE_MAX);
+        mouse_report.y = mousekey_motion_take(&mousekey_cursor_motion.y, MOUSEKEY_MOVE_MAX);
+    } else {
+        mousekey_motion_reset(&mousekey_cursor_motion);
+    }
+
+    if (held->h || held->v) {
+        mousekey_motion_profile_t profile = wheel_profile();
+        mousekey_motion_integrate(&mousekey_wheel_motion, &profile, direction_of(held->h), direction_of(held->v), ms);
+        mouse_report.h = mousekey_motion_take(&mousekey_wheel_motion.x, MOUSEKEY_WHEEL_MAX);
+        mouse_report.v = mousekey_motion_take(&mousekey_wheel_motion.y, MOUSEKEY_WHEEL_MAX);
+    } else {
+        mousekey_motion_reset(&mousekey_wheel_motion);
+    }
+}
+
+#    elif !defined(MK_COMBINED)
 #        ifndef MK_KINETIC_SPEED
 #            ifndef MOUSEKEY_INERTIA
 
@@ -313,7 +395,11 @@ void mousekey_task(void) {
     mouse_report.v = 0;
     mouse_report.h = 0;
 
-#    ifdef MOUSEKEY_INERTIA
+#    if defined(MOUSEKEY_MOTION_ENGINE)
+
+    motion_task(&tmpmr);
+
+#    elif defined(MOUSEKEY_INERTIA)
 
     // if an animation is in progress and it's time for the next frame
     if ((mousekey_frame) && timer_elapsed(last_timer_c) > ((mousekey_frame > 1) ? mk_interval : mk_delay * 10)) {
@@ -357,8 +443,9 @@ void mousekey_task(void) {
         }
     }
 
-#    endif // MOUSEKEY_INERTIA or not
+#    endif // MOUSEKEY_MOTION_ENGINE, MOUSEKEY_INERTIA or neither
 
+#    ifndef MOUSEKEY_MOTION_ENGINE
     if ((tmpmr.v || tmpmr.h) && timer_elapsed(last_timer_w) > (mousekey_wheel_repeat ? mk_wheel_interval : mk_wheel_delay * 10)) {
         if (mousekey_wheel_repeat != UINT8_MAX) mousekey_wheel_repeat++;
         if (tmpmr.v != 0) mouse_report.v = wheel_unit() * ((tmpmr.v > 0) ? 1 : -1);
@@ -376,6 +463,7 @@ void mousekey_task(void) {
             }
         }
     }
+#    endif
 
     if (has_mouse_report_changed(&mouse_report, &tmpmr) || should_mousekey_report_send(&mouse_report)) {
         mousekey_send();
@@ -637,6 +725,10 @@ void mousekey_clear(void) {
     mousekey_x_dir     = 0;
     mousekey_y_dir     = 0;
 #endif
+#ifdef MOUSEKEY_MOTION_ENGINE
+    mousekey_motion_reset(&mousekey_cursor_motion);
+    mousekey_motion_reset(&mousekey_wheel_motion);
+#endif
 }
 
 static void mousekey_debug(void) {
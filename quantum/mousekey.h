@@ -20,6 +20,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <stdint.h>
 #include "host.h"
 
+#if defined(MOUSEKEY_MOTION_ENGINE) && (defined(MK_3_SPEED) || defined(MK_COMBINED) || defined(MK_KINETIC_SPEED) || defined(MOUSEKEY_INERTIA))
+#    error MOUSEKEY_MOTION_ENGINE cannot be used with the other mouse key modes
+#endif
+
 #ifndef MK_3_SPEED
 
 /* max value on report descriptor */
@@ -38,7 +42,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    ifndef MOUSEKEY_MOVE_DELTA
 #        if defined(MK_KINETIC_SPEED)
 #            define MOUSEKEY_MOVE_DELTA 16
-#        elif defined(MOUSEKEY_INERTIA)
+#        elif defined(MOUSEKEY_INERTIA) || defined(MOUSEKEY_MOTION_ENGINE)
 #            define MOUSEKEY_MOVE_DELTA 1
 #        else
 #            define MOUSEKEY_MOVE_DELTA 8
@@ -47,7 +51,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    ifndef MOUSEKEY_DELAY
 #        if defined(MK_KINETIC_SPEED)
 #            define MOUSEKEY_DELAY 5
-#        elif defined(MOUSEKEY_INERTIA)
+#        elif defined(MOUSEKEY_INERTIA) || defined(MOUSEKEY_MOTION_ENGINE)
 #            define MOUSEKEY_DELAY 150 // allow single-pixel movements before repeat activates
 #        else
 #            define MOUSEKEY_DELAY 10
@@ -120,6 +124,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #        define MOUSEKEY_WHEEL_DECELERATED_MOVEMENTS 8
 #    endif
 
+#    ifndef MOUSEKEY_MOTION_CURVE
+#        define MOUSEKEY_MOTION_CURVE MOUSEKEY_CURVE_QUADRATIC
+#    endif
+#    ifndef MOUSEKEY_MOTION_TIME_TO_MAX
+#        define MOUSEKEY_MOTION_TIME_TO_MAX 1000
+#    endif
+#    ifndef MOUSEKEY_MOTION_WHEEL_TIME_TO_MAX
+#        define MOUSEKEY_MOTION_WHEEL_TIME_TO_MAX 1000
+#    endif
+
 #else /* #ifndef MK_3_SPEED */
 
 #    ifndef MK_C_OFFSET_UNMOD
@@ -184,6 +198,9 @@ extern uint8_t mk_max_speed;
 extern uint8_t mk_time_to_max;
 extern uint8_t mk_wheel_max_speed;
 extern uint8_t mk_wheel_time_to_max;
+#ifdef MOUSEKEY_MOTION_ENGINE
+extern uint8_t mk_curve;
+#endif
 
 void           mousekey_task(void);
 void           mousekey_on(uint8_t code);
@@ -0,0 +1,91 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mousekey_motion.h"
+#include "progmem.h"
+#include "util.h"
+
+/* Fraction of the way to the maximum speed (0-255) at evenly spaced times from 0 to time_to_max, ease in and out by default */
+#ifndef MOUSEKEY_MOTION_TABLE
+#    define MOUSEKEY_MOTION_TABLE \
+        { 0, 11, 40, 81, 128, 174, 215, 244, 255 }
+#endif
+
+static const uint8_t motion_table[] PROGMEM = MOUSEKEY_MOTION_TABLE;
+
+_Static_assert(ARRAY_SIZE(motion_table) >= 2, "MOUSEKEY_MOTION_TABLE needs at least two entries");
+
+void mousekey_motion_reset(mousekey_motion_t *motion) {
+    motion->x       = 0;
+    motion->y       = 0;
+    motion->elapsed = 0;
+}
+
+uint32_t mousekey_motion_shape(uint8_t curve, uint32_t progress) {
+    if (progress >= MOUSEKEY_MOTION_ONE) {
+        return curve == MOUSEKEY_CURVE_TABLE ? ((uint32_t)pgm_read_byte(&motion_table[ARRAY_SIZE(motion_table) - 1]) << 16) / 255 : MOUSEKEY_MOTION_ONE;
+    }
+
+    switch (curve) {
+        case MOUSEKEY_CURVE_QUADRATIC:
+            return (progress * progress) >> 16;
+        case MOUSEKEY_CURVE_TABLE: {
+            // Linear interpolation between the two surrounding entries
+            uint32_t scaled = progress * (ARRAY_SIZE(motion_table) - 1);
+            uint8_t  index  = scaled >> 16;
+            uint32_t frac   = scaled & 0xFFFF;
+            int32_t  a      = pgm_read_byte(&motion_table[index]);
+            int32_t  b      = pgm_read_byte(&motion_table[index + 1]);
+            return (uint32_t)((a << 16) + (b - a) * (int32_t)frac) / 255;
+        }
+        default:
+            return progress;
+    }
+}
+
+uint32_t mousekey_motion_velocity(const mousekey_motion_profile_t *profile, uint16_t elapsed) {
+    if (elapsed < profile->delay) {
+        return 0;
+    }
+
+    uint16_t time     = elapsed - profile->delay;
+    uint32_t progress = time >= profile->time_to_max ? MOUSEKEY_MOTION_ONE : ((uint32_t)time << 16) / profile->time_to_max;
+    uint32_t shape    = mousekey_motion_shape(profile->curve, progress);
+
+    // Q16 pixels per second, which stays between the initial and maximum speed times 2^16 and so fits in 32 bits
+    uint32_t speed = (uint32_t)profile->initial_speed << 16;
+    if (profile->max_speed >= profile->initial_speed) {
+        speed += (uint32_t)(profile->max_speed - profile->initial_speed) * shape;
+    } else {
+        speed -= (uint32_t)(profile->initial_speed - profile->max_speed) * shape;
+    }
+    return speed / 1000;
+}
+
+void mousekey_motion_integrate(mousekey_motion_t *motion, const mousekey_motion_profile_t *profile, int8_t dx, int8_t dy, uint16_t ms) {
+    for (; ms > 0; --ms) {
+        int32_t velocity = mousekey_motion_velocity(profile, motion->elapsed);
+
+        // 181/256 approximates 1/sqrt(2), as in times_inv_sqrt2()
+        if (dx && dy) {
+            velocity = (velocity >> 8) * 181;
+        }
+
+        motion->x += dx * velocity;
+        motion->y += dy * velocity;
+        if (motion->elapsed < UINT16_MAX) {
+            motion->elapsed++;
+        }
+    }
+}
+
+int8_t mousekey_motion_take(int32_t *position, int8_t limit) {
+    int32_t whole = *position / MOUSEKEY_MOTION_ONE;
+    if (whole > limit) {
+        whole = limit;
+    } else if (whole < -limit) {
+        whole = -limit;
+    }
+    *position -= whole * MOUSEKEY_MOTION_ONE;
+    return whole;
+}
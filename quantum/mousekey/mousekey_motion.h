@@ -0,0 +1,81 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Positions are Q16 fixed point: MOUSEKEY_MOTION_ONE is one pixel, or one wheel step.
+ */
+#define MOUSEKEY_MOTION_ONE ((int32_t)1 << 16)
+
+/**
+ * Shapes of the ramp from the initial speed to the maximum speed.
+ */
+enum mousekey_curve {
+    MOUSEKEY_CURVE_LINEAR,    // speed grows evenly with time
+    MOUSEKEY_CURVE_QUADRATIC, // speed grows with the square of time, for finer control at low speeds
+    MOUSEKEY_CURVE_TABLE,     // speed follows MOUSEKEY_MOTION_TABLE
+};
+
+/**
+ * How the speed of a held key evolves. Speeds are in pixels (or wheel steps) per second, times in milliseconds.
+ */
+typedef struct {
+    uint16_t initial_speed; // speed once the delay has passed
+    uint16_t max_speed;     // speed from time_to_max on
+    uint16_t delay;         // time from the key press until continuous motion starts
+    uint16_t time_to_max;   // time from the end of the delay until max_speed is reached
+    uint8_t  curve;         // enum mousekey_curve
+} mousekey_motion_profile_t;
+
+/**
+ * Motion along two axes, sharing one ramp.
+ */
+typedef struct {
+    int32_t  x;       // Q16 distance travelled but not reported yet
+    int32_t  y;       // ...
+    uint16_t elapsed; // time since the motion started, saturating
+} mousekey_motion_t;
+
+/**
+ * @brief Stops the motion, dropping any distance not reported yet
+ */
+void mousekey_motion_reset(mousekey_motion_t *motion);
+
+/**
+ * @brief Evaluates a ramp curve
+ *
+ * @param curve enum mousekey_curve
+ * @param progress Q16 fraction of time_to_max elapsed, from 0 to MOUSEKEY_MOTION_ONE
+ * @return Q16 fraction of the way from the initial speed to the maximum speed
+ */
+uint32_t mousekey_motion_shape(uint8_t curve, uint32_t progress);
+
+/**
+ * @brief Speed of the motion a given time after it started
+ *
+ * @return Q16 pixels per millisecond
+ */
+uint32_t mousekey_motion_velocity(const mousekey_motion_profile_t *profile, uint16_t elapsed);
+
+/**
+ * @brief Advances the motion one millisecond at a time
+ *
+ * Moving along both axes at once scales the speed by 1/sqrt(2), so that diagonals are not faster.
+ *
+ * @param dx direction along x: -1, 0 or 1
+ * @param dy direction along y: -1, 0 or 1
+ * @param ms number of milliseconds to integrate
+ */
+void mousekey_motion_integrate(mousekey_motion_t *motion, const mousekey_motion_profile_t *profile, int8_t dx, int8_t dy, uint16_t ms);
+
+/**
+ * @brief Removes the whole pixels from a position, keeping the fraction for later
+ *
+ * @param position Q16 position, mousekey_motion_t::x or mousekey_motion_t::y
+ * @param limit largest magnitude to take, anything beyond is kept for later
+ * @return whole pixels taken, rounded towards zero
+ */
+int8_t mousekey_motion_take(int32_t *position, int8_t limit);
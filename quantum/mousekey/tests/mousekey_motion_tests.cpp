@@ -0,0 +1,264 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <cmath>
+#include <vector>
+
+extern "C" {
+#include "keycodes.h"
+#include "mousekey.h"
+#include "mousekey_motion.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Mock host, recording every report sent and when */
+struct sent_report {
+    report_mouse_t report;
+    uint32_t       time;
+};
+static std::vector<sent_report> sent;
+
+extern "C" void host_mouse_send(report_mouse_t *report) {
+    sent.push_back({*report, timer_read32()});
+}
+
+extern "C" bool has_mouse_report_changed(report_mouse_t *new_report, report_mouse_t *old_report) {
+    return (new_report->buttons != old_report->buttons) || (new_report->x != 0 && new_report->x != old_report->x) || (new_report->y != 0 && new_report->y != old_report->y) || (new_report->h != 0 && new_report->h != old_report->h) || (new_report->v != 0 && new_report->v != old_report->v);
+}
+
+/* Speed of a profile in pixels per millisecond, computed in floating point from the definition of each curve */
+static double expected_velocity(const mousekey_motion_profile_t &profile, int elapsed) {
+    static const double table[] = {0, 11, 40, 81, 128, 174, 215, 244, 255};
+
+    if (elapsed < profile.delay) {
+        return 0;
+    }
+    double progress = profile.time_to_max ? std::min(1.0, (double)(elapsed - profile.delay) / profile.time_to_max) : 1.0;
+    double shape;
+    switch (profile.curve) {
+        case MOUSEKEY_CURVE_QUADRATIC:
+            shape = progress * progress;
+            break;
+        case MOUSEKEY_CURVE_TABLE: {
+            double scaled = progress * 8;
+            int    index  = std::min(7, (int)scaled);
+            shape         = (table[index] + (table[index + 1] - table[index]) * (scaled - index)) / 255;
+        } break;
+        default:
+            shape = progress;
+            break;
+    }
+    return (profile.initial_speed + (profile.max_speed - profile.initial_speed) * shape) / 1000;
+}
+
+static double to_pixels(int32_t position) {
+    return (double)position / MOUSEKEY_MOTION_ONE;
+}
+
+TEST(MousekeyMotionShape, Curves) {
+    for (uint32_t progress = 0; progress <= MOUSEKEY_MOTION_ONE; progress += 1024) {
+        EXPECT_EQ(mousekey_motion_shape(MOUSEKEY_CURVE_LINEAR, progress), progress);
+        EXPECT_NEAR(mousekey_motion_shape(MOUSEKEY_CURVE_QUADRATIC, progress), (double)progress * progress / MOUSEKEY_MOTION_ONE, 1);
+    }
+    EXPECT_EQ(mousekey_motion_shape(MOUSEKEY_CURVE_TABLE, 0), 0);
+    EXPECT_EQ(mousekey_motion_shape(MOUSEKEY_CURVE_TABLE, MOUSEKEY_MOTION_ONE / 2), MOUSEKEY_MOTION_ONE * 128 / 255);
+    EXPECT_EQ(mousekey_motion_shape(MOUSEKEY_CURVE_TABLE, MOUSEKEY_MOTION_ONE), MOUSEKEY_MOTION_ONE);
+    EXPECT_EQ(mousekey_motion_shape(MOUSEKEY_CURVE_LINEAR, 2 * MOUSEKEY_MOTION_ONE), MOUSEKEY_MOTION_ONE);
+}
+
+TEST(MousekeyMotionShape, TableIsMonotonic) {
+    uint32_t last = 0;
+    for (uint32_t progress = 0; progress <= MOUSEKEY_MOTION_ONE; progress += 64) {
+        uint32_t shape = mousekey_motion_shape(MOUSEKEY_CURVE_TABLE, progress);
+        EXPECT_GE(shape, last) << "at " << progress;
+        last = shape;
+    }
+}
+
+TEST(MousekeyMotionTake, KeepsFraction) {
+    int32_t position = 5 * MOUSEKEY_MOTION_ONE / 2;
+    EXPECT_EQ(mousekey_motion_take(&position, 127), 2);
+    EXPECT_EQ(position, MOUSEKEY_MOTION_ONE / 2);
+
+    position = -5 * MOUSEKEY_MOTION_ONE / 2;
+    EXPECT_EQ(mousekey_motion_take(&position, 127), -2);
+    EXPECT_EQ(position, -MOUSEKEY_MOTION_ONE / 2);
+
+    position = 200 * MOUSEKEY_MOTION_ONE + 1;
+    EXPECT_EQ(mousekey_motion_take(&position, 127), 127);
+    EXPECT_EQ(position, 73 * MOUSEKEY_MOTION_ONE + 1);
+}
+
+class MousekeyMotionTrajectory : public ::testing::TestWithParam<uint8_t> {};
+
+TEST_P(MousekeyMotionTrajectory, FollowsCurve) {
+    const mousekey_motion_profile_t profile = {100, 3000, 150, 800, GetParam()};
+    mousekey_motion_t               motion  = {};
+    double                          travel  = 0;
+
+    for (int ms = 0; ms < 1500; ++ms) {
+        EXPECT_NEAR(to_pixels(mousekey_motion_velocity(&profile, ms)), expected_velocity(profile, ms), 0.0002) << "at " << ms << " ms";
+        travel += expected_velocity(profile, ms);
+
+        mousekey_motion_integrate(&motion, &profile, 1, 0, 1);
+        EXPECT_NEAR(to_pixels(motion.x), travel, 0.05) << "after " << ms + 1 << " ms";
+        EXPECT_EQ(motion.y, 0);
+    }
+
+    // Integrating in one go gives the same trajectory as one millisecond at a time
+    mousekey_motion_t bulk = {};
+    mousekey_motion_integrate(&bulk, &profile, 1, 0, 1500);
+    EXPECT_EQ(bulk.x, motion.x);
+    EXPECT_EQ(bulk.elapsed, 1500);
+}
+
+TEST_P(MousekeyMotionTrajectory, DiagonalIsNotFaster) {
+    const mousekey_motion_profile_t profile  = {100, 3000, 0, 800, GetParam()};
+    mousekey_motion_t               straight = {};
+    mousekey_motion_t               diagonal = {};
+
+    mousekey_motion_integrate(&straight, &profile, 0, -1, 1000);
+    mousekey_motion_integrate(&diagonal, &profile, -1, 1, 1000);
+    EXPECT_EQ(-diagonal.x, diagonal.y);
+    EXPECT_NEAR(to_pixels(diagonal.y), -to_pixels(straight.y) / std::sqrt(2.0), 2);
+}
+
+INSTANTIATE_TEST_SUITE_P(Curves, MousekeyMotionTrajectory, ::testing::Values(MOUSEKEY_CURVE_LINEAR, MOUSEKEY_CURVE_QUADRATIC, MOUSEKEY_CURVE_TABLE), [](const ::testing::TestParamInfo<uint8_t> &info) {
+    switch (info.param) {
+        case MOUSEKEY_CURVE_LINEAR:
+            return "Linear";
+        case MOUSEKEY_CURVE_QUADRATIC:
+            return "Quadratic";
+        default:
+            return "Table";
+    }
+});
+
+class MousekeyMotionEngine : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        mousekey_clear();
+        mousekey_task();
+        sent.clear();
+    }
+
+    void press(uint8_t code) {
+        mousekey_on(code);
+        mousekey_send();
+    }
+
+    void release(uint8_t code) {
+        mousekey_off(code);
+        mousekey_send();
+    }
+
+    // Runs the task every millisecond, like a fast matrix scan would
+    void run(uint32_t ms) {
+        for (; ms > 0; --ms) {
+            advance_time(1);
+            mousekey_task();
+        }
+    }
+
+    int32_t sum_x(size_t from = 0) {
+        int32_t sum = 0;
+        for (size_t i = from; i < sent.size(); ++i) {
+            sum += sent[i].report.x;
+        }
+        return sum;
+    }
+};
+
+TEST_F(MousekeyMotionEngine, TapMovesOnePixel) {
+    press(KC_MS_RIGHT);
+    run(50);
+    release(KC_MS_RIGHT);
+    run(500);
+
+    EXPECT_EQ(sum_x(), MOUSEKEY_MOVE_DELTA);
+    for (auto &s : sent) {
+        EXPECT_EQ(s.report.y, 0);
+    }
+}
+
+TEST_F(MousekeyMotionEngine, HeldKeyFollowsCurve) {
+    const mousekey_motion_profile_t profile = {MOUSEKEY_INITIAL_SPEED, MOUSEKEY_BASE_SPEED, MOUSEKEY_DELAY, MOUSEKEY_MOTION_TIME_TO_MAX, MOUSEKEY_MOTION_CURVE};
+
+    press(KC_MS_RIGHT);
+    size_t first = sent.size();
+    double travel = 0;
+    for (int ms = 0; ms < 2000; ++ms) {
+        travel += expected_velocity(profile, ms);
+        run(1);
+        EXPECT_LE(sum_x(first), travel + 0.2) << "after " << ms + 1 << " ms";
+        EXPECT_GT(sum_x(first), travel - 1.2) << "after " << ms + 1 << " ms";
+    }
+
+    // Reports are only sent when the cursor moves by a whole pixel
+    for (size_t i = first; i < sent.size(); ++i) {
+        EXPECT_NE(sent[i].report.x, 0);
+        EXPECT_EQ(sent[i].report.y, 0);
+    }
+    EXPECT_LT(sent.size() - first, 2000);
+
+    release(KC_MS_RIGHT);
+    size_t after = sent.size();
+    run(100);
+    EXPECT_EQ(sent.size(), after);
+}
+
+TEST_F(MousekeyMotionEngine, SlowMotionIsEven) {
+    // KC_ACL0 moves at a constant MOUSEKEY_DECELERATED_SPEED, 400 pixels per second or a pixel every 2.5 ms
+    press(KC_MS_ACCEL0);
+    press(KC_MS_DOWN);
+    run(MOUSEKEY_DELAY);
+    size_t first = sent.size();
+    run(1000);
+
+    EXPECT_NEAR(sent.size() - first, 400, 1);
+    for (size_t i = first; i < sent.size(); ++i) {
+        EXPECT_EQ(sent[i].report.y, 1);
+        if (i > first) {
+            uint32_t gap = sent[i].time - sent[i - 1].time;
+            EXPECT_TRUE(gap == 2 || gap == 3) << "gap of " << gap << " ms";
+        }
+    }
+}
+
+TEST_F(MousekeyMotionEngine, SlowTaskKeepsDistance) {
+    // The same distance is travelled however often the task runs
+    press(KC_MS_LEFT);
+    for (int i = 0; i < 100; ++i) {
+        advance_time(20);
+        mousekey_task();
+    }
+    int32_t coarse = sum_x();
+
+    release(KC_MS_LEFT);
+    run(10);
+    sent.clear();
+    press(KC_MS_LEFT);
+    run(2000);
+    EXPECT_EQ(sum_x(), coarse);
+    EXPECT_LT(coarse, 0);
+}
+
+TEST_F(MousekeyMotionEngine, WheelUsesItsOwnProfile) {
+    press(KC_MS_WH_UP);
+    run(MOUSEKEY_WHEEL_DELAY + 1000);
+
+    int32_t steps = 0;
+    for (auto &s : sent) {
+        EXPECT_EQ(s.report.x, 0);
+        EXPECT_GE(s.report.v, 0);
+        steps += s.report.v;
+    }
+    // One step on the press, then ramping from the initial to the base number of movements per second
+    EXPECT_GT(steps, MOUSEKEY_WHEEL_INITIAL_MOVEMENTS);
+    EXPECT_LT(steps, MOUSEKEY_WHEEL_BASE_MOVEMENTS + 1);
+}
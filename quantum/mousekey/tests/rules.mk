@@ -0,0 +1,8 @@
+mousekey_motion_DEFS := -DMOUSE_ENABLE -DMOUSEKEY_ENABLE -DMOUSEKEY_MOTION_ENGINE -DNO_DEBUG -DNO_PRINT
+mousekey_motion_INC := $(QUANTUM_PATH)/mousekey
+
+mousekey_motion_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/mousekey/tests/mousekey_motion_tests.cpp \
+	$(QUANTUM_PATH)/mousekey.c \
+	$(QUANTUM_PATH)/mousekey/mousekey_motion.c
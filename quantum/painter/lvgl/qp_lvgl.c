@@ -2,6 +2,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "qp_internal.h"
 #include "qp_lvgl.h"
 #include "timer.h"
 #include "deferred_exec.h"
@@ -19,16 +20,129 @@ static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_ta
 painter_device_t selected_display = NULL;
 void *           color_buffer     = NULL;
 
+static qp_lvgl_stats_t lvgl_stats          = {0};
+static uint32_t        lvgl_handler_start  = 0; // When lv_task_handler was last invoked
+static uint32_t        lvgl_frame_start    = 0; // When the refresh currently being sent was started
+static bool            lvgl_frame_active   = false;
+static bool            lvgl_work_performed = false; // Whether the current task invocation did any LVGL work
+
+#if QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+// Area handed over by LVGL which is still being sent to the display, a chunk of rows at a time
+typedef struct lvgl_flush_state_t {
+    lv_disp_drv_t *disp;
+    lv_area_t      area;
+    lv_color_t *   color_p;
+    lv_coord_t     next_row;
+    bool           active;
+} lvgl_flush_state_t;
+
+static lvgl_flush_state_t lvgl_flush = {0};
+#endif // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+
+#if QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS > 0
+_Static_assert((QUANTUM_PAINTER_LVGL_MAX_DEFER_MS) > 0, "QUANTUM_PAINTER_LVGL_MAX_DEFER_MS must be greater than 0");
+
+// Tracks how long a piece of LVGL work has been postponed because of input activity
+typedef struct lvgl_holdoff_t {
+    uint32_t since;
+    bool     active;
+} lvgl_holdoff_t;
+
+static lvgl_holdoff_t lvgl_refresh_holdoff = {0};
+#    if QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+static lvgl_holdoff_t lvgl_chunk_holdoff = {0};
+#    endif // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+
+// Returns true if work should be postponed, which is never for longer than QUANTUM_PAINTER_LVGL_MAX_DEFER_MS at a time
+static bool qp_lvgl_hold_off(lvgl_holdoff_t *holdoff) {
+    if (last_input_activity_elapsed() >= QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS) {
+        holdoff->active = false;
+        return false;
+    }
+
+    if (!holdoff->active) {
+        holdoff->since  = timer_read32();
+        holdoff->active = true;
+        return true;
+    }
+
+    // Continuous typing would otherwise leave the display stale indefinitely
+    if (timer_elapsed32(holdoff->since) >= QUANTUM_PAINTER_LVGL_MAX_DEFER_MS) {
+        holdoff->active = false;
+        return false;
+    }
+
+    return true;
+}
+#endif // QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter LVGL Integration Internal: qp_lvgl_flush
 
+static void qp_lvgl_flush_done(lv_disp_drv_t *disp) {
+    // Only the last area of a refresh completes the frame
+    if (lvgl_frame_active && lv_disp_flush_is_last(disp)) {
+        lvgl_stats.frame_time = timer_elapsed32(lvgl_frame_start);
+        if (lvgl_stats.frame_time > lvgl_stats.max_frame_time) {
+            lvgl_stats.max_frame_time = lvgl_stats.frame_time;
+        }
+        lvgl_frame_active = false;
+    }
+    lv_disp_flush_ready(disp);
+}
+
+#if QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+static void qp_lvgl_flush_chunk(void) {
+    if (!lvgl_flush.active) {
+        return;
+    }
+
+    // Send as many whole rows as fit within the chunk size, but always at least one
+    lv_coord_t width = lvgl_flush.area.x2 - lvgl_flush.area.x1 + 1;
+    lv_coord_t rows  = QP_MAX(1, QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS / width);
+    if (lvgl_flush.next_row + rows - 1 > lvgl_flush.area.y2) {
+        rows = lvgl_flush.area.y2 - lvgl_flush.next_row + 1;
+    }
+
+    lv_color_t *chunk = lvgl_flush.color_p + (uint32_t)(lvgl_flush.next_row - lvgl_flush.area.y1) * width;
+    qp_viewport(selected_display, lvgl_flush.area.x1, lvgl_flush.next_row, lvgl_flush.area.x2, lvgl_flush.next_row + rows - 1);
+    qp_pixdata(selected_display, (void *)chunk, (uint32_t)rows * width);
+    lvgl_flush.next_row += rows;
+    lvgl_work_performed = true;
+
+    if (lvgl_flush.next_row > lvgl_flush.area.y2) {
+        qp_flush(selected_display);
+        lvgl_flush.active = false;
+        qp_lvgl_flush_done(lvgl_flush.disp);
+    }
+}
+
+static void qp_lvgl_wait(lv_disp_drv_t *disp) {
+    // LVGL needs the draw buffer back before it can continue, so finish sending the pending area now
+    qp_lvgl_flush_chunk();
+}
+#endif // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+
 void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     if (selected_display) {
+        if (!lvgl_frame_active) {
+            lvgl_frame_start  = lvgl_handler_start;
+            lvgl_frame_active = true;
+        }
+#if QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+        // Hand the area over to qp_lvgl_internal_tick, which sends it over the following task invocations
+        lvgl_flush.disp     = disp;
+        lvgl_flush.area     = *area;
+        lvgl_flush.color_p  = color_p;
+        lvgl_flush.next_row = area->y1;
+        lvgl_flush.active   = true;
+#else  // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
         uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
         qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
         qp_pixdata(selected_display, (void *)color_p, number_pixels);
         qp_flush(selected_display);
-        lv_disp_flush_ready(disp);
+        qp_lvgl_flush_done(disp);
+#endif // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
     }
 }
 
@@ -42,6 +156,15 @@ static uint32_t tick_task_callback(uint32_t trigger_time, void *cb_arg) {
             last_tick = now;
         } break;
         case 1:
+#if QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS > 0
+            // Leave the time to processing input while there's recent activity
+            if (qp_lvgl_hold_off(&lvgl_refresh_holdoff)) {
+                lvgl_stats.deferred_refreshes++;
+                break;
+            }
+#endif // QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS > 0
+            lvgl_handler_start  = timer_read32();
+            lvgl_work_performed = true;
             lv_task_handler();
             break;
 
@@ -95,17 +218,23 @@ bool qp_lvgl_attach(painter_device_t device) {
 
     // Set up lvgl display buffer
     static lv_disp_draw_buf_t draw_buf;
-    // Allocate a buffer for 1/10 screen size
+    // Allocate a buffer for 1/10 screen size, or two of them if areas are sent in chunks so that LVGL can render into
+    // one while the other is being sent
+#if QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+    const size_t num_buffers = 2;
+#else  // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+    const size_t num_buffers = 1;
+#endif // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
     const size_t count_required = driver->panel_width * driver->panel_height / 10;
-    color_buffer                = color_buffer ? realloc(color_buffer, sizeof(lv_color_t) * count_required) : malloc(sizeof(lv_color_t) * count_required);
+    color_buffer                = color_buffer ? realloc(color_buffer, sizeof(lv_color_t) * count_required * num_buffers) : malloc(sizeof(lv_color_t) * count_required * num_buffers);
     if (!color_buffer) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up memory buffer)\n");
         qp_lvgl_detach();
         return false;
     }
-    memset(color_buffer, 0, sizeof(lv_color_t) * count_required);
+    memset(color_buffer, 0, sizeof(lv_color_t) * count_required * num_buffers);
     // Initialize the display buffer.
-    lv_disp_draw_buf_init(&draw_buf, color_buffer, NULL, count_required);
+    lv_disp_draw_buf_init(&draw_buf, color_buffer, num_buffers > 1 ? (lv_color_t *)color_buffer + count_required : NULL, count_required);
 
     selected_display = device;
 
@@ -119,6 +248,9 @@ bool qp_lvgl_attach(painter_device_t device) {
     disp_drv.draw_buf = &draw_buf;     /*Assign the buffer to the display*/
     disp_drv.hor_res  = panel_width;   /*Set the horizontal resolution of the display*/
     disp_drv.ver_res  = panel_height;  /*Set the vertical resolution of the display*/
+#if QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+    disp_drv.wait_cb  = qp_lvgl_wait;  /*Keep sending the pending area while LVGL waits for a buffer*/
+#endif                                 // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
     lv_disp_drv_register(&disp_drv);   /*Finally register the driver*/
 
     return true;
@@ -135,13 +267,51 @@ void qp_lvgl_detach(void) {
         free(color_buffer);
         color_buffer = NULL;
     }
+#if QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+    lvgl_flush.active = false;
+#endif // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+#if QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS > 0
+    lvgl_refresh_holdoff.active = false;
+#    if QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+    lvgl_chunk_holdoff.active = false;
+#    endif // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+#endif // QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS > 0
+    lvgl_frame_active = false;
+    memset(&lvgl_stats, 0, sizeof(lvgl_stats));
     selected_display = NULL;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter LVGL Integration API: qp_lvgl_get_stats
+
+void qp_lvgl_get_stats(qp_lvgl_stats_t *stats) {
+    *stats = lvgl_stats;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter LVGL Integration Internal: qp_lvgl_internal_tick
 
 void qp_lvgl_internal_tick(void) {
     static uint32_t last_lvgl_exec = 0;
+    uint32_t        start          = timer_read32();
+    lvgl_work_performed            = false;
+
+#if QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+#    if QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS > 0
+    if (lvgl_flush.active && !qp_lvgl_hold_off(&lvgl_chunk_holdoff))
+#    endif // QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS > 0
+    {
+        qp_lvgl_flush_chunk();
+    }
+#endif // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS > 0
+
     deferred_exec_advanced_task(lvgl_executors, 2, &last_lvgl_exec);
+
+    // Everything done here holds up the rest of the keyboard loop, including input processing
+    if (lvgl_work_performed) {
+        lvgl_stats.input_latency = timer_elapsed32(start);
+        if (lvgl_stats.input_latency > lvgl_stats.max_input_latency) {
+            lvgl_stats.max_input_latency = lvgl_stats.input_latency;
+        }
+    }
 }
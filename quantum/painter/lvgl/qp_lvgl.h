@@ -7,6 +7,47 @@
 #include "qp.h"
 #include "lvgl.h"
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter - LVGL configurables
+
+#ifndef QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS
+/**
+ * @def This controls the maximum number of pixels sent to the display per Quantum Painter task invocation when
+ *      flushing areas rendered by LVGL. Whole rows are always sent, so at least one row goes out each time.
+ *      When non-zero, LVGL is also given a second draw buffer so it can render the next area while the previous
+ *      one is still being sent. Set to 0 to send each area in its entirety from within LVGL's flush callback.
+ */
+#    define QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS 0
+#endif // QUANTUM_PAINTER_LVGL_FLUSH_CHUNK_PIXELS
+
+#ifndef QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS
+/**
+ * @def This controls how long (in milliseconds) LVGL refreshes are suspended after any matrix, encoder, or pointing
+ *      device activity, so that input is processed without waiting on rendering. Set to 0 to disable.
+ */
+#    define QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS 0
+#endif // QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS
+
+#ifndef QUANTUM_PAINTER_LVGL_MAX_DEFER_MS
+/**
+ * @def This controls the longest time (in milliseconds) that QUANTUM_PAINTER_LVGL_INPUT_HOLDOFF_MS may postpone LVGL
+ *      refreshes or chunk sending during continuous input activity. Once exceeded, one refresh or chunk is processed
+ *      regardless, so the display keeps updating while typing.
+ */
+#    define QUANTUM_PAINTER_LVGL_MAX_DEFER_MS 500
+#endif // QUANTUM_PAINTER_LVGL_MAX_DEFER_MS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter - LVGL types
+
+typedef struct qp_lvgl_stats_t {
+    uint32_t frame_time;         // Milliseconds from the start of the most recent LVGL refresh until its last area was sent
+    uint32_t max_frame_time;     // Longest frame_time seen since attaching
+    uint32_t input_latency;      // Milliseconds spent in LVGL during the most recent task invocation which did any LVGL work
+    uint32_t max_input_latency;  // Longest input_latency seen since attaching
+    uint32_t deferred_refreshes; // Number of LVGL refreshes postponed because of recent input activity
+} qp_lvgl_stats_t;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter - LVGL External API
 
@@ -23,3 +64,12 @@ bool qp_lvgl_attach(painter_device_t device);
  * Disconnects LVGL from any attached display
  */
 void qp_lvgl_detach(void);
+
+/**
+ * Retrieves LVGL rendering statistics gathered since the last call to qp_lvgl_attach().
+ *
+ * Frame time and input latency are measured using the millisecond system timer.
+ *
+ * @param stats[out] the location to write the statistics to
+ */
+void qp_lvgl_get_stats(qp_lvgl_stats_t *stats);
@@ -10,7 +10,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF API
 
-bool qff_read_font_descriptor(qp_stream_t *stream, uint8_t *line_height, bool *has_ascii_table, uint16_t *num_unicode_glyphs, uint8_t *bpp, bool *has_palette, painter_compression_t *compression_scheme, uint32_t *total_bytes) {
+bool qff_read_font_descriptor(qp_stream_t *stream, uint8_t *line_height, bool *has_ascii_table, uint16_t *num_unicode_glyphs, uint8_t *bpp, bool *has_palette, painter_compression_t *compression_scheme, uint8_t *flags, uint32_t *total_bytes) {
     // Seek to the start
     qp_stream_setpos(stream, 0);
 
@@ -56,6 +56,9 @@ bool qff_read_font_descriptor(qp_stream_t *stream, uint8_t *line_height, bool *h
     if (compression_scheme) {
         *compression_scheme = font_descriptor.compression_scheme;
     }
+    if (flags) {
+        *flags = font_descriptor.flags;
+    }
     if (total_bytes) {
         *total_bytes = font_descriptor.total_file_size;
     }
@@ -102,7 +105,7 @@ bool qff_validate_stream(qp_stream_t *stream) {
     bool     has_ascii_table;
     uint16_t num_unicode_glyphs;
 
-    if (!qff_read_font_descriptor(stream, NULL, &has_ascii_table, &num_unicode_glyphs, NULL, NULL, NULL, NULL)) {
+    if (!qff_read_font_descriptor(stream, NULL, &has_ascii_table, &num_unicode_glyphs, NULL, NULL, NULL, NULL, NULL)) {
         return false;
     }
 
@@ -127,7 +130,7 @@ uint32_t qff_get_total_size(qp_stream_t *stream) {
 
     // Read the font descriptor, grabbing the size
     uint32_t total_size;
-    if (!qff_read_font_descriptor(stream, NULL, NULL, NULL, NULL, NULL, NULL, &total_size)) {
+    if (!qff_read_font_descriptor(stream, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &total_size)) {
         return false;
     }
 
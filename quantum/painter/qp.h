@@ -56,6 +56,15 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of unicode glyph lookups remembered for each loaded font. Glyphs outside the ASCII
+ *      table otherwise need a search of the font's unicode table every time they're measured or drawn. Each entry
+ *      costs 8 bytes of RAM per font slot; set to 0 to disable the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 8
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -64,6 +73,14 @@
 #    define QUANTUM_PAINTER_CONCURRENT_ANIMATIONS 4
 #endif // QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 
+#ifndef QUANTUM_PAINTER_NUM_DISPLAY_LISTS
+/**
+ * @def This controls the maximum number of display lists that can be created with \ref qp_display_list_make. Display
+ *      list contents are held in the buffer supplied by the caller, this only covers the bookkeeping for each one.
+ */
+#    define QUANTUM_PAINTER_NUM_DISPLAY_LISTS 2
+#endif // QUANTUM_PAINTER_NUM_DISPLAY_LISTS
+
 #ifndef QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE
 /**
  * @def This controls the maximum size of the pixel data buffer used for single blocks of transmission. Larger buffers
@@ -72,6 +89,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_ASYNC_PIXDATA
+/**
+ * @def This controls whether pixel data is transmitted asynchronously, for comms drivers that support it. The pixel
+ *      data buffer is split in two halves, one of which is filled while the other is being transmitted. Solid fills are
+ *      queued and drained from the Quantum Painter task, so drawing calls return without waiting for the transfer.
+ */
+#    define QUANTUM_PAINTER_ASYNC_PIXDATA FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -129,6 +155,11 @@ typedef struct painter_font_desc_t {
  */
 typedef const painter_font_desc_t *painter_font_handle_t;
 
+/**
+ * @typedef A handle to a Quantum Painter display list.
+ */
+typedef const void *painter_display_list_t;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API
 
@@ -394,6 +425,30 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
  */
 void qp_stop_animation(deferred_token anim_token);
 
+/**
+ * Attaches a cache to a running animation, so that frames are stored in the device's native pixel format the first
+ * time they're rendered and are subsequently transmitted without decoding the image.
+ *
+ * @note Frames which don't fit in the remaining space are decoded from the image as normal. The cache is tied to the
+ *       animation's device, location, and colors, and is discarded when the animation is stopped.
+ *
+ * @param anim_token[in] the animation token returned by \ref qp_animate, or \ref qp_animate_recolor.
+ * @param arena[in] 4-byte aligned memory to hold the cached frames, or NULL to detach any existing cache
+ * @param arena_size[in] the number of bytes available in the arena; see \ref qp_animation_cache_size
+ * @return true if the cache was attached
+ * @return false if the token was invalid, or the arena was misaligned or too small to hold the frame table
+ */
+bool qp_animation_cache(deferred_token anim_token, void *arena, uint32_t arena_size);
+
+/**
+ * Calculates the number of bytes required to cache every frame of an animation on the given device.
+ *
+ * @param device[in] the handle of the device the animation will be drawn on
+ * @param image[in] the handle of the image to be animated
+ * @return the required size of the arena passed to \ref qp_animation_cache, or 0 if the image could not be read
+ */
+uint32_t qp_animation_cache_size(painter_device_t device, painter_image_handle_t image);
+
 /**
  * Loads a font into memory.
  *
@@ -453,6 +508,106 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+/**
+ * Creates a display list, which records drawing primitives for a frame and, when rendered, only redraws the parts of
+ * the display that differ from the previously-rendered frame.
+ *
+ * @note The buffer is split in two: one half holds the frame being recorded, the other the frame on the display. Each
+ *       primitive takes 28 bytes, plus the font handle and string for text.
+ *
+ * @param device[in] the handle of the device to draw on
+ * @param buffer[in] the memory used to hold the recorded primitives, which must remain valid while the list is in use
+ * @param buffer_size[in] the size of the buffer in bytes
+ * @param hue_bg[in] the hue used to clear areas no longer covered by a primitive, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the saturation used to clear areas no longer covered by a primitive, with 0-100% mapped to 0-255
+ * @param val_bg[in] the value used to clear areas no longer covered by a primitive, with 0-100% mapped to 0-255
+ * @return a display list handle usable with the other qp_display_list_* functions
+ * @return NULL if the device or buffer was invalid, or all display lists are in use
+ */
+painter_display_list_t qp_display_list_make(painter_device_t device, void *buffer, uint32_t buffer_size, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+/**
+ * Closes a display list handle when no longer in use.
+ *
+ * @param list[in] the handle of the display list
+ * @return true if closing the display list succeeded
+ * @return false if the handle was invalid
+ */
+bool qp_display_list_close(painter_display_list_t list);
+
+/**
+ * Starts recording a new frame, discarding anything recorded since the last \ref qp_display_list_render.
+ *
+ * @param list[in] the handle of the display list
+ * @return true if recording started
+ * @return false if the handle was invalid
+ */
+bool qp_display_list_begin(painter_display_list_t list);
+
+/**
+ * Forces the next \ref qp_display_list_render to clear and redraw the whole display, for example after something else
+ * has drawn to it.
+ *
+ * @param list[in] the handle of the display list
+ */
+void qp_display_list_invalidate(painter_display_list_t list);
+
+/**
+ * Records a rectangle, see \ref qp_rect. Filled rectangles of the same color sharing a full edge with the previously
+ * recorded one are merged into it.
+ *
+ * @return false if the list is out of space
+ */
+bool qp_display_list_rect(painter_display_list_t list, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records a line, see \ref qp_line.
+ *
+ * @return false if the list is out of space
+ */
+bool qp_display_list_line(painter_display_list_t list, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val);
+
+/**
+ * Records a circle, see \ref qp_circle.
+ *
+ * @return false if the list is out of space
+ */
+bool qp_display_list_circle(painter_display_list_t list, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records an ellipse, see \ref qp_ellipse.
+ *
+ * @return false if the list is out of space
+ */
+bool qp_display_list_ellipse(painter_display_list_t list, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records text, see \ref qp_drawtext. The string is copied into the display list.
+ *
+ * @return false if the list is out of space, or the font was invalid
+ */
+bool qp_display_list_drawtext(painter_display_list_t list, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str);
+
+/**
+ * Records recolored text, see \ref qp_drawtext_recolor. The string is copied into the display list.
+ *
+ * @return false if the list is out of space, or the font was invalid
+ */
+bool qp_display_list_drawtext_recolor(painter_display_list_t list, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+/**
+ * Draws the primitives recorded since \ref qp_display_list_begin which differ from the previously-rendered frame,
+ * along with anything they overlap, then starts recording the next frame.
+ *
+ * @note The first render after \ref qp_display_list_make or \ref qp_display_list_invalidate clears the display to the
+ *       background color and draws everything.
+ *
+ * @param list[in] the handle of the display list
+ * @return true if drawing succeeded
+ * @return false if drawing failed, in which case the next render redraws everything
+ */
+bool qp_display_list_render(painter_display_list_t list);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
@@ -2,6 +2,185 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_comms.h"
+#include "qp_draw.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous pixdata queue
+//
+// Transfers out of the pixdata buffer are queued rather than waited upon, for comms drivers which provide
+// comms_send_async. Only one transfer is in flight at a time; the queue is advanced from thread context by
+// qp_comms_async_task(), so the comms driver's completion interrupt never has to start the next transfer itself.
+// Consecutive transmissions of the same data (such as solid fills) are coalesced into a single entry with a repeat
+// count.
+//
+// Once qp_comms_stop() has been called for the operation, the remaining transfers drain in the background. The bus is
+// then released as soon as each transfer completes, and only reclaimed for the next one on a later pass, leaving it
+// free for other clients of the same bus (such as SPI pointing devices or flash) in the meantime.
+
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+
+#    define QP_COMMS_ASYNC_QUEUE_SIZE 4
+
+typedef struct qp_comms_async_job_t {
+    painter_device_t device;
+    const void      *data;
+    uint32_t         byte_count;
+    uint32_t         repeats; // number of further transmissions of the same data
+} qp_comms_async_job_t;
+
+static qp_comms_async_job_t qp_comms_async_queue[QP_COMMS_ASYNC_QUEUE_SIZE];
+static uint8_t              qp_comms_async_head      = 0;
+static uint8_t              qp_comms_async_count     = 0;
+static bool                 qp_comms_async_started   = false;
+static volatile bool        qp_comms_async_in_flight = false;
+static painter_device_t     qp_comms_async_device    = NULL;  // device whose comms were most recently started
+static bool                 qp_comms_async_claimed   = false; // comms are started for qp_comms_async_device
+static bool                 qp_comms_async_open      = false; // qp_comms_stop() hasn't yet been called for it
+static bool                 qp_comms_async_blocked   = false; // comms couldn't be restarted to send queued data
+static bool                 qp_comms_async_failed    = false; // a queued transfer couldn't be sent
+
+void qp_comms_async_complete(void) {
+    qp_comms_async_in_flight = false;
+}
+
+static void qp_comms_async_pop(void) {
+    qp_comms_async_head = (qp_comms_async_head + 1) % QP_COMMS_ASYNC_QUEUE_SIZE;
+    qp_comms_async_count--;
+}
+
+static void qp_comms_async_release_bus(void) {
+    painter_driver_t *driver = (painter_driver_t *)qp_comms_async_device;
+    driver->comms_vtable->comms_stop(qp_comms_async_device);
+    qp_comms_async_claimed = false;
+}
+
+bool qp_comms_async_task(void) {
+    if (qp_comms_async_in_flight) {
+        return false;
+    }
+
+    // Retire the transfer that just completed
+    if (qp_comms_async_started) {
+        qp_comms_async_started    = false;
+        qp_comms_async_job_t *job = &qp_comms_async_queue[qp_comms_async_head];
+        if (job->repeats > 0) {
+            job->repeats--;
+        } else {
+            qp_comms_async_pop();
+        }
+
+        // Once the operation has been stopped, give the bus up for the rest of this pass
+        if (!qp_comms_async_open) {
+            qp_comms_async_release_bus();
+            return qp_comms_async_count == 0;
+        }
+    }
+
+    while (qp_comms_async_count > 0) {
+        qp_comms_async_job_t *job    = &qp_comms_async_queue[qp_comms_async_head];
+        painter_driver_t     *driver = (painter_driver_t *)job->device;
+
+        // Reclaim the bus if it was released after the previous transfer; if someone else has it, try again later
+        if (!qp_comms_async_claimed) {
+            if (!driver->comms_vtable->comms_start(job->device)) {
+                qp_comms_async_blocked = true;
+                return false;
+            }
+            qp_comms_async_claimed = true;
+        }
+        qp_comms_async_blocked = false;
+
+        qp_comms_async_started   = true;
+        qp_comms_async_in_flight = true;
+        if (driver->comms_vtable->comms_send_async(job->device, job->data, job->byte_count)) {
+            return false;
+        }
+
+        // Drop the transmission, and report the failure from the next send or comms start
+        qp_dprintf("qp_comms_async_task: fail (comms_send_async failed)\n");
+        qp_comms_async_started   = false;
+        qp_comms_async_in_flight = false;
+        qp_comms_async_failed    = true;
+        qp_comms_async_pop();
+    }
+
+    if (qp_comms_async_claimed && !qp_comms_async_open) {
+        qp_comms_async_release_bus();
+    }
+    return true;
+}
+
+// Returns false if a queued transfer failed since the last check
+static bool qp_comms_async_check(void) {
+    bool ok               = !qp_comms_async_failed;
+    qp_comms_async_failed = false;
+    return ok;
+}
+
+// Drops every queued transfer if the bus couldn't be reclaimed to send them, so that callers waiting on the queue don't
+// spin forever -- the failure is reported from the next send or comms start
+static bool qp_comms_async_abandon_if_blocked(void) {
+    if (!qp_comms_async_blocked) {
+        return false;
+    }
+    qp_dprintf("qp_comms_async: fail (bus is in use, dropping %d queued transfers)\n", (int)qp_comms_async_count);
+    qp_comms_async_count   = 0;
+    qp_comms_async_blocked = false;
+    qp_comms_async_failed  = true;
+    return true;
+}
+
+bool qp_comms_async_flush(void) {
+    while (!qp_comms_async_task()) {
+        if (qp_comms_async_abandon_if_blocked()) {
+            break;
+        }
+    }
+    return qp_comms_async_check();
+}
+
+void qp_comms_async_release(const void *data, uint32_t byte_count) {
+    const uint8_t *start = (const uint8_t *)data;
+    const uint8_t *end   = start + byte_count;
+    for (;;) {
+        bool referenced = false;
+        for (uint8_t i = 0; i < qp_comms_async_count; ++i) {
+            const qp_comms_async_job_t *job = &qp_comms_async_queue[(qp_comms_async_head + i) % QP_COMMS_ASYNC_QUEUE_SIZE];
+            const uint8_t              *p   = (const uint8_t *)job->data;
+            if (p < end && p + job->byte_count > start) {
+                referenced = true;
+                break;
+            }
+        }
+        if (!referenced || (!qp_comms_async_task() && qp_comms_async_abandon_if_blocked())) {
+            return;
+        }
+    }
+}
+
+static void qp_comms_async_enqueue(painter_device_t device, const void *data, uint32_t byte_count) {
+    // Coalesce with the last entry if it's the same transmission
+    if (qp_comms_async_count > 0) {
+        qp_comms_async_job_t *tail = &qp_comms_async_queue[(qp_comms_async_head + qp_comms_async_count - 1) % QP_COMMS_ASYNC_QUEUE_SIZE];
+        if (tail->device == device && tail->data == data && tail->byte_count == byte_count) {
+            tail->repeats++;
+            qp_comms_async_task();
+            return;
+        }
+    }
+
+    while (qp_comms_async_count == QP_COMMS_ASYNC_QUEUE_SIZE) {
+        if (!qp_comms_async_task() && qp_comms_async_abandon_if_blocked()) {
+            return;
+        }
+    }
+
+    qp_comms_async_queue[(qp_comms_async_head + qp_comms_async_count) % QP_COMMS_ASYNC_QUEUE_SIZE] = (qp_comms_async_job_t){.device = device, .data = data, .byte_count = byte_count, .repeats = 0};
+    qp_comms_async_count++;
+    qp_comms_async_task();
+}
+
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base comms APIs
@@ -13,6 +192,10 @@ bool qp_comms_init(painter_device_t device) {
         return false;
     }
 
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    qp_comms_async_flush();
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+
     return driver->comms_vtable->comms_init(device);
 }
 
@@ -23,7 +206,20 @@ bool qp_comms_start(painter_device_t device) {
         return false;
     }
 
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    // Anything still queued from a previous operation needs to finish, including releasing the bus
+    if (!qp_comms_async_flush()) {
+        qp_dprintf("qp_comms_start: fail (previous transfers could not be completed)\n");
+        return false;
+    }
+
+    qp_comms_async_device  = device;
+    qp_comms_async_claimed = driver->comms_vtable->comms_start(device);
+    qp_comms_async_open    = qp_comms_async_claimed;
+    return qp_comms_async_claimed;
+#else  // QUANTUM_PAINTER_ASYNC_PIXDATA
     return driver->comms_vtable->comms_start(device);
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
 }
 
 void qp_comms_stop(painter_device_t device) {
@@ -33,6 +229,15 @@ void qp_comms_stop(painter_device_t device) {
         return;
     }
 
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    // Stops immediately if nothing is queued, otherwise the bus is released as each remaining transfer completes
+    if (device == qp_comms_async_device) {
+        qp_comms_async_open = false;
+        qp_comms_async_task();
+        return;
+    }
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+
     driver->comms_vtable->comms_stop(device);
 }
 
@@ -43,6 +248,18 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
         return false;
     }
 
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    // Only the pixdata buffer is guaranteed to be left untouched until the transfer completes
+    if (driver->comms_vtable->comms_send_async && qp_internal_is_pixdata_buffer(data)) {
+        qp_comms_async_enqueue(device, data, byte_count);
+        return qp_comms_async_check() ? byte_count : 0;
+    }
+
+    if (!qp_comms_async_flush()) {
+        return 0;
+    }
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
@@ -52,6 +269,9 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
 void qp_comms_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    qp_comms_async_flush();
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
     comms_vtable->send_command(device, cmd);
 }
 
@@ -68,5 +288,8 @@ uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const vo
 void qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    qp_comms_async_flush();
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
     comms_vtable->bulk_command_sequence(device, sequence, sequence_len);
 }
@@ -23,3 +23,23 @@ void     qp_comms_command(painter_device_t device, uint8_t cmd);
 void     qp_comms_command_databyte(painter_device_t device, uint8_t cmd, uint8_t data);
 uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const void* data, uint32_t byte_count);
 void     qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t* sequence, size_t sequence_len);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous pixdata APIs
+
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+
+// Signals completion of the transfer started by comms_send_async -- safe to call from interrupt context
+void qp_comms_async_complete(void);
+
+// Progresses queued transfers, releasing the bus between them once comms have been stopped, returning true once
+// nothing remains outstanding
+bool qp_comms_async_task(void);
+
+// Waits until all queued transfers have completed and the bus has been released, returning false if any of them failed
+bool qp_comms_async_flush(void);
+
+// Waits until no queued transfer references the supplied memory range
+void qp_comms_async_release(const void* data, uint32_t byte_count);
+
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
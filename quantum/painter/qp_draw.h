@@ -9,9 +9,28 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter utility functions
 
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+// The pixdata buffer is split in two, one half is filled while the other is in flight.
+#    define QP_PIXDATA_BUFFER_SIZE ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / 2)
+
+// Global variable used for native pixel data streaming, pointing at the half currently being filled.
+extern uint8_t* qp_internal_global_pixdata_buffer;
+
+// Switches to the other half of the pixdata buffer, waiting for any queued transmission of it to complete. Call after
+// transmitting the pixdata buffer if it's going to be refilled.
+void qp_internal_swap_pixdata_buffer(void);
+
+// Check if the supplied data lives within the pixdata buffer, and is therefore safe to transmit asynchronously
+bool qp_internal_is_pixdata_buffer(const void* data);
+#else
+#    define QP_PIXDATA_BUFFER_SIZE (QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE)
+
 // Global variable used for native pixel data streaming.
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
 
+static inline void qp_internal_swap_pixdata_buffer(void) {}
+#endif
+
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
 
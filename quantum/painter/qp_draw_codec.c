@@ -28,7 +28,22 @@ bool qp_internal_bpp_capable(uint8_t bits_per_pixel) {
     return true;
 }
 
+static bool qp_internal_decode_palette_bulk(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_state_t* output_state);
+
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg) {
+    // Decoding straight into the pixdata buffer can be done in bulk for the standard palette formats
+    if (output_callback == qp_internal_pixel_appender && ((qp_internal_pixel_output_state_t*)output_arg)->max_pixels > 0) {
+        switch (bits_per_pixel) {
+            case 1:
+            case 2:
+            case 4:
+            case 8:
+                return qp_internal_decode_palette_bulk(device, pixel_count, bits_per_pixel, input_callback, input_arg, palette, (qp_internal_pixel_output_state_t*)output_arg);
+            default:
+                break;
+        }
+    }
+
     const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
     const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
     uint32_t      remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
@@ -65,7 +80,35 @@ bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, u
     return qp_internal_decode_palette(device, pixel_count, bits_per_pixel, input_callback, input_arg, qp_internal_global_pixel_lookup_table, output_callback, output_arg);
 }
 
+static bool qp_internal_read_bytes(qp_internal_byte_input_callback input_callback, void* input_arg, uint8_t* buffer, uint32_t byte_count);
+
 bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_callback output_callback, void* output_arg) {
+    // Raw data headed for the pixdata buffer can be read directly into it
+    if (output_callback == qp_internal_byte_appender && ((qp_internal_byte_output_state_t*)output_arg)->max_bytes > 0) {
+        qp_internal_byte_output_state_t* state  = (qp_internal_byte_output_state_t*)output_arg;
+        painter_driver_t*                driver = (painter_driver_t*)device;
+        uint32_t                         remaining_bytes = byte_count;
+        while (remaining_bytes > 0) {
+            uint32_t space = state->max_bytes - state->byte_write_pos;
+            uint32_t count = remaining_bytes < space ? remaining_bytes : space;
+            if (!qp_internal_read_bytes(input_callback, input_arg, &qp_internal_global_pixdata_buffer[state->byte_write_pos], count)) {
+                return false;
+            }
+            state->byte_write_pos += count;
+            remaining_bytes -= count;
+
+            // If we've hit the transmit limit, send out the entire buffer and reset the write position
+            if (state->byte_write_pos == state->max_bytes) {
+                if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+                    return false;
+                }
+                qp_internal_swap_pixdata_buffer();
+                state->byte_write_pos = 0;
+            }
+        }
+        return true;
+    }
+
     uint32_t remaining_bytes = byte_count;
     while (remaining_bytes > 0) {
         int16_t byteval = input_callback(input_arg);
@@ -125,6 +168,169 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Bulk pull of bytes, push of pixels
+
+// Reads the requested number of decoded bytes, copying uncompressed data and RLE runs in blocks where possible
+static bool qp_internal_read_bytes(qp_internal_byte_input_callback input_callback, void* input_arg, uint8_t* buffer, uint32_t byte_count) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)input_arg;
+
+    if (input_callback == qp_drawimage_byte_uncompressed_decoder) {
+        if (byte_count == 0) {
+            return true;
+        }
+        if (qp_stream_read(buffer, 1, byte_count, state->src_stream) != byte_count) {
+            return false;
+        }
+        state->curr = buffer[byte_count - 1];
+        return true;
+    }
+
+    if (input_callback == qp_drawimage_byte_rle_decoder) {
+        // Mirrors qp_drawimage_byte_rle_decoder(), so the two can be used interchangeably on the same input state
+        while (byte_count > 0) {
+            if (state->rle.mode == MARKER_BYTE) {
+                uint8_t c = qp_stream_get(state->src_stream);
+                if (c >= 128) {
+                    state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
+                    state->rle.remain = c - 127;
+                } else {
+                    state->rle.mode   = REPEATING_RUN; // repeated run
+                    state->rle.remain = c;
+                }
+
+                state->curr = qp_stream_get(state->src_stream);
+            }
+
+            // A zero-length repeating run wraps around in the bytewise decoder, so emit one byte and carry on from 255
+            if (state->rle.remain == 0) {
+                *buffer++         = (uint8_t)state->curr;
+                state->rle.remain = 255;
+                byte_count--;
+                continue;
+            }
+
+            uint8_t count = state->rle.remain < byte_count ? state->rle.remain : byte_count;
+            if (state->rle.mode == REPEATING_RUN) {
+                memset(buffer, (uint8_t)state->curr, count);
+            } else {
+                // The first byte of the run has already been read, and the byte after the copied span is queued up
+                buffer[0] = (uint8_t)state->curr;
+                if (count > 1) {
+                    qp_stream_read(&buffer[1], 1, count - 1, state->src_stream);
+                }
+                if (state->rle.remain > count) {
+                    state->curr = qp_stream_get(state->src_stream);
+                }
+            }
+
+            state->rle.remain -= count;
+            if (state->rle.remain == 0) {
+                // Swap back to querying the marker byte mode
+                state->rle.mode = MARKER_BYTE;
+            }
+
+            buffer += count;
+            byte_count -= count;
+        }
+        return true;
+    }
+
+    // Unknown input, fall back to pulling one byte at a time
+    for (uint32_t i = 0; i < byte_count; ++i) {
+        int16_t byteval = input_callback(input_arg);
+        if (byteval < 0) {
+            return false;
+        }
+        buffer[i] = (uint8_t)byteval;
+    }
+    return true;
+}
+
+// Number of pixels decoded per batch by the bulk palette decoder -- must be a multiple of 8
+#define QP_BULK_DECODE_PIXELS 64
+
+// Expands packed palette indices, LSb first, a 32-bit word at a time. Inlined with a constant bpp so each format gets its own unrolled loop.
+static inline __attribute__((always_inline)) void qp_internal_unpack_indices(const uint8_t* src, uint8_t* dst, uint32_t byte_count, const uint8_t bits_per_pixel) {
+    const uint8_t pixel_bitmask   = (1 << bits_per_pixel) - 1;
+    const uint8_t pixels_per_word = 32 / bits_per_pixel;
+    for (; byte_count >= 4; byte_count -= 4) {
+        uint32_t word = src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+        for (uint8_t q = 0; q < pixels_per_word; ++q) {
+            dst[q] = word & pixel_bitmask;
+            word >>= bits_per_pixel;
+        }
+        src += 4;
+        dst += pixels_per_word;
+    }
+    for (; byte_count > 0; --byte_count) {
+        uint8_t byteval = *src++;
+        for (uint8_t q = 0; q < 8 / bits_per_pixel; ++q) {
+            *dst++ = byteval & pixel_bitmask;
+            byteval >>= bits_per_pixel;
+        }
+    }
+}
+
+static bool qp_internal_decode_palette_bulk(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_state_t* output_state) {
+    painter_driver_t* driver          = (painter_driver_t*)device;
+    const uint8_t     pixels_per_byte = 8 / bits_per_pixel;
+    uint8_t           packed[QP_BULK_DECODE_PIXELS];
+    uint8_t           unpacked[QP_BULK_DECODE_PIXELS];
+
+    uint32_t remaining_pixels = pixel_count;
+    while (remaining_pixels > 0) {
+        // Read a batch, the final byte may only be partially used
+        uint32_t batch_pixels = remaining_pixels < QP_BULK_DECODE_PIXELS ? remaining_pixels : QP_BULK_DECODE_PIXELS;
+        uint32_t batch_bytes  = (batch_pixels + pixels_per_byte - 1) / pixels_per_byte;
+        if (!qp_internal_read_bytes(input_callback, input_arg, packed, batch_bytes)) {
+            return false;
+        }
+
+        uint8_t* indices = unpacked;
+        switch (bits_per_pixel) {
+            case 1:
+                qp_internal_unpack_indices(packed, unpacked, batch_bytes, 1);
+                break;
+            case 2:
+                qp_internal_unpack_indices(packed, unpacked, batch_bytes, 2);
+                break;
+            case 4:
+                qp_internal_unpack_indices(packed, unpacked, batch_bytes, 4);
+                break;
+            default:
+                indices = packed; // 8bpp data is already one index per byte
+                break;
+        }
+
+        // Hand the batch to the driver, transmitting whenever the pixdata buffer fills up
+        uint32_t done = 0;
+        while (done < batch_pixels) {
+            uint32_t space = output_state->max_pixels - output_state->pixel_write_pos;
+            uint32_t count = (batch_pixels - done) < space ? (batch_pixels - done) : space;
+            if (!driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, palette, output_state->pixel_write_pos, count, &indices[done])) {
+                return false;
+            }
+            output_state->pixel_write_pos += count;
+            done += count;
+
+            if (output_state->pixel_write_pos == output_state->max_pixels) {
+                if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state->pixel_write_pos)) {
+                    return false;
+                }
+                qp_internal_swap_pixdata_buffer();
+                output_state->pixel_write_pos = 0;
+            }
+        }
+
+        remaining_pixels -= batch_pixels;
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Output appenders
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -138,6 +344,7 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
         if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
             return false;
         }
+        qp_internal_swap_pixdata_buffer();
         state->pixel_write_pos = 0;
     }
 
@@ -158,6 +365,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
         if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
+        qp_internal_swap_pixdata_buffer();
         state->byte_write_pos = 0;
     }
 
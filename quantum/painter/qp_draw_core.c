@@ -20,7 +20,12 @@ _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIX
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_halves[2][QP_PIXDATA_BUFFER_SIZE];
+uint8_t *qp_internal_global_pixdata_buffer = qp_internal_pixdata_halves[0];
+#else
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -38,9 +43,21 @@ __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table
 
 uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     painter_driver_t *driver = (painter_driver_t *)device;
-    return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
+    return ((QP_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
+}
+
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+void qp_internal_swap_pixdata_buffer(void) {
+    qp_internal_global_pixdata_buffer = (qp_internal_global_pixdata_buffer == qp_internal_pixdata_halves[0]) ? qp_internal_pixdata_halves[1] : qp_internal_pixdata_halves[0];
+    qp_comms_async_release(qp_internal_global_pixdata_buffer, QP_PIXDATA_BUFFER_SIZE);
 }
 
+bool qp_internal_is_pixdata_buffer(const void *data) {
+    const uint8_t *p = (const uint8_t *)data;
+    return p >= &qp_internal_pixdata_halves[0][0] && p < &qp_internal_pixdata_halves[1][QP_PIXDATA_BUFFER_SIZE];
+}
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -53,6 +70,11 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     uint32_t          pixels_in_pixdata = qp_internal_num_pixels_in_buffer(device);
     num_pixels                          = QP_MIN(pixels_in_pixdata, num_pixels);
 
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    // Some callers fill before starting comms, so make sure a previous draw isn't still transmitting from this half
+    qp_comms_async_release(qp_internal_global_pixdata_buffer, QP_PIXDATA_BUFFER_SIZE);
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+
     // Convert the color to native pixel format
     qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
     driver->driver_vtable->palette_convert(device, 1, &color);
@@ -241,7 +263,11 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
     uint32_t remaining = w * h;
     driver->driver_vtable->viewport(device, l, t, r, b);
     while (remaining > 0) {
-        uint32_t transmit = QP_MIN(remaining, pixels_in_pixdata);
+        // Any partial block goes first, so that the identical full blocks after it can be queued back-to-back
+        uint32_t transmit = remaining % pixels_in_pixdata;
+        if (transmit == 0) {
+            transmit = pixels_in_pixdata;
+        }
         if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, transmit)) {
             return false;
         }
@@ -207,7 +207,33 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     return true;
 }
 
-static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+// Destination for natively-formatted pixel data when a frame is being decoded into an animation cache
+typedef struct qgf_frame_cache_target_t {
+    uint8_t *buffer;      // where the native pixel data should be written
+    uint32_t capacity;    // the number of bytes available at buffer
+    uint32_t pixel_count; // the number of native pixels written, zero if the frame did not fit
+} qgf_frame_cache_target_t;
+
+// Appenders used when decoding into a cache target, which hold the entire frame rather than flushing in chunks
+typedef struct qgf_frame_cache_output_state_t {
+    painter_device_t device;
+    uint8_t *        target;
+    uint32_t         write_pos;
+} qgf_frame_cache_output_state_t;
+
+static bool qp_drawimage_cache_pixel_appender(qp_pixel_t *palette, uint8_t index, void *cb_arg) {
+    qgf_frame_cache_output_state_t *state  = (qgf_frame_cache_output_state_t *)cb_arg;
+    painter_driver_t *              driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixels(state->device, state->target, palette, state->write_pos++, 1, &index);
+}
+
+static bool qp_drawimage_cache_byte_appender(uint8_t byteval, void *cb_arg) {
+    qgf_frame_cache_output_state_t *state  = (qgf_frame_cache_output_state_t *)cb_arg;
+    painter_driver_t *              driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixdata(state->device, state->target, state->write_pos++, byteval);
+}
+
+static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_cache_target_t *cache_target) {
     qp_dprintf("qp_drawimage_recolor: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
@@ -262,6 +288,32 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+    // If requested, decode the whole frame into the cache target instead, as long as it fits
+    if (cache_target) {
+        uint32_t byte_count       = (pixel_count * driver->native_bits_per_pixel + 7) / 8;
+        cache_target->pixel_count = 0;
+        if (byte_count <= cache_target->capacity && (frame_info->bpp <= 8 || frame_info->bpp == driver->native_bits_per_pixel)) {
+            qgf_frame_cache_output_state_t output_state = {.device = device, .target = cache_target->buffer, .write_pos = 0};
+
+            bool ret;
+            if (frame_info->bpp <= 8) {
+                ret = qp_internal_decode_palette(device, pixel_count, frame_info->bpp, input_callback, &input_state, qp_internal_global_pixel_lookup_table, qp_drawimage_cache_pixel_appender, &output_state);
+            } else {
+                ret = qp_internal_send_bytes(device, byte_count, input_callback, &input_state, qp_drawimage_cache_byte_appender, &output_state);
+            }
+
+            // Transmit the decoded frame in one go
+            ret = ret && driver->driver_vtable->pixdata(device, cache_target->buffer, pixel_count);
+            if (ret) {
+                cache_target->pixel_count = pixel_count;
+            }
+
+            qp_dprintf("qp_drawimage_recolor: %s (cached)\n", ret ? "ok" : "fail");
+            qp_comms_stop(device);
+            return ret;
+        }
+    }
+
     bool ret = false;
     if (frame_info->bpp <= 8) {
         // Set up the output state
@@ -299,7 +351,7 @@ bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, paint
     qgf_frame_info_t frame_info = {0};
     qp_pixel_t       fg_hsv888  = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t       bg_hsv888  = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
+    return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888, NULL);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -321,15 +373,98 @@ typedef struct animation_state_t {
     qp_pixel_t             bg_hsv888;
     uint16_t               frame_number;
     deferred_token         defer_token;
+    uint8_t *              cache_arena; // frame offset table, followed by the cached frames
+    uint32_t               cache_size;
+    uint32_t               cache_used;
 } animation_state_t;
 
+// Header for each frame held in an animation cache, followed by the frame's native pixel data
+typedef struct animation_cache_frame_t {
+    uint16_t left;   // relative to the animation's location, inclusive
+    uint16_t top;    // relative to the animation's location, inclusive
+    uint16_t right;  // relative to the animation's location, inclusive
+    uint16_t bottom; // relative to the animation's location, inclusive
+    uint16_t delay;
+    uint16_t reserved; // keeps the pixel data 4-byte aligned
+} animation_cache_frame_t;
+
+_Static_assert(sizeof(animation_cache_frame_t) % 4 == 0, "animation_cache_frame_t must preserve 4-byte alignment");
+
+#define ANIMATION_CACHE_ALIGN(n) (((n) + 3) & ~(uint32_t)3)
+
 static deferred_executor_t animation_executors[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
 static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS]    = {0};
 
+// Renders the current frame of a cached animation, either straight from the cache or by decoding it into the cache
+static bool qp_render_cached_animation_frame(animation_state_t *state, qgf_frame_info_t *frame_info) {
+    painter_driver_t *driver        = (painter_driver_t *)state->device;
+    uint32_t *        frame_offsets = (uint32_t *)state->cache_arena;
+
+    // Frame is already cached, so send it directly
+    if (frame_offsets[state->frame_number] != 0) {
+        animation_cache_frame_t *frame = (animation_cache_frame_t *)(state->cache_arena + frame_offsets[state->frame_number]);
+        uint16_t                 l     = state->x + frame->left;
+        uint16_t                 t     = state->y + frame->top;
+        uint16_t                 r     = state->x + frame->right;
+        uint16_t                 b     = state->y + frame->bottom;
+        uint32_t                 count = ((uint32_t)(r - l + 1)) * (b - t + 1);
+
+        if (!qp_comms_start(state->device)) {
+            qp_dprintf("qp_render_cached_animation_frame: fail (could not start comms)\n");
+            return false;
+        }
+
+        bool ret = driver->driver_vtable->viewport(state->device, l, t, r, b) && driver->driver_vtable->pixdata(state->device, (const uint8_t *)(frame + 1), count);
+        qp_comms_stop(state->device);
+
+        frame_info->delay = frame->delay;
+        return ret;
+    }
+
+    // Otherwise decode into whatever space remains in the arena -- frames which don't fit are streamed as normal
+    uint32_t                 frame_offset = state->cache_used;
+    animation_cache_frame_t *frame        = (animation_cache_frame_t *)(state->cache_arena + frame_offset);
+    qgf_frame_cache_target_t target       = {0};
+    if (frame_offset + sizeof(animation_cache_frame_t) <= state->cache_size) {
+        target.buffer   = (uint8_t *)(frame + 1);
+        target.capacity = state->cache_size - frame_offset - sizeof(animation_cache_frame_t);
+    }
+
+    if (!qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, frame_info, state->fg_hsv888, state->bg_hsv888, target.buffer ? &target : NULL)) {
+        return false;
+    }
+
+    if (target.pixel_count > 0) {
+        if (frame_info->is_delta) {
+            frame->left   = frame_info->left;
+            frame->top    = frame_info->top;
+            frame->right  = frame_info->right - 1;
+            frame->bottom = frame_info->bottom - 1;
+        } else {
+            frame->left   = 0;
+            frame->top    = 0;
+            frame->right  = state->image->width - 1;
+            frame->bottom = state->image->height - 1;
+        }
+        frame->delay                          = frame_info->delay;
+        frame->reserved                       = 0;
+        frame_offsets[state->frame_number]    = frame_offset;
+        state->cache_used                     = ANIMATION_CACHE_ALIGN(frame_offset + sizeof(animation_cache_frame_t) + (target.pixel_count * driver->native_bits_per_pixel + 7) / 8);
+        qp_dprintf("qp_render_cached_animation_frame: cached frame #%d (%d/%d bytes used)\n", (int)state->frame_number, (int)state->cache_used, (int)state->cache_size);
+    }
+
+    return true;
+}
+
 static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
     qgf_frame_info_t frame_info = {0};
     qp_dprintf("qp_render_animation_state: entry (frame #%d)\n", (int)state->frame_number);
-    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
+    bool ret;
+    if (state->cache_arena) {
+        ret = qp_render_cached_animation_frame(state, &frame_info);
+    } else {
+        ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888, NULL);
+    }
     if (ret) {
         ++state->frame_number;
         if (state->frame_number >= state->image->frame_count) {
@@ -377,6 +512,7 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
     anim_state->fg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     anim_state->bg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
     anim_state->frame_number = 0;
+    anim_state->cache_arena  = NULL;
 
     // Draw the first frame
     uint16_t delay_ms;
@@ -411,6 +547,83 @@ void qp_stop_animation(deferred_token anim_token) {
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_animation_cache_size
+
+uint32_t qp_animation_cache_size(painter_device_t device, painter_image_handle_t image) {
+    painter_driver_t *  driver    = (painter_driver_t *)device;
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)image;
+    if (!driver || !driver->validate_ok || !qgf_image || !qgf_image->validate_ok) {
+        qp_dprintf("qp_animation_cache_size: fail (invalid device or image)\n");
+        return 0;
+    }
+
+    uint32_t total = ANIMATION_CACHE_ALIGN(image->frame_count * sizeof(uint32_t));
+    for (uint16_t i = 0; i < image->frame_count; ++i) {
+        qgf_frame_v1_t frame_descriptor;
+        uint8_t        bpp;
+        bool           has_palette;
+        bool           is_delta;
+        qgf_seek_to_frame_descriptor(&qgf_image->stream, i);
+        if (qp_stream_read(&frame_descriptor, sizeof(qgf_frame_v1_t), 1, &qgf_image->stream) != 1 || !qgf_parse_frame_descriptor(&frame_descriptor, &bpp, &has_palette, &is_delta, NULL, NULL)) {
+            return 0;
+        }
+
+        uint32_t pixel_count = ((uint32_t)image->width) * image->height;
+        if (is_delta) {
+            // Skip past the palette to get to the delta rect
+            if (has_palette) {
+                qp_stream_seek(&qgf_image->stream, sizeof(qgf_palette_v1_t) + (1u << bpp) * sizeof(qgf_palette_entry_v1_t), SEEK_CUR);
+            }
+
+            qgf_delta_v1_t delta_descriptor;
+            if (qp_stream_read(&delta_descriptor, sizeof(qgf_delta_v1_t), 1, &qgf_image->stream) != 1) {
+                return 0;
+            }
+            pixel_count = ((uint32_t)(delta_descriptor.right - delta_descriptor.left)) * (delta_descriptor.bottom - delta_descriptor.top);
+        }
+
+        total += ANIMATION_CACHE_ALIGN(sizeof(animation_cache_frame_t) + (pixel_count * driver->native_bits_per_pixel + 7) / 8);
+    }
+
+    return total;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_animation_cache
+
+bool qp_animation_cache(deferred_token anim_token, void *arena, uint32_t arena_size) {
+    for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
+        animation_state_t *state = &animation_states[i];
+        if (state->device == NULL || state->defer_token != anim_token) {
+            continue;
+        }
+
+        // Detaching the cache returns the animation to decoding from the image
+        if (arena == NULL) {
+            state->cache_arena = NULL;
+            return true;
+        }
+
+        // The arena needs to be aligned for the frame table and native pixel data, and hold at least the frame table
+        uint32_t table_size = ANIMATION_CACHE_ALIGN(state->image->frame_count * sizeof(uint32_t));
+        if (((uintptr_t)arena & 3) != 0 || arena_size < table_size) {
+            qp_dprintf("qp_animation_cache: fail (arena misaligned or too small for %d frames)\n", (int)state->image->frame_count);
+            return false;
+        }
+
+        // Frames are added to the cache as they are first rendered
+        memset(arena, 0, table_size);
+        state->cache_arena = (uint8_t *)arena;
+        state->cache_size  = arena_size;
+        state->cache_used  = table_size;
+        return true;
+    }
+
+    qp_dprintf("qp_animation_cache: fail (invalid animation token)\n");
+    return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Core API: qp_internal_animation_tick
 
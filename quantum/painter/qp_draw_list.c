@@ -0,0 +1,460 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "qp_internal.h"
+#include "qp_draw.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Display list internals
+//
+// Each frame is recorded as a sequence of variable-length records into one half of the user-supplied buffer, while the
+// other half holds the frame which is currently on the display. On render, records are compared pairwise against the
+// previous frame: the old bounds of anything that changed or disappeared are cleared to the background color, then
+// every primitive which changed -- or overlaps an area which has been redrawn -- is rasterized again, in order.
+
+// Maximum number of separate regions tracked while rendering, beyond which regions are merged together
+#define QP_DISPLAY_LIST_MAX_REGIONS 8
+
+typedef enum {
+    QP_DISPLAY_LIST_RECT,
+    QP_DISPLAY_LIST_LINE,
+    QP_DISPLAY_LIST_CIRCLE,
+    QP_DISPLAY_LIST_ELLIPSE,
+    QP_DISPLAY_LIST_TEXT,
+} qp_display_list_type_t;
+
+typedef struct qp_display_list_bounds_t {
+    uint16_t l, t, r, b; // inclusive
+} qp_display_list_bounds_t;
+
+typedef struct qp_display_list_record_t {
+    uint8_t                  type;
+    uint8_t                  filled;
+    uint16_t                 size; // total record size in bytes, including any trailing text data
+    qp_display_list_bounds_t bounds;
+    uint16_t                 args[4]; // primitive coordinates, as passed to the corresponding qp_* function
+    uint8_t                  hsv[6];  // color, followed by background color for text
+    uint8_t                  reserved[2];
+    // Text records are followed by the font handle and the NUL-terminated string
+} qp_display_list_record_t;
+
+_Static_assert(sizeof(qp_display_list_record_t) % 4 == 0, "qp_display_list_record_t must be a multiple of 4 bytes");
+
+typedef struct qp_display_list_t {
+    bool             validate_ok;
+    painter_device_t device;
+    uint8_t *        frames[2];
+    uint32_t         frame_size;
+    uint32_t         frame_used[2];
+    uint8_t          current;     // frame being recorded, the other frame is on the display
+    uint32_t         last_record; // offset of the most recent record in the current frame, or UINT32_MAX
+    bool             full_redraw;
+    uint8_t          hue_bg;
+    uint8_t          sat_bg;
+    uint8_t          val_bg;
+} qp_display_list_t;
+
+static qp_display_list_t display_lists[QUANTUM_PAINTER_NUM_DISPLAY_LISTS] = {0};
+
+typedef struct qp_display_list_regions_t {
+    qp_display_list_bounds_t rects[QP_DISPLAY_LIST_MAX_REGIONS];
+    uint8_t                  count;
+} qp_display_list_regions_t;
+
+static inline qp_display_list_record_t *qp_display_list_record_at(qp_display_list_t *list, uint8_t frame, uint32_t offset) {
+    return (qp_display_list_record_t *)&list->frames[frame][offset];
+}
+
+static uint16_t qp_display_list_clamp(int32_t value) {
+    return value < 0 ? 0 : (value > UINT16_MAX ? UINT16_MAX : (uint16_t)value);
+}
+
+static bool qp_display_list_intersects(const qp_display_list_bounds_t *a, const qp_display_list_bounds_t *b) {
+    return a->l <= b->r && b->l <= a->r && a->t <= b->b && b->t <= a->b;
+}
+
+static uint32_t qp_display_list_area(const qp_display_list_bounds_t *a) {
+    return ((uint32_t)(a->r - a->l) + 1) * ((uint32_t)(a->b - a->t) + 1);
+}
+
+static void qp_display_list_union(qp_display_list_bounds_t *target, const qp_display_list_bounds_t *other) {
+    target->l = QP_MIN(target->l, other->l);
+    target->t = QP_MIN(target->t, other->t);
+    target->r = QP_MAX(target->r, other->r);
+    target->b = QP_MAX(target->b, other->b);
+}
+
+// Checks if two rectangles can be merged without covering any extra area -- one contains the other, or they share a
+// full edge.
+static bool qp_display_list_can_merge(const qp_display_list_bounds_t *a, const qp_display_list_bounds_t *b) {
+    if (a->t == b->t && a->b == b->b) {
+        return a->l <= (uint32_t)b->r + 1 && b->l <= (uint32_t)a->r + 1;
+    }
+    if (a->l == b->l && a->r == b->r) {
+        return a->t <= (uint32_t)b->b + 1 && b->t <= (uint32_t)a->b + 1;
+    }
+    return (a->l <= b->l && a->t <= b->t && a->r >= b->r && a->b >= b->b) || (b->l <= a->l && b->t <= a->t && b->r >= a->r && b->b >= a->b);
+}
+
+static void qp_display_list_add_region(qp_display_list_regions_t *regions, const qp_display_list_bounds_t *bounds) {
+    for (uint8_t i = 0; i < regions->count; ++i) {
+        if (qp_display_list_can_merge(&regions->rects[i], bounds)) {
+            qp_display_list_union(&regions->rects[i], bounds);
+            return;
+        }
+    }
+
+    if (regions->count < QP_DISPLAY_LIST_MAX_REGIONS) {
+        regions->rects[regions->count++] = *bounds;
+        return;
+    }
+
+    // Out of space, so grow whichever region needs the least additional area
+    uint8_t  best      = 0;
+    uint32_t best_cost = UINT32_MAX;
+    for (uint8_t i = 0; i < regions->count; ++i) {
+        qp_display_list_bounds_t merged = regions->rects[i];
+        qp_display_list_union(&merged, bounds);
+        uint32_t cost = qp_display_list_area(&merged) - qp_display_list_area(&regions->rects[i]);
+        if (cost < best_cost) {
+            best      = i;
+            best_cost = cost;
+        }
+    }
+    qp_display_list_union(&regions->rects[best], bounds);
+}
+
+static bool qp_display_list_overlaps(const qp_display_list_regions_t *regions, const qp_display_list_bounds_t *bounds) {
+    for (uint8_t i = 0; i < regions->count; ++i) {
+        if (qp_display_list_intersects(&regions->rects[i], bounds)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Reserves space for a record in the frame being recorded
+static qp_display_list_record_t *qp_display_list_append(qp_display_list_t *list, qp_display_list_type_t type, uint32_t extra_bytes) {
+    uint32_t size = (sizeof(qp_display_list_record_t) + extra_bytes + 3) & ~3u;
+    uint32_t used = list->frame_used[list->current];
+    if (size > UINT16_MAX || used + size > list->frame_size) {
+        qp_dprintf("qp_display_list: fail (out of space)\n");
+        return NULL;
+    }
+
+    qp_display_list_record_t *record = qp_display_list_record_at(list, list->current, used);
+    memset(record, 0, size);
+    record->type                    = type;
+    record->size                    = size;
+    list->last_record               = used;
+    list->frame_used[list->current] = used + size;
+    return record;
+}
+
+static qp_display_list_t *qp_display_list_validate(painter_display_list_t list_handle) {
+    qp_display_list_t *list = (qp_display_list_t *)list_handle;
+    if (!list || !list->validate_ok) {
+        qp_dprintf("qp_display_list: fail (invalid display list)\n");
+        return NULL;
+    }
+    return list;
+}
+
+static bool qp_display_list_draw(qp_display_list_t *list, const qp_display_list_record_t *record) {
+    const uint16_t *a = record->args;
+    const uint8_t * c = record->hsv;
+    switch (record->type) {
+        case QP_DISPLAY_LIST_RECT:
+            return qp_rect(list->device, a[0], a[1], a[2], a[3], c[0], c[1], c[2], record->filled);
+        case QP_DISPLAY_LIST_LINE:
+            return qp_line(list->device, a[0], a[1], a[2], a[3], c[0], c[1], c[2]);
+        case QP_DISPLAY_LIST_CIRCLE:
+            return qp_circle(list->device, a[0], a[1], a[2], c[0], c[1], c[2], record->filled);
+        case QP_DISPLAY_LIST_ELLIPSE:
+            return qp_ellipse(list->device, a[0], a[1], a[2], a[3], c[0], c[1], c[2], record->filled);
+        case QP_DISPLAY_LIST_TEXT: {
+            painter_font_handle_t font;
+            memcpy(&font, &record[1], sizeof(font));
+            const char *str = (const char *)&record[1] + sizeof(font);
+            return qp_drawtext_recolor(list->device, a[0], a[1], font, str, c[0], c[1], c[2], c[3], c[4], c[5]) > 0 || !*str;
+        }
+    }
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_display_list_make
+
+painter_display_list_t qp_display_list_make(painter_device_t device, void *buffer, uint32_t buffer_size, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_dprintf("qp_display_list_make: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok || !buffer) {
+        qp_dprintf("qp_display_list_make: fail (invalid device or buffer)\n");
+        return NULL;
+    }
+
+    // Each half of the buffer holds one frame, aligned to 4 bytes
+    uintptr_t start   = ((uintptr_t)buffer + 3) & ~(uintptr_t)3;
+    uint32_t  padding = start - (uintptr_t)buffer;
+    if (buffer_size < padding + 2 * sizeof(qp_display_list_record_t)) {
+        qp_dprintf("qp_display_list_make: fail (buffer too small)\n");
+        return NULL;
+    }
+    uint32_t frame_size = ((buffer_size - padding) / 2) & ~3u;
+
+    for (int i = 0; i < QUANTUM_PAINTER_NUM_DISPLAY_LISTS; ++i) {
+        qp_display_list_t *list = &display_lists[i];
+        if (!list->validate_ok) {
+            list->device        = device;
+            list->frames[0]     = (uint8_t *)start;
+            list->frames[1]     = (uint8_t *)start + frame_size;
+            list->frame_size    = frame_size;
+            list->frame_used[0] = 0;
+            list->frame_used[1] = 0;
+            list->current       = 0;
+            list->last_record   = UINT32_MAX;
+            list->full_redraw   = true;
+            list->hue_bg        = hue_bg;
+            list->sat_bg        = sat_bg;
+            list->val_bg        = val_bg;
+            list->validate_ok   = true;
+            qp_dprintf("qp_display_list_make: ok\n");
+            return (painter_display_list_t)list;
+        }
+    }
+
+    qp_dprintf("qp_display_list_make: fail (no free display lists)\n");
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_display_list_close
+
+bool qp_display_list_close(painter_display_list_t list_handle) {
+    qp_display_list_t *list = qp_display_list_validate(list_handle);
+    if (!list) {
+        return false;
+    }
+    list->validate_ok = false;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_display_list_begin / qp_display_list_invalidate
+
+bool qp_display_list_begin(painter_display_list_t list_handle) {
+    qp_display_list_t *list = qp_display_list_validate(list_handle);
+    if (!list) {
+        return false;
+    }
+    list->frame_used[list->current] = 0;
+    list->last_record               = UINT32_MAX;
+    return true;
+}
+
+void qp_display_list_invalidate(painter_display_list_t list_handle) {
+    qp_display_list_t *list = qp_display_list_validate(list_handle);
+    if (list) {
+        list->full_redraw = true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: primitives
+
+bool qp_display_list_rect(painter_display_list_t list_handle, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    qp_display_list_t *list = qp_display_list_validate(list_handle);
+    if (!list) {
+        return false;
+    }
+
+    qp_display_list_bounds_t bounds = {.l = QP_MIN(left, right), .t = QP_MIN(top, bottom), .r = QP_MAX(left, right), .b = QP_MAX(top, bottom)};
+
+    // Merge with the previous fill if it's the same color and shares a full edge, so it can be drawn in one go
+    if (filled && list->last_record != UINT32_MAX) {
+        qp_display_list_record_t *prev = qp_display_list_record_at(list, list->current, list->last_record);
+        if (prev->type == QP_DISPLAY_LIST_RECT && prev->filled && prev->hsv[0] == hue && prev->hsv[1] == sat && prev->hsv[2] == val && qp_display_list_can_merge(&prev->bounds, &bounds)) {
+            qp_display_list_union(&prev->bounds, &bounds);
+            prev->args[0] = prev->bounds.l;
+            prev->args[1] = prev->bounds.t;
+            prev->args[2] = prev->bounds.r;
+            prev->args[3] = prev->bounds.b;
+            return true;
+        }
+    }
+
+    qp_display_list_record_t *record = qp_display_list_append(list, QP_DISPLAY_LIST_RECT, 0);
+    if (!record) {
+        return false;
+    }
+    record->filled  = filled;
+    record->bounds  = bounds;
+    record->args[0] = bounds.l;
+    record->args[1] = bounds.t;
+    record->args[2] = bounds.r;
+    record->args[3] = bounds.b;
+    record->hsv[0]  = hue;
+    record->hsv[1]  = sat;
+    record->hsv[2]  = val;
+    return true;
+}
+
+bool qp_display_list_line(painter_display_list_t list_handle, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val) {
+    qp_display_list_t *list = qp_display_list_validate(list_handle);
+    if (!list) {
+        return false;
+    }
+
+    qp_display_list_record_t *record = qp_display_list_append(list, QP_DISPLAY_LIST_LINE, 0);
+    if (!record) {
+        return false;
+    }
+    record->bounds  = (qp_display_list_bounds_t){.l = QP_MIN(x0, x1), .t = QP_MIN(y0, y1), .r = QP_MAX(x0, x1), .b = QP_MAX(y0, y1)};
+    record->args[0] = x0;
+    record->args[1] = y0;
+    record->args[2] = x1;
+    record->args[3] = y1;
+    record->hsv[0]  = hue;
+    record->hsv[1]  = sat;
+    record->hsv[2]  = val;
+    return true;
+}
+
+static bool qp_display_list_curve(painter_display_list_t list_handle, qp_display_list_type_t type, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    qp_display_list_t *list = qp_display_list_validate(list_handle);
+    if (!list) {
+        return false;
+    }
+
+    qp_display_list_record_t *record = qp_display_list_append(list, type, 0);
+    if (!record) {
+        return false;
+    }
+    record->filled  = filled;
+    record->bounds  = (qp_display_list_bounds_t){.l = qp_display_list_clamp((int32_t)x - sizex), .t = qp_display_list_clamp((int32_t)y - sizey), .r = qp_display_list_clamp((int32_t)x + sizex), .b = qp_display_list_clamp((int32_t)y + sizey)};
+    record->args[0] = x;
+    record->args[1] = y;
+    record->args[2] = sizex;
+    record->args[3] = sizey;
+    record->hsv[0]  = hue;
+    record->hsv[1]  = sat;
+    record->hsv[2]  = val;
+    return true;
+}
+
+bool qp_display_list_circle(painter_display_list_t list_handle, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    return qp_display_list_curve(list_handle, QP_DISPLAY_LIST_CIRCLE, x, y, radius, radius, hue, sat, val, filled);
+}
+
+bool qp_display_list_ellipse(painter_display_list_t list_handle, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    return qp_display_list_curve(list_handle, QP_DISPLAY_LIST_ELLIPSE, x, y, sizex, sizey, hue, sat, val, filled);
+}
+
+bool qp_display_list_drawtext(painter_display_list_t list_handle, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str) {
+    // Same substitution as qp_drawtext
+    return qp_display_list_drawtext_recolor(list_handle, x, y, font, str, 0, 0, 255, 0, 0, 0);
+}
+
+bool qp_display_list_drawtext_recolor(painter_display_list_t list_handle, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_display_list_t *list = qp_display_list_validate(list_handle);
+    if (!list || !font || !str) {
+        return false;
+    }
+
+    int16_t width = qp_textwidth(font, str);
+    if (width < 0) {
+        return false;
+    }
+
+    // The string is copied into the list, so that the caller's buffer can be reused for the next frame
+    uint32_t                  length = strlen(str) + 1;
+    qp_display_list_record_t *record = qp_display_list_append(list, QP_DISPLAY_LIST_TEXT, sizeof(font) + length);
+    if (!record) {
+        return false;
+    }
+    record->bounds  = (qp_display_list_bounds_t){.l = x, .t = y, .r = qp_display_list_clamp((int32_t)x + width - 1), .b = qp_display_list_clamp((int32_t)y + font->line_height - 1)};
+    record->args[0] = x;
+    record->args[1] = y;
+    record->hsv[0]  = hue_fg;
+    record->hsv[1]  = sat_fg;
+    record->hsv[2]  = val_fg;
+    record->hsv[3]  = hue_bg;
+    record->hsv[4]  = sat_bg;
+    record->hsv[5]  = val_bg;
+    memcpy(&record[1], &font, sizeof(font));
+    memcpy((uint8_t *)&record[1] + sizeof(font), str, length);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_display_list_render
+
+bool qp_display_list_render(painter_display_list_t list_handle) {
+    qp_dprintf("qp_display_list_render: entry\n");
+    qp_display_list_t *list = qp_display_list_validate(list_handle);
+    if (!list) {
+        return false;
+    }
+
+    uint8_t  cur_frame  = list->current;
+    uint8_t  prev_frame = cur_frame ^ 1;
+    uint32_t cur_used   = list->frame_used[cur_frame];
+    uint32_t prev_used  = list->full_redraw ? 0 : list->frame_used[prev_frame];
+
+    qp_display_list_regions_t cleared = {0};
+    qp_display_list_regions_t dirty   = {0};
+    if (list->full_redraw) {
+        uint16_t width, height;
+        qp_get_geometry(list->device, &width, &height, NULL, NULL, NULL);
+        qp_display_list_bounds_t all = {.l = 0, .t = 0, .r = width - 1, .b = height - 1};
+        qp_display_list_add_region(&cleared, &all);
+    }
+
+    // Work out which areas no longer hold what they used to
+    for (uint32_t p = 0, c = 0; p < prev_used || c < cur_used;) {
+        qp_display_list_record_t *prev = p < prev_used ? qp_display_list_record_at(list, prev_frame, p) : NULL;
+        qp_display_list_record_t *cur  = c < cur_used ? qp_display_list_record_at(list, cur_frame, c) : NULL;
+        if (!prev || !cur || prev->size != cur->size || memcmp(prev, cur, cur->size) != 0) {
+            if (prev) {
+                qp_display_list_add_region(&cleared, &prev->bounds);
+            }
+            if (cur) {
+                qp_display_list_add_region(&dirty, &cur->bounds);
+            }
+        }
+        p += prev ? prev->size : 0;
+        c += cur ? cur->size : 0;
+    }
+
+    // Clear the vacated areas to the background color
+    bool ret = true;
+    for (uint8_t i = 0; i < cleared.count; ++i) {
+        const qp_display_list_bounds_t *r = &cleared.rects[i];
+        ret &= qp_rect(list->device, r->l, r->t, r->r, r->b, list->hue_bg, list->sat_bg, list->val_bg, true);
+        qp_display_list_add_region(&dirty, r);
+    }
+
+    // Redraw anything which changed, or which overlaps something that has been drawn over
+    for (uint32_t p = 0, c = 0; c < cur_used;) {
+        qp_display_list_record_t *prev    = p < prev_used ? qp_display_list_record_at(list, prev_frame, p) : NULL;
+        qp_display_list_record_t *cur     = qp_display_list_record_at(list, cur_frame, c);
+        bool                      changed = !prev || prev->size != cur->size || memcmp(prev, cur, cur->size) != 0;
+        if (changed || qp_display_list_overlaps(&dirty, &cur->bounds)) {
+            ret &= qp_display_list_draw(list, cur);
+            qp_display_list_add_region(&dirty, &cur->bounds);
+        }
+        p += prev ? prev->size : 0;
+        c += cur->size;
+    }
+
+    // The recorded frame is now what's on the display
+    list->current                   = prev_frame;
+    list->full_redraw               = !ret;
+    list->frame_used[list->current] = 0;
+    list->last_record               = UINT32_MAX;
+
+    qp_dprintf("qp_display_list_render: %s\n", ret ? "ok" : "fail");
+    return ret;
+}
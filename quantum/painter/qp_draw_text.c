@@ -12,14 +12,29 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > UINT8_MAX
+#    error QUANTUM_PAINTER_GLYPH_CACHE_SIZE must be no more than 255
+#endif
+
+// Remembered unicode glyph lookup, holding the raw glyph info from the unicode table
+typedef struct qff_glyph_cache_entry_t {
+    uint32_t code_point;
+    uint32_t value; // Uses QFF_GLYPH_*_(BITS|MASK)
+} qff_glyph_cache_entry_t;
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
     bool                  has_ascii_table;
     uint16_t              num_unicode_glyphs;
+    bool                  unicode_table_sorted;
     uint8_t               bpp;
     bool                  has_palette;
     painter_compression_t compression_scheme;
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    uint8_t                 glyph_cache_count;
+    qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_SIZE]; // most recently used first
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -97,7 +112,14 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
     // Read the info (parsing already successful above, no need to check return value)
-    qff_read_font_descriptor(&font->stream, &font->base.line_height, &font->has_ascii_table, &font->num_unicode_glyphs, &font->bpp, &font->has_palette, &font->compression_scheme, NULL);
+    uint8_t flags;
+    qff_read_font_descriptor(&font->stream, &font->base.line_height, &font->has_ascii_table, &font->num_unicode_glyphs, &font->bpp, &font->has_palette, &font->compression_scheme, &flags, NULL);
+    font->unicode_table_sorted = (flags & QFF_FONT_FLAG_SORTED_UNICODE_TABLE) != 0;
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Forget any glyphs belonging to the previous occupant of this slot
+    font->glyph_cache_count = 0;
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
 
     if (!qp_internal_bpp_capable(font->bpp)) {
         qp_dprintf("qp_load_font: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)font->bpp);
@@ -213,6 +235,123 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
+// Helper that returns the offset in the stream of the glyph data block's contents
+static inline uint32_t qff_glyph_data_offset(qff_font_handle_t *qff_font) {
+    return sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
+           + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
+           + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+           + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
+           + sizeof(qgf_block_header_v1_t);                                                                                                                    // Skip the data block header
+}
+
+// Helper that positions the stream at the start of a glyph's data, given its glyph info
+static inline bool qp_drawtext_seek_glyph_data(qff_font_handle_t *qff_font, uint32_t glyph_value, uint8_t *width) {
+    uint32_t glyph_offset = ((glyph_value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    if (qp_stream_setpos(&qff_font->stream, qff_glyph_data_offset(qff_font) + glyph_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    *width = (uint8_t)(glyph_value & QFF_GLYPH_WIDTH_MASK);
+    return true;
+}
+
+// Helper that reads the glyph info for the unicode table entry at the supplied index
+static inline bool qff_read_unicode_glyph(qff_font_handle_t *qff_font, uint16_t index, qff_unicode_glyph_v1_t *glyph_info) {
+    uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
+                                 + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+                                 + sizeof(qgf_block_header_v1_t)                                        // Skip the unicode block header
+                                 + index * sizeof(qff_unicode_glyph_v1_t);                              // Jump direct to the entry
+
+    if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
+        qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+        return false;
+    }
+
+    if (qp_stream_read(glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+        qp_dprintf("Failed to read unicode glyph info\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Helper that searches the unicode table for the supplied code point, returning its glyph info
+static bool qff_find_unicode_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *glyph_value) {
+    qff_unicode_glyph_v1_t glyph_info;
+
+    if (qff_font->unicode_table_sorted) {
+        // Table is ordered by code point, so we can binary search it
+        uint16_t lo = 0;
+        uint16_t hi = qff_font->num_unicode_glyphs;
+        while (lo < hi) {
+            uint16_t mid = lo + (hi - lo) / 2;
+            if (!qff_read_unicode_glyph(qff_font, mid, &glyph_info)) {
+                return false;
+            }
+
+            if (glyph_info.code_point == code_point) {
+                *glyph_value = glyph_info.value;
+                return true;
+            } else if (glyph_info.code_point < code_point) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+    } else if (qff_font->num_unicode_glyphs > 0) {
+        // Fonts generated without the sorted flag can't be assumed to be in any order, so scan the whole table
+        if (!qff_read_unicode_glyph(qff_font, 0, &glyph_info)) {
+            return false;
+        }
+
+        for (uint16_t i = 0;;) {
+            if (glyph_info.code_point == code_point) {
+                *glyph_value = glyph_info.value;
+                return true;
+            }
+
+            if (++i >= qff_font->num_unicode_glyphs) {
+                break;
+            }
+
+            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+                qp_dprintf("Failed to read unicode glyph info\n");
+                return false;
+            }
+        }
+    }
+
+    // Not found
+    qp_dprintf("Failed to find unicode glyph info\n");
+    return false;
+}
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+// Helper that looks up a code point in the font's glyph cache, promoting it to most recently used if found
+static inline bool qff_glyph_cache_lookup(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *glyph_value) {
+    for (uint8_t i = 0; i < qff_font->glyph_cache_count; ++i) {
+        if (qff_font->glyph_cache[i].code_point == code_point) {
+            qff_glyph_cache_entry_t entry = qff_font->glyph_cache[i];
+            memmove(&qff_font->glyph_cache[1], &qff_font->glyph_cache[0], i * sizeof(qff_glyph_cache_entry_t));
+            qff_font->glyph_cache[0] = entry;
+            *glyph_value             = entry.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Helper that adds a code point to the font's glyph cache as most recently used, evicting the least recently used
+static inline void qff_glyph_cache_insert(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t glyph_value) {
+    if (qff_font->glyph_cache_count < QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        ++qff_font->glyph_cache_count;
+    }
+    memmove(&qff_font->glyph_cache[1], &qff_font->glyph_cache[0], (qff_font->glyph_cache_count - 1) * sizeof(qff_glyph_cache_entry_t));
+    qff_font->glyph_cache[0] = (qff_glyph_cache_entry_t){.code_point = code_point, .value = glyph_value};
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
@@ -230,63 +369,24 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
-        return true;
+        return qp_drawtext_seek_glyph_data(qff_font, glyph_info.value, width);
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
-
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
-
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
-                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+        uint32_t glyph_value;
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+        if (!qff_glyph_cache_lookup(qff_font, code_point, &glyph_value)) {
+            if (!qff_find_unicode_glyph(qff_font, code_point, &glyph_value)) {
                 return false;
             }
-
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
-                return true;
-            }
+            qff_glyph_cache_insert(qff_font, code_point, glyph_value);
+        }
+#else  // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+        if (!qff_find_unicode_glyph(qff_font, code_point, &glyph_value)) {
+            return false;
         }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
-        return false;
+        return qp_drawtext_seek_glyph_data(qff_font, glyph_value, width);
     }
     return false;
 }
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_internal.h"
+#include "qp_comms.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Core API: device registration
@@ -65,6 +66,11 @@ static void qp_internal_display_timeout_task(void) {
 _Static_assert((QUANTUM_PAINTER_TASK_THROTTLE) > 0 && (QUANTUM_PAINTER_TASK_THROTTLE) < 1000, "QUANTUM_PAINTER_TASK_THROTTLE must be between 1 and 999");
 
 void qp_internal_task(void) {
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    // Keep queued pixdata moving on every pass, as transfers complete far more often than the throttle allows
+    qp_comms_async_task();
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+
     // Perform throttling of the internal processing of Quantum Painter
     static uint32_t last_tick = 0;
     uint32_t        now       = timer_read32();
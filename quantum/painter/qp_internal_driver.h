@@ -38,12 +38,18 @@ typedef bool (*painter_driver_comms_init_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_start_func)(painter_device_t device);
 typedef void (*painter_driver_comms_stop_func)(painter_device_t device);
 typedef uint32_t (*painter_driver_comms_send_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_send_async_func)(painter_device_t device, const void *data, uint32_t byte_count);
 
 typedef struct painter_comms_vtable_t {
     painter_driver_comms_init_func  comms_init;
     painter_driver_comms_start_func comms_start;
     painter_driver_comms_stop_func  comms_stop;
     painter_driver_comms_send_func  comms_send;
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    // Optional. Starts transmission of data without waiting for it to complete, calling qp_comms_async_complete() once
+    // the transfer has finished (potentially from interrupt context).
+    painter_driver_comms_send_async_func comms_send_async;
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
 } painter_comms_vtable_t;
 
 typedef void (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
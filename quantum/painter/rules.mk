@@ -33,6 +33,7 @@ SRC += \
     $(QUANTUM_DIR)/painter/qp_draw_circle.c \
     $(QUANTUM_DIR)/painter/qp_draw_ellipse.c \
     $(QUANTUM_DIR)/painter/qp_draw_image.c \
+    $(QUANTUM_DIR)/painter/qp_draw_list.c \
     $(QUANTUM_DIR)/painter/qp_draw_text.c
 
 # Check if people want animations... enable the defered exec if so.
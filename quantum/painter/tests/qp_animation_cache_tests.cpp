@@ -0,0 +1,375 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "qp.h"
+#include "qgf.h"
+void qp_internal_animation_tick(void);
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+constexpr uint16_t WIDTH       = 64;
+constexpr uint16_t HEIGHT      = 64;
+constexpr uint16_t FRAME_DELAY = 10;
+
+struct delta_t {
+    uint16_t left, top, right, bottom; // right and bottom are exclusive, as per qgf_delta_v1_t
+};
+
+struct image_t {
+    std::vector<uint8_t> bytes;
+    std::vector<size_t>  data_offsets; // start of each frame's pixel data
+    std::vector<size_t>  data_lengths;
+};
+
+void put(std::vector<uint8_t> &out, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        out.push_back((uint8_t)(value >> (8 * i)));
+    }
+}
+
+void put_block_header(std::vector<uint8_t> &out, uint8_t type_id, uint32_t length) {
+    put(out, type_id, 1);
+    put(out, (uint8_t)~type_id, 1);
+    put(out, length, 3);
+}
+
+// Simple RLE encoder producing the format consumed by qp_drawimage_byte_rle_decoder()
+std::vector<uint8_t> rle_encode(const std::vector<uint8_t> &in) {
+    std::vector<uint8_t> out;
+    size_t               i = 0;
+    while (i < in.size()) {
+        size_t run = 1;
+        while (i + run < in.size() && in[i + run] == in[i] && run < 127) {
+            ++run;
+        }
+        if (run >= 2) {
+            out.push_back((uint8_t)run);
+            out.push_back(in[i]);
+            i += run;
+            continue;
+        }
+
+        size_t start = i;
+        while (i < in.size() && i - start < 128 && (i + 1 >= in.size() || in[i + 1] != in[i])) {
+            ++i;
+        }
+        if (i == start) {
+            ++i;
+        }
+        out.push_back((uint8_t)(127 + (i - start)));
+        out.insert(out.end(), in.begin() + start, in.begin() + i);
+    }
+    return out;
+}
+
+// Builds a QGF animation with random pixel content; the first frame is always full, later frames are deltas if supplied
+image_t make_image(uint16_t width, uint16_t height, uint16_t frame_count, qp_image_format_t format, uint8_t bpp, bool has_palette, bool rle, const std::vector<delta_t> &deltas, uint32_t seed) {
+    std::mt19937 rng(seed);
+
+    std::vector<std::vector<uint8_t>> frames;
+    for (uint16_t i = 0; i < frame_count; ++i) {
+        std::vector<uint8_t> frame;
+        put_block_header(frame, QGF_FRAME_DESCRIPTOR_TYPEID, sizeof(qgf_frame_v1_t) - sizeof(qgf_block_header_v1_t));
+        bool is_delta = i > 0 && !deltas.empty();
+        put(frame, format, 1);
+        put(frame, is_delta ? QGF_FRAME_FLAG_DELTA : 0x00, 1);
+        put(frame, rle ? IMAGE_COMPRESSED_RLE : IMAGE_UNCOMPRESSED, 1);
+        put(frame, 0xFF, 1);
+        put(frame, FRAME_DELAY, 2);
+
+        if (has_palette) {
+            // Distinct colors for each index, so any change of pixel data shows up in the output
+            put_block_header(frame, QGF_FRAME_PALETTE_DESCRIPTOR_TYPEID, (1 << bpp) * sizeof(qgf_palette_entry_v1_t));
+            for (int c = 0; c < (1 << bpp); ++c) {
+                put(frame, (uint8_t)(c * (256 >> bpp) + i), 1);
+                put(frame, 255, 1);
+                put(frame, 255 - c * 4, 1);
+            }
+        }
+
+        uint32_t pixel_count = (uint32_t)width * height;
+        if (is_delta) {
+            const delta_t &delta = deltas[(i - 1) % deltas.size()];
+            put_block_header(frame, QGF_FRAME_DELTA_DESCRIPTOR_TYPEID, sizeof(qgf_delta_v1_t) - sizeof(qgf_block_header_v1_t));
+            put(frame, delta.left, 2);
+            put(frame, delta.top, 2);
+            put(frame, delta.right, 2);
+            put(frame, delta.bottom, 2);
+            pixel_count = (uint32_t)(delta.right - delta.left) * (delta.bottom - delta.top);
+        }
+
+        // Short runs of repeated bytes, so that RLE has something to work with
+        std::vector<uint8_t> data;
+        while (data.size() < (pixel_count * bpp + 7) / 8) {
+            data.insert(data.end(), 1 + rng() % 6, (uint8_t)rng());
+        }
+        data.resize((pixel_count * bpp + 7) / 8);
+        if (rle) {
+            data = rle_encode(data);
+        }
+        put_block_header(frame, QGF_FRAME_DATA_DESCRIPTOR_TYPEID, data.size());
+        frame.insert(frame.end(), data.begin(), data.end());
+        frames.push_back(frame);
+    }
+
+    image_t image;
+    size_t  offset = sizeof(qgf_graphics_descriptor_v1_t) + sizeof(qgf_frame_offsets_v1_t) + frame_count * sizeof(uint32_t);
+    size_t  total  = offset;
+    for (auto &frame : frames) {
+        total += frame.size();
+    }
+
+    put_block_header(image.bytes, QGF_GRAPHICS_DESCRIPTOR_TYPEID, sizeof(qgf_graphics_descriptor_v1_t) - sizeof(qgf_block_header_v1_t));
+    put(image.bytes, QGF_MAGIC, 3);
+    put(image.bytes, 0x01, 1);
+    put(image.bytes, total, 4);
+    put(image.bytes, ~(uint32_t)total, 4);
+    put(image.bytes, width, 2);
+    put(image.bytes, height, 2);
+    put(image.bytes, frame_count, 2);
+    put_block_header(image.bytes, QGF_FRAME_OFFSET_DESCRIPTOR_TYPEID, frame_count * sizeof(uint32_t));
+    for (auto &frame : frames) {
+        put(image.bytes, offset, 4);
+        offset += frame.size();
+    }
+    for (auto &frame : frames) {
+        image.bytes.insert(image.bytes.end(), frame.begin(), frame.end());
+    }
+
+    // Locate each frame's pixel data, which is always the final block of the frame
+    offset = sizeof(qgf_graphics_descriptor_v1_t) + sizeof(qgf_frame_offsets_v1_t) + frame_count * sizeof(uint32_t);
+    for (auto &frame : frames) {
+        size_t pos = sizeof(qgf_frame_v1_t);
+        if (has_palette) {
+            pos += sizeof(qgf_palette_v1_t) + (1 << bpp) * sizeof(qgf_palette_entry_v1_t);
+        }
+        if (frame[sizeof(qgf_block_header_v1_t) + 1] & QGF_FRAME_FLAG_DELTA) {
+            pos += sizeof(qgf_delta_v1_t);
+        }
+        pos += sizeof(qgf_data_v1_t);
+        image.data_offsets.push_back(offset + pos);
+        image.data_lengths.push_back(frame.size() - pos);
+        offset += frame.size();
+    }
+    return image;
+}
+
+} // namespace
+
+class QpAnimationCache : public ::testing::Test {
+   protected:
+    // Surfaces cannot be released once made, so they're shared across the whole suite
+    static void SetUpTestSuite() {
+        uncached_surface = qp_rgb565_make_surface(WIDTH, HEIGHT, uncached_buffer);
+        cached_surface   = qp_rgb565_make_surface(WIDTH, HEIGHT, cached_buffer);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(uncached_surface, nullptr);
+        ASSERT_NE(cached_surface, nullptr);
+        ASSERT_TRUE(qp_init(uncached_surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(cached_surface, QP_ROTATION_0));
+        memset(uncached_buffer, 0, sizeof(uncached_buffer));
+        memset(cached_buffer, 0, sizeof(cached_buffer));
+    }
+
+    void TearDown() override {
+        for (auto token : tokens) {
+            qp_stop_animation(token);
+        }
+        tokens.clear();
+        if (image) {
+            qp_close_image(image);
+            image = nullptr;
+        }
+    }
+
+    void load(const image_t &source) {
+        data  = source;
+        image = qp_load_image_mem(data.bytes.data());
+        ASSERT_NE(image, nullptr);
+    }
+
+    deferred_token animate(painter_device_t device, bool recolor) {
+        deferred_token token = recolor ? qp_animate_recolor(device, 8, 4, image, 0, 255, 255, 170, 255, 64) : qp_animate(device, 8, 4, image);
+        EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+        tokens.push_back(token);
+        return token;
+    }
+
+    // Starts an uncached and a cached copy of the animation in lockstep
+    void start(bool recolor, uint32_t arena_size) {
+        animate(uncached_surface, recolor);
+        deferred_token token = animate(cached_surface, recolor);
+        arena.assign((arena_size + 3) / 4, 0);
+        ASSERT_TRUE(qp_animation_cache(token, arena.data(), arena_size));
+    }
+
+    // Time keeps moving forward across tests, as the animation executor remembers when it last ran
+    static void next_frame() {
+        advance_time(FRAME_DELAY);
+        qp_internal_animation_tick();
+    }
+
+    // Steps through a few loops of the animation, checking the cached output after every frame
+    void expect_identical_output(int loops) {
+        EXPECT_EQ(memcmp(uncached_buffer, cached_buffer, sizeof(cached_buffer)), 0) << "frame 0";
+        for (int frame = 1; frame < loops * image->frame_count; ++frame) {
+            std::vector<uint16_t> previous(cached_buffer, cached_buffer + WIDTH * HEIGHT);
+            next_frame();
+            ASSERT_NE(memcmp(previous.data(), cached_buffer, sizeof(cached_buffer)), 0) << "frame " << frame << " was not drawn";
+            ASSERT_EQ(memcmp(uncached_buffer, cached_buffer, sizeof(cached_buffer)), 0) << "frame " << frame;
+        }
+    }
+
+    // Invalidates the pixel data of each of the image's frames, leaving the headers intact
+    void corrupt_pixel_data() {
+        for (size_t i = 0; i < data.data_offsets.size(); ++i) {
+            for (size_t j = 0; j < data.data_lengths[i]; ++j) {
+                data.bytes[data.data_offsets[i] + j] ^= 0xFF;
+            }
+        }
+    }
+
+    static painter_device_t uncached_surface;
+    static painter_device_t cached_surface;
+    static uint16_t         uncached_buffer[WIDTH * HEIGHT];
+    static uint16_t         cached_buffer[WIDTH * HEIGHT];
+
+    image_t                     data;
+    painter_image_handle_t      image = nullptr;
+    std::vector<uint32_t>       arena;
+    std::vector<deferred_token> tokens;
+};
+
+painter_device_t QpAnimationCache::uncached_surface;
+painter_device_t QpAnimationCache::cached_surface;
+uint16_t         QpAnimationCache::uncached_buffer[WIDTH * HEIGHT];
+uint16_t         QpAnimationCache::cached_buffer[WIDTH * HEIGHT];
+
+TEST_F(QpAnimationCache, FullFramesMatchUncached) {
+    load(make_image(40, 32, 6, PALETTE_4BPP, 4, true, false, {}, 1));
+    start(false, qp_animation_cache_size(cached_surface, image));
+    expect_identical_output(3);
+}
+
+TEST_F(QpAnimationCache, RleFramesMatchUncached) {
+    load(make_image(40, 32, 6, PALETTE_4BPP, 4, true, true, {}, 2));
+    start(false, qp_animation_cache_size(cached_surface, image));
+    expect_identical_output(3);
+}
+
+TEST_F(QpAnimationCache, DeltaFramesMatchUncached) {
+    load(make_image(40, 32, 6, PALETTE_4BPP, 4, true, false, {{0, 0, 10, 8}, {5, 6, 40, 7}, {39, 31, 40, 32}, {12, 3, 29, 30}}, 3));
+    start(false, qp_animation_cache_size(cached_surface, image));
+    expect_identical_output(3);
+}
+
+TEST_F(QpAnimationCache, RecoloredFramesMatchUncached) {
+    load(make_image(40, 32, 4, GRAYSCALE_2BPP, 2, false, true, {{4, 4, 20, 20}}, 4));
+    start(true, qp_animation_cache_size(cached_surface, image));
+    expect_identical_output(3);
+}
+
+TEST_F(QpAnimationCache, CachedFramesDoNotReadTheImage) {
+    load(make_image(40, 32, 6, PALETTE_4BPP, 4, true, false, {}, 5));
+    start(false, qp_animation_cache_size(cached_surface, image));
+
+    // The first frame was drawn before the cache was attached, so a full loop from there populates every frame
+    std::vector<std::vector<uint16_t>> reference(image->frame_count);
+    reference[0].assign(uncached_buffer, uncached_buffer + WIDTH * HEIGHT);
+    for (int frame = 1; frame <= image->frame_count; ++frame) {
+        next_frame();
+        reference[frame % image->frame_count].assign(uncached_buffer, uncached_buffer + WIDTH * HEIGHT);
+    }
+
+    // Every frame is now served from the cache, so changing the image's pixel data has no visible effect
+    corrupt_pixel_data();
+    for (int frame = 1; frame <= 2 * image->frame_count; ++frame) {
+        next_frame();
+        int expected = frame % image->frame_count;
+        ASSERT_EQ(memcmp(cached_buffer, reference[expected].data(), sizeof(cached_buffer)), 0) << "frame " << expected;
+        EXPECT_NE(memcmp(uncached_buffer, reference[expected].data(), sizeof(uncached_buffer)), 0) << "frame " << expected;
+    }
+}
+
+TEST_F(QpAnimationCache, PartialBudgetCachesEarliestFrames) {
+    constexpr uint16_t frames = 6;
+    constexpr uint16_t cached = 2;
+    load(make_image(40, 32, frames, PALETTE_4BPP, 4, true, false, {}, 6));
+
+    // Full frames are all the same size, so the arena holds the frame table plus two frames, with a little to spare
+    uint32_t full_size  = qp_animation_cache_size(cached_surface, image);
+    uint32_t table_size = frames * sizeof(uint32_t);
+    uint32_t frame_size = (full_size - table_size) / frames;
+    start(false, table_size + cached * frame_size + frame_size - 1);
+    expect_identical_output(1);
+    next_frame();
+
+    // Frames 1 and 2 were the first rendered after attaching the cache, so only the others still read the image
+    corrupt_pixel_data();
+    for (int frame = 1; frame < frames; ++frame) {
+        next_frame();
+        if (frame <= cached) {
+            EXPECT_NE(memcmp(uncached_buffer, cached_buffer, sizeof(cached_buffer)), 0) << "frame " << frame;
+        } else {
+            EXPECT_EQ(memcmp(uncached_buffer, cached_buffer, sizeof(cached_buffer)), 0) << "frame " << frame;
+        }
+    }
+}
+
+TEST_F(QpAnimationCache, RejectsUnusableArenas) {
+    load(make_image(8, 8, 3, PALETTE_4BPP, 4, true, false, {}, 7));
+    deferred_token token = animate(cached_surface, false);
+
+    uint32_t arena_words[8];
+    EXPECT_FALSE(qp_animation_cache(token, arena_words, 3 * sizeof(uint32_t) - 1));
+    EXPECT_FALSE(qp_animation_cache(token, (uint8_t *)arena_words + 1, sizeof(arena_words) - 1));
+    EXPECT_FALSE(qp_animation_cache(INVALID_DEFERRED_TOKEN, arena_words, sizeof(arena_words)));
+    EXPECT_TRUE(qp_animation_cache(token, arena_words, sizeof(arena_words)));
+    EXPECT_TRUE(qp_animation_cache(token, NULL, 0));
+}
+
+TEST_F(QpAnimationCache, Benchmark) {
+    constexpr int loops  = 50;
+    constexpr int frames = 8;
+
+    auto measure = [&](const image_t &source, bool cache) {
+        load(source);
+        deferred_token token = animate(cached_surface, false);
+        if (cache) {
+            arena.assign((qp_animation_cache_size(cached_surface, image) + 3) / 4, 0);
+            EXPECT_TRUE(qp_animation_cache(token, arena.data(), arena.size() * sizeof(uint32_t)));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < loops * frames; ++i) {
+            next_frame();
+        }
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (loops * frames);
+
+        TearDown();
+        return ns;
+    };
+
+    image_t full  = make_image(WIDTH, HEIGHT - 8, frames, PALETTE_4BPP, 4, true, true, {}, 8);
+    image_t delta = make_image(WIDTH, HEIGHT - 8, frames, PALETTE_4BPP, 4, true, true, {{8, 8, 40, 24}, {20, 30, 56, 50}}, 9);
+
+    double full_uncached  = measure(full, false);
+    double full_cached    = measure(full, true);
+    double delta_uncached = measure(delta, false);
+    double delta_cached   = measure(delta, true);
+
+    std::cout << "[ BENCHMARK] " << WIDTH << "x" << (HEIGHT - 8) << " " << frames << "-frame 4bpp RLE animation on rgb565 surface: full frames " << full_uncached << " ns/frame uncached, " << full_cached << " ns/frame cached; delta frames " << delta_uncached << " ns/frame uncached, " << delta_cached << " ns/frame cached" << std::endl;
+}
@@ -0,0 +1,375 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+extern "C" {
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+#include "qp_stream.h"
+}
+
+namespace {
+
+enum event_type_t { EVENT_START, EVENT_STOP, EVENT_COMMAND, EVENT_SEND, EVENT_SEND_ASYNC };
+
+struct event_t {
+    event_type_t         type;
+    const void*          data;
+    std::vector<uint8_t> bytes;
+};
+
+std::vector<event_t> events;
+
+// Asynchronous transfer currently "on the wire"
+const void* in_flight_data  = nullptr;
+uint32_t    in_flight_bytes = 0;
+bool        auto_complete   = true;
+bool        fail_async      = false;
+
+// Shared bus, which only one client can have started at a time
+bool bus_held = false;
+
+bool client_start() {
+    if (bus_held) {
+        return false;
+    }
+    bus_held = true;
+    return true;
+}
+
+void client_stop() {
+    bus_held = false;
+}
+
+// Completes the transfer in flight, capturing the data as it is at completion time so that any modification of the
+// buffer while it was being transmitted shows up as a mismatch
+void complete_transfer() {
+    ASSERT_NE(in_flight_data, nullptr);
+    const uint8_t* bytes = (const uint8_t*)in_flight_data;
+    events.push_back({EVENT_SEND_ASYNC, in_flight_data, std::vector<uint8_t>(bytes, bytes + in_flight_bytes)});
+    in_flight_data = nullptr;
+    qp_comms_async_complete();
+}
+
+bool mock_comms_init(painter_device_t device) {
+    return true;
+}
+
+bool mock_comms_start(painter_device_t device) {
+    if (!client_start()) {
+        return false;
+    }
+    events.push_back({EVENT_START, nullptr, {}});
+    return true;
+}
+
+void mock_comms_stop(painter_device_t device) {
+    EXPECT_TRUE(bus_held) << "comms stopped without being started";
+    client_stop();
+    events.push_back({EVENT_STOP, nullptr, {}});
+}
+
+uint32_t mock_comms_send(painter_device_t device, const void* data, uint32_t byte_count) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    events.push_back({EVENT_SEND, data, std::vector<uint8_t>(bytes, bytes + byte_count)});
+    return byte_count;
+}
+
+bool mock_comms_send_async(painter_device_t device, const void* data, uint32_t byte_count) {
+    EXPECT_EQ(in_flight_data, nullptr) << "transfer started while another was in flight";
+    EXPECT_TRUE(bus_held) << "transfer started without comms being started";
+    if (fail_async) {
+        return false;
+    }
+    in_flight_data  = data;
+    in_flight_bytes = byte_count;
+    if (auto_complete) {
+        complete_transfer();
+    }
+    return true;
+}
+
+void mock_send_command(painter_device_t device, uint8_t cmd) {
+    events.push_back({EVENT_COMMAND, nullptr, {cmd}});
+}
+
+const painter_comms_with_command_vtable_t mock_comms_vtable = {
+    .base =
+        {
+            .comms_init       = mock_comms_init,
+            .comms_start      = mock_comms_start,
+            .comms_stop       = mock_comms_stop,
+            .comms_send       = mock_comms_send,
+            .comms_send_async = mock_comms_send_async,
+        },
+    .send_command          = mock_send_command,
+    .bulk_command_sequence = NULL,
+};
+
+bool mock_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    qp_comms_command(device, 0x2C);
+    return true;
+}
+
+bool mock_pixdata(painter_device_t device, const void* pixel_data, uint32_t native_pixel_count) {
+    return qp_comms_send(device, pixel_data, native_pixel_count * sizeof(uint16_t)) == native_pixel_count * sizeof(uint16_t);
+}
+
+bool mock_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t* palette) {
+    for (int16_t i = 0; i < palette_size; ++i) {
+        palette[i].rgb565 = (uint16_t)((palette[i].hsv888.h << 8) | palette[i].hsv888.v);
+    }
+    return true;
+}
+
+bool mock_append_pixels(painter_device_t device, uint8_t* target_buffer, qp_pixel_t* palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t* palette_indices) {
+    uint16_t* buf = (uint16_t*)target_buffer;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+    }
+    return true;
+}
+
+bool mock_append_pixdata(painter_device_t device, uint8_t* target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    target_buffer[pixdata_offset] = pixdata_byte;
+    return true;
+}
+
+const painter_driver_vtable_t mock_driver_vtable = {
+    .init            = NULL,
+    .power           = NULL,
+    .clear           = NULL,
+    .flush           = NULL,
+    .viewport        = mock_viewport,
+    .pixdata         = mock_pixdata,
+    .palette_convert = mock_palette_convert,
+    .append_pixels   = mock_append_pixels,
+    .append_pixdata  = mock_append_pixdata,
+};
+
+// Drains the queue, completing each transfer as it is started
+void drain() {
+    while (!qp_comms_async_task()) {
+        if (in_flight_data) {
+            complete_transfer();
+        }
+    }
+}
+
+} // namespace
+
+class QpCommsAsync : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        driver                       = {};
+        driver.driver_vtable         = &mock_driver_vtable;
+        driver.comms_vtable          = &mock_comms_vtable.base;
+        driver.native_bits_per_pixel = 16;
+        driver.validate_ok           = true;
+        driver.panel_width           = 240;
+        driver.panel_height          = 320;
+        events.clear();
+        in_flight_data = nullptr;
+        auto_complete  = true;
+        fail_async     = false;
+        bus_held       = false;
+    }
+
+    void TearDown() override {
+        auto_complete = false;
+        fail_async    = false;
+        drain();
+        EXPECT_FALSE(bus_held) << "bus was left claimed";
+    }
+
+    std::vector<event_type_t> event_types() {
+        std::vector<event_type_t> types;
+        for (auto& e : events) {
+            types.push_back(e.type);
+        }
+        return types;
+    }
+
+    painter_driver_t driver;
+};
+
+TEST_F(QpCommsAsync, FillReturnsBeforeTransfersComplete) {
+    auto_complete = false;
+
+    // 9900 pixels is 618 full blocks of 16 pixels and one partial block of 12
+    EXPECT_EQ(qp_internal_num_pixels_in_buffer(&driver), 16u);
+    EXPECT_TRUE(qp_rect(&driver, 0, 0, 99, 98, 0x12, 0xFF, 0x34, true));
+
+    // Only the first transfer has been started, and comms are still held open for it
+    EXPECT_EQ(event_types(), (std::vector<event_type_t>{EVENT_START, EVENT_COMMAND}));
+    EXPECT_EQ(in_flight_bytes, 24u);
+    EXPECT_TRUE(bus_held);
+
+    drain();
+
+    // Partial block first, then every full block, with comms stopped after each and restarted for the next
+    ASSERT_EQ(events.size(), 2u + 2 + 618 * 3);
+    EXPECT_EQ(events[2].bytes.size(), 24u);
+    uint32_t total_bytes = 0;
+    for (size_t i = 2; i < events.size(); i += 3) {
+        ASSERT_EQ(events[i].type, EVENT_SEND_ASYNC);
+        ASSERT_EQ(events[i + 1].type, EVENT_STOP);
+        if (i > 2) {
+            ASSERT_EQ(events[i - 1].type, EVENT_START);
+            EXPECT_EQ(events[i].bytes.size(), 32u);
+        }
+        EXPECT_EQ(events[i].data, events[2].data);
+        for (size_t j = 0; j < events[i].bytes.size(); j += 2) {
+            EXPECT_EQ(events[i].bytes[j] | (events[i].bytes[j + 1] << 8), 0x1234);
+        }
+        total_bytes += events[i].bytes.size();
+    }
+    EXPECT_EQ(total_bytes, 9900u * 2);
+    EXPECT_EQ(events.back().type, EVENT_STOP);
+}
+
+TEST_F(QpCommsAsync, NextOperationWaitsForQueuedTransfers) {
+    auto_complete = false;
+    EXPECT_TRUE(qp_rect(&driver, 0, 0, 15, 0, 0, 0, 0, true));
+    complete_transfer();
+
+    // Starting the next operation releases the previous operation's comms first
+    auto_complete = true;
+    EXPECT_TRUE(qp_comms_start(&driver));
+    EXPECT_EQ(event_types(), (std::vector<event_type_t>{EVENT_START, EVENT_COMMAND, EVENT_SEND_ASYNC, EVENT_STOP, EVENT_START}));
+    qp_comms_stop(&driver);
+}
+
+TEST_F(QpCommsAsync, LastTransferReleasesBus) {
+    auto_complete = false;
+    EXPECT_TRUE(qp_rect(&driver, 0, 0, 15, 0, 0, 0, 0, true));
+    EXPECT_TRUE(bus_held);
+
+    // The first pass after the transfer completes stops comms, without waiting for another operation
+    complete_transfer();
+    EXPECT_TRUE(qp_comms_async_task());
+    EXPECT_FALSE(bus_held);
+    EXPECT_EQ(events.back().type, EVENT_STOP);
+}
+
+TEST_F(QpCommsAsync, SecondClientCanStartDuringBackgroundFill) {
+    auto_complete = false;
+
+    // 100 pixels is one partial block of 4 and six full blocks of 16
+    EXPECT_TRUE(qp_rect(&driver, 0, 0, 99, 0, 0x12, 0xFF, 0x34, true));
+    complete_transfer();
+
+    // The main loop's pass through qp_internal_task() gives up the bus, and leaves it free for the rest of the loop
+    EXPECT_FALSE(qp_comms_async_task());
+    EXPECT_FALSE(bus_held);
+    ASSERT_TRUE(client_start());
+
+    // The fill waits for the other client instead of failing
+    EXPECT_FALSE(qp_comms_async_task());
+    EXPECT_EQ(in_flight_data, nullptr);
+    client_stop();
+
+    drain();
+    uint32_t total_bytes = 0;
+    for (auto& e : events) {
+        if (e.type == EVENT_SEND_ASYNC) {
+            total_bytes += e.bytes.size();
+        }
+    }
+    EXPECT_EQ(total_bytes, 100u * 2);
+    EXPECT_EQ(events.back().type, EVENT_STOP);
+}
+
+TEST_F(QpCommsAsync, BlockedTransfersAreDroppedWhenWaitedOn) {
+    auto_complete = false;
+    EXPECT_TRUE(qp_rect(&driver, 0, 0, 99, 0, 0x12, 0xFF, 0x34, true));
+    complete_transfer();
+    EXPECT_FALSE(qp_comms_async_task());
+    ASSERT_TRUE(client_start());
+
+    // Waiting for the pixdata buffer gives up on the queued transfers rather than spinning while the bus is held
+    qp_comms_async_release(qp_internal_global_pixdata_buffer, sizeof(qp_internal_global_pixdata_buffer));
+    EXPECT_TRUE(qp_comms_async_task());
+    EXPECT_EQ(in_flight_data, nullptr);
+    client_stop();
+
+    // and the next operation reports the failure
+    auto_complete = true;
+    EXPECT_FALSE(qp_comms_start(&driver));
+    EXPECT_TRUE(qp_comms_start(&driver));
+    qp_comms_stop(&driver);
+}
+
+TEST_F(QpCommsAsync, FailedTransferFailsOperation) {
+    fail_async = true;
+    EXPECT_FALSE(qp_rect(&driver, 0, 0, 99, 0, 0, 0, 0, true));
+    EXPECT_FALSE(bus_held);
+
+    fail_async = false;
+    EXPECT_TRUE(qp_rect(&driver, 0, 0, 99, 0, 0, 0, 0, true));
+}
+
+TEST_F(QpCommsAsync, FailedBackgroundTransferIsReportedByNextStart) {
+    auto_complete = false;
+    EXPECT_TRUE(qp_rect(&driver, 0, 0, 99, 0, 0, 0, 0, true));
+
+    // Transfers started after the fill returned fail
+    fail_async = true;
+    complete_transfer();
+    drain();
+    EXPECT_FALSE(bus_held);
+
+    fail_async    = false;
+    auto_complete = true;
+    EXPECT_FALSE(qp_comms_start(&driver));
+    EXPECT_TRUE(qp_comms_start(&driver));
+    qp_comms_stop(&driver);
+}
+
+TEST_F(QpCommsAsync, DataOutsidePixdataBufferIsSentSynchronously) {
+    uint8_t data[4] = {1, 2, 3, 4};
+    EXPECT_TRUE(qp_comms_start(&driver));
+    EXPECT_EQ(qp_comms_send(&driver, data, sizeof(data)), sizeof(data));
+    qp_comms_stop(&driver);
+    EXPECT_EQ(event_types(), (std::vector<event_type_t>{EVENT_START, EVENT_SEND, EVENT_STOP}));
+}
+
+TEST_F(QpCommsAsync, StreamedPixelsAlternateBufferHalves) {
+    std::vector<uint8_t> indices(1000);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = (uint8_t)(i * 7);
+    }
+    qp_pixel_t palette[256];
+    for (int i = 0; i < 256; ++i) {
+        palette[i].rgb565 = (uint16_t)(i * 257 + 1);
+    }
+
+    qp_memory_stream_t               stream   = qp_make_memory_stream(indices.data(), indices.size());
+    qp_internal_byte_input_state_t   in_state = {.device = &driver, .src_stream = (qp_stream_t*)&stream};
+    qp_internal_byte_input_callback  callback = qp_internal_prepare_input_state(&in_state, IMAGE_UNCOMPRESSED);
+    qp_internal_pixel_output_state_t output   = {.device = &driver, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(&driver)};
+    EXPECT_TRUE(qp_comms_start(&driver));
+    EXPECT_TRUE(qp_internal_decode_palette(&driver, indices.size(), 8, callback, &in_state, palette, qp_internal_pixel_appender, &output));
+    if (output.pixel_write_pos > 0) {
+        EXPECT_TRUE(mock_pixdata(&driver, qp_internal_global_pixdata_buffer, output.pixel_write_pos));
+    }
+    qp_comms_stop(&driver);
+
+    std::vector<uint8_t> transmitted;
+    const void*          previous = nullptr;
+    for (auto& e : events) {
+        if (e.type == EVENT_SEND_ASYNC) {
+            EXPECT_NE(e.data, previous);
+            previous = e.data;
+            transmitted.insert(transmitted.end(), e.bytes.begin(), e.bytes.end());
+        }
+    }
+    ASSERT_EQ(transmitted.size(), indices.size() * 2);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        EXPECT_EQ(transmitted[i * 2] | (transmitted[i * 2 + 1] << 8), palette[indices[i]].rgb565);
+    }
+}
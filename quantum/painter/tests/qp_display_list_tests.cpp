@@ -0,0 +1,212 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "qp.h"
+}
+
+namespace {
+
+constexpr uint16_t WIDTH  = 64;
+constexpr uint16_t HEIGHT = 48;
+
+struct primitive_t {
+    enum { RECT, FILLED_RECT, LINE, CIRCLE, ELLIPSE } type;
+    uint16_t a, b, c, d;
+    uint8_t  hue, val;
+};
+
+primitive_t random_primitive(std::mt19937 &rng) {
+    primitive_t p;
+    p.type = (decltype(p.type))(rng() % 5);
+    p.hue  = rng() % 4 * 64;
+    p.val  = 128 + rng() % 128;
+    switch (p.type) {
+        case primitive_t::RECT:
+        case primitive_t::FILLED_RECT:
+        case primitive_t::LINE:
+            p.a = rng() % WIDTH;
+            p.b = rng() % HEIGHT;
+            p.c = rng() % WIDTH;
+            p.d = rng() % HEIGHT;
+            break;
+        case primitive_t::CIRCLE:
+        case primitive_t::ELLIPSE:
+            p.c = 1 + rng() % 8;
+            p.d = 1 + rng() % 8;
+            p.a = p.c + rng() % (WIDTH - 2 * p.c);
+            p.b = p.d + rng() % (HEIGHT - 2 * p.d);
+            if (p.type == primitive_t::CIRCLE) {
+                p.b = p.c + rng() % (HEIGHT - 2 * p.c);
+            }
+            break;
+    }
+    return p;
+}
+
+void draw_immediate(painter_device_t device, const primitive_t &p) {
+    switch (p.type) {
+        case primitive_t::RECT:
+        case primitive_t::FILLED_RECT:
+            qp_rect(device, p.a, p.b, p.c, p.d, p.hue, 255, p.val, p.type == primitive_t::FILLED_RECT);
+            break;
+        case primitive_t::LINE:
+            qp_line(device, p.a, p.b, p.c, p.d, p.hue, 255, p.val);
+            break;
+        case primitive_t::CIRCLE:
+            qp_circle(device, p.a, p.b, p.c, p.hue, 255, p.val, p.val & 1);
+            break;
+        case primitive_t::ELLIPSE:
+            qp_ellipse(device, p.a, p.b, p.c, p.d, p.hue, 255, p.val, p.val & 1);
+            break;
+    }
+}
+
+bool record(painter_display_list_t list, const primitive_t &p) {
+    switch (p.type) {
+        case primitive_t::RECT:
+        case primitive_t::FILLED_RECT:
+            return qp_display_list_rect(list, p.a, p.b, p.c, p.d, p.hue, 255, p.val, p.type == primitive_t::FILLED_RECT);
+        case primitive_t::LINE:
+            return qp_display_list_line(list, p.a, p.b, p.c, p.d, p.hue, 255, p.val);
+        case primitive_t::CIRCLE:
+            return qp_display_list_circle(list, p.a, p.b, p.c, p.hue, 255, p.val, p.val & 1);
+        case primitive_t::ELLIPSE:
+            return qp_display_list_ellipse(list, p.a, p.b, p.c, p.d, p.hue, 255, p.val, p.val & 1);
+    }
+    return false;
+}
+
+} // namespace
+
+class QpDisplayList : public ::testing::Test {
+   protected:
+    // Surfaces cannot be released once made, so they're shared across the whole suite
+    static void SetUpTestSuite() {
+        listed    = qp_rgb565_make_surface(WIDTH, HEIGHT, listed_buffer);
+        reference = qp_rgb565_make_surface(WIDTH, HEIGHT, reference_buffer);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(listed, nullptr);
+        ASSERT_NE(reference, nullptr);
+        ASSERT_TRUE(qp_init(listed, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(reference, QP_ROTATION_0));
+    }
+
+    void TearDown() override {
+        if (list) {
+            qp_display_list_close(list);
+        }
+    }
+
+    // Draws a frame through the display list, and in full onto the reference surface
+    void render(const std::vector<primitive_t> &frame) {
+        ASSERT_TRUE(qp_display_list_begin(list));
+        for (auto &p : frame) {
+            ASSERT_TRUE(record(list, p));
+        }
+        ASSERT_TRUE(qp_display_list_render(list));
+
+        qp_rect(reference, 0, 0, WIDTH - 1, HEIGHT - 1, 0, 0, 0, true);
+        for (auto &p : frame) {
+            draw_immediate(reference, p);
+        }
+    }
+
+    static painter_device_t listed;
+    static painter_device_t reference;
+    static uint16_t         listed_buffer[WIDTH * HEIGHT];
+    static uint16_t         reference_buffer[WIDTH * HEIGHT];
+
+    painter_display_list_t list = nullptr;
+    uint32_t               list_buffer[512];
+};
+
+painter_device_t QpDisplayList::listed;
+painter_device_t QpDisplayList::reference;
+uint16_t         QpDisplayList::listed_buffer[WIDTH * HEIGHT];
+uint16_t         QpDisplayList::reference_buffer[WIDTH * HEIGHT];
+
+TEST_F(QpDisplayList, IncrementalRenderMatchesFullRedraw) {
+    list = qp_display_list_make(listed, list_buffer, sizeof(list_buffer), 0, 0, 0);
+    ASSERT_NE(list, nullptr);
+
+    std::mt19937             rng(1234);
+    std::vector<primitive_t> frame;
+    for (int i = 0; i < 12; ++i) {
+        frame.push_back(random_primitive(rng));
+    }
+
+    for (int n = 0; n < 200; ++n) {
+        SCOPED_TRACE(testing::Message() << "frame " << n);
+        render(frame);
+        ASSERT_EQ(memcmp(listed_buffer, reference_buffer, sizeof(listed_buffer)), 0);
+
+        // Change, remove, or add a few primitives for the next frame
+        int changes = rng() % 3;
+        for (int i = 0; i < changes; ++i) {
+            switch (rng() % 4) {
+                case 0:
+                    if (frame.size() > 1) {
+                        frame.erase(frame.begin() + rng() % frame.size());
+                    }
+                    break;
+                case 1:
+                    if (frame.size() < 16) {
+                        frame.insert(frame.begin() + rng() % (frame.size() + 1), random_primitive(rng));
+                    }
+                    break;
+                default:
+                    frame[rng() % frame.size()] = random_primitive(rng);
+                    break;
+            }
+        }
+    }
+}
+
+TEST_F(QpDisplayList, UnchangedFrameDrawsNothing) {
+    list = qp_display_list_make(listed, list_buffer, sizeof(list_buffer), 0, 0, 0);
+    ASSERT_NE(list, nullptr);
+
+    std::vector<primitive_t> frame = {{primitive_t::FILLED_RECT, 4, 4, 20, 20, 0, 255}, {primitive_t::LINE, 30, 30, 60, 40, 64, 200}};
+    render(frame);
+
+    // Scribble over the surface behind the display list's back, which an unchanged frame must not touch
+    listed_buffer[10 * WIDTH + 10] = 0x1234;
+    render(frame);
+    EXPECT_EQ(listed_buffer[10 * WIDTH + 10], 0x1234);
+
+    // Changing an unrelated primitive leaves the area untouched too
+    frame[1].hue = 128;
+    render(frame);
+    EXPECT_EQ(listed_buffer[10 * WIDTH + 10], 0x1234);
+
+    // Invalidating redraws everything
+    qp_display_list_invalidate(list);
+    render(frame);
+    EXPECT_EQ(memcmp(listed_buffer, reference_buffer, sizeof(listed_buffer)), 0);
+}
+
+TEST_F(QpDisplayList, AdjacentFillsAreMerged) {
+    // Only enough room for one primitive per frame
+    list = qp_display_list_make(listed, list_buffer, 2 * 28, 0, 0, 0);
+    ASSERT_NE(list, nullptr);
+
+    ASSERT_TRUE(qp_display_list_begin(list));
+    EXPECT_TRUE(qp_display_list_rect(list, 0, 0, 9, 9, 0, 255, 255, true));
+    EXPECT_TRUE(qp_display_list_rect(list, 10, 0, 19, 9, 0, 255, 255, true));
+    EXPECT_TRUE(qp_display_list_rect(list, 0, 10, 19, 19, 0, 255, 255, true));
+    EXPECT_FALSE(qp_display_list_rect(list, 0, 30, 19, 39, 0, 255, 255, true));
+    EXPECT_FALSE(qp_display_list_rect(list, 0, 20, 19, 29, 64, 255, 255, true));
+    EXPECT_TRUE(qp_display_list_render(list));
+
+    qp_rect(reference, 0, 0, WIDTH - 1, HEIGHT - 1, 0, 0, 0, true);
+    qp_rect(reference, 0, 0, 19, 19, 0, 255, 255, true);
+    EXPECT_EQ(memcmp(listed_buffer, reference_buffer, sizeof(listed_buffer)), 0);
+}
@@ -0,0 +1,218 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "qp_internal.h"
+#include "qp_draw.h"
+#include "qp_stream.h"
+}
+
+extern "C" {
+// Globals normally provided by qp_draw_core.c
+uint8_t    qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+qp_pixel_t qp_internal_global_pixel_lookup_table[16];
+
+bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    return false;
+}
+}
+
+namespace {
+
+// Transmitted native pixel data, as seen by the mock display
+std::vector<uint8_t> transmitted;
+
+bool mock_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    const uint8_t *bytes = (const uint8_t *)pixel_data;
+    transmitted.insert(transmitted.end(), bytes, bytes + native_pixel_count * sizeof(uint16_t));
+    return true;
+}
+
+bool mock_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    uint16_t *buf = (uint16_t *)target_buffer;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+    }
+    return true;
+}
+
+bool mock_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    target_buffer[pixdata_offset] = pixdata_byte;
+    return true;
+}
+
+const painter_driver_vtable_t mock_vtable = {
+    .init            = NULL,
+    .power           = NULL,
+    .clear           = NULL,
+    .flush           = NULL,
+    .viewport        = NULL,
+    .pixdata         = mock_pixdata,
+    .palette_convert = NULL,
+    .append_pixels   = mock_append_pixels,
+    .append_pixdata  = mock_append_pixdata,
+};
+
+// Reference outputs, one palette lookup or byte per callback invocation
+std::vector<uint8_t> reference;
+
+bool reference_pixel_appender(qp_pixel_t *palette, uint8_t index, void *cb_arg) {
+    uint16_t pixel = palette[index].rgb565;
+    reference.insert(reference.end(), (uint8_t *)&pixel, (uint8_t *)&pixel + sizeof(pixel));
+    return true;
+}
+
+bool reference_byte_appender(uint8_t byteval, void *cb_arg) {
+    reference.push_back(byteval);
+    return true;
+}
+
+// Generates pixel data made up of random runs, along with its QMK RLE encoding
+void make_data(size_t length, std::mt19937 &rng, std::vector<uint8_t> &raw, std::vector<uint8_t> &rle) {
+    raw.clear();
+    rle.clear();
+    while (raw.size() < length) {
+        if (rng() % 2) {
+            uint8_t run   = 1 + rng() % 127;
+            uint8_t value = rng();
+            rle.push_back(run);
+            rle.push_back(value);
+            raw.insert(raw.end(), run, value);
+        } else {
+            uint8_t run = 1 + rng() % 128;
+            rle.push_back(127 + run);
+            for (uint8_t i = 0; i < run; ++i) {
+                uint8_t value = rng();
+                rle.push_back(value);
+                raw.push_back(value);
+            }
+        }
+    }
+}
+
+} // namespace
+
+class QpDrawCodec : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        driver                        = {};
+        driver.driver_vtable          = &mock_vtable;
+        driver.native_bits_per_pixel  = 16;
+        driver.validate_ok            = true;
+        for (int i = 0; i < 256; ++i) {
+            palette[i].rgb565 = (uint16_t)(i * 257 + 1);
+        }
+        transmitted.clear();
+        reference.clear();
+    }
+
+    painter_driver_t driver;
+    qp_pixel_t       palette[256];
+};
+
+TEST_F(QpDrawCodec, PaletteDecodeMatchesBytewiseDecoder) {
+    std::mt19937 rng(1234);
+    for (uint8_t bpp : {1, 2, 4, 8}) {
+        for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE}) {
+            for (uint32_t pixel_count : {1u, 7u, 63u, 64u, 65u, 1000u, 4099u}) {
+                for (uint32_t max_pixels : {5u, 32u}) {
+                    std::vector<uint8_t> raw, rle;
+                    make_data((pixel_count * bpp + 7) / 8, rng, raw, rle);
+                    std::vector<uint8_t> &input = compression == IMAGE_COMPRESSED_RLE ? rle : raw;
+                    SCOPED_TRACE(testing::Message() << "bpp=" << (int)bpp << " compression=" << (int)compression << " pixels=" << pixel_count << " max_pixels=" << max_pixels);
+                    SetUp();
+
+                    // Reference, one pixel per callback
+                    qp_memory_stream_t              ref_stream   = qp_make_memory_stream(input.data(), input.size());
+                    qp_internal_byte_input_state_t  ref_input    = {.device = &driver, .src_stream = (qp_stream_t *)&ref_stream};
+                    qp_internal_byte_input_callback ref_callback = qp_internal_prepare_input_state(&ref_input, compression);
+                    EXPECT_TRUE(qp_internal_decode_palette(&driver, pixel_count, bpp, ref_callback, &ref_input, palette, reference_pixel_appender, NULL));
+
+                    // Bulk, straight into the pixdata buffer
+                    qp_memory_stream_t               stream   = qp_make_memory_stream(input.data(), input.size());
+                    qp_internal_byte_input_state_t   in_state = {.device = &driver, .src_stream = (qp_stream_t *)&stream};
+                    qp_internal_byte_input_callback  callback = qp_internal_prepare_input_state(&in_state, compression);
+                    qp_internal_pixel_output_state_t output   = {.device = &driver, .pixel_write_pos = 0, .max_pixels = max_pixels};
+                    EXPECT_TRUE(qp_internal_decode_palette(&driver, pixel_count, bpp, callback, &in_state, palette, qp_internal_pixel_appender, &output));
+                    if (output.pixel_write_pos > 0) {
+                        mock_pixdata(&driver, qp_internal_global_pixdata_buffer, output.pixel_write_pos);
+                    }
+
+                    EXPECT_EQ(transmitted, reference);
+                    EXPECT_EQ(qp_stream_tell(&stream), qp_stream_tell(&ref_stream));
+                }
+            }
+        }
+    }
+}
+
+TEST_F(QpDrawCodec, NativeBytesMatchBytewiseDecoder) {
+    std::mt19937 rng(5678);
+    for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE}) {
+        for (uint32_t byte_count : {2u, 64u, 66u, 1000u, 4098u}) {
+            std::vector<uint8_t> raw, rle;
+            make_data(byte_count, rng, raw, rle);
+            std::vector<uint8_t> &input = compression == IMAGE_COMPRESSED_RLE ? rle : raw;
+            SCOPED_TRACE(testing::Message() << "compression=" << (int)compression << " bytes=" << byte_count);
+            SetUp();
+
+            qp_memory_stream_t              ref_stream   = qp_make_memory_stream(input.data(), input.size());
+            qp_internal_byte_input_state_t  ref_input    = {.device = &driver, .src_stream = (qp_stream_t *)&ref_stream};
+            qp_internal_byte_input_callback ref_callback = qp_internal_prepare_input_state(&ref_input, compression);
+            EXPECT_TRUE(qp_internal_send_bytes(&driver, byte_count, ref_callback, &ref_input, reference_byte_appender, NULL));
+
+            qp_memory_stream_t              stream   = qp_make_memory_stream(input.data(), input.size());
+            qp_internal_byte_input_state_t  in_state = {.device = &driver, .src_stream = (qp_stream_t *)&stream};
+            qp_internal_byte_input_callback callback = qp_internal_prepare_input_state(&in_state, compression);
+            qp_internal_byte_output_state_t output   = {.device = &driver, .byte_write_pos = 0, .max_bytes = QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE};
+            EXPECT_TRUE(qp_internal_send_bytes(&driver, byte_count, callback, &in_state, qp_internal_byte_appender, &output));
+            if (output.byte_write_pos > 0) {
+                mock_pixdata(&driver, qp_internal_global_pixdata_buffer, output.byte_write_pos / sizeof(uint16_t));
+            }
+
+            EXPECT_EQ(transmitted, reference);
+        }
+    }
+}
+
+TEST_F(QpDrawCodec, BulkDecodeResumesBytewiseRleState) {
+    std::mt19937         rng(42);
+    std::vector<uint8_t> raw, rle;
+    make_data(2000, rng, raw, rle);
+
+    qp_memory_stream_t              ref_stream   = qp_make_memory_stream(rle.data(), rle.size());
+    qp_internal_byte_input_state_t  ref_input    = {.device = &driver, .src_stream = (qp_stream_t *)&ref_stream};
+    qp_internal_byte_input_callback ref_callback = qp_internal_prepare_input_state(&ref_input, IMAGE_COMPRESSED_RLE);
+    EXPECT_TRUE(qp_internal_decode_palette(&driver, 2000, 8, ref_callback, &ref_input, palette, reference_pixel_appender, NULL));
+
+    // Start off one byte at a time, stopping partway through a run, then switch to bulk decoding
+    qp_memory_stream_t              stream   = qp_make_memory_stream(rle.data(), rle.size());
+    qp_internal_byte_input_state_t  in_state = {.device = &driver, .src_stream = (qp_stream_t *)&stream};
+    qp_internal_byte_input_callback callback = qp_internal_prepare_input_state(&in_state, IMAGE_COMPRESSED_RLE);
+    for (int i = 0; i < 3; ++i) {
+        int16_t  byteval = callback(&in_state);
+        uint16_t pixel   = palette[byteval].rgb565;
+        transmitted.insert(transmitted.end(), (uint8_t *)&pixel, (uint8_t *)&pixel + sizeof(pixel));
+    }
+    qp_internal_pixel_output_state_t output = {.device = &driver, .pixel_write_pos = 0, .max_pixels = 32};
+    EXPECT_TRUE(qp_internal_decode_palette(&driver, 1997, 8, callback, &in_state, palette, qp_internal_pixel_appender, &output));
+    if (output.pixel_write_pos > 0) {
+        mock_pixdata(&driver, qp_internal_global_pixdata_buffer, output.pixel_write_pos);
+    }
+
+    EXPECT_EQ(transmitted, reference);
+}
+
+TEST_F(QpDrawCodec, BulkDecodeFailsOnTruncatedInput) {
+    std::vector<uint8_t>             raw(10, 0x5A);
+    qp_memory_stream_t               stream   = qp_make_memory_stream(raw.data(), raw.size());
+    qp_internal_byte_input_state_t   in_state = {.device = &driver, .src_stream = (qp_stream_t *)&stream};
+    qp_internal_byte_input_callback  callback = qp_internal_prepare_input_state(&in_state, IMAGE_UNCOMPRESSED);
+    qp_internal_pixel_output_state_t output   = {.device = &driver, .pixel_write_pos = 0, .max_pixels = 32};
+    EXPECT_FALSE(qp_internal_decode_palette(&driver, 100, 4, callback, &in_state, palette, qp_internal_pixel_appender, &output));
+}
@@ -0,0 +1,238 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "qp.h"
+#include "qff.h"
+}
+
+namespace {
+
+constexpr uint16_t NUM_GLYPHS        = 2000;
+constexpr uint32_t FIRST_CODE_POINT  = 0x4E00; // CJK unified ideographs
+constexpr uint32_t CODE_POINT_STRIDE = 3;
+constexpr uint8_t  LINE_HEIGHT       = 8;
+
+constexpr size_t DESCRIPTOR_SIZE    = sizeof(qff_font_descriptor_v1_t);
+constexpr size_t BLOCK_HEADER_SIZE  = sizeof(qgf_block_header_v1_t);
+constexpr size_t UNICODE_GLYPH_SIZE = sizeof(qff_unicode_glyph_v1_t);
+constexpr size_t TABLE_OFFSET       = DESCRIPTOR_SIZE + BLOCK_HEADER_SIZE;
+
+uint32_t code_point_of(uint16_t index) {
+    return FIRST_CODE_POINT + index * CODE_POINT_STRIDE;
+}
+
+uint8_t width_of(uint32_t code_point) {
+    return 1 + code_point % 60;
+}
+
+std::string utf8(uint32_t code_point) {
+    std::string out;
+    if (code_point < 0x80) {
+        out += (char)code_point;
+    } else if (code_point < 0x800) {
+        out += (char)(0xC0 | (code_point >> 6));
+        out += (char)(0x80 | (code_point & 0x3F));
+    } else {
+        out += (char)(0xE0 | (code_point >> 12));
+        out += (char)(0x80 | ((code_point >> 6) & 0x3F));
+        out += (char)(0x80 | (code_point & 0x3F));
+    }
+    return out;
+}
+
+void put(std::vector<uint8_t> &out, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        out.push_back((uint8_t)(value >> (8 * i)));
+    }
+}
+
+void put_block_header(std::vector<uint8_t> &out, uint8_t type_id, uint32_t length) {
+    put(out, type_id, 1);
+    put(out, (uint8_t)~type_id, 1);
+    put(out, length, 3);
+}
+
+// Builds a 1bpp QFF with only a unicode table, listing the supplied code points in the order given
+std::vector<uint8_t> make_font(const std::vector<uint32_t> &code_points, bool sorted_flag) {
+    std::vector<uint8_t> table;
+    std::vector<uint8_t> data;
+    for (auto code_point : code_points) {
+        uint8_t width = width_of(code_point);
+        put(table, code_point, 3);
+        put(table, (uint32_t)(data.size() << QFF_GLYPH_WIDTH_BITS) | width, 3);
+        data.resize(data.size() + (width * LINE_HEIGHT + 7) / 8, 0x55);
+    }
+
+    uint32_t total = DESCRIPTOR_SIZE + BLOCK_HEADER_SIZE + table.size() + BLOCK_HEADER_SIZE + data.size();
+
+    std::vector<uint8_t> font;
+    put_block_header(font, QFF_FONT_DESCRIPTOR_TYPEID, DESCRIPTOR_SIZE - BLOCK_HEADER_SIZE);
+    put(font, QFF_MAGIC, 3);
+    put(font, 0x01, 1);     // version
+    put(font, total, 4);
+    put(font, ~total, 4);
+    put(font, LINE_HEIGHT, 1);
+    put(font, 0, 1); // no ascii table
+    put(font, code_points.size(), 2);
+    put(font, GRAYSCALE_1BPP, 1);
+    put(font, sorted_flag ? QFF_FONT_FLAG_SORTED_UNICODE_TABLE : 0x00, 1);
+    put(font, 0x00, 1); // uncompressed
+    put(font, 0xFF, 1); // transparency index
+    put_block_header(font, QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID, table.size());
+    font.insert(font.end(), table.begin(), table.end());
+    put_block_header(font, 0x04, data.size());
+    font.insert(font.end(), data.begin(), data.end());
+    return font;
+}
+
+// Rewrites the width of a glyph in the font's unicode table, so stale cached lookups can be told apart from fresh ones
+void patch_width(std::vector<uint8_t> &font, uint32_t code_point, uint8_t width) {
+    for (size_t offset = TABLE_OFFSET; offset < TABLE_OFFSET + NUM_GLYPHS * UNICODE_GLYPH_SIZE; offset += UNICODE_GLYPH_SIZE) {
+        uint32_t entry = font[offset] | (font[offset + 1] << 8) | (font[offset + 2] << 16);
+        if (entry == code_point) {
+            font[offset + 3] = (font[offset + 3] & ~QFF_GLYPH_WIDTH_MASK) | width;
+            return;
+        }
+    }
+    FAIL() << "code point " << code_point << " not in font";
+}
+
+} // namespace
+
+class QpFontLookup : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        for (uint16_t i = 0; i < NUM_GLYPHS; ++i) {
+            code_points.push_back(code_point_of(i));
+        }
+        sorted_data = make_font(code_points, true);
+
+        // Same glyphs, in an arbitrary order, without the sorted flag
+        std::vector<uint32_t> shuffled = code_points;
+        std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(1234));
+        unsorted_data = make_font(shuffled, false);
+
+        sorted = qp_load_font_mem(sorted_data.data());
+        ASSERT_NE(sorted, nullptr);
+        unsorted = qp_load_font_mem(unsorted_data.data());
+        ASSERT_NE(unsorted, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_font(sorted);
+        qp_close_font(unsorted);
+    }
+
+    std::vector<uint32_t> code_points;
+    std::vector<uint8_t>  sorted_data;
+    std::vector<uint8_t>  unsorted_data;
+    painter_font_handle_t sorted;
+    painter_font_handle_t unsorted;
+};
+
+TEST_F(QpFontLookup, SortedAndUnsortedTablesAgree) {
+    for (auto code_point : code_points) {
+        std::string str = utf8(code_point);
+        EXPECT_EQ(qp_textwidth(sorted, str.c_str()), width_of(code_point)) << "U+" << std::hex << code_point;
+        EXPECT_EQ(qp_textwidth(unsorted, str.c_str()), width_of(code_point)) << "U+" << std::hex << code_point;
+    }
+
+    std::string label;
+    int16_t     width = 0;
+    for (uint16_t index : {0, 1, 999, 1000, 1998, 1999}) {
+        label += utf8(code_point_of(index));
+        width += width_of(code_point_of(index));
+    }
+    EXPECT_EQ(qp_textwidth(sorted, label.c_str()), width);
+    EXPECT_EQ(qp_textwidth(unsorted, label.c_str()), width);
+}
+
+TEST_F(QpFontLookup, MissingGlyphsAreNotFound) {
+    const uint32_t last = code_point_of(NUM_GLYPHS - 1);
+    for (uint32_t code_point : {(uint32_t)0xE9, FIRST_CODE_POINT - 1, FIRST_CODE_POINT + 1, code_point_of(1000) + 2, last + 1, (uint32_t)0xFFFD}) {
+        std::string str = utf8(code_point);
+        EXPECT_EQ(qp_textwidth(sorted, str.c_str()), 0) << "U+" << std::hex << code_point;
+        EXPECT_EQ(qp_textwidth(unsorted, str.c_str()), 0) << "U+" << std::hex << code_point;
+    }
+
+    // A missing glyph fails the whole string, and isn't remembered as found afterwards
+    std::string str = utf8(FIRST_CODE_POINT) + utf8(FIRST_CODE_POINT + 1);
+    EXPECT_EQ(qp_textwidth(sorted, str.c_str()), 0);
+    str = utf8(FIRST_CODE_POINT + 1);
+    EXPECT_EQ(qp_textwidth(sorted, str.c_str()), 0);
+}
+
+TEST_F(QpFontLookup, CacheEvictsLeastRecentlyUsed) {
+    static_assert(QUANTUM_PAINTER_GLYPH_CACHE_SIZE == 8, "test expects an eight entry glyph cache");
+
+    auto lookup = [&](uint16_t index) { return qp_textwidth(sorted, utf8(code_point_of(index)).c_str()); };
+
+    // Fill the cache; glyph 0 is now the least recently used
+    for (uint16_t index = 0; index < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++index) {
+        lookup(index);
+    }
+
+    // Touching glyph 0 makes glyph 1 the least recently used, so the next new glyph evicts glyph 1 instead
+    lookup(0);
+    lookup(100);
+
+    // Change the font underneath the cache -- cached glyphs keep their old widths, evicted ones are read afresh
+    for (uint16_t index : {0, 1, 2, 100}) {
+        patch_width(sorted_data, code_point_of(index), 61);
+    }
+    EXPECT_EQ(lookup(0), width_of(code_point_of(0)));
+    EXPECT_EQ(lookup(2), width_of(code_point_of(2)));
+    EXPECT_EQ(lookup(100), width_of(code_point_of(100)));
+    EXPECT_EQ(lookup(1), 61);
+
+    // Reloading the font into the same slot forgets everything cached for the previous font
+    qp_close_font(sorted);
+    sorted = qp_load_font_mem(sorted_data.data());
+    ASSERT_NE(sorted, nullptr);
+    EXPECT_EQ(lookup(0), 61);
+    EXPECT_EQ(lookup(2), 61);
+}
+
+TEST_F(QpFontLookup, Benchmark) {
+    constexpr int iterations = 20000;
+
+    std::mt19937             rng(42);
+    std::vector<std::string> random_glyphs;
+    for (int i = 0; i < 256; ++i) {
+        random_glyphs.push_back(utf8(code_point_of(rng() % NUM_GLYPHS)));
+    }
+    std::string label;
+    for (uint16_t index : {12, 345, 678, 901, 1234, 1567}) {
+        label += utf8(code_point_of(index));
+    }
+
+    auto measure = [&](painter_font_handle_t font, bool use_label) {
+        int64_t total = 0;
+        auto    start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            total += qp_textwidth(font, use_label ? label.c_str() : random_glyphs[i % random_glyphs.size()].c_str());
+        }
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+        EXPECT_GT(total, 0);
+        return ns;
+    };
+
+    // The shuffled table without the sorted flag is the linear scan baseline
+    double linear_random = measure(unsorted, false);
+    double linear_label  = measure(unsorted, true);
+    double sorted_random = measure(sorted, false);
+    double sorted_label  = measure(sorted, true);
+
+    std::cout << "[ BENCHMARK] " << NUM_GLYPHS << " glyph font, " << QUANTUM_PAINTER_GLYPH_CACHE_SIZE << " entry cache: linear " << linear_random << " ns/random glyph, " << linear_label << " ns/6-glyph label; sorted " << sorted_random << " ns/random glyph, " << sorted_label << " ns/6-glyph label" << std::endl;
+    EXPECT_LT(sorted_random, linear_random);
+}
@@ -0,0 +1,229 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+}
+
+namespace {
+
+constexpr uint16_t WIDTH  = 64;
+constexpr uint16_t HEIGHT = 48;
+
+struct rect_t {
+    uint16_t l, t, r, b;
+
+    uint32_t pixels() const {
+        return (uint32_t)(r - l + 1) * (b - t + 1);
+    }
+    bool operator<(const rect_t &other) const {
+        return std::tie(l, t, r, b) < std::tie(other.l, other.t, other.r, other.b);
+    }
+    bool operator==(const rect_t &other) const {
+        return std::tie(l, t, r, b) == std::tie(other.l, other.t, other.r, other.b);
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const rect_t &rect) {
+    return os << "(" << rect.l << "," << rect.t << ")-(" << rect.r << "," << rect.b << ")";
+}
+
+// What the surface sent to the display
+std::vector<rect_t> viewports;
+uint32_t            pixdata_calls;
+uint32_t            pixdata_bytes;
+
+// The display, which records the transfer and forwards it to a second surface
+painter_driver_t display;
+painter_device_t target;
+
+bool spy_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    viewports.push_back({left, top, right, bottom});
+    return qp_viewport(target, left, top, right, bottom);
+}
+
+bool spy_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    pixdata_calls++;
+    pixdata_bytes += native_pixel_count * sizeof(uint16_t);
+    return qp_pixdata(target, pixel_data, native_pixel_count);
+}
+
+bool spy_comms_start(painter_device_t device) {
+    return true;
+}
+
+void spy_comms_stop(painter_device_t device) {}
+
+const painter_driver_vtable_t spy_driver_vtable = {
+    .init            = NULL,
+    .power           = NULL,
+    .clear           = NULL,
+    .flush           = NULL,
+    .viewport        = spy_viewport,
+    .pixdata         = spy_pixdata,
+    .palette_convert = NULL,
+    .append_pixels   = NULL,
+    .append_pixdata  = NULL,
+};
+
+const painter_comms_vtable_t spy_comms_vtable = {
+    .comms_init  = NULL,
+    .comms_start = spy_comms_start,
+    .comms_stop  = spy_comms_stop,
+    .comms_send  = NULL,
+};
+
+} // namespace
+
+class QpRgb565Surface : public ::testing::Test {
+   protected:
+    // Surfaces cannot be released once made, so they're shared across the whole suite
+    static void SetUpTestSuite() {
+        source = qp_rgb565_make_surface(WIDTH, HEIGHT, source_buffer);
+        target = qp_rgb565_make_surface(WIDTH, HEIGHT, target_buffer);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(source, nullptr);
+        ASSERT_NE(target, nullptr);
+        ASSERT_TRUE(qp_init(source, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(target, QP_ROTATION_0));
+        ASSERT_TRUE(qp_flush(source));
+
+        display                       = {};
+        display.driver_vtable         = &spy_driver_vtable;
+        display.comms_vtable          = &spy_comms_vtable;
+        display.native_bits_per_pixel = 16;
+        display.validate_ok           = true;
+        display.panel_width           = WIDTH;
+        display.panel_height          = HEIGHT;
+        viewports.clear();
+        pixdata_calls = 0;
+        pixdata_bytes = 0;
+    }
+
+    void fill(const rect_t &rect, uint8_t hue) {
+        ASSERT_TRUE(qp_rect(source, rect.l, rect.t, rect.r, rect.b, hue, 255, 255, true));
+    }
+
+    // Draws the source surface onto the display, returning the regions which were sent
+    std::vector<rect_t> draw() {
+        viewports.clear();
+        pixdata_calls = 0;
+        pixdata_bytes = 0;
+        EXPECT_TRUE(qp_rgb565_surface_draw(source, &display, 0, 0));
+        std::vector<rect_t> sorted = viewports;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    }
+
+    static uint32_t bytes(const std::vector<rect_t> &rects) {
+        uint32_t total = 0;
+        for (auto &rect : rects) {
+            total += rect.pixels() * sizeof(uint16_t);
+        }
+        return total;
+    }
+
+    static painter_device_t source;
+    static uint16_t         source_buffer[WIDTH * HEIGHT];
+    static uint16_t         target_buffer[WIDTH * HEIGHT];
+};
+
+painter_device_t QpRgb565Surface::source;
+uint16_t         QpRgb565Surface::source_buffer[WIDTH * HEIGHT];
+uint16_t         QpRgb565Surface::target_buffer[WIDTH * HEIGHT];
+
+#if RGB565_SURFACE_DIRTY_RECTS > 1
+TEST_F(QpRgb565Surface, DisjointRectsAreSentSeparately) {
+    fill({0, 0, 9, 9}, 0);
+    fill({50, 30, 59, 39}, 64);
+
+    std::vector<rect_t> expected = {{0, 0, 9, 9}, {50, 30, 59, 39}};
+    EXPECT_EQ(draw(), expected);
+    EXPECT_EQ(pixdata_bytes, 2 * 100 * sizeof(uint16_t));
+    EXPECT_EQ(memcmp(source_buffer, target_buffer, sizeof(source_buffer)), 0);
+
+    // Nothing is left dirty afterwards
+    EXPECT_EQ(draw(), std::vector<rect_t>{});
+    EXPECT_EQ(pixdata_bytes, 0u);
+}
+
+TEST_F(QpRgb565Surface, TouchingRectsAreMerged) {
+    fill({0, 0, 9, 9}, 0);
+    fill({10, 0, 19, 9}, 64);   // adjacent
+    fill({15, 5, 24, 14}, 128); // overlapping the merged pair
+    fill({40, 40, 41, 41}, 192);
+
+    std::vector<rect_t> expected = {{0, 0, 24, 14}, {40, 40, 41, 41}};
+    EXPECT_EQ(draw(), expected);
+    EXPECT_EQ(pixdata_bytes, bytes(expected));
+    EXPECT_EQ(memcmp(source_buffer, target_buffer, sizeof(source_buffer)), 0);
+}
+
+TEST_F(QpRgb565Surface, FullListMergesCheapestPair) {
+    static_assert(RGB565_SURFACE_DIRTY_RECTS == 4, "test expects four dirty rectangles");
+    fill({0, 0, 3, 3}, 0);
+    fill({5, 0, 8, 3}, 32);
+    fill({40, 40, 43, 43}, 64);
+    fill({20, 20, 23, 23}, 96);
+    // The fifth region is closest to the second one, and is merged with it
+    fill({60, 0, 63, 3}, 128);
+
+    std::vector<rect_t> expected = {{0, 0, 3, 3}, {5, 0, 63, 3}, {20, 20, 23, 23}, {40, 40, 43, 43}};
+    EXPECT_EQ(draw(), expected);
+    EXPECT_EQ(pixdata_bytes, bytes(expected));
+    EXPECT_EQ(memcmp(source_buffer, target_buffer, sizeof(source_buffer)), 0);
+}
+#else
+TEST_F(QpRgb565Surface, DisjointRectsAreSentAsBoundingBox) {
+    fill({0, 0, 9, 9}, 0);
+    fill({50, 30, 59, 39}, 64);
+
+    std::vector<rect_t> expected = {{0, 0, 59, 39}};
+    EXPECT_EQ(draw(), expected);
+    EXPECT_EQ(pixdata_bytes, bytes(expected));
+    EXPECT_EQ(memcmp(source_buffer, target_buffer, sizeof(source_buffer)), 0);
+
+    // Nothing is left dirty afterwards
+    EXPECT_EQ(draw(), std::vector<rect_t>{});
+    EXPECT_EQ(pixdata_bytes, 0u);
+}
+#endif
+
+TEST_F(QpRgb565Surface, FullSurfaceIsSentAsOneRun) {
+    fill({0, 0, WIDTH - 1, HEIGHT - 1}, 0);
+    // Anything else drawn is inside the full surface rectangle
+    fill({10, 10, 20, 20}, 64);
+
+    std::vector<rect_t> expected = {{0, 0, WIDTH - 1, HEIGHT - 1}};
+    EXPECT_EQ(draw(), expected);
+    EXPECT_EQ(pixdata_bytes, WIDTH * HEIGHT * sizeof(uint16_t));
+    // Full-width regions are contiguous, so every transfer but the last fills the pixdata buffer
+    uint32_t buffer_pixels = QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / sizeof(uint16_t);
+    EXPECT_EQ(pixdata_calls, (WIDTH * HEIGHT + buffer_pixels - 1) / buffer_pixels);
+    EXPECT_EQ(memcmp(source_buffer, target_buffer, sizeof(source_buffer)), 0);
+}
+
+TEST_F(QpRgb565Surface, UnchangedPixelsAreNotDirty) {
+    fill({0, 0, 9, 9}, 0);
+    draw();
+
+    // Redrawing the same content changes nothing
+    fill({0, 0, 9, 9}, 0);
+    EXPECT_EQ(draw(), std::vector<rect_t>{});
+
+    // Only the changed part of an overlapping fill is sent
+    fill({0, 0, 9, 19}, 0);
+    std::vector<rect_t> expected = {{0, 10, 9, 19}};
+    EXPECT_EQ(draw(), expected);
+    EXPECT_EQ(pixdata_bytes, bytes(expected));
+}
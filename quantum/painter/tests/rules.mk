@@ -0,0 +1,74 @@
+qp_draw_codec_DEFS := -DMATRIX_ROWS=1 -DMATRIX_COLS=1 -DNO_DEBUG -DQUANTUM_PAINTER_ENABLE -DQUANTUM_PAINTER_PIXDATA_BUFFER_SIZE=64
+qp_draw_codec_INC := $(QUANTUM_PATH)/painter
+
+qp_draw_codec_SRC := \
+	$(QUANTUM_PATH)/painter/tests/qp_draw_codec_tests.cpp \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c
+
+qp_comms_async_DEFS := -DMATRIX_ROWS=1 -DMATRIX_COLS=1 -DNO_DEBUG -DQUANTUM_PAINTER_ENABLE -DQUANTUM_PAINTER_PIXDATA_BUFFER_SIZE=64 -DQUANTUM_PAINTER_ASYNC_PIXDATA=1
+qp_comms_async_INC := $(QUANTUM_PATH)/painter
+
+qp_comms_async_SRC := \
+	$(QUANTUM_PATH)/painter/tests/qp_comms_async_tests.cpp \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c
+
+qp_surface_common_DEFS := -DMATRIX_ROWS=1 -DMATRIX_COLS=1 -DNO_DEBUG -DQUANTUM_PAINTER_ENABLE -DQUANTUM_PAINTER_RGB565_SURFACE_ENABLE -DRGB565_SURFACE_NUM_DEVICES=2
+qp_surface_common_INC := \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/generic
+
+qp_surface_common_SRC := \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_draw_list.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(DRIVER_PATH)/painter/generic/qp_rgb565_surface.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+qp_display_list_DEFS := $(qp_surface_common_DEFS)
+qp_display_list_INC := $(qp_surface_common_INC)
+
+qp_display_list_SRC := \
+	$(QUANTUM_PATH)/painter/tests/qp_display_list_tests.cpp \
+	$(qp_surface_common_SRC)
+
+qp_rgb565_surface_DEFS := $(qp_surface_common_DEFS) -DRGB565_SURFACE_DIRTY_RECTS=4
+qp_rgb565_surface_INC := $(qp_surface_common_INC)
+
+qp_rgb565_surface_SRC := \
+	$(QUANTUM_PATH)/painter/tests/qp_rgb565_surface_tests.cpp \
+	$(qp_surface_common_SRC)
+
+qp_rgb565_surface_bounding_box_DEFS := $(qp_surface_common_DEFS)
+qp_rgb565_surface_bounding_box_INC := $(qp_surface_common_INC)
+qp_rgb565_surface_bounding_box_SRC := $(qp_rgb565_surface_SRC)
+
+qp_font_lookup_DEFS := $(qp_surface_common_DEFS)
+qp_font_lookup_INC := $(qp_surface_common_INC)
+
+qp_font_lookup_SRC := \
+	$(QUANTUM_PATH)/painter/tests/qp_font_lookup_tests.cpp \
+	$(qp_surface_common_SRC)
+
+qp_animation_cache_DEFS := $(qp_surface_common_DEFS)
+qp_animation_cache_INC := $(qp_surface_common_INC)
+
+qp_animation_cache_SRC := \
+	$(QUANTUM_PATH)/painter/tests/qp_animation_cache_tests.cpp \
+	$(qp_surface_common_SRC)
@@ -0,0 +1,8 @@
+TEST_LIST += \
+	qp_animation_cache \
+	qp_comms_async \
+	qp_display_list \
+	qp_draw_codec \
+	qp_font_lookup \
+	qp_rgb565_surface \
+	qp_rgb565_surface_bounding_box
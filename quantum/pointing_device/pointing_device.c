@@ -79,8 +79,23 @@ uint16_t pointing_device_get_shared_cpi(void) {
 static report_mouse_t local_mouse_report         = {};
 static bool           pointing_device_force_send = false;
 
+#ifdef POINTING_DEVICE_SUBPIXEL_ENABLE
+static subpixel_remainder_t local_subpixel_remainder = {};
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+static subpixel_remainder_t shared_subpixel_remainder = {};
+#    endif
+#endif
+
 extern const pointing_device_driver_t pointing_device_driver;
 
+#ifdef POINTING_DEVICE_REPORT_SCHEDULER
+#    if defined(SPLIT_POINTING_ENABLE)
+#        error POINTING_DEVICE_REPORT_SCHEDULER not supported when sharing the pointing device report between sides.
+#    endif
+static pointing_device_scheduler_stats_t scheduler_stats   = {};
+static uint8_t                           scheduler_pending = 0; // Samples merged into local_mouse_report since the last report
+#endif
+
 /**
  * @brief Keyboard level code pointing device initialisation
  *
@@ -156,6 +171,17 @@ __attribute__((weak)) void pointing_device_init(void) {
 #endif
     }
 
+#ifdef POINTING_DEVICE_REPORT_SCHEDULER
+    memset(&scheduler_stats, 0, sizeof(scheduler_stats));
+    scheduler_pending = 0;
+#endif
+#ifdef POINTING_DEVICE_SUBPIXEL_ENABLE
+    memset(&local_subpixel_remainder, 0, sizeof(local_subpixel_remainder));
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+    memset(&shared_subpixel_remainder, 0, sizeof(shared_subpixel_remainder));
+#    endif
+#endif
+
     pointing_device_init_kb();
     pointing_device_init_user();
 }
@@ -182,6 +208,85 @@ __attribute__((weak)) bool pointing_device_send(void) {
     return should_send_report || buttons;
 }
 
+/**
+ * @brief clamps int16_t to int8_t
+ *
+ * @param[in] int16_t value
+ * @return int8_t clamped value
+ */
+static inline int8_t pointing_device_hv_clamp(int16_t value) {
+    if (value < INT8_MIN) {
+        return INT8_MIN;
+    } else if (value > INT8_MAX) {
+        return INT8_MAX;
+    } else {
+        return value;
+    }
+}
+
+/**
+ * @brief clamps int16_t to int8_t
+ *
+ * @param[in] clamp_range_t value
+ * @return mouse_xy_report_t clamped value
+ */
+static inline mouse_xy_report_t pointing_device_xy_clamp(clamp_range_t value) {
+    if (value < XY_REPORT_MIN) {
+        return XY_REPORT_MIN;
+    } else if (value > XY_REPORT_MAX) {
+        return XY_REPORT_MAX;
+    } else {
+        return value;
+    }
+}
+
+#ifdef POINTING_DEVICE_REPORT_SCHEDULER
+/**
+ * @brief Merges a sensor sample into the report waiting to be sent
+ *
+ * Movement is added up, clamping to the range of the report, and buttons are taken from the sample.
+ *
+ * @param[in] pending report_mouse_t waiting to be sent
+ * @param[in] sample report_mouse_t just read from the sensor
+ * @return merged report_mouse_t
+ */
+static report_mouse_t pointing_device_merge_sample(report_mouse_t pending, report_mouse_t sample) {
+    clamp_range_t x = (clamp_range_t)pending.x + sample.x;
+    clamp_range_t y = (clamp_range_t)pending.y + sample.y;
+    int16_t       h = (int16_t)pending.h + sample.h;
+    int16_t       v = (int16_t)pending.v + sample.v;
+
+    pending.x       = pointing_device_xy_clamp(x);
+    pending.y       = pointing_device_xy_clamp(y);
+    pending.h       = pointing_device_hv_clamp(h);
+    pending.v       = pointing_device_hv_clamp(v);
+    pending.buttons = sample.buttons;
+
+    scheduler_stats.samples++;
+    if (scheduler_pending > 0) {
+        scheduler_stats.merged++;
+    }
+    if (scheduler_pending < UINT8_MAX) {
+        scheduler_pending++;
+    }
+    if (pending.x != x || pending.y != y || pending.h != h || pending.v != v) {
+        scheduler_stats.dropped++;
+    }
+    return pending;
+}
+
+/**
+ * @brief Gets the pointing device report scheduler statistics
+ *
+ * NOTE : Only available when using POINTING_DEVICE_REPORT_SCHEDULER
+ *
+ * @return statistics gathered since pointing_device_init()
+ */
+const pointing_device_scheduler_stats_t *pointing_device_get_scheduler_stats(void) {
+    return &scheduler_stats;
+}
+#endif
+
 /**
  * @brief Adjust mouse report by any optional common pointing configuration defines
  *
@@ -233,7 +338,19 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
-#if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+#if defined(POINTING_DEVICE_REPORT_SCHEDULER)
+    // Reports follow the host's polling interval, and the sensor is always read right before one is due
+    static uint32_t last_report = 0;
+    static uint32_t last_sample = 0;
+    const bool      report_due  = timer_elapsed32(last_report) >= POINTING_DEVICE_REPORT_INTERVAL_MS;
+    if (!report_due && timer_elapsed32(last_sample) < POINTING_DEVICE_SAMPLE_INTERVAL_MS) {
+        return false;
+    }
+    last_sample = timer_read32();
+    if (report_due) {
+        last_report = last_sample;
+    }
+#elif (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
         return false;
@@ -264,6 +381,14 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #    else
 #        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
 #    endif
+#elif defined(POINTING_DEVICE_REPORT_SCHEDULER)
+    local_mouse_report = pointing_device_merge_sample(local_mouse_report, pointing_device_driver.get_report((report_mouse_t){.buttons = local_mouse_report.buttons}));
+
+    if (!report_due) {
+        return false;
+    }
+    scheduler_stats.reports++;
+    scheduler_pending = 0;
 #else
     local_mouse_report = pointing_device_driver.get_report(local_mouse_report);
 #endif // defined(SPLIT_POINTING_ENABLE)
@@ -277,9 +402,16 @@ __attribute__((weak)) bool pointing_device_task(void) {
         local_mouse_report  = pointing_device_adjust_by_defines_right(local_mouse_report);
         shared_mouse_report = pointing_device_adjust_by_defines(shared_mouse_report);
     }
+#    ifdef POINTING_DEVICE_SUBPIXEL_ENABLE
+    local_mouse_report  = pointing_device_subpixel_apply(&local_subpixel_remainder, local_mouse_report);
+    shared_mouse_report = pointing_device_subpixel_apply(&shared_subpixel_remainder, shared_mouse_report);
+#    endif
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
 #else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#    ifdef POINTING_DEVICE_SUBPIXEL_ENABLE
+    local_mouse_report = pointing_device_subpixel_apply(&local_subpixel_remainder, local_mouse_report);
+#    endif
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
 #endif
     // automatic mouse layer function
@@ -371,37 +503,6 @@ void pointing_device_set_cpi_on_side(bool left, uint16_t cpi) {
     }
 }
 
-/**
- * @brief clamps int16_t to int8_t
- *
- * @param[in] int16_t value
- * @return int8_t clamped value
- */
-static inline int8_t pointing_device_hv_clamp(int16_t value) {
-    if (value < INT8_MIN) {
-        return INT8_MIN;
-    } else if (value > INT8_MAX) {
-        return INT8_MAX;
-    } else {
-        return value;
-    }
-}
-
-/**
- * @brief clamps int16_t to int8_t
- *
- * @param[in] clamp_range_t value
- * @return mouse_xy_report_t clamped value
- */
-static inline mouse_xy_report_t pointing_device_xy_clamp(clamp_range_t value) {
-    if (value < XY_REPORT_MIN) {
-        return XY_REPORT_MIN;
-    } else if (value > XY_REPORT_MAX) {
-        return XY_REPORT_MAX;
-    } else {
-        return value;
-    }
-}
 /**
  * @brief combines 2 mouse reports and returns 2
  *
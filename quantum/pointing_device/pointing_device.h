@@ -24,6 +24,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
 #    include "pointing_device_auto_mouse.h"
 #endif
+#ifdef POINTING_DEVICE_SUBPIXEL_ENABLE
+#    include "pointing_device_subpixel.h"
+#endif
 
 #if defined(POINTING_DEVICE_DRIVER_adns5050)
 #    include "drivers/sensors/adns5050.h"
@@ -99,6 +102,28 @@ typedef int32_t clamp_range_t;
 typedef int16_t clamp_range_t;
 #endif
 
+#ifdef POINTING_DEVICE_REPORT_SCHEDULER
+#    ifndef POINTING_DEVICE_REPORT_INTERVAL_MS
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define POINTING_DEVICE_REPORT_INTERVAL_MS USB_POLLING_INTERVAL_MS
+#        else
+#            define POINTING_DEVICE_REPORT_INTERVAL_MS 1
+#        endif
+#    endif
+#    ifndef POINTING_DEVICE_SAMPLE_INTERVAL_MS
+#        define POINTING_DEVICE_SAMPLE_INTERVAL_MS POINTING_DEVICE_REPORT_INTERVAL_MS
+#    endif
+
+typedef struct {
+    uint32_t samples; // Sensor reads
+    uint32_t reports; // Reports handed on for sending
+    uint32_t merged;  // Sensor reads merged into a report along with earlier ones
+    uint32_t dropped; // Sensor reads whose movement was clamped because the report was full
+} pointing_device_scheduler_stats_t;
+
+const pointing_device_scheduler_stats_t *pointing_device_get_scheduler_stats(void);
+#endif
+
 void           pointing_device_init(void);
 bool           pointing_device_task(void);
 bool           pointing_device_send(void);
@@ -0,0 +1,69 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_SUBPIXEL_ENABLE
+
+#    include "pointing_device_subpixel.h"
+#    include "pointing_device.h"
+#    include "util.h"
+#    include <stdlib.h>
+
+static uint32_t subpixel_xy_scale = POINTING_DEVICE_SUBPIXEL_XY_SCALE;
+static uint32_t subpixel_hv_scale = POINTING_DEVICE_SUBPIXEL_HV_SCALE;
+
+void pointing_device_set_subpixel_scale(uint32_t xy_scale, uint32_t hv_scale) {
+    subpixel_xy_scale = xy_scale;
+    subpixel_hv_scale = hv_scale;
+}
+
+uint32_t pointing_device_get_subpixel_xy_scale(void) {
+    return subpixel_xy_scale;
+}
+
+uint32_t pointing_device_get_subpixel_hv_scale(void) {
+    return subpixel_hv_scale;
+}
+
+__attribute__((weak)) uint32_t pointing_device_subpixel_gain_user(uint16_t speed) {
+#    ifdef POINTING_DEVICE_SUBPIXEL_ACCELERATION
+    uint32_t gain = SUBPIXEL_ONE + (uint32_t)speed * (POINTING_DEVICE_SUBPIXEL_ACCELERATION);
+    return MIN(gain, POINTING_DEVICE_SUBPIXEL_ACCELERATION_LIMIT);
+#    else
+    return SUBPIXEL_ONE;
+#    endif
+}
+
+__attribute__((weak)) uint32_t pointing_device_subpixel_gain_kb(uint16_t speed) {
+    return pointing_device_subpixel_gain_user(speed);
+}
+
+/**
+ * @brief Adds scaled movement to a Q16 remainder, returning the whole counts that fit in the report
+ *
+ * Anything left in the remainder beyond one full report is dropped, so that motion stops soon after the sensor does.
+ */
+static int32_t subpixel_accumulate(int32_t *remainder, int32_t value, uint32_t scale, int32_t min, int32_t max) {
+    int64_t total = *remainder + (int64_t)value * scale;
+    int32_t out   = total / (int32_t)SUBPIXEL_ONE; // Rounds towards zero, so both directions behave the same
+    out           = MAX(min, MIN(out, max));
+    total -= (int64_t)out * SUBPIXEL_ONE;
+    *remainder = MAX((int64_t)min * SUBPIXEL_ONE, MIN(total, (int64_t)max * SUBPIXEL_ONE));
+    return out;
+}
+
+report_mouse_t pointing_device_subpixel_apply(subpixel_remainder_t *remainder, report_mouse_t mouse_report) {
+    // Cheap approximation of the length of the X/Y movement
+    uint16_t ax    = abs(mouse_report.x);
+    uint16_t ay    = abs(mouse_report.y);
+    uint16_t speed = MAX(ax, ay) + MIN(ax, ay) / 2;
+
+    uint32_t xy_scale = ((uint64_t)subpixel_xy_scale * pointing_device_subpixel_gain_kb(speed)) >> 16;
+
+    mouse_report.x = subpixel_accumulate(&remainder->x, mouse_report.x, xy_scale, XY_REPORT_MIN, XY_REPORT_MAX);
+    mouse_report.y = subpixel_accumulate(&remainder->y, mouse_report.y, xy_scale, XY_REPORT_MIN, XY_REPORT_MAX);
+    mouse_report.h = subpixel_accumulate(&remainder->h, mouse_report.h, subpixel_hv_scale, INT8_MIN, INT8_MAX);
+    mouse_report.v = subpixel_accumulate(&remainder->v, mouse_report.v, subpixel_hv_scale, INT8_MIN, INT8_MAX);
+    return mouse_report;
+}
+
+#endif // POINTING_DEVICE_SUBPIXEL_ENABLE
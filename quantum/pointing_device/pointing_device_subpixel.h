@@ -0,0 +1,70 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+/* check settings and set defaults */
+#ifndef POINTING_DEVICE_SUBPIXEL_ENABLE
+#    error "POINTING_DEVICE_SUBPIXEL_ENABLE not defined! check config settings"
+#endif
+
+/**
+ * Fixed point 1.0 for the sub-pixel motion pipeline, whose scales and gains are Q16.
+ */
+#define SUBPIXEL_ONE ((uint32_t)1 << 16)
+
+#ifndef POINTING_DEVICE_SUBPIXEL_XY_SCALE
+#    define POINTING_DEVICE_SUBPIXEL_XY_SCALE SUBPIXEL_ONE
+#endif
+#ifndef POINTING_DEVICE_SUBPIXEL_HV_SCALE
+#    define POINTING_DEVICE_SUBPIXEL_HV_SCALE SUBPIXEL_ONE
+#endif
+#if defined(POINTING_DEVICE_SUBPIXEL_ACCELERATION) && !defined(POINTING_DEVICE_SUBPIXEL_ACCELERATION_LIMIT)
+#    define POINTING_DEVICE_SUBPIXEL_ACCELERATION_LIMIT (4 * SUBPIXEL_ONE)
+#endif
+
+/**
+ * Motion carried over between reports, in Q16 counts. Each pipeline (e.g. each side of a combined split) has its own.
+ */
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+} subpixel_remainder_t;
+
+/**
+ * @brief Scales a report's motion, adding and carrying sub-count remainders
+ *
+ * Movement is scaled by the XY or HV scale and, for X and Y, the gain returned by pointing_device_subpixel_gain_kb().
+ * The whole counts are emitted in the report, and the fraction left over -- as well as anything beyond the range of
+ * the report -- is carried into the next one, so that slow or scaled down movement is not lost to truncation.
+ *
+ * @param[in] remainder motion carried over by this pipeline
+ * @param[in] mouse_report report_mouse_t to be scaled
+ * @return report_mouse_t with scaled values
+ */
+report_mouse_t pointing_device_subpixel_apply(subpixel_remainder_t *remainder, report_mouse_t mouse_report);
+
+/**
+ * @brief Sets the Q16 scales applied to X/Y movement and to scrolling
+ *
+ * Replaces dividing or multiplying the report in pointing_device_task_*(), e.g. for sniping or drag scroll, so that
+ * the fractions are carried over instead of discarded.
+ */
+void     pointing_device_set_subpixel_scale(uint32_t xy_scale, uint32_t hv_scale);
+uint32_t pointing_device_get_subpixel_xy_scale(void);
+uint32_t pointing_device_get_subpixel_hv_scale(void);
+
+/**
+ * @brief Q16 gain for X/Y movement at the given speed, in counts per report
+ *
+ * Defaults to a linear curve from 1.0, rising by POINTING_DEVICE_SUBPIXEL_ACCELERATION per count up to
+ * POINTING_DEVICE_SUBPIXEL_ACCELERATION_LIMIT, or a constant 1.0 without POINTING_DEVICE_SUBPIXEL_ACCELERATION.
+ */
+uint32_t pointing_device_subpixel_gain_kb(uint16_t speed);
+uint32_t pointing_device_subpixel_gain_user(uint16_t speed);
@@ -0,0 +1,163 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+#include "pointing_device.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Fake sensor, reporting the same movement on every read and recording when it was read */
+static report_mouse_t        sensor_motion;
+static std::vector<uint32_t> sensor_reads;
+
+static void fake_init(void) {}
+static report_mouse_t fake_get_report(report_mouse_t mouse_report) {
+    sensor_reads.push_back(timer_read32());
+    mouse_report.x = sensor_motion.x;
+    mouse_report.y = sensor_motion.y;
+    mouse_report.h = sensor_motion.h;
+    mouse_report.v = sensor_motion.v;
+    mouse_report.buttons |= sensor_motion.buttons;
+    return mouse_report;
+}
+static uint16_t fake_get_cpi(void) {
+    return 800;
+}
+static void fake_set_cpi(uint16_t cpi) {}
+
+extern "C" const pointing_device_driver_t pointing_device_driver = {
+    .init       = fake_init,
+    .get_report = fake_get_report,
+    .set_cpi    = fake_set_cpi,
+    .get_cpi    = fake_get_cpi,
+};
+
+/* Fake host, recording every report sent and when */
+struct sent_report {
+    report_mouse_t report;
+    uint32_t       time;
+};
+static std::vector<sent_report> sent;
+
+extern "C" void host_mouse_send(report_mouse_t *report) {
+    sent.push_back({*report, timer_read32()});
+}
+
+extern "C" bool has_mouse_report_changed(report_mouse_t *new_report, report_mouse_t *old_report) {
+    return memcmp(new_report, old_report, sizeof(report_mouse_t)) != 0;
+}
+
+class PointingDeviceScheduler : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        sensor_motion = {};
+        sensor_reads.clear();
+        sent.clear();
+        set_time(1000);
+        pointing_device_init();
+        // Settle the schedule, so that every test starts right after a report
+        pointing_device_task();
+        sensor_reads.clear();
+        sent.clear();
+    }
+
+    // Runs the pointing device task as often as the main loop would, for the given time
+    void run(uint32_t ms, uint32_t loop_ms = 1) {
+        const pointing_device_scheduler_stats_t *stats = pointing_device_get_scheduler_stats();
+        start                                          = *stats;
+        for (uint32_t t = 0; t < ms; t += loop_ms) {
+            advance_time(loop_ms);
+            pointing_device_task();
+        }
+    }
+
+    // Statistics since the start of the last run()
+    pointing_device_scheduler_stats_t delta(void) {
+        const pointing_device_scheduler_stats_t *stats = pointing_device_get_scheduler_stats();
+        return {stats->samples - start.samples, stats->reports - start.reports, stats->merged - start.merged, stats->dropped - start.dropped};
+    }
+
+    pointing_device_scheduler_stats_t start;
+};
+
+TEST_F(PointingDeviceScheduler, ReportsFollowTheHostInterval) {
+    sensor_motion.x = 1;
+    sensor_motion.y = -2;
+    run(100);
+
+    ASSERT_EQ(sent.size(), 25);
+    for (size_t i = 0; i < sent.size(); i++) {
+        EXPECT_EQ(sent[i].report.x, 4);
+        EXPECT_EQ(sent[i].report.y, -8);
+        if (i > 0) {
+            EXPECT_EQ(sent[i].time - sent[i - 1].time, 4);
+        }
+    }
+
+    auto stats = delta();
+    EXPECT_EQ(stats.samples, 100);
+    EXPECT_EQ(stats.reports, 25);
+    EXPECT_EQ(stats.merged, 75);
+    EXPECT_EQ(stats.dropped, 0);
+}
+
+TEST_F(PointingDeviceScheduler, SensorIsReadRightBeforeEachReport) {
+    sensor_motion.x = 3;
+    run(40);
+
+    ASSERT_EQ(sent.size(), 10);
+    for (auto &report : sent) {
+        EXPECT_TRUE(std::find(sensor_reads.begin(), sensor_reads.end(), report.time) != sensor_reads.end()) << "report at " << report.time;
+    }
+}
+
+TEST_F(PointingDeviceScheduler, SlowMainLoopIsNotMerged) {
+    // A main loop slower than the host sends every sample in its own report
+    sensor_motion.v = 1;
+    run(100, 10);
+
+    ASSERT_EQ(sent.size(), 10);
+    for (auto &report : sent) {
+        EXPECT_EQ(report.report.v, 1);
+    }
+    auto stats = delta();
+    EXPECT_EQ(stats.samples, 10);
+    EXPECT_EQ(stats.reports, 10);
+    EXPECT_EQ(stats.merged, 0);
+}
+
+TEST_F(PointingDeviceScheduler, OverflowingSamplesAreCounted) {
+    sensor_motion.x = 100;
+    sensor_motion.h = -50;
+    run(8);
+
+    ASSERT_EQ(sent.size(), 2);
+    EXPECT_EQ(sent[0].report.x, XY_REPORT_MAX);
+    EXPECT_EQ(sent[0].report.h, INT8_MIN);
+
+    // Only the first of the four samples in each report fit
+    auto stats = delta();
+    EXPECT_EQ(stats.samples, 8);
+    EXPECT_EQ(stats.merged, 6);
+    EXPECT_EQ(stats.dropped, 6);
+}
+
+TEST_F(PointingDeviceScheduler, ButtonsAreKept) {
+    sensor_motion.buttons = 1 << POINTING_DEVICE_BUTTON1;
+    run(4);
+    ASSERT_EQ(sent.size(), 1);
+    EXPECT_EQ(sent[0].report.buttons, 1 << POINTING_DEVICE_BUTTON1);
+
+    sensor_motion.buttons = 0;
+    sensor_motion.x       = 1;
+    run(4);
+    EXPECT_EQ(pointing_device_get_report().buttons, 1 << POINTING_DEVICE_BUTTON1);
+}
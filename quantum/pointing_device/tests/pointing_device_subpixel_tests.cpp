@@ -0,0 +1,172 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <cstring>
+#include <deque>
+#include <random>
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+/* Mock sensor, playing back a stream of reports */
+static std::deque<report_mouse_t> sensor_reports;
+
+static void mock_init(void) {}
+static report_mouse_t mock_get_report(report_mouse_t mouse_report) {
+    if (!sensor_reports.empty()) {
+        mouse_report = sensor_reports.front();
+        sensor_reports.pop_front();
+    }
+    return mouse_report;
+}
+static uint16_t mock_get_cpi(void) {
+    return 800;
+}
+static void mock_set_cpi(uint16_t cpi) {}
+
+extern "C" const pointing_device_driver_t pointing_device_driver = {
+    .init       = mock_init,
+    .get_report = mock_get_report,
+    .set_cpi    = mock_set_cpi,
+    .get_cpi    = mock_get_cpi,
+};
+
+/* Mock host, adding up all movement sent */
+static int32_t sent_x, sent_y, sent_h, sent_v;
+
+extern "C" void host_mouse_send(report_mouse_t *report) {
+    sent_x += report->x;
+    sent_y += report->y;
+    sent_h += report->h;
+    sent_v += report->v;
+}
+
+extern "C" bool has_mouse_report_changed(report_mouse_t *new_report, report_mouse_t *old_report) {
+    return memcmp(new_report, old_report, sizeof(report_mouse_t)) != 0;
+}
+
+/* Acceleration curve for the tests that need one: double speed from 10 counts per report */
+static bool accelerate;
+
+extern "C" uint32_t pointing_device_subpixel_gain_user(uint16_t speed) {
+    return accelerate && speed >= 10 ? 2 * SUBPIXEL_ONE : SUBPIXEL_ONE;
+}
+
+static report_mouse_t motion(int8_t x, int8_t y, int8_t h = 0, int8_t v = 0) {
+    report_mouse_t report = {};
+    report.x              = x;
+    report.y              = y;
+    report.h              = h;
+    report.v              = v;
+    return report;
+}
+
+class PointingDeviceSubpixel : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        sensor_reports.clear();
+        sent_x = sent_y = sent_h = sent_v = 0;
+        accelerate                        = false;
+        pointing_device_set_subpixel_scale(SUBPIXEL_ONE, SUBPIXEL_ONE);
+        pointing_device_init();
+    }
+
+    // Runs the pointing device task until the sensor stream has been played back, then a few more times
+    void run(int extra = 4) {
+        while (!sensor_reports.empty()) {
+            pointing_device_task();
+        }
+        for (int i = 0; i < extra; i++) {
+            pointing_device_task();
+        }
+    }
+};
+
+TEST_F(PointingDeviceSubpixel, UnityScalePassesThrough) {
+    for (int i = 0; i < 100; i++) {
+        sensor_reports.push_back(motion(i % 7 - 3, 5 - i % 11, i % 3 - 1, 1 - i % 3));
+    }
+    int32_t x = 0, y = 0, h = 0, v = 0;
+    for (auto &report : sensor_reports) {
+        x += report.x;
+        y += report.y;
+        h += report.h;
+        v += report.v;
+    }
+    run();
+    EXPECT_EQ(sent_x, x);
+    EXPECT_EQ(sent_y, y);
+    EXPECT_EQ(sent_h, h);
+    EXPECT_EQ(sent_v, v);
+}
+
+TEST_F(PointingDeviceSubpixel, SlowMovementIsNotQuantizedAway) {
+    // A quarter of a count per report would always truncate to zero
+    pointing_device_set_subpixel_scale(SUBPIXEL_ONE / 4, SUBPIXEL_ONE);
+    for (int i = 0; i < 1000; i++) {
+        sensor_reports.push_back(motion(1, -1));
+    }
+    run();
+    EXPECT_EQ(sent_x, 250);
+    EXPECT_EQ(sent_y, -250);
+}
+
+TEST_F(PointingDeviceSubpixel, DragScrollCarriesRemainder) {
+    pointing_device_set_subpixel_scale(SUBPIXEL_ONE, SUBPIXEL_ONE / 8);
+    for (int i = 0; i < 100; i++) {
+        sensor_reports.push_back(motion(0, 0, 3, -1));
+    }
+    run();
+    EXPECT_EQ(sent_h, 300 / 8);
+    EXPECT_EQ(sent_v, -100 / 8);
+}
+
+TEST_F(PointingDeviceSubpixel, OverflowIsCarriedToTheNextReport) {
+    // Doubled, a single fast report no longer fits in the 8-bit report
+    pointing_device_set_subpixel_scale(2 * SUBPIXEL_ONE, SUBPIXEL_ONE);
+    sensor_reports.push_back(motion(100, -100));
+    run();
+    EXPECT_EQ(sent_x, 200);
+    EXPECT_EQ(sent_y, -200);
+}
+
+TEST_F(PointingDeviceSubpixel, AccelerationCurveIsApplied) {
+    accelerate = true;
+    for (int i = 0; i < 10; i++) {
+        sensor_reports.push_back(motion(2, 0));
+    }
+    for (int i = 0; i < 10; i++) {
+        sensor_reports.push_back(motion(0, 20));
+    }
+    run();
+    EXPECT_EQ(sent_x, 20);
+    EXPECT_EQ(sent_y, 400);
+}
+
+TEST_F(PointingDeviceSubpixel, RandomStreamsMatchTotalDisplacement) {
+    std::mt19937 rng(1234);
+    // Exact Q16 displacement expected across all rounds, only the final fraction may be left in the remainder
+    int64_t x = 0, y = 0, h = 0, v = 0;
+    for (int round = 0; round < 50; round++) {
+        uint32_t xy_scale = SUBPIXEL_ONE / 8 + rng() % (2 * SUBPIXEL_ONE);
+        uint32_t hv_scale = SUBPIXEL_ONE / 16 + rng() % SUBPIXEL_ONE;
+        pointing_device_set_subpixel_scale(xy_scale, hv_scale);
+
+        for (int i = rng() % 500; i > 0; i--) {
+            report_mouse_t report = motion(rng() % 61 - 30, rng() % 61 - 30, rng() % 5 - 2, rng() % 5 - 2);
+            x += (int64_t)report.x * xy_scale;
+            y += (int64_t)report.y * xy_scale;
+            h += (int64_t)report.h * hv_scale;
+            v += (int64_t)report.v * hv_scale;
+            sensor_reports.push_back(report);
+        }
+        run();
+
+        EXPECT_LT(std::abs(sent_x * (int64_t)SUBPIXEL_ONE - x), SUBPIXEL_ONE) << "round " << round;
+        EXPECT_LT(std::abs(sent_y * (int64_t)SUBPIXEL_ONE - y), SUBPIXEL_ONE) << "round " << round;
+        EXPECT_LT(std::abs(sent_h * (int64_t)SUBPIXEL_ONE - h), SUBPIXEL_ONE) << "round " << round;
+        EXPECT_LT(std::abs(sent_v * (int64_t)SUBPIXEL_ONE - v), SUBPIXEL_ONE) << "round " << round;
+    }
+}
@@ -0,0 +1,16 @@
+pointing_device_subpixel_DEFS := -DMOUSE_ENABLE -DPOINTING_DEVICE_ENABLE -DPOINTING_DEVICE_SUBPIXEL_ENABLE -DNO_DEBUG -DNO_PRINT
+pointing_device_subpixel_INC := $(QUANTUM_PATH)/pointing_device
+
+pointing_device_subpixel_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/pointing_device/tests/pointing_device_subpixel_tests.cpp \
+	$(QUANTUM_PATH)/pointing_device/pointing_device.c \
+	$(QUANTUM_PATH)/pointing_device/pointing_device_subpixel.c
+
+pointing_device_scheduler_DEFS := -DMOUSE_ENABLE -DPOINTING_DEVICE_ENABLE -DPOINTING_DEVICE_REPORT_SCHEDULER -DPOINTING_DEVICE_REPORT_INTERVAL_MS=4 -DPOINTING_DEVICE_SAMPLE_INTERVAL_MS=1 -DNO_DEBUG -DNO_PRINT
+pointing_device_scheduler_INC := $(QUANTUM_PATH)/pointing_device
+
+pointing_device_scheduler_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/pointing_device/tests/pointing_device_scheduler_tests.cpp \
+	$(QUANTUM_PATH)/pointing_device/pointing_device.c
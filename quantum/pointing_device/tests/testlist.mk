@@ -0,0 +1 @@
+TEST_LIST += pointing_device_subpixel pointing_device_scheduler
@@ -0,0 +1,104 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "autocorrect_dictionary.h"
+#include "progmem.h"
+
+uint32_t autocorrect_trie_find(const uint8_t *data, uint32_t size, const uint8_t *buffer, uint8_t buffer_size) {
+    // Check for typo in buffer using a trie stored in `data`.
+    uint32_t state = 0;
+    uint8_t  code  = pgm_read_byte(data + state);
+    for (int16_t i = buffer_size - 1; i >= 0; --i) {
+        uint8_t const key_i = buffer[i];
+
+        if (code & 64) { // Check for match in node with multiple children.
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(data + (state += 3))) {
+                if (!code) return AUTOCORRECT_NO_MATCH;
+            }
+            // Follow link to child node.
+            state = (pgm_read_byte(data + state + 1) | pgm_read_byte(data + state + 2) << 8);
+            // Check for match in node with single child.
+        } else if (code != key_i) {
+            return AUTOCORRECT_NO_MATCH;
+        } else if (!(code = pgm_read_byte(data + (++state)))) {
+            ++state;
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= size) {
+            return AUTOCORRECT_NO_MATCH;
+        }
+
+        code = pgm_read_byte(data + state);
+
+        if (code & 128) { // A typo was found!
+            return state;
+        }
+    }
+    return AUTOCORRECT_NO_MATCH;
+}
+
+static uint32_t autocorrect_dawg_read_link(const autocorrect_dawg_t *dawg, uint32_t offset) {
+    uint32_t link = 0;
+    for (uint8_t i = 0; i < dawg->link_bytes; ++i) {
+        link |= (uint32_t)pgm_read_byte(dawg->data + offset + i) << (8 * i);
+    }
+    return link;
+}
+
+static uint32_t autocorrect_dawg_step(const autocorrect_dawg_t *dawg, uint32_t state, uint8_t keycode) {
+    uint8_t code = pgm_read_byte(dawg->data + state);
+    if (code & 128) { // Corrections have no children.
+        return AUTOCORRECT_NO_MATCH;
+    }
+    if (!(code & 64)) { // Chain links continue with the next byte.
+        return code == keycode ? state + 1 : AUTOCORRECT_NO_MATCH;
+    }
+
+    // Branches are sorted by keycode, so the search can stop early.
+    uint32_t edge = state + 1;
+    for (uint8_t count = code & 63; count > 0; --count, edge += 1 + dawg->link_bytes) {
+        uint8_t key = pgm_read_byte(dawg->data + edge);
+        if (key == keycode) {
+            return autocorrect_dawg_read_link(dawg, edge + 1);
+        }
+        if (key > keycode) {
+            break;
+        }
+    }
+    return AUTOCORRECT_NO_MATCH;
+}
+
+void autocorrect_dawg_reset(autocorrect_dawg_matcher_t *matcher) {
+    matcher->count = 0;
+}
+
+uint32_t autocorrect_dawg_advance(const autocorrect_dawg_t *dawg, autocorrect_dawg_matcher_t *matcher, uint8_t keycode) {
+    uint8_t kept = 0;
+
+    // Advance existing partial matches oldest first, then try starting a new one from the root.
+    for (uint8_t i = 0; i <= matcher->count; ++i) {
+        uint32_t next = autocorrect_dawg_step(dawg, i < matcher->count ? matcher->states[i] : 0, keycode);
+
+        // Stop following a match if `next` is an invalid index. This should not normally happen, it is a safeguard in
+        // case of a bug, data corruption, etc.
+        if (next >= dawg->size) {
+            continue;
+        }
+
+        if (pgm_read_byte(dawg->data + next) & 128) { // A typo was found!
+            matcher->count = 0;
+            return next;
+        }
+
+        // Typos are never longer than the capacity, so a full set of states only happens on corrupt data.
+        if (kept < matcher->capacity) {
+            matcher->states[kept++] = next;
+        }
+    }
+
+    matcher->count = kept;
+    return AUTOCORRECT_NO_MATCH;
+}
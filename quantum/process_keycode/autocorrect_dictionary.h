@@ -0,0 +1,70 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Returned by the dictionary lookups when no typo has been found.
+ */
+#define AUTOCORRECT_NO_MATCH UINT32_MAX
+
+/**
+ * Compressed autocorrect dictionary, as emitted by `qmk generate-autocorrect-data`: a directed acyclic word graph of
+ * the typos in typing order, with common endings shared. Each node is one of:
+ *
+ *   - a correction:   `128 | backspaces`, followed by the NUL-terminated replacement text
+ *   - a chain link:   a single keycode (< 64), whose only child immediately follows
+ *   - a branch:       `64 | count`, followed by `count` pairs of keycode and child offset (`link_bytes` bytes, little
+ *                     endian), sorted by keycode
+ *
+ * The root node is at offset 0.
+ */
+typedef struct autocorrect_dawg_t {
+    const uint8_t *data; // PROGMEM
+    uint32_t       size;
+    uint8_t        link_bytes;
+} autocorrect_dawg_t;
+
+/**
+ * Incremental matcher state for a DAWG dictionary -- the nodes reached by each partial typo match ending at the most
+ * recent keypress. At most one state is needed per character of the longest typo.
+ */
+typedef struct autocorrect_dawg_matcher_t {
+    uint32_t *states;
+    uint8_t   capacity;
+    uint8_t   count;
+} autocorrect_dawg_matcher_t;
+
+/**
+ * @brief Searches the legacy reversed trie for a typo ending at the end of the keycode buffer
+ *
+ * @param data PROGMEM trie data
+ * @param size size of the trie data, in bytes
+ * @param buffer keycodes typed, oldest first
+ * @param buffer_size number of keycodes in `buffer`
+ * @return offset of the matching correction node, or AUTOCORRECT_NO_MATCH
+ */
+uint32_t autocorrect_trie_find(const uint8_t *data, uint32_t size, const uint8_t *buffer, uint8_t buffer_size);
+
+/**
+ * @brief Forgets all partial matches
+ *
+ * @param matcher matcher state to reset
+ */
+void autocorrect_dawg_reset(autocorrect_dawg_matcher_t *matcher);
+
+/**
+ * @brief Advances all partial matches by a keycode, starting a new one at the root
+ *
+ * The work done is bounded by the length of the longest typo, regardless of the number of entries in the dictionary.
+ * The matcher is reset when a typo is found.
+ *
+ * @param dawg dictionary to match against
+ * @param matcher matcher state to advance
+ * @param keycode basic keycode typed
+ * @return offset of the matching correction node, or AUTOCORRECT_NO_MATCH
+ */
+uint32_t autocorrect_dawg_advance(const autocorrect_dawg_t *dawg, autocorrect_dawg_matcher_t *matcher, uint8_t keycode);
@@ -5,6 +5,7 @@
 // Original source: https://getreuer.info/posts/keyboards/autocorrection
 
 #include "process_autocorrect.h"
+#include "autocorrect_dictionary.h"
 #include <string.h>
 #include "keycodes.h"
 #include "quantum_keycodes.h"
@@ -22,6 +23,15 @@
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+#ifdef AUTOCORRECT_DAWG_LINK_BYTES
+static const autocorrect_dawg_t autocorrect_dawg = {.data = autocorrect_data, .size = DICTIONARY_SIZE, .link_bytes = AUTOCORRECT_DAWG_LINK_BYTES};
+
+static uint32_t                   autocorrect_dawg_states[AUTOCORRECT_MAX_LENGTH];
+static autocorrect_dawg_matcher_t autocorrect_matcher = {.states = autocorrect_dawg_states, .capacity = AUTOCORRECT_MAX_LENGTH, .count = 0};
+// Number of keycodes at the start of `typo_buffer` that the matcher has seen
+static uint8_t autocorrect_matcher_size = 0;
+#endif
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -265,7 +275,18 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             return true;
     }
 
-    // Rotate oldest character if buffer is full.
+#ifdef AUTOCORRECT_DAWG_LINK_BYTES
+    // The buffer may have been edited (backspace, reset, or user callback) since the matcher last saw it, so catch up.
+    if (autocorrect_matcher_size != typo_buffer_size) {
+        autocorrect_dawg_reset(&autocorrect_matcher);
+        for (uint8_t i = 0; i < typo_buffer_size; ++i) {
+            autocorrect_dawg_advance(&autocorrect_dawg, &autocorrect_matcher, typo_buffer[i]);
+        }
+    }
+#endif
+
+    // Rotate oldest character if buffer is full. Partial matches never span the
+    // whole buffer, so the matcher is unaffected.
     if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
         memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
         typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
@@ -273,103 +294,86 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
 
     // Append `keycode` to buffer.
     typo_buffer[typo_buffer_size++] = keycode;
+
+#ifdef AUTOCORRECT_DAWG_LINK_BYTES
+    // Feed the new keycode to the partial matches carried over from previous keypresses.
+    uint32_t state           = autocorrect_dawg_advance(&autocorrect_dawg, &autocorrect_matcher, keycode);
+    autocorrect_matcher_size = typo_buffer_size;
+#else
     // Return if buffer is smaller than the shortest word.
     if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
         return true;
     }
 
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
-
-        if (code & 64) { // Check for match in node with multiple children.
-            code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
-                if (!code) return true;
-            }
-            // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
-            // Check for match in node with single child.
-        } else if (code != key_i) {
-            return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
-            ++state;
-        }
+    uint32_t state = autocorrect_trie_find(autocorrect_data, DICTIONARY_SIZE, typo_buffer, typo_buffer_size);
+#endif
 
-        // Stop if `state` becomes an invalid index. This should not normally
-        // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
-            return true;
-        }
+    if (state == AUTOCORRECT_NO_MATCH) {
+        return true;
+    }
 
-        code = pgm_read_byte(autocorrect_data + state);
-
-        if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
+    // A typo was found! Apply autocorrect.
+    const uint8_t backspaces = (pgm_read_byte(autocorrect_data + state) & 63) + !record->event.pressed;
+    const char *  changes    = (const char *)(autocorrect_data + state + 1);
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
+        }
 
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
+        ++typo_len;
+    }
 
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
 
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
 
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
         }
+        send_string_P(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
     }
-    return true;
 }
@@ -21,22 +21,37 @@
 #ifdef AUDIO_ENABLE
 #    include "audio.h"
 
-#    ifndef AG_NORM_SONG
-#        define AG_NORM_SONG SONG(AG_NORM_SOUND)
+// the default songs are played from their song stream, songs set in config.h keep the SONG() format
+#    if !defined(AG_NORM_SONG) || !defined(CG_NORM_SONG)
+static const uint8_t norm_song_stream[] PROGMEM = SONG_STREAM(AG_NORM_SOUND);
 #    endif
-#    ifndef AG_SWAP_SONG
-#        define AG_SWAP_SONG SONG(AG_SWAP_SOUND)
-#    endif
-#    ifndef CG_NORM_SONG
-#        define CG_NORM_SONG SONG(AG_NORM_SOUND)
-#    endif
-#    ifndef CG_SWAP_SONG
-#        define CG_SWAP_SONG SONG(AG_SWAP_SOUND)
+#    if !defined(AG_SWAP_SONG) || !defined(CG_SWAP_SONG)
+static const uint8_t swap_song_stream[] PROGMEM = SONG_STREAM(AG_SWAP_SOUND);
 #    endif
+#    ifdef AG_NORM_SONG
 float ag_norm_song[][2] = AG_NORM_SONG;
+#        define PLAY_AG_NORM_SONG() PLAY_SONG(ag_norm_song)
+#    else
+#        define PLAY_AG_NORM_SONG() PLAY_SONG_STREAM(norm_song_stream)
+#    endif
+#    ifdef AG_SWAP_SONG
 float ag_swap_song[][2] = AG_SWAP_SONG;
+#        define PLAY_AG_SWAP_SONG() PLAY_SONG(ag_swap_song)
+#    else
+#        define PLAY_AG_SWAP_SONG() PLAY_SONG_STREAM(swap_song_stream)
+#    endif
+#    ifdef CG_NORM_SONG
 float cg_norm_song[][2] = CG_NORM_SONG;
+#        define PLAY_CG_NORM_SONG() PLAY_SONG(cg_norm_song)
+#    else
+#        define PLAY_CG_NORM_SONG() PLAY_SONG_STREAM(norm_song_stream)
+#    endif
+#    ifdef CG_SWAP_SONG
 float cg_swap_song[][2] = CG_SWAP_SONG;
+#        define PLAY_CG_SWAP_SONG() PLAY_SONG(cg_swap_song)
+#    else
+#        define PLAY_CG_SWAP_SONG() PLAY_SONG_STREAM(swap_song_stream)
+#    endif
 #endif
 
 /**
@@ -86,13 +101,13 @@ bool process_magic(uint16_t keycode, keyrecord_t *record) {
                 case QK_MAGIC_SWAP_ALT_GUI:
                     keymap_config.swap_lalt_lgui = keymap_config.swap_ralt_rgui = true;
 #ifdef AUDIO_ENABLE
-                    PLAY_SONG(ag_swap_song);
+                    PLAY_AG_SWAP_SONG();
 #endif
                     break;
                 case QK_MAGIC_SWAP_CTL_GUI:
                     keymap_config.swap_lctl_lgui = keymap_config.swap_rctl_rgui = true;
 #ifdef AUDIO_ENABLE
-                    PLAY_SONG(cg_swap_song);
+                    PLAY_CG_SWAP_SONG();
 #endif
                     break;
                 case QK_MAGIC_UNSWAP_CONTROL_CAPS_LOCK:
@@ -132,13 +147,13 @@ bool process_magic(uint16_t keycode, keyrecord_t *record) {
                 case QK_MAGIC_UNSWAP_ALT_GUI:
                     keymap_config.swap_lalt_lgui = keymap_config.swap_ralt_rgui = false;
 #ifdef AUDIO_ENABLE
-                    PLAY_SONG(ag_norm_song);
+                    PLAY_AG_NORM_SONG();
 #endif
                     break;
                 case QK_MAGIC_UNSWAP_CTL_GUI:
                     keymap_config.swap_lctl_lgui = keymap_config.swap_rctl_rgui = false;
 #ifdef AUDIO_ENABLE
-                    PLAY_SONG(cg_norm_song);
+                    PLAY_CG_NORM_SONG();
 #endif
                     break;
                 case QK_MAGIC_TOGGLE_ALT_GUI:
@@ -146,9 +161,9 @@ bool process_magic(uint16_t keycode, keyrecord_t *record) {
                     keymap_config.swap_ralt_rgui = keymap_config.swap_lalt_lgui;
 #ifdef AUDIO_ENABLE
                     if (keymap_config.swap_ralt_rgui) {
-                        PLAY_SONG(ag_swap_song);
+                        PLAY_AG_SWAP_SONG();
                     } else {
-                        PLAY_SONG(ag_norm_song);
+                        PLAY_AG_NORM_SONG();
                     }
 #endif
                     break;
@@ -157,9 +172,9 @@ bool process_magic(uint16_t keycode, keyrecord_t *record) {
                     keymap_config.swap_rctl_rgui = keymap_config.swap_lctl_lgui;
 #ifdef AUDIO_ENABLE
                     if (keymap_config.swap_rctl_rgui) {
-                        PLAY_SONG(cg_swap_song);
+                        PLAY_CG_SWAP_SONG();
                     } else {
-                        PLAY_SONG(cg_norm_song);
+                        PLAY_CG_NORM_SONG();
                     }
 #endif
                     break;
@@ -17,6 +17,8 @@
 #include "quantum_keycodes.h"
 #include "eeconfig.h"
 #include "keymap_steno.h"
+#include "timer.h"
+#include "util.h"
 #include <string.h>
 #ifdef VIRTSER_ENABLE
 #    include "virtser.h"
@@ -35,6 +37,22 @@ static uint8_t chord[MAX_STROKE_SIZE] = {0};
 // At the end of this scenario given as an example, `chord` would have five bits set to 1 but
 // `n_pressed_keys` would be set to 2 because there are only two keys currently being pressed down.
 static int8_t n_pressed_keys = 0;
+// Whether the chord has already been sent, by a first-up release or a repeat, since its last key was pressed.
+static bool chord_sent = false;
+
+#ifdef STENO_REPEAT
+#    ifndef STENO_REPEAT_DELAY
+#        define STENO_REPEAT_DELAY 500
+#    endif
+#    ifndef STENO_REPEAT_INTERVAL
+#        define STENO_REPEAT_INTERVAL 100
+#    endif
+// Time of the last steno key event, or of the last repeat.
+static uint16_t repeat_timer = 0;
+// Whether the chord is held: the last steno key event was a press.
+static bool repeat_armed = false;
+static bool repeating    = false;
+#endif
 
 #ifdef STENO_ENABLE_ALL
 static steno_mode_t mode;
@@ -52,11 +70,11 @@ static inline void steno_clear_chord(void) {
 
 #    ifdef VIRTSER_ENABLE
 void send_steno_chord_gemini(void) {
-    // Set MSB to 1 to indicate the start of packet
+    // The chord already is the packet, bit for bit, apart from its MSB
+    // which is set to 1 to indicate the start of packet
     chord[0] |= 0x80;
-    for (uint8_t i = 0; i < GEMINI_STROKE_SIZE; ++i) {
-        virtser_send(chord[i]);
-    }
+    virtser_send_buffer(chord, GEMINI_STROKE_SIZE);
+    chord[0] &= ~0x80;
 }
 #    else
 #        pragma message "VIRTSER_ENABLE = yes is required for Gemini PR to work properly out of the box!"
@@ -94,18 +112,21 @@ static const uint8_t boltmap[64] PROGMEM = {TXB_NUL, TXB_NUM, TXB_NUM, TXB_NUM,
 
 #    ifdef VIRTSER_ENABLE
 static void send_steno_chord_bolt(void) {
+    uint8_t packet[BOLT_STROKE_SIZE + 1];
+    uint8_t size = 0;
     for (uint8_t i = 0; i < BOLT_STROKE_SIZE; ++i) {
         // TX Bolt uses variable length packets where each byte corresponds to a bit array of certain keys.
         // If a user chorded the keys of the first group with keys of the last group, for example, there
         // would be bytes of 0x00 in `chord` for the middle groups which we mustn't send.
         if (chord[i]) {
-            virtser_send(chord[i]);
+            packet[size++] = chord[i];
         }
     }
     // Sending a null packet is not always necessary, but it is simpler and more reliable
     // to unconditionally send it every time instead of keeping track of more states and
     // creating more branches in the execution of the program.
-    virtser_send(0);
+    packet[size++] = 0;
+    virtser_send_buffer(packet, size);
 }
 #    else
 #        pragma message "VIRTSER_ENABLE = yes is required for TX Bolt to work properly out of the box!"
@@ -121,6 +142,31 @@ static bool add_bolt_key_to_chord(uint8_t key) {
 }
 #endif // STENO_ENABLE_BOLT
 
+/* The protocol of each mode: how a key goes into the chord as it is pressed, which makes
+ * the chord the packet to send apart from the framing, and how the chord is then sent.
+ */
+typedef struct {
+    bool (*add_key_to_chord)(uint8_t key);
+    void (*send_chord)(void);
+} steno_protocol_t;
+
+static const steno_protocol_t steno_protocols[] = {
+#ifdef STENO_ENABLE_GEMINI
+    [STENO_MODE_GEMINI] = {add_gemini_key_to_chord,
+#    ifdef VIRTSER_ENABLE
+                           send_steno_chord_gemini
+#    endif
+    },
+#endif // STENO_ENABLE_GEMINI
+#ifdef STENO_ENABLE_BOLT
+    [STENO_MODE_BOLT] = {add_bolt_key_to_chord,
+#    ifdef VIRTSER_ENABLE
+                         send_steno_chord_bolt
+#    endif
+    },
+#endif // STENO_ENABLE_BOLT
+};
+
 #ifdef STENO_COMBINEDMAP
 /* Used to look up when pressing the middle row key to combine two consonant or vowel keys */
 static const uint16_t combinedmap_first[] PROGMEM  = {STN_S1, STN_TL, STN_PL, STN_HL, STN_FR, STN_PR, STN_LR, STN_TR, STN_DR, STN_A, STN_E};
@@ -157,6 +203,28 @@ __attribute__((weak)) bool process_steno_user(uint16_t keycode, keyrecord_t *rec
     return true;
 }
 
+static void send_steno_chord(void) {
+    chord_sent = true;
+    if (!send_steno_chord_user(mode, chord)) {
+        return;
+    }
+    if (mode < ARRAY_SIZE(steno_protocols) && steno_protocols[mode].send_chord) {
+        steno_protocols[mode].send_chord();
+    }
+}
+
+void steno_task(void) {
+#ifdef STENO_REPEAT
+    if (!repeat_armed || timer_elapsed(repeat_timer) < (repeating ? STENO_REPEAT_INTERVAL : STENO_REPEAT_DELAY)) {
+        return;
+    }
+    // The chord was held long enough to be sent again, and again, until one of its keys is released
+    repeating    = true;
+    repeat_timer = timer_read();
+    send_steno_chord();
+#endif // STENO_REPEAT
+}
+
 bool process_steno(uint16_t keycode, keyrecord_t *record) {
     if (keycode < QK_STENO || keycode > QK_STENO_MAX) {
         return true; // Not a steno key, pass it further along the chain
@@ -194,22 +262,18 @@ bool process_steno(uint16_t keycode, keyrecord_t *record) {
         }
 #endif // STENO_COMBINEDMAP
         case STN__MIN ... STN__MAX:
+#ifdef STENO_REPEAT
+            repeat_armed = record->event.pressed;
+            repeating    = false;
+            repeat_timer = timer_read();
+#endif // STENO_REPEAT
             if (record->event.pressed) {
                 n_pressed_keys++;
-                switch (mode) {
-#ifdef STENO_ENABLE_BOLT
-                    case STENO_MODE_BOLT:
-                        add_bolt_key_to_chord(keycode - QK_STENO);
-                        break;
-#endif // STENO_ENABLE_BOLT
-#ifdef STENO_ENABLE_GEMINI
-                    case STENO_MODE_GEMINI:
-                        add_gemini_key_to_chord(keycode - QK_STENO);
-                        break;
-#endif // STENO_ENABLE_GEMINI
-                    default:
-                        return false;
+                chord_sent = false;
+                if (mode >= ARRAY_SIZE(steno_protocols) || !steno_protocols[mode].add_key_to_chord) {
+                    return false;
                 }
+                steno_protocols[mode].add_key_to_chord(keycode - QK_STENO);
                 if (!post_process_steno_user(keycode, record, mode, chord, n_pressed_keys)) {
                     return false;
                 }
@@ -218,29 +282,20 @@ bool process_steno(uint16_t keycode, keyrecord_t *record) {
                 if (!post_process_steno_user(keycode, record, mode, chord, n_pressed_keys)) {
                     return false;
                 }
+#ifndef STENO_FIRST_UP
                 if (n_pressed_keys > 0) {
                     // User hasn't released all keys yet,
                     // so the chord cannot be sent
                     return false;
                 }
-                n_pressed_keys = 0;
-                if (!send_steno_chord_user(mode, chord)) {
-                    steno_clear_chord();
-                    return false;
+#endif // STENO_FIRST_UP
+                // With STENO_FIRST_UP, the chord is sent as soon as one of its keys is released,
+                // and the keys still held only count towards the next chord if pressed again
+                if (n_pressed_keys < 0) {
+                    n_pressed_keys = 0;
                 }
-                switch (mode) {
-#if defined(STENO_ENABLE_BOLT) && defined(VIRTSER_ENABLE)
-                    case STENO_MODE_BOLT:
-                        send_steno_chord_bolt();
-                        break;
-#endif // STENO_ENABLE_BOLT && VIRTSER_ENABLE
-#if defined(STENO_ENABLE_GEMINI) && defined(VIRTSER_ENABLE)
-                    case STENO_MODE_GEMINI:
-                        send_steno_chord_gemini();
-                        break;
-#endif // STENO_ENABLE_GEMINI && VIRTSER_ENABLE
-                    default:
-                        break;
+                if (!chord_sent) {
+                    send_steno_chord();
                 }
                 steno_clear_chord();
             }
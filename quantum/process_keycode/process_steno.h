@@ -35,6 +35,7 @@ typedef enum {
 } steno_mode_t;
 
 bool process_steno(uint16_t keycode, keyrecord_t *record);
+void steno_task(void);
 #ifdef STENO_ENABLE_ALL
 void steno_init(void);
 void steno_set_mode(steno_mode_t mode);
@@ -0,0 +1,171 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (70 entries):
+//   :guage     -> gauge
+//   :the:the:  -> the
+//   :thier     -> their
+//   :ture      -> true
+//   accomodate -> accommodate
+//   acommodate -> accommodate
+//   aparent    -> apparent
+//   aparrent   -> apparent
+//   apparant   -> apparent
+//   apparrent  -> apparent
+//   aquire     -> acquire
+//   becuase    -> because
+//   cauhgt     -> caught
+//   cheif      -> chief
+//   choosen    -> chosen
+//   cieling    -> ceiling
+//   collegue   -> colleague
+//   concensus  -> consensus
+//   contians   -> contains
+//   cosnt      -> const
+//   dervied    -> derived
+//   fales      -> false
+//   fasle      -> false
+//   fitler     -> filter
+//   flase      -> false
+//   foward     -> forward
+//   frequecy   -> frequency
+//   gaurantee  -> guarantee
+//   guaratee   -> guarantee
+//   heigth     -> height
+//   heirarchy  -> hierarchy
+//   inclued    -> include
+//   interator  -> iterator
+//   intput     -> input
+//   invliad    -> invalid
+//   lenght     -> length
+//   liasion    -> liaison
+//   libary     -> library
+//   listner    -> listener
+//   looses:    -> loses
+//   looup      -> lookup
+//   manefist   -> manifest
+//   namesapce  -> namespace
+//   namespcae  -> namespace
+//   occassion  -> occasion
+//   occured    -> occurred
+//   ouptut     -> output
+//   ouput      -> output
+//   overide    -> override
+//   postion    -> position
+//   priviledge -> privilege
+//   psuedo     -> pseudo
+//   recieve    -> receive
+//   refered    -> referred
+//   relevent   -> relevant
+//   repitition -> repetition
+//   retrun     -> return
+//   retun      -> return
+//   reuslt     -> result
+//   reutrn     -> return
+//   saftey     -> safety
+//   seperate   -> separate
+//   singed     -> signed
+//   stirng     -> string
+//   strign     -> string
+//   swithc     -> switch
+//   swtich     -> switch
+//   thresold   -> threshold
+//   udpate     -> update
+//   widht      -> width
+
+#define AUTOCORRECT_MIN_LENGTH 5 // ":ture"
+#define AUTOCORRECT_MAX_LENGTH 10 // "accomodate"
+#define AUTOCORRECT_DAWG_LINK_BYTES 2
+#define DICTIONARY_SIZE 1033
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x53, 0x04, 0x3A, 0x00, 0x05, 0xB4, 0x00, 0x06, 0xC0, 0x00, 0x07, 0x34, 0x01, 0x09, 0x40, 0x01,
+    0x0A, 0x8D, 0x01, 0x0B, 0xB1, 0x01, 0x0C, 0xCF, 0x01, 0x0F, 0x08, 0x02, 0x10, 0x57, 0x02, 0x11,
+    0x65, 0x02, 0x12, 0x81, 0x02, 0x13, 0xC7, 0x02, 0x15, 0xF3, 0x02, 0x16, 0x59, 0x03, 0x17, 0xB7,
+    0x03, 0x18, 0xC4, 0x03, 0x1A, 0xD0, 0x03, 0x2C, 0xD5, 0x03, 0x43, 0x06, 0x44, 0x00, 0x13, 0x6C,
+    0x00, 0x14, 0xA8, 0x00, 0x42, 0x06, 0x4B, 0x00, 0x12, 0x5A, 0x00, 0x12, 0x10, 0x12, 0x07, 0x04,
+    0x17, 0x08, 0x84, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x10, 0x10, 0x12, 0x07, 0x04, 0x17,
+    0x08, 0x87, 0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x42, 0x04, 0x73, 0x00,
+    0x13, 0x90, 0x00, 0x15, 0x42, 0x08, 0x7B, 0x00, 0x15, 0x85, 0x00, 0x11, 0x17, 0x84, 0x70, 0x61,
+    0x72, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x11, 0x17, 0x85, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00,
+    0x04, 0x15, 0x42, 0x04, 0x99, 0x00, 0x15, 0xA0, 0x00, 0x11, 0x17, 0x82, 0x65, 0x6E, 0x74, 0x00,
+    0x08, 0x11, 0x17, 0x83, 0x65, 0x6E, 0x74, 0x00, 0x18, 0x0C, 0x15, 0x08, 0x84, 0x63, 0x71, 0x75,
+    0x69, 0x72, 0x65, 0x00, 0x08, 0x06, 0x18, 0x04, 0x16, 0x08, 0x83, 0x61, 0x75, 0x73, 0x65, 0x00,
+    0x44, 0x04, 0xCD, 0x00, 0x0B, 0xD6, 0x00, 0x0C, 0xED, 0x00, 0x12, 0xFA, 0x00, 0x18, 0x0B, 0x0A,
+    0x17, 0x82, 0x67, 0x68, 0x74, 0x00, 0x42, 0x08, 0xDD, 0x00, 0x12, 0xE4, 0x00, 0x0C, 0x09, 0x82,
+    0x69, 0x65, 0x66, 0x00, 0x12, 0x16, 0x08, 0x11, 0x83, 0x73, 0x65, 0x6E, 0x00, 0x08, 0x0F, 0x0C,
+    0x11, 0x0A, 0x85, 0x65, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x00, 0x43, 0x0F, 0x04, 0x01, 0x11, 0x0F,
+    0x01, 0x16, 0x2D, 0x01, 0x0F, 0x08, 0x0A, 0x18, 0x08, 0x82, 0x61, 0x67, 0x75, 0x65, 0x00, 0x42,
+    0x06, 0x16, 0x01, 0x17, 0x23, 0x01, 0x08, 0x11, 0x16, 0x18, 0x16, 0x85, 0x73, 0x65, 0x6E, 0x73,
+    0x75, 0x73, 0x00, 0x0C, 0x04, 0x11, 0x16, 0x83, 0x61, 0x69, 0x6E, 0x73, 0x00, 0x11, 0x17, 0x82,
+    0x6E, 0x73, 0x74, 0x00, 0x08, 0x15, 0x19, 0x0C, 0x08, 0x07, 0x83, 0x69, 0x76, 0x65, 0x64, 0x00,
+    0x45, 0x04, 0x50, 0x01, 0x0C, 0x64, 0x01, 0x0F, 0x6E, 0x01, 0x12, 0x77, 0x01, 0x15, 0x82, 0x01,
+    0x42, 0x0F, 0x57, 0x01, 0x16, 0x5D, 0x01, 0x08, 0x16, 0x81, 0x73, 0x65, 0x00, 0x0F, 0x08, 0x82,
+    0x6C, 0x73, 0x65, 0x00, 0x17, 0x0F, 0x08, 0x15, 0x83, 0x6C, 0x74, 0x65, 0x72, 0x00, 0x04, 0x16,
+    0x08, 0x83, 0x61, 0x6C, 0x73, 0x65, 0x00, 0x1A, 0x04, 0x15, 0x07, 0x83, 0x72, 0x77, 0x61, 0x72,
+    0x64, 0x00, 0x08, 0x14, 0x18, 0x08, 0x06, 0x1C, 0x81, 0x6E, 0x63, 0x79, 0x00, 0x42, 0x04, 0x94,
+    0x01, 0x18, 0xA5, 0x01, 0x18, 0x15, 0x04, 0x11, 0x17, 0x08, 0x08, 0x87, 0x75, 0x61, 0x72, 0x61,
+    0x6E, 0x74, 0x65, 0x65, 0x00, 0x04, 0x15, 0x04, 0x17, 0x08, 0x08, 0x82, 0x6E, 0x74, 0x65, 0x65,
+    0x00, 0x08, 0x0C, 0x42, 0x0A, 0xBA, 0x01, 0x15, 0xC0, 0x01, 0x17, 0x0B, 0x81, 0x68, 0x74, 0x00,
+    0x04, 0x15, 0x06, 0x0B, 0x1C, 0x87, 0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x11,
+    0x43, 0x06, 0xDA, 0x01, 0x17, 0xE2, 0x01, 0x19, 0xFE, 0x01, 0x0F, 0x18, 0x08, 0x07, 0x81, 0x64,
+    0x65, 0x00, 0x42, 0x08, 0xE9, 0x01, 0x13, 0xF7, 0x01, 0x15, 0x04, 0x17, 0x12, 0x15, 0x87, 0x74,
+    0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x18, 0x17, 0x83, 0x70, 0x75, 0x74, 0x00, 0x0F, 0x0C,
+    0x04, 0x07, 0x83, 0x61, 0x6C, 0x69, 0x64, 0x00, 0x43, 0x08, 0x12, 0x02, 0x0C, 0x1A, 0x02, 0x12,
+    0x41, 0x02, 0x11, 0x0A, 0x0B, 0x17, 0x81, 0x74, 0x68, 0x00, 0x43, 0x04, 0x24, 0x02, 0x05, 0x2E,
+    0x02, 0x16, 0x37, 0x02, 0x16, 0x0C, 0x12, 0x11, 0x83, 0x69, 0x73, 0x6F, 0x6E, 0x00, 0x04, 0x15,
+    0x1C, 0x82, 0x72, 0x61, 0x72, 0x79, 0x00, 0x17, 0x11, 0x08, 0x15, 0x82, 0x65, 0x6E, 0x65, 0x72,
+    0x00, 0x12, 0x42, 0x16, 0x49, 0x02, 0x18, 0x51, 0x02, 0x08, 0x16, 0x2C, 0x84, 0x73, 0x65, 0x73,
+    0x00, 0x13, 0x81, 0x6B, 0x75, 0x70, 0x00, 0x04, 0x11, 0x08, 0x09, 0x0C, 0x16, 0x17, 0x84, 0x69,
+    0x66, 0x65, 0x73, 0x74, 0x00, 0x04, 0x10, 0x08, 0x16, 0x42, 0x04, 0x70, 0x02, 0x13, 0x79, 0x02,
+    0x13, 0x06, 0x08, 0x83, 0x70, 0x61, 0x63, 0x65, 0x00, 0x06, 0x04, 0x08, 0x82, 0x61, 0x63, 0x65,
+    0x00, 0x43, 0x06, 0x8B, 0x02, 0x18, 0xA5, 0x02, 0x19, 0xBC, 0x02, 0x06, 0x42, 0x04, 0x93, 0x02,
+    0x18, 0x9D, 0x02, 0x16, 0x16, 0x0C, 0x12, 0x11, 0x83, 0x69, 0x6F, 0x6E, 0x00, 0x15, 0x08, 0x07,
+    0x81, 0x72, 0x65, 0x64, 0x00, 0x13, 0x42, 0x17, 0xAD, 0x02, 0x18, 0xB5, 0x02, 0x18, 0x17, 0x83,
+    0x74, 0x70, 0x75, 0x74, 0x00, 0x17, 0x82, 0x74, 0x70, 0x75, 0x74, 0x00, 0x08, 0x15, 0x0C, 0x07,
+    0x08, 0x82, 0x72, 0x69, 0x64, 0x65, 0x00, 0x43, 0x12, 0xD1, 0x02, 0x15, 0xDD, 0x02, 0x16, 0xE9,
+    0x02, 0x16, 0x17, 0x0C, 0x12, 0x11, 0x83, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x19, 0x0C,
+    0x0F, 0x08, 0x07, 0x0A, 0x08, 0x82, 0x67, 0x65, 0x00, 0x18, 0x08, 0x07, 0x12, 0x83, 0x65, 0x75,
+    0x64, 0x6F, 0x00, 0x08, 0x46, 0x06, 0x07, 0x03, 0x09, 0x11, 0x03, 0x0F, 0x15, 0x03, 0x13, 0x1F,
+    0x03, 0x17, 0x2F, 0x03, 0x18, 0x42, 0x03, 0x0C, 0x08, 0x19, 0x08, 0x83, 0x65, 0x69, 0x76, 0x65,
+    0x00, 0x41, 0x08, 0x9D, 0x02, 0x08, 0x19, 0x08, 0x11, 0x17, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x0C,
+    0x17, 0x0C, 0x17, 0x0C, 0x12, 0x11, 0x86, 0x65, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42,
+    0x15, 0x36, 0x03, 0x18, 0x3D, 0x03, 0x18, 0x11, 0x82, 0x75, 0x72, 0x6E, 0x00, 0x11, 0x80, 0x72,
+    0x6E, 0x00, 0x42, 0x16, 0x49, 0x03, 0x17, 0x51, 0x03, 0x0F, 0x17, 0x83, 0x73, 0x75, 0x6C, 0x74,
+    0x00, 0x15, 0x11, 0x83, 0x74, 0x75, 0x72, 0x6E, 0x00, 0x45, 0x04, 0x69, 0x03, 0x08, 0x72, 0x03,
+    0x0C, 0x7F, 0x03, 0x17, 0x89, 0x03, 0x1A, 0xA0, 0x03, 0x09, 0x17, 0x08, 0x1C, 0x82, 0x65, 0x74,
+    0x79, 0x00, 0x13, 0x08, 0x15, 0x04, 0x17, 0x08, 0x84, 0x61, 0x72, 0x61, 0x74, 0x65, 0x00, 0x11,
+    0x0A, 0x08, 0x07, 0x83, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x42, 0x0C, 0x90, 0x03, 0x15, 0x99, 0x03,
+    0x15, 0x11, 0x0A, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x0A, 0x11, 0x81, 0x6E, 0x67, 0x00,
+    0x42, 0x0C, 0xA7, 0x03, 0x17, 0xAE, 0x03, 0x17, 0x0B, 0x06, 0x81, 0x63, 0x68, 0x00, 0x0C, 0x06,
+    0x0B, 0x83, 0x69, 0x74, 0x63, 0x68, 0x00, 0x0B, 0x15, 0x08, 0x16, 0x12, 0x0F, 0x07, 0x82, 0x68,
+    0x6F, 0x6C, 0x64, 0x00, 0x07, 0x13, 0x04, 0x17, 0x08, 0x84, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00,
+    0x0C, 0x41, 0x07, 0x14, 0x02, 0x42, 0x0A, 0xDC, 0x03, 0x17, 0xE6, 0x03, 0x18, 0x04, 0x0A, 0x08,
+    0x83, 0x61, 0x75, 0x67, 0x65, 0x00, 0x42, 0x0B, 0xED, 0x03, 0x18, 0x02, 0x04, 0x42, 0x08, 0xF4,
+    0x03, 0x0C, 0xFB, 0x03, 0x2C, 0x17, 0x0B, 0x08, 0x2C, 0x84, 0x00, 0x08, 0x15, 0x82, 0x65, 0x69,
+    0x72, 0x00, 0x15, 0x08, 0x82, 0x72, 0x75, 0x65, 0x00
+};
@@ -0,0 +1,857 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (400 entries):
+//   baabel          -> baable
+//   babaiiton:      -> babaition
+//   bachoowing      -> bachowoing
+//   badaely:        -> badealy
+//   bafabuoment     -> bafaboument
+//   bgaeaous:       -> bageaous
+//   baogument       -> bagoument
+//   bgarolument     -> bagrolument
+//   bahevetaion     -> baheveation
+//   abipleness      -> baipleness
+//   baisdeoing      -> baisedoing
+//   :baisoign       -> baisoing
+//   baithavuoness   -> baithavouness
+//   baiwaitoeur     -> baiwaitouer
+//   baeltion        -> baletion
+//   :bapeid         -> bapied
+//   bashaeed        -> basheaed
+//   :bastbueer      -> bastubeer
+//   barteaplaing    -> batreaplaing
+//   ebachoed        -> beachoed
+//   beagroduaer     -> beagroudaer
+//   beayl           -> bealy
+//   baement         -> beament
+//   ebaness:        -> beaness
+//   beasoesaness    -> beasoseaness
+//   ebatheaing      -> beatheaing
+//   beaiton         -> beation
+//   beatitraiabel:  -> beatitraiable
+//   :beavounses     -> beavouness
+//   bedarieaed      -> bedaireaed
+//   :beftiion       -> befition
+//   beiged          -> begied
+//   bgeoed          -> begoed
+//   bieve           -> beive
+//   :bethaible      -> bethiable
+//   bevoudouus:     -> bevouduous
+//   biabifily       -> bibaifily
+//   ibgreness       -> bigreness
+//   binaethouing    -> bineathouing
+//   :ibsagrotion    -> bisagrotion
+//   :btiratrotion   -> bitratrotion
+//   :bivaiweaign    -> bivaiweaing
+//   :bwiupluive     -> biwupluive
+//   :boigcaing      -> bogicaing
+//   bohivie         -> bohiive
+//   bmoent:         -> boment
+//   bonses          -> boness
+//   bouos:          -> boous
+//   obpeed          -> bopeed
+//   bosanses:       -> bosaness
+//   bothuifment     -> bothufiment
+//   :botino         -> botion
+//   botreid         -> botried
+//   buoer           -> bouer
+//   bofueed         -> boufeed
+//   bougolaeable    -> bougoleaable
+//   obugotily       -> bougotily
+//   obuing          -> bouing
+//   boluoness       -> bouloness
+//   obuly           -> bouly
+//   boumagroutoin:  -> boumagroution
+//   :bouuos         -> bouous
+//   boupleanses     -> boupleaness
+//   bousatreuos     -> bousatreous
+//   bouseasotable   -> bouseastoable
+//   boushaitiher    -> boushaithier
+//   bousatiploued   -> boustaiploued
+//   obuteed         -> bouteed
+//   boutoumive      -> boutomuive
+//   bouwonuaer      -> bouwounaer
+//   :bfueive        -> bufeive
+//   bufide          -> bufied
+//   bugaiemtion     -> bugaimetion
+//   :buign          -> buing
+//   bumnet          -> bument
+//   bunenoalbe      -> bunenoable
+//   ubroutaied:     -> buroutaied
+//   bushuiton       -> bushution
+//   cacuoment       -> cacoument
+//   cagaiiev        -> cagaiive
+//   cagouiton       -> cagoution
+//   cagustuoness    -> cagustouness
+//   acibotion       -> caibotion
+//   :caeid          -> caied
+//   caeir:          -> caier
+//   cagiraition     -> caigraition
+//   cainig          -> caiing
+//   caiiev:         -> caiive
+//   canieshuable    -> caineshuable
+//   cainomuent      -> cainoument
+//   cairemnet       -> cairement
+//   casiaive        -> caisaive
+//   caitoin         -> caition
+//   caiiwly         -> caiwily
+//   acness          -> caness
+//   caeraable       -> careaable
+//   acrouly         -> carouly
+//   castioruive     -> castirouive
+//   cavavumetn      -> cavavument
+//   caeer           -> ceaer
+//   cemaent         -> ceament
+//   :caeneaive      -> ceaneaive
+//   ceauos:         -> ceaous
+//   ceaplbuious     -> ceaplubious
+//   caesapiable     -> ceasapiable
+//   caestipeous     -> ceastipeous
+//   :caetaraiment   -> ceataraiment
+//   ceatohness      -> ceathoness
+//   caetreable:     -> ceatreable
+//   cebuemnt        -> cebument
+//   ceaciness       -> cecainess
+//   cegorous        -> cegroous
+//   cegutino        -> cegution
+//   cneess          -> ceness
+//   :ceuos          -> ceous
+//   ctehachouous    -> cethachouous
+//   cehteed         -> cetheed
+//   ection          -> cetion
+//   cahbaiable      -> chabaiable
+//   hcacaiment      -> chacaiment
+//   caher           -> chaer
+//   chaibale        -> chaiable
+//   chiadoution     -> chaidoution
+//   hcaihoupaition  -> chaihoupaition
+//   :chainig        -> chaiing
+//   hcaily          -> chaily
+//   chaipeadiaer    -> chaipeadaier
+//   chapiohaer      -> chaipohaer
+//   chaihtoly       -> chaitholy
+//   chiathucution:  -> chaithucution
+//   chaitretaion    -> chaitreation
+//   chiave          -> chaive
+//   hcaly           -> chaly
+//   chamalonig:     -> chamaloing
+//   chametn:        -> chament
+//   hcatiment       -> chatiment
+//   chatoulpaous    -> chatouplaous
+//   cahtrouvoable   -> chatrouvoable
+//   cheahceatriness -> cheacheatriness
+//   chealainses     -> chealainess
+//   :cheamutino     -> cheamution
+//   chenaeament     -> cheaneament
+//   cheashiaive     -> cheashaiive
+//   cheashweeous    -> cheasheweous
+//   :cheavoubale    -> cheavouable
+//   chebonoign      -> chebonoing
+//   cheiev          -> cheive
+//   hcely           -> chely
+//   cehmaivaied     -> chemaivaied
+//   chmeent         -> chement
+//   cheplacheauos   -> cheplacheaous
+//   cehrihation     -> cherihation
+//   chevamnet       -> chevament
+//   chbiugeaing     -> chibugeaing
+//   chichoius       -> chichious
+//   chicougaaible   -> chicougaiable
+//   hcier           -> chier
+//   cihmuness:      -> chimuness
+//   chienly:        -> chinely
+//   :hcious         -> chious
+//   chithiaer:      -> chithaier
+//   cihtion         -> chition
+//   chiveafoualbe   -> chiveafouable
+//   chivoius:       -> chivious
+//   chode           -> choed
+//   choenness       -> choneness
+//   chostitribale   -> chostitriable
+//   :chtoeaous      -> choteaous
+//   :chtoion        -> chotion
+//   chuoed          -> choued
+//   chuogipoable    -> chougipoable
+//   :chuogition     -> chougition
+//   chonuimeable    -> chounimeable
+//   cohuous:        -> chouous
+//   chuopousuing    -> choupousuing
+//   chouiton        -> choution
+//   chouvatroure    -> chouvatrouer
+//   chouavvaly      -> chouvavaly
+//   chowasatiing    -> chowastaiing
+//   chuabel:        -> chuable
+//   chuchialbe      -> chuchiable
+//   cuhed           -> chued
+//   cheur           -> chuer
+//   :chunaifeanses  -> chunaifeaness
+//   chnuess         -> chuness
+//   chuintion       -> chunition
+//   chupimnet       -> chupiment
+//   cuhtheing       -> chutheing
+//   chuthiiev       -> chuthiive
+//   chtuion:        -> chution
+//   cbiuing         -> cibuing
+//   cinig           -> ciing
+//   cinses          -> ciness
+//   icous           -> cious
+//   ciplaoble       -> ciploable
+//   cistaithiament: -> cistaithaiment
+//   cithaiogive     -> cithaigoive
+//   :cwiition       -> ciwition
+//   cocahhument     -> cochahument
+//   cofore          -> cofoer
+//   coftoion        -> cofotion
+//   cogratsuing     -> cograstuing
+//   :comiwide       -> comiwied
+//   comolpoive      -> comoploive
+//   ocnaive         -> conaive
+//   couos           -> coous
+//   coplutering     -> coplutreing
+//   :cotsachument   -> costachument
+//   ctoion:         -> cotion
+//   cotrowaaible    -> cotrowaiable
+//   ocudaed         -> coudaed
+//   ocued           -> coued
+//   cougahteaous    -> cougatheaous
+//   ocuous:         -> couous
+//   copuliing:      -> coupliing
+//   ocution:        -> coution
+//   covouanous      -> covounaous
+//   cwoaied         -> cowaied
+//   ucbament        -> cubament
+//   :cuceoaus       -> cuceaous
+//   cucetsouness    -> cucestouness
+//   cucohnouer      -> cuchonouer
+//   cucuhly:        -> cuchuly
+//   cugoteir        -> cugotier
+//   :cunig          -> cuing
+//   cuvie           -> cuive
+//   cuelatoed:      -> culeatoed
+//   cuuos           -> cuous
+//   curauos         -> curaous
+//   custishnaess    -> custishaness
+//   cusotness       -> custoness
+//   :uctuguing      -> cutuguing
+//   daalbe          -> daable
+//   :dacaefier      -> daceafier
+//   :adcuhued       -> dacuhued
+//   daibale:        -> daiable
+//   :daeid          -> daied
+//   diament         -> daiment
+//   daianilaier     -> dainailaier
+//   dianess         -> dainess
+//   :danig          -> daing
+//   adistaiive      -> daistaiive
+//   daistaeer       -> daisteaer
+//   diave           -> daive
+//   daivigraetion:  -> daivigreation
+//   dastievaly      -> dastivealy
+//   dsatouhaable    -> dastouhaable
+//   dasuudment      -> dasudument
+//   dtaion          -> dation
+//   dartiweing      -> datriweing
+//   datupounig      -> datupouing
+//   edaable         -> deaable
+//   daeble          -> deable
+//   dedairiing      -> deadiriing
+//   daeer           -> deaer
+//   daegreable      -> deagreable
+//   deaign          -> deaing
+//   daeness         -> deaness
+//   deaappleaous    -> deapapleaous
+//   :dearoaginess   -> dearogainess
+//   deaatily        -> deataily
+//   deatino         -> deation
+//   deatrcioument   -> deatricoument
+//   deaweid         -> deawied
+//   dediafament     -> dedaifament
+//   dedegravie      -> dedegraive
+//   deudness        -> deduness
+//   :degriang       -> degraing
+//   degurness       -> degruness
+//   :delade         -> delaed
+//   delpeed         -> depleed
+//   :delpouer       -> deplouer
+//   :desheare       -> desheaer
+//   desheplaitoin   -> desheplaition
+//   edthuness       -> dethuness
+//   edveshaiment    -> deveshaiment
+//   dcioment        -> dicoment
+//   :dicocuaing     -> dicoucaing
+//   didodimnet:     -> didodiment
+//   :digeiton       -> digetion
+//   diemnt          -> diment
+//   diplgeeaous     -> diplegeaous
+//   dipliung        -> dipluing
+//   diaripouly      -> diraipouly
+//   disheaalbe      -> disheaable
+//   dihtagament:    -> dithagament
+//   dithibaiiev     -> dithibaiive
+//   dtihihouive     -> dithihouive
+//   dviagraly       -> divagraly
+//   diavious        -> divaious
+//   diwoumetn:      -> diwoument
+//   dohcemeer       -> dochemeer
+//   docuoive        -> docouive
+//   dofutruuos:     -> dofutruous
+//   dloogaier       -> dologaier
+//   :dopliatrier    -> doplaitrier
+//   :droealy        -> dorealy
+//   douboign:       -> douboing
+//   douuftheaable   -> doufutheaable
+//   doiung          -> douing
+//   doulatorable    -> doulatroable
+//   doumanses:      -> doumaness
+//   :dounaftuion    -> dounafution
+//   dounesonses:    -> dounesoness
+//   duonouness      -> dounouness
+//   duoous          -> douous
+//   doupiahious:    -> doupaihious
+//   duopluness      -> doupluness
+//   dopuoly         -> doupoly
+//   duopuing        -> doupuing
+//   odushoing       -> doushoing
+//   doutino         -> doution
+//   douvuoment      -> douvoument
+//   douowument      -> douwoument
+//   udable          -> duable
+//   dubeatrtiion:   -> dubeatrition
+//   ducastere       -> ducasteer
+//   dugivie         -> dugiive
+//   udhument        -> duhument
+//   dunig           -> duing
+//   duloapily:      -> dulopaily
+//   :dumnet         -> dument
+//   dnuess          -> duness
+//   udtion          -> dution
+//   :fhaely         -> fahely
+//   fainig          -> faiing
+//   :fialation      -> failation
+//   fiang           -> faing
+//   faiuos:         -> faious
+//   faishaigreatoin -> faishaigreation
+//   faishuoness     -> faishouness
+//   faiavition      -> faivaition
+//   afladainess:    -> faladainess
+//   falehsouness:   -> faleshouness
+//   fnaoous:        -> fanoous
+//   faroushetaion   -> farousheation
+//   feaabel         -> feaable
+//   faechaihaer     -> feachaihaer
+//   feachucuhing    -> feachuchuing
+//   efachued        -> feachued
+//   feagarigrued    -> feagraigrued
+//   fealifoure      -> fealifouer
+//   faement         -> feament
+//   :feoaus         -> feaous
+//   feapolument     -> feaploument
+//   fesaheness      -> feasheness
+//   feashure        -> feashuer
+//   feaatly         -> feataly
+//   fedimetn        -> fediment
+//   feditaide       -> feditaied
+//   fergeastaition  -> fegreastaition
+//   fehiacouive     -> fehaicouive
+//   efment          -> fement
+//   feomufaous:     -> femoufaous
+//   fpeoous         -> fepoous
+//   ferifaire       -> ferifaier
+//   efsheplouness   -> fesheplouness
+//   fetoin          -> fetion
+//   ftereer         -> fetreer
+//   eftrupouly      -> fetrupouly
+//   fevaiiton       -> fevaition
+//   ifburoive       -> fiburoive
+//   figrotahness    -> figrothaness
+//   finig           -> fiing
+//   fiseyl          -> fisely
+//   fisitable       -> fistiable
+//   :fistduoument   -> fistudoument
+//   fitheobument    -> fitheboument
+//   foafous:        -> fofaous
+//   foaftion        -> fofation
+//   fogritino       -> fogrition
+//   fogrure         -> fogruer
+//   fiove           -> foive
+//   :folmuoment     -> folumoment
+//   fmoeive         -> fomeive
+//   foemnt          -> foment
+//   :foploiuve      -> foplouive
+//   foshaalbe       -> foshaable
+//   foshtuouous     -> foshutouous
+//   ofthament       -> fothament
+//   foeur           -> fouer
+//   fourgument      -> fougrument
+//   :fuoing         -> fouing
+//   fouiev          -> fouive
+//   foluoed         -> fouloed
+//   foluy           -> fouly
+//   :ofumeaed       -> foumeaed
+//   fuoness         -> founess
+//   foupumetn:      -> foupument
+//   :fouerneed      -> foureneed
+//   foutsoudealy    -> foustoudealy
+//   ufchoment       -> fuchoment
+//   fuguoous        -> fugouous
+//   ufive:          -> fuive
+//   :fuemnt         -> fument
+//   fupulable       -> fupluable
+//   fusuoness       -> fusouness
+//   ufstibied       -> fustibied
+//   futeowment:     -> futewoment
+//   futhaiign       -> futhaiing
+
+#define AUTOCORRECT_MIN_LENGTH 5 // "beayl"
+#define AUTOCORRECT_MAX_LENGTH 15 // "cheahceatriness"
+#define AUTOCORRECT_DAWG_LINK_BYTES 3
+#define DICTIONARY_SIZE 6732
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x4B, 0x04, 0x2D, 0x00, 0x00, 0x05, 0xB3, 0x00, 0x00, 0x06, 0x51, 0x04, 0x00, 0x07, 0x10, 0x0C,
+    0x00, 0x08, 0x5A, 0x10, 0x00, 0x09, 0x4B, 0x11, 0x00, 0x0B, 0x78, 0x14, 0x00, 0x0C, 0xFE, 0x14,
+    0x00, 0x12, 0x39, 0x15, 0x00, 0x18, 0x14, 0x16, 0x00, 0x2C, 0xB5, 0x16, 0x00, 0x44, 0x05, 0x3E,
+    0x00, 0x00, 0x06, 0x52, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x09, 0x9C, 0x00, 0x00, 0x0C, 0x13,
+    0x0F, 0x08, 0x11, 0x08, 0x16, 0x16, 0x89, 0x62, 0x61, 0x69, 0x70, 0x6C, 0x65, 0x6E, 0x65, 0x73,
+    0x73, 0x00, 0x43, 0x0C, 0x5F, 0x00, 0x00, 0x11, 0x70, 0x00, 0x00, 0x15, 0x7B, 0x00, 0x00, 0x05,
+    0x12, 0x17, 0x0C, 0x12, 0x11, 0x88, 0x63, 0x61, 0x69, 0x62, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x00,
+    0x08, 0x16, 0x16, 0x85, 0x63, 0x61, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x12, 0x18, 0x0F, 0x1C, 0x86,
+    0x63, 0x61, 0x72, 0x6F, 0x75, 0x6C, 0x79, 0x00, 0x0C, 0x16, 0x17, 0x04, 0x0C, 0x0C, 0x19, 0x08,
+    0x89, 0x64, 0x61, 0x69, 0x73, 0x74, 0x61, 0x69, 0x69, 0x76, 0x65, 0x00, 0x0F, 0x04, 0x07, 0x04,
+    0x0C, 0x11, 0x08, 0x16, 0x16, 0x2C, 0x8B, 0x66, 0x61, 0x6C, 0x61, 0x64, 0x61, 0x69, 0x6E, 0x65,
+    0x73, 0x73, 0x00, 0x47, 0x04, 0xD0, 0x00, 0x00, 0x08, 0xD0, 0x01, 0x00, 0x0A, 0x57, 0x02, 0x00,
+    0x0C, 0x94, 0x02, 0x00, 0x10, 0xCC, 0x02, 0x00, 0x12, 0xD8, 0x02, 0x00, 0x18, 0xFE, 0x03, 0x00,
+    0x4B, 0x04, 0xFD, 0x00, 0x00, 0x05, 0x04, 0x01, 0x00, 0x06, 0x11, 0x01, 0x00, 0x07, 0x1F, 0x01,
+    0x00, 0x08, 0x2A, 0x01, 0x00, 0x09, 0x4A, 0x01, 0x00, 0x0B, 0x5A, 0x01, 0x00, 0x0C, 0x69, 0x01,
+    0x00, 0x12, 0xA1, 0x01, 0x00, 0x15, 0xB0, 0x01, 0x00, 0x16, 0xC5, 0x01, 0x00, 0x05, 0x08, 0x0F,
+    0x81, 0x6C, 0x65, 0x00, 0x04, 0x0C, 0x0C, 0x17, 0x12, 0x11, 0x2C, 0x84, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x0B, 0x12, 0x12, 0x1A, 0x0C, 0x11, 0x0A, 0x84, 0x77, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x04,
+    0x08, 0x0F, 0x1C, 0x2C, 0x84, 0x65, 0x61, 0x6C, 0x79, 0x00, 0x42, 0x0F, 0x33, 0x01, 0x00, 0x10,
+    0x3F, 0x01, 0x00, 0x17, 0x0C, 0x12, 0x11, 0x85, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08,
+    0x11, 0x17, 0x85, 0x65, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x05, 0x18, 0x12, 0x10, 0x08,
+    0x11, 0x17, 0x85, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x19, 0x08, 0x17, 0x04, 0x0C,
+    0x12, 0x11, 0x84, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x43, 0x16, 0x76, 0x01, 0x00, 0x17, 0x84,
+    0x01, 0x00, 0x1A, 0x95, 0x01, 0x00, 0x07, 0x08, 0x12, 0x0C, 0x11, 0x0A, 0x85, 0x65, 0x64, 0x6F,
+    0x69, 0x6E, 0x67, 0x00, 0x0B, 0x04, 0x19, 0x18, 0x12, 0x11, 0x08, 0x16, 0x16, 0x85, 0x6F, 0x75,
+    0x6E, 0x65, 0x73, 0x73, 0x00, 0x04, 0x0C, 0x17, 0x12, 0x08, 0x18, 0x15, 0x82, 0x75, 0x65, 0x72,
+    0x00, 0x0A, 0x18, 0x10, 0x08, 0x11, 0x17, 0x86, 0x67, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00,
+    0x17, 0x08, 0x04, 0x13, 0x0F, 0x04, 0x0C, 0x11, 0x0A, 0x89, 0x74, 0x72, 0x65, 0x61, 0x70, 0x6C,
+    0x61, 0x69, 0x6E, 0x67, 0x00, 0x0B, 0x04, 0x08, 0x08, 0x07, 0x83, 0x65, 0x61, 0x65, 0x64, 0x00,
+    0x44, 0x04, 0xE1, 0x01, 0x00, 0x07, 0x31, 0x02, 0x00, 0x0C, 0x40, 0x02, 0x00, 0x19, 0x49, 0x02,
+    0x00, 0x45, 0x0A, 0xF6, 0x01, 0x00, 0x0C, 0x04, 0x02, 0x00, 0x16, 0x0D, 0x02, 0x00, 0x17, 0x1E,
+    0x02, 0x00, 0x1C, 0x2C, 0x02, 0x00, 0x15, 0x12, 0x07, 0x18, 0x04, 0x08, 0x15, 0x84, 0x75, 0x64,
+    0x61, 0x65, 0x72, 0x00, 0x17, 0x12, 0x11, 0x83, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x08, 0x16,
+    0x04, 0x11, 0x08, 0x16, 0x16, 0x86, 0x73, 0x65, 0x61, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x0C, 0x17,
+    0x15, 0x04, 0x0C, 0x04, 0x05, 0x08, 0x0F, 0x2C, 0x82, 0x6C, 0x65, 0x00, 0x0F, 0x81, 0x6C, 0x79,
+    0x00, 0x04, 0x15, 0x0C, 0x08, 0x04, 0x08, 0x07, 0x85, 0x69, 0x72, 0x65, 0x61, 0x65, 0x64, 0x00,
+    0x0A, 0x08, 0x07, 0x83, 0x67, 0x69, 0x65, 0x64, 0x00, 0x12, 0x18, 0x07, 0x12, 0x18, 0x18, 0x16,
+    0x2C, 0x84, 0x75, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x04, 0x60, 0x02, 0x00, 0x08, 0x8A, 0x02, 0x00,
+    0x42, 0x08, 0x69, 0x02, 0x00, 0x15, 0x77, 0x02, 0x00, 0x04, 0x12, 0x18, 0x16, 0x2C, 0x87, 0x61,
+    0x67, 0x65, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x12, 0x0F, 0x18, 0x10, 0x08, 0x11, 0x17, 0x89, 0x61,
+    0x67, 0x72, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x12, 0x08, 0x07, 0x84, 0x65, 0x67,
+    0x6F, 0x65, 0x64, 0x00, 0x43, 0x04, 0xA1, 0x02, 0x00, 0x08, 0xB0, 0x02, 0x00, 0x11, 0xB8, 0x02,
+    0x00, 0x05, 0x0C, 0x09, 0x0C, 0x0F, 0x1C, 0x86, 0x62, 0x61, 0x69, 0x66, 0x69, 0x6C, 0x79, 0x00,
+    0x19, 0x08, 0x83, 0x65, 0x69, 0x76, 0x65, 0x00, 0x04, 0x08, 0x17, 0x0B, 0x12, 0x18, 0x0C, 0x11,
+    0x0A, 0x88, 0x65, 0x61, 0x74, 0x68, 0x6F, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x08, 0x11, 0x17,
+    0x2C, 0x85, 0x6F, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x47, 0x09, 0xF5, 0x02, 0x00, 0x0B, 0x00, 0x03,
+    0x00, 0x0F, 0x09, 0x03, 0x00, 0x11, 0x18, 0x03, 0x00, 0x16, 0x20, 0x03, 0x00, 0x17, 0x2B, 0x03,
+    0x00, 0x18, 0x4B, 0x03, 0x00, 0x18, 0x08, 0x08, 0x07, 0x84, 0x75, 0x66, 0x65, 0x65, 0x64, 0x00,
+    0x0C, 0x19, 0x0C, 0x08, 0x82, 0x69, 0x76, 0x65, 0x00, 0x18, 0x12, 0x11, 0x08, 0x16, 0x16, 0x86,
+    0x75, 0x6C, 0x6F, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x16, 0x08, 0x16, 0x82, 0x65, 0x73, 0x73, 0x00,
+    0x04, 0x11, 0x16, 0x08, 0x16, 0x2C, 0x83, 0x65, 0x73, 0x73, 0x00, 0x42, 0x0B, 0x34, 0x03, 0x00,
+    0x15, 0x43, 0x03, 0x00, 0x18, 0x0C, 0x09, 0x10, 0x08, 0x11, 0x17, 0x85, 0x66, 0x69, 0x6D, 0x65,
+    0x6E, 0x74, 0x00, 0x08, 0x0C, 0x07, 0x82, 0x69, 0x65, 0x64, 0x00, 0x47, 0x0A, 0x68, 0x03, 0x00,
+    0x10, 0x78, 0x03, 0x00, 0x12, 0x87, 0x03, 0x00, 0x13, 0x8E, 0x03, 0x00, 0x16, 0x96, 0x03, 0x00,
+    0x17, 0xE4, 0x03, 0x00, 0x1A, 0xF1, 0x03, 0x00, 0x12, 0x0F, 0x04, 0x08, 0x04, 0x05, 0x0F, 0x08,
+    0x85, 0x65, 0x61, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x0A, 0x15, 0x12, 0x18, 0x17, 0x12, 0x0C,
+    0x11, 0x2C, 0x83, 0x69, 0x6F, 0x6E, 0x00, 0x16, 0x2C, 0x83, 0x6F, 0x75, 0x73, 0x00, 0x0F, 0x08,
+    0x04, 0x41, 0x11, 0x18, 0x03, 0x00, 0x43, 0x04, 0xA3, 0x03, 0x00, 0x08, 0xC7, 0x03, 0x00, 0x0B,
+    0xD7, 0x03, 0x00, 0x17, 0x42, 0x0C, 0xAD, 0x03, 0x00, 0x15, 0xBE, 0x03, 0x00, 0x13, 0x0F, 0x12,
+    0x18, 0x08, 0x07, 0x88, 0x74, 0x61, 0x69, 0x70, 0x6C, 0x6F, 0x75, 0x65, 0x64, 0x00, 0x08, 0x18,
+    0x12, 0x16, 0x82, 0x6F, 0x75, 0x73, 0x00, 0x04, 0x16, 0x12, 0x17, 0x04, 0x05, 0x0F, 0x08, 0x85,
+    0x74, 0x6F, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x0C, 0x17, 0x0C, 0x0B, 0x08, 0x15, 0x83, 0x68,
+    0x69, 0x65, 0x72, 0x00, 0x12, 0x18, 0x10, 0x0C, 0x19, 0x08, 0x84, 0x6D, 0x75, 0x69, 0x76, 0x65,
+    0x00, 0x12, 0x11, 0x18, 0x04, 0x08, 0x15, 0x84, 0x75, 0x6E, 0x61, 0x65, 0x72, 0x00, 0x46, 0x09,
+    0x17, 0x04, 0x00, 0x0A, 0x1E, 0x04, 0x00, 0x10, 0x2E, 0x04, 0x00, 0x11, 0x36, 0x04, 0x00, 0x12,
+    0x42, 0x04, 0x00, 0x16, 0x4A, 0x04, 0x00, 0x0C, 0x07, 0x08, 0x81, 0x65, 0x64, 0x00, 0x04, 0x0C,
+    0x08, 0x10, 0x17, 0x0C, 0x12, 0x11, 0x85, 0x6D, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x11, 0x08,
+    0x17, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x11, 0x12, 0x04, 0x0F, 0x05, 0x08, 0x82, 0x62, 0x6C,
+    0x65, 0x00, 0x08, 0x15, 0x83, 0x6F, 0x75, 0x65, 0x72, 0x00, 0x0B, 0x18, 0x41, 0x0C, 0x04, 0x02,
+    0x00, 0x4A, 0x04, 0x7A, 0x04, 0x00, 0x05, 0x0D, 0x06, 0x00, 0x08, 0x1A, 0x06, 0x00, 0x0B, 0xDF,
+    0x06, 0x00, 0x0C, 0xD9, 0x09, 0x00, 0x11, 0x4B, 0x0A, 0x00, 0x12, 0x56, 0x0A, 0x00, 0x17, 0x22,
+    0x0B, 0x00, 0x18, 0x4C, 0x0B, 0x00, 0x1A, 0x03, 0x0C, 0x00, 0x48, 0x06, 0x4C, 0x01, 0x00, 0x08,
+    0x9B, 0x04, 0x00, 0x0A, 0x0B, 0x05, 0x00, 0x0B, 0x3C, 0x05, 0x00, 0x0C, 0x78, 0x05, 0x00, 0x11,
+    0xC9, 0x05, 0x00, 0x16, 0xDE, 0x05, 0x00, 0x19, 0x02, 0x06, 0x00, 0x45, 0x08, 0xB0, 0x04, 0x00,
+    0x0C, 0xB7, 0x04, 0x00, 0x15, 0xBE, 0x04, 0x00, 0x16, 0xCC, 0x04, 0x00, 0x17, 0xF9, 0x04, 0x00,
+    0x15, 0x83, 0x65, 0x61, 0x65, 0x72, 0x00, 0x15, 0x2C, 0x83, 0x69, 0x65, 0x72, 0x00, 0x04, 0x04,
+    0x05, 0x0F, 0x08, 0x86, 0x72, 0x65, 0x61, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x42, 0x04, 0xD5, 0x04,
+    0x00, 0x17, 0xE7, 0x04, 0x00, 0x13, 0x0C, 0x04, 0x05, 0x0F, 0x08, 0x89, 0x65, 0x61, 0x73, 0x61,
+    0x70, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0C, 0x13, 0x08, 0x12, 0x18, 0x16, 0x89, 0x65, 0x61,
+    0x73, 0x74, 0x69, 0x70, 0x65, 0x6F, 0x75, 0x73, 0x00, 0x15, 0x08, 0x04, 0x05, 0x0F, 0x08, 0x2C,
+    0x89, 0x65, 0x61, 0x74, 0x72, 0x65, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x44, 0x04, 0x1C, 0x05, 0x00,
+    0x0C, 0x24, 0x05, 0x00, 0x12, 0x4B, 0x04, 0x00, 0x18, 0x36, 0x05, 0x00, 0x0C, 0x0C, 0x08, 0x19,
+    0x81, 0x76, 0x65, 0x00, 0x15, 0x04, 0x0C, 0x17, 0x0C, 0x12, 0x11, 0x88, 0x69, 0x67, 0x72, 0x61,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x16, 0x41, 0x17, 0x87, 0x01, 0x00, 0x43, 0x05, 0x49, 0x05,
+    0x00, 0x08, 0x5A, 0x05, 0x00, 0x17, 0x61, 0x05, 0x00, 0x04, 0x0C, 0x04, 0x05, 0x0F, 0x08, 0x88,
+    0x68, 0x61, 0x62, 0x61, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x15, 0x83, 0x68, 0x61, 0x65, 0x72,
+    0x00, 0x15, 0x12, 0x18, 0x19, 0x12, 0x04, 0x05, 0x0F, 0x08, 0x8B, 0x68, 0x61, 0x74, 0x72, 0x6F,
+    0x75, 0x76, 0x6F, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x44, 0x0C, 0x89, 0x05, 0x00, 0x11, 0xA0, 0x05,
+    0x00, 0x15, 0xBB, 0x05, 0x00, 0x17, 0xC1, 0x05, 0x00, 0x42, 0x08, 0x92, 0x05, 0x00, 0x1A, 0x98,
+    0x05, 0x00, 0x19, 0x2C, 0x82, 0x76, 0x65, 0x00, 0x0F, 0x1C, 0x83, 0x77, 0x69, 0x6C, 0x79, 0x00,
+    0x42, 0x0C, 0xA9, 0x05, 0x00, 0x12, 0xAF, 0x05, 0x00, 0x0A, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x10,
+    0x18, 0x08, 0x11, 0x17, 0x84, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x41, 0x10, 0x2E, 0x04,
+    0x00, 0x12, 0x0C, 0x11, 0x82, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x08, 0x16, 0x0B, 0x18, 0x04, 0x05,
+    0x0F, 0x08, 0x89, 0x69, 0x6E, 0x65, 0x73, 0x68, 0x75, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x42, 0x0C,
+    0xE7, 0x05, 0x00, 0x17, 0xF3, 0x05, 0x00, 0x04, 0x0C, 0x19, 0x08, 0x85, 0x69, 0x73, 0x61, 0x69,
+    0x76, 0x65, 0x00, 0x0C, 0x12, 0x15, 0x18, 0x0C, 0x19, 0x08, 0x85, 0x72, 0x6F, 0x75, 0x69, 0x76,
+    0x65, 0x00, 0x04, 0x19, 0x18, 0x10, 0x08, 0x17, 0x11, 0x81, 0x6E, 0x74, 0x00, 0x0C, 0x18, 0x0C,
+    0x11, 0x0A, 0x85, 0x69, 0x62, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x45, 0x04, 0x2F, 0x06, 0x00, 0x05,
+    0x70, 0x06, 0x00, 0x0A, 0x7B, 0x06, 0x00, 0x0B, 0x97, 0x06, 0x00, 0x10, 0xD4, 0x06, 0x00, 0x44,
+    0x06, 0x40, 0x06, 0x00, 0x13, 0x4E, 0x06, 0x00, 0x17, 0x5D, 0x06, 0x00, 0x18, 0x6B, 0x06, 0x00,
+    0x0C, 0x11, 0x08, 0x16, 0x16, 0x86, 0x63, 0x61, 0x69, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x0F, 0x05,
+    0x18, 0x0C, 0x12, 0x18, 0x16, 0x85, 0x75, 0x62, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x12, 0x0B, 0x11,
+    0x08, 0x16, 0x16, 0x85, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x41, 0x12, 0x87, 0x03, 0x00,
+    0x18, 0x08, 0x10, 0x11, 0x17, 0x83, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x12, 0x84, 0x06, 0x00,
+    0x18, 0x8F, 0x06, 0x00, 0x15, 0x12, 0x18, 0x16, 0x84, 0x72, 0x6F, 0x6F, 0x75, 0x73, 0x00, 0x17,
+    0x0C, 0x11, 0x12, 0x81, 0x6F, 0x6E, 0x00, 0x43, 0x10, 0xA4, 0x06, 0x00, 0x15, 0xB7, 0x06, 0x00,
+    0x17, 0xCA, 0x06, 0x00, 0x04, 0x0C, 0x19, 0x04, 0x0C, 0x08, 0x07, 0x89, 0x68, 0x65, 0x6D, 0x61,
+    0x69, 0x76, 0x61, 0x69, 0x65, 0x64, 0x00, 0x0C, 0x0B, 0x04, 0x17, 0x0C, 0x12, 0x11, 0x89, 0x68,
+    0x65, 0x72, 0x69, 0x68, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x08, 0x07, 0x84, 0x74, 0x68,
+    0x65, 0x65, 0x64, 0x00, 0x04, 0x08, 0x11, 0x17, 0x84, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x49,
+    0x04, 0x04, 0x07, 0x00, 0x05, 0x86, 0x07, 0x00, 0x08, 0x99, 0x07, 0x00, 0x0C, 0x2C, 0x08, 0x00,
+    0x10, 0xCF, 0x08, 0x00, 0x11, 0xDA, 0x08, 0x00, 0x12, 0xE5, 0x08, 0x00, 0x17, 0x5D, 0x09, 0x00,
+    0x18, 0x69, 0x09, 0x00, 0x44, 0x0C, 0x15, 0x07, 0x00, 0x10, 0x4C, 0x07, 0x00, 0x13, 0x67, 0x07,
+    0x00, 0x17, 0x76, 0x07, 0x00, 0x44, 0x05, 0x26, 0x07, 0x00, 0x0B, 0x2F, 0x07, 0x00, 0x13, 0x3A,
+    0x07, 0x00, 0x17, 0x47, 0x07, 0x00, 0x04, 0x0F, 0x08, 0x83, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x17,
+    0x12, 0x0F, 0x1C, 0x84, 0x74, 0x68, 0x6F, 0x6C, 0x79, 0x00, 0x08, 0x04, 0x07, 0x0C, 0x04, 0x08,
+    0x15, 0x83, 0x61, 0x69, 0x65, 0x72, 0x00, 0x41, 0x15, 0x5C, 0x01, 0x00, 0x42, 0x04, 0x55, 0x07,
+    0x00, 0x08, 0x60, 0x07, 0x00, 0x0F, 0x12, 0x11, 0x0C, 0x0A, 0x2C, 0x83, 0x69, 0x6E, 0x67, 0x00,
+    0x17, 0x11, 0x2C, 0x82, 0x6E, 0x74, 0x00, 0x0C, 0x12, 0x0B, 0x04, 0x08, 0x15, 0x86, 0x69, 0x70,
+    0x6F, 0x68, 0x61, 0x65, 0x72, 0x00, 0x12, 0x18, 0x0F, 0x13, 0x04, 0x12, 0x18, 0x16, 0x85, 0x70,
+    0x6C, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x0C, 0x18, 0x0A, 0x08, 0x04, 0x0C, 0x11, 0x0A, 0x88, 0x69,
+    0x62, 0x75, 0x67, 0x65, 0x61, 0x69, 0x6E, 0x67, 0x00, 0x47, 0x04, 0xB6, 0x07, 0x00, 0x05, 0x02,
+    0x08, 0x00, 0x0C, 0x1E, 0x05, 0x00, 0x11, 0x0C, 0x08, 0x00, 0x13, 0x1D, 0x08, 0x00, 0x18, 0x9B,
+    0x01, 0x00, 0x19, 0x27, 0x08, 0x00, 0x43, 0x0B, 0xC3, 0x07, 0x00, 0x0F, 0xDA, 0x07, 0x00, 0x16,
+    0xE0, 0x07, 0x00, 0x06, 0x08, 0x04, 0x17, 0x15, 0x0C, 0x11, 0x08, 0x16, 0x16, 0x8A, 0x63, 0x68,
+    0x65, 0x61, 0x74, 0x72, 0x69, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x04, 0x41, 0x0C, 0x91, 0x03, 0x00,
+    0x0B, 0x42, 0x0C, 0xEA, 0x07, 0x00, 0x1A, 0xF5, 0x07, 0x00, 0x04, 0x0C, 0x19, 0x08, 0x84, 0x61,
+    0x69, 0x69, 0x76, 0x65, 0x00, 0x08, 0x08, 0x12, 0x18, 0x16, 0x85, 0x65, 0x77, 0x65, 0x6F, 0x75,
+    0x73, 0x00, 0x12, 0x11, 0x12, 0x0C, 0x0A, 0x11, 0x81, 0x6E, 0x67, 0x00, 0x04, 0x08, 0x04, 0x10,
+    0x08, 0x11, 0x17, 0x87, 0x61, 0x6E, 0x65, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0F, 0x04, 0x06,
+    0x0B, 0x08, 0x41, 0x04, 0xBF, 0x03, 0x00, 0x41, 0x04, 0xBC, 0x05, 0x00, 0x45, 0x04, 0x41, 0x08,
+    0x00, 0x06, 0x7C, 0x08, 0x00, 0x08, 0x9E, 0x08, 0x00, 0x17, 0xA8, 0x08, 0x00, 0x19, 0xB4, 0x08,
+    0x00, 0x43, 0x07, 0x4E, 0x08, 0x00, 0x17, 0x5F, 0x08, 0x00, 0x19, 0x75, 0x08, 0x00, 0x12, 0x18,
+    0x17, 0x0C, 0x12, 0x11, 0x88, 0x61, 0x69, 0x64, 0x6F, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0B,
+    0x18, 0x06, 0x18, 0x17, 0x0C, 0x12, 0x11, 0x2C, 0x8B, 0x61, 0x69, 0x74, 0x68, 0x75, 0x63, 0x75,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x83, 0x61, 0x69, 0x76, 0x65, 0x00, 0x42, 0x0B, 0x85, 0x08,
+    0x00, 0x12, 0x8F, 0x08, 0x00, 0x12, 0x0C, 0x18, 0x16, 0x83, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x18,
+    0x0A, 0x04, 0x04, 0x0C, 0x05, 0x0F, 0x08, 0x84, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x11, 0x0F,
+    0x1C, 0x2C, 0x84, 0x6E, 0x65, 0x6C, 0x79, 0x00, 0x0B, 0x0C, 0x04, 0x08, 0x15, 0x2C, 0x84, 0x61,
+    0x69, 0x65, 0x72, 0x00, 0x42, 0x08, 0xBD, 0x08, 0x00, 0x12, 0xC5, 0x08, 0x00, 0x04, 0x09, 0x12,
+    0x41, 0x18, 0x39, 0x04, 0x00, 0x0C, 0x18, 0x16, 0x2C, 0x84, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x08,
+    0x08, 0x11, 0x17, 0x84, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x18, 0x08, 0x16, 0x16, 0x84, 0x75,
+    0x6E, 0x65, 0x73, 0x73, 0x00, 0x46, 0x07, 0x19, 0x04, 0x00, 0x08, 0xFE, 0x08, 0x00, 0x11, 0x0B,
+    0x09, 0x00, 0x16, 0x1E, 0x09, 0x00, 0x18, 0x28, 0x09, 0x00, 0x1A, 0x4D, 0x09, 0x00, 0x11, 0x11,
+    0x08, 0x16, 0x16, 0x85, 0x6E, 0x65, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x18, 0x0C, 0x10, 0x08, 0x04,
+    0x05, 0x0F, 0x08, 0x88, 0x75, 0x6E, 0x69, 0x6D, 0x65, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x17, 0x0C,
+    0x17, 0x15, 0x0C, 0x41, 0x05, 0x26, 0x07, 0x00, 0x43, 0x04, 0x35, 0x09, 0x00, 0x0C, 0x04, 0x02,
+    0x00, 0x19, 0x42, 0x09, 0x00, 0x19, 0x19, 0x04, 0x0F, 0x1C, 0x85, 0x76, 0x61, 0x76, 0x61, 0x6C,
+    0x79, 0x00, 0x04, 0x17, 0x15, 0x12, 0x18, 0x15, 0x08, 0x81, 0x65, 0x72, 0x00, 0x04, 0x16, 0x04,
+    0x17, 0x0C, 0x0C, 0x11, 0x0A, 0x85, 0x74, 0x61, 0x69, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x0C, 0x12,
+    0x11, 0x2C, 0x85, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x04, 0x24, 0x02, 0x00, 0x06, 0x82,
+    0x09, 0x00, 0x0C, 0x88, 0x09, 0x00, 0x12, 0x95, 0x09, 0x00, 0x13, 0xCF, 0x09, 0x00, 0x17, 0xD4,
+    0x09, 0x00, 0x0B, 0x41, 0x0C, 0x39, 0x04, 0x00, 0x11, 0x17, 0x0C, 0x12, 0x11, 0x85, 0x6E, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x43, 0x08, 0xA2, 0x09, 0x00, 0x0A, 0xA9, 0x09, 0x00, 0x13, 0xBC,
+    0x09, 0x00, 0x07, 0x83, 0x6F, 0x75, 0x65, 0x64, 0x00, 0x0C, 0x13, 0x12, 0x04, 0x05, 0x0F, 0x08,
+    0x89, 0x6F, 0x75, 0x67, 0x69, 0x70, 0x6F, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x12, 0x18, 0x16, 0x18,
+    0x0C, 0x11, 0x0A, 0x89, 0x6F, 0x75, 0x70, 0x6F, 0x75, 0x73, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x41,
+    0x0C, 0xBC, 0x05, 0x00, 0x41, 0x0B, 0x1C, 0x05, 0x00, 0x45, 0x0B, 0xEE, 0x09, 0x00, 0x11, 0x12,
+    0x0A, 0x00, 0x13, 0x1B, 0x0A, 0x00, 0x16, 0x28, 0x0A, 0x00, 0x17, 0x3C, 0x0A, 0x00, 0x42, 0x10,
+    0xF7, 0x09, 0x00, 0x17, 0x07, 0x0A, 0x00, 0x18, 0x11, 0x08, 0x16, 0x16, 0x2C, 0x88, 0x68, 0x69,
+    0x6D, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x0C, 0x12, 0x11, 0x85, 0x68, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x42, 0x0C, 0xA9, 0x05, 0x00, 0x16, 0x19, 0x03, 0x00, 0x0F, 0x04, 0x12, 0x05, 0x0F,
+    0x08, 0x84, 0x6F, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x17, 0x04, 0x0C, 0x17, 0x0B, 0x0C, 0x04, 0x10,
+    0x08, 0x11, 0x17, 0x2C, 0x86, 0x61, 0x69, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0B, 0x04, 0x0C, 0x12,
+    0x0A, 0x0C, 0x19, 0x08, 0x84, 0x67, 0x6F, 0x69, 0x76, 0x65, 0x00, 0x08, 0x08, 0x16, 0x16, 0x84,
+    0x65, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x49, 0x06, 0x7B, 0x0A, 0x00, 0x09, 0x8D, 0x0A, 0x00, 0x0A,
+    0xA1, 0x0A, 0x00, 0x0B, 0xB1, 0x0A, 0x00, 0x10, 0xBE, 0x0A, 0x00, 0x13, 0xCD, 0x0A, 0x00, 0x17,
+    0xF3, 0x0A, 0x00, 0x18, 0xFA, 0x0A, 0x00, 0x19, 0x14, 0x0B, 0x00, 0x04, 0x0B, 0x0B, 0x18, 0x10,
+    0x08, 0x11, 0x17, 0x87, 0x68, 0x61, 0x68, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x12, 0x47,
+    0x09, 0x00, 0x17, 0x96, 0x0A, 0x00, 0x12, 0x0C, 0x12, 0x11, 0x84, 0x6F, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x15, 0x04, 0x17, 0x16, 0x18, 0x0C, 0x11, 0x0A, 0x85, 0x73, 0x74, 0x75, 0x69, 0x6E, 0x67,
+    0x00, 0x18, 0x12, 0x18, 0x16, 0x2C, 0x86, 0x68, 0x6F, 0x75, 0x6F, 0x75, 0x73, 0x00, 0x12, 0x0F,
+    0x13, 0x12, 0x0C, 0x19, 0x08, 0x85, 0x70, 0x6C, 0x6F, 0x69, 0x76, 0x65, 0x00, 0x42, 0x0F, 0xD6,
+    0x0A, 0x00, 0x18, 0xE4, 0x0A, 0x00, 0x18, 0x17, 0x08, 0x15, 0x0C, 0x11, 0x0A, 0x84, 0x72, 0x65,
+    0x69, 0x6E, 0x67, 0x00, 0x0F, 0x0C, 0x0C, 0x11, 0x0A, 0x2C, 0x87, 0x75, 0x70, 0x6C, 0x69, 0x69,
+    0x6E, 0x67, 0x00, 0x15, 0x12, 0x41, 0x1A, 0x91, 0x08, 0x00, 0x42, 0x0A, 0x03, 0x0B, 0x00, 0x12,
+    0xC1, 0x03, 0x00, 0x04, 0x0B, 0x17, 0x08, 0x04, 0x12, 0x18, 0x16, 0x86, 0x74, 0x68, 0x65, 0x61,
+    0x6F, 0x75, 0x73, 0x00, 0x12, 0x18, 0x04, 0x11, 0x12, 0x18, 0x16, 0x84, 0x6E, 0x61, 0x6F, 0x75,
+    0x73, 0x00, 0x42, 0x08, 0x2B, 0x0B, 0x00, 0x12, 0x41, 0x0B, 0x00, 0x0B, 0x04, 0x06, 0x0B, 0x12,
+    0x18, 0x12, 0x18, 0x16, 0x8A, 0x65, 0x74, 0x68, 0x61, 0x63, 0x68, 0x6F, 0x75, 0x6F, 0x75, 0x73,
+    0x00, 0x0C, 0x12, 0x11, 0x2C, 0x85, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x48, 0x06, 0x6D, 0x0B,
+    0x00, 0x08, 0xA5, 0x0B, 0x00, 0x0A, 0xB5, 0x0B, 0x00, 0x0B, 0xBF, 0x0B, 0x00, 0x15, 0x22, 0x08,
+    0x00, 0x16, 0xDE, 0x0B, 0x00, 0x18, 0xC0, 0x03, 0x00, 0x19, 0x02, 0x03, 0x00, 0x43, 0x08, 0x7A,
+    0x0B, 0x00, 0x12, 0x8C, 0x0B, 0x00, 0x18, 0x9B, 0x0B, 0x00, 0x17, 0x16, 0x12, 0x18, 0x11, 0x08,
+    0x16, 0x16, 0x87, 0x73, 0x74, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x0B, 0x11, 0x12, 0x18,
+    0x08, 0x15, 0x86, 0x68, 0x6F, 0x6E, 0x6F, 0x75, 0x65, 0x72, 0x00, 0x0B, 0x0F, 0x1C, 0x2C, 0x84,
+    0x68, 0x75, 0x6C, 0x79, 0x00, 0x0F, 0x04, 0x17, 0x12, 0x08, 0x07, 0x2C, 0x87, 0x6C, 0x65, 0x61,
+    0x74, 0x6F, 0x65, 0x64, 0x00, 0x12, 0x17, 0x08, 0x0C, 0x15, 0x82, 0x69, 0x65, 0x72, 0x00, 0x42,
+    0x08, 0xC8, 0x0B, 0x00, 0x17, 0xCF, 0x0B, 0x00, 0x07, 0x83, 0x68, 0x75, 0x65, 0x64, 0x00, 0x0B,
+    0x08, 0x0C, 0x11, 0x0A, 0x87, 0x68, 0x75, 0x74, 0x68, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x12,
+    0xE7, 0x0B, 0x00, 0x17, 0xF4, 0x0B, 0x00, 0x17, 0x11, 0x08, 0x16, 0x16, 0x85, 0x74, 0x6F, 0x6E,
+    0x65, 0x73, 0x73, 0x00, 0x0C, 0x16, 0x0B, 0x11, 0x04, 0x08, 0x16, 0x16, 0x84, 0x61, 0x6E, 0x65,
+    0x73, 0x73, 0x00, 0x12, 0x04, 0x0C, 0x08, 0x07, 0x85, 0x6F, 0x77, 0x61, 0x69, 0x65, 0x64, 0x00,
+    0x4B, 0x04, 0x3D, 0x0C, 0x00, 0x06, 0x11, 0x0D, 0x00, 0x08, 0x20, 0x0D, 0x00, 0x0C, 0xF0, 0x0D,
+    0x00, 0x0F, 0xB6, 0x0E, 0x00, 0x11, 0xDA, 0x08, 0x00, 0x12, 0xC7, 0x0E, 0x00, 0x16, 0x89, 0x0F,
+    0x00, 0x17, 0xA0, 0x0F, 0x00, 0x18, 0xBD, 0x0F, 0x00, 0x19, 0x49, 0x10, 0x00, 0x46, 0x04, 0x3A,
+    0x04, 0x00, 0x08, 0x56, 0x0C, 0x00, 0x0C, 0x8C, 0x0C, 0x00, 0x15, 0xD2, 0x0C, 0x00, 0x16, 0xE3,
+    0x0C, 0x00, 0x17, 0x07, 0x0D, 0x00, 0x44, 0x05, 0x67, 0x0C, 0x00, 0x08, 0xB0, 0x04, 0x00, 0x0A,
+    0x70, 0x0C, 0x00, 0x11, 0x81, 0x0C, 0x00, 0x0F, 0x08, 0x84, 0x65, 0x61, 0x62, 0x6C, 0x65, 0x00,
+    0x15, 0x08, 0x04, 0x05, 0x0F, 0x08, 0x88, 0x65, 0x61, 0x67, 0x72, 0x65, 0x61, 0x62, 0x6C, 0x65,
+    0x00, 0x08, 0x16, 0x16, 0x85, 0x65, 0x61, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x44, 0x04, 0x9D, 0x0C,
+    0x00, 0x05, 0xAE, 0x0C, 0x00, 0x16, 0xB8, 0x0C, 0x00, 0x19, 0xC0, 0x0C, 0x00, 0x11, 0x0C, 0x0F,
+    0x04, 0x0C, 0x08, 0x15, 0x87, 0x6E, 0x61, 0x69, 0x6C, 0x61, 0x69, 0x65, 0x72, 0x00, 0x04, 0x0F,
+    0x08, 0x2C, 0x84, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x17, 0x04, 0x08, 0x41, 0x08, 0xB0, 0x04, 0x00,
+    0x0C, 0x0A, 0x15, 0x04, 0x08, 0x17, 0x0C, 0x12, 0x11, 0x2C, 0x86, 0x65, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x17, 0x0C, 0x1A, 0x08, 0x0C, 0x11, 0x0A, 0x87, 0x74, 0x72, 0x69, 0x77, 0x65, 0x69,
+    0x6E, 0x67, 0x00, 0x42, 0x17, 0xEC, 0x0C, 0x00, 0x18, 0xF9, 0x0C, 0x00, 0x0C, 0x08, 0x19, 0x04,
+    0x0F, 0x1C, 0x84, 0x76, 0x65, 0x61, 0x6C, 0x79, 0x00, 0x18, 0x07, 0x10, 0x08, 0x11, 0x17, 0x85,
+    0x64, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x18, 0x13, 0x12, 0x18, 0x11, 0x41, 0x0C, 0xA9, 0x05,
+    0x00, 0x0C, 0x12, 0x10, 0x08, 0x11, 0x17, 0x86, 0x69, 0x63, 0x6F, 0x6D, 0x65, 0x6E, 0x74, 0x00,
+    0x46, 0x04, 0x39, 0x0D, 0x00, 0x07, 0x8A, 0x0D, 0x00, 0x0A, 0xBF, 0x0D, 0x00, 0x0F, 0xCD, 0x0D,
+    0x00, 0x16, 0xD8, 0x0D, 0x00, 0x18, 0xE3, 0x0D, 0x00, 0x44, 0x04, 0x4A, 0x0D, 0x00, 0x0C, 0x06,
+    0x08, 0x00, 0x17, 0x6F, 0x0D, 0x00, 0x1A, 0x43, 0x03, 0x00, 0x42, 0x13, 0x53, 0x0D, 0x00, 0x17,
+    0x65, 0x0D, 0x00, 0x13, 0x0F, 0x08, 0x04, 0x12, 0x18, 0x16, 0x88, 0x70, 0x61, 0x70, 0x6C, 0x65,
+    0x61, 0x6F, 0x75, 0x73, 0x00, 0x0C, 0x0F, 0x1C, 0x84, 0x74, 0x61, 0x69, 0x6C, 0x79, 0x00, 0x42,
+    0x0C, 0x91, 0x06, 0x00, 0x15, 0x78, 0x0D, 0x00, 0x06, 0x0C, 0x12, 0x18, 0x10, 0x08, 0x11, 0x17,
+    0x87, 0x69, 0x63, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x43, 0x04, 0x97, 0x0D, 0x00, 0x08,
+    0xA7, 0x0D, 0x00, 0x0C, 0xAE, 0x0D, 0x00, 0x0C, 0x15, 0x0C, 0x0C, 0x11, 0x0A, 0x87, 0x61, 0x64,
+    0x69, 0x72, 0x69, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x15, 0x41, 0x04, 0x01, 0x03, 0x00, 0x04, 0x09,
+    0x04, 0x10, 0x08, 0x11, 0x17, 0x87, 0x61, 0x69, 0x66, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x18,
+    0x15, 0x11, 0x08, 0x16, 0x16, 0x85, 0x72, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x13, 0x08, 0x08,
+    0x07, 0x84, 0x70, 0x6C, 0x65, 0x65, 0x64, 0x00, 0x0B, 0x08, 0x13, 0x0F, 0x04, 0x0C, 0x41, 0x17,
+    0xC1, 0x05, 0x00, 0x07, 0x11, 0x08, 0x16, 0x16, 0x85, 0x64, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00,
+    0x48, 0x04, 0x11, 0x0E, 0x00, 0x07, 0x5C, 0x0E, 0x00, 0x08, 0x72, 0x06, 0x00, 0x0B, 0x69, 0x0E,
+    0x00, 0x13, 0x7D, 0x0E, 0x00, 0x16, 0x9F, 0x0E, 0x00, 0x17, 0xA6, 0x0E, 0x00, 0x1A, 0xAE, 0x0E,
+    0x00, 0x44, 0x10, 0x22, 0x0E, 0x00, 0x11, 0x2D, 0x0E, 0x00, 0x15, 0x38, 0x0E, 0x00, 0x19, 0x48,
+    0x0E, 0x00, 0x08, 0x11, 0x17, 0x85, 0x61, 0x69, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x16, 0x16,
+    0x85, 0x61, 0x69, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x0C, 0x13, 0x12, 0x18, 0x0F, 0x1C, 0x87, 0x72,
+    0x61, 0x69, 0x70, 0x6F, 0x75, 0x6C, 0x79, 0x00, 0x42, 0x08, 0x76, 0x08, 0x00, 0x0C, 0x51, 0x0E,
+    0x00, 0x12, 0x18, 0x16, 0x85, 0x76, 0x61, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x12, 0x07, 0x0C, 0x10,
+    0x11, 0x08, 0x17, 0x2C, 0x83, 0x65, 0x6E, 0x74, 0x00, 0x17, 0x04, 0x0A, 0x04, 0x10, 0x08, 0x11,
+    0x17, 0x2C, 0x89, 0x74, 0x68, 0x61, 0x67, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0F, 0x42, 0x0A,
+    0x87, 0x0E, 0x00, 0x0C, 0x96, 0x0E, 0x00, 0x08, 0x08, 0x04, 0x12, 0x18, 0x16, 0x86, 0x65, 0x67,
+    0x65, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x18, 0x11, 0x0A, 0x83, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x0B,
+    0x08, 0x41, 0x04, 0x39, 0x04, 0x00, 0x0B, 0x0C, 0x05, 0x41, 0x04, 0x1C, 0x05, 0x00, 0x12, 0x18,
+    0x10, 0x41, 0x08, 0x60, 0x07, 0x00, 0x12, 0x12, 0x0A, 0x04, 0x0C, 0x08, 0x15, 0x87, 0x6F, 0x6C,
+    0x6F, 0x67, 0x61, 0x69, 0x65, 0x72, 0x00, 0x46, 0x06, 0xE0, 0x0E, 0x00, 0x09, 0xEC, 0x0E, 0x00,
+    0x0B, 0xF5, 0x0E, 0x00, 0x0C, 0x96, 0x0E, 0x00, 0x13, 0x04, 0x0F, 0x00, 0x18, 0x0F, 0x0F, 0x00,
+    0x18, 0x12, 0x0C, 0x19, 0x08, 0x84, 0x6F, 0x75, 0x69, 0x76, 0x65, 0x00, 0x18, 0x17, 0x15, 0x18,
+    0x41, 0x18, 0x6B, 0x06, 0x00, 0x06, 0x08, 0x10, 0x08, 0x08, 0x15, 0x86, 0x63, 0x68, 0x65, 0x6D,
+    0x65, 0x65, 0x72, 0x00, 0x18, 0x12, 0x0F, 0x1C, 0x84, 0x75, 0x70, 0x6F, 0x6C, 0x79, 0x00, 0x49,
+    0x05, 0x34, 0x0F, 0x00, 0x0F, 0x3D, 0x0F, 0x00, 0x10, 0x20, 0x03, 0x00, 0x11, 0x4D, 0x0F, 0x00,
+    0x12, 0x54, 0x0F, 0x00, 0x13, 0x63, 0x0F, 0x00, 0x17, 0x90, 0x06, 0x00, 0x18, 0x74, 0x0F, 0x00,
+    0x19, 0x4C, 0x01, 0x00, 0x12, 0x0C, 0x0A, 0x11, 0x2C, 0x82, 0x6E, 0x67, 0x00, 0x04, 0x17, 0x12,
+    0x15, 0x04, 0x05, 0x0F, 0x08, 0x85, 0x72, 0x6F, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x08, 0x16, 0x41,
+    0x12, 0x21, 0x03, 0x00, 0x1A, 0x18, 0x10, 0x08, 0x11, 0x17, 0x86, 0x77, 0x6F, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x00, 0x0C, 0x04, 0x0B, 0x0C, 0x12, 0x18, 0x16, 0x2C, 0x87, 0x61, 0x69, 0x68, 0x69,
+    0x6F, 0x75, 0x73, 0x00, 0x09, 0x17, 0x0B, 0x08, 0x04, 0x04, 0x05, 0x0F, 0x08, 0x89, 0x66, 0x75,
+    0x74, 0x68, 0x65, 0x61, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x17, 0x12, 0x18, 0x0B, 0x04, 0x04,
+    0x05, 0x0F, 0x08, 0x8A, 0x61, 0x73, 0x74, 0x6F, 0x75, 0x68, 0x61, 0x61, 0x62, 0x6C, 0x65, 0x00,
+    0x42, 0x04, 0x5F, 0x01, 0x00, 0x0C, 0xA9, 0x0F, 0x00, 0x0B, 0x0C, 0x0B, 0x12, 0x18, 0x0C, 0x19,
+    0x08, 0x89, 0x69, 0x74, 0x68, 0x69, 0x68, 0x6F, 0x75, 0x69, 0x76, 0x65, 0x00, 0x46, 0x05, 0xD6,
+    0x0F, 0x00, 0x06, 0xE7, 0x0F, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x0F, 0xEF, 0x0F, 0x00, 0x11, 0x0C,
+    0x0D, 0x00, 0x12, 0xFD, 0x0F, 0x00, 0x08, 0x04, 0x17, 0x15, 0x17, 0x0C, 0x0C, 0x12, 0x11, 0x2C,
+    0x85, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x04, 0x16, 0x17, 0x41, 0x08, 0x47, 0x09, 0x00, 0x12,
+    0x04, 0x13, 0x0C, 0x0F, 0x1C, 0x2C, 0x85, 0x70, 0x61, 0x69, 0x6C, 0x79, 0x00, 0x43, 0x11, 0x0A,
+    0x10, 0x00, 0x12, 0x1B, 0x10, 0x00, 0x13, 0x24, 0x10, 0x00, 0x12, 0x18, 0x11, 0x08, 0x16, 0x16,
+    0x88, 0x6F, 0x75, 0x6E, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x18, 0x16, 0x84, 0x6F, 0x75,
+    0x6F, 0x75, 0x73, 0x00, 0x42, 0x0F, 0x2D, 0x10, 0x00, 0x18, 0x3D, 0x10, 0x00, 0x18, 0x11, 0x08,
+    0x16, 0x16, 0x88, 0x6F, 0x75, 0x70, 0x6C, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x0C, 0x11, 0x0A,
+    0x86, 0x6F, 0x75, 0x70, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x04, 0x0A, 0x15, 0x04, 0x0F, 0x1C,
+    0x87, 0x69, 0x76, 0x61, 0x67, 0x72, 0x61, 0x6C, 0x79, 0x00, 0x44, 0x05, 0x6B, 0x10, 0x00, 0x06,
+    0xA6, 0x10, 0x00, 0x07, 0xB2, 0x10, 0x00, 0x09, 0xF4, 0x10, 0x00, 0x04, 0x43, 0x06, 0x79, 0x10,
+    0x00, 0x11, 0x87, 0x10, 0x00, 0x17, 0x94, 0x10, 0x00, 0x0B, 0x12, 0x08, 0x07, 0x87, 0x62, 0x65,
+    0x61, 0x63, 0x68, 0x6F, 0x65, 0x64, 0x00, 0x08, 0x16, 0x16, 0x2C, 0x87, 0x62, 0x65, 0x61, 0x6E,
+    0x65, 0x73, 0x73, 0x00, 0x0B, 0x08, 0x04, 0x0C, 0x11, 0x0A, 0x89, 0x62, 0x65, 0x61, 0x74, 0x68,
+    0x65, 0x61, 0x69, 0x6E, 0x67, 0x00, 0x17, 0x0C, 0x12, 0x11, 0x85, 0x63, 0x65, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x43, 0x04, 0xBF, 0x10, 0x00, 0x17, 0xCC, 0x10, 0x00, 0x19, 0xDD, 0x10, 0x00, 0x04,
+    0x05, 0x0F, 0x08, 0x86, 0x64, 0x65, 0x61, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0B, 0x18, 0x11, 0x08,
+    0x16, 0x16, 0x88, 0x64, 0x65, 0x74, 0x68, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x08, 0x16, 0x0B,
+    0x04, 0x0C, 0x10, 0x08, 0x11, 0x17, 0x8B, 0x64, 0x65, 0x76, 0x65, 0x73, 0x68, 0x61, 0x69, 0x6D,
+    0x65, 0x6E, 0x74, 0x00, 0x44, 0x04, 0x05, 0x11, 0x00, 0x10, 0x14, 0x11, 0x00, 0x16, 0x1F, 0x11,
+    0x00, 0x17, 0x38, 0x11, 0x00, 0x06, 0x0B, 0x18, 0x08, 0x07, 0x87, 0x66, 0x65, 0x61, 0x63, 0x68,
+    0x75, 0x65, 0x64, 0x00, 0x08, 0x11, 0x17, 0x85, 0x66, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0B,
+    0x08, 0x13, 0x0F, 0x12, 0x18, 0x11, 0x08, 0x16, 0x16, 0x8C, 0x66, 0x65, 0x73, 0x68, 0x65, 0x70,
+    0x6C, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x15, 0x18, 0x13, 0x12, 0x18, 0x0F, 0x1C, 0x89,
+    0x66, 0x65, 0x74, 0x72, 0x75, 0x70, 0x6F, 0x75, 0x6C, 0x79, 0x00, 0x49, 0x04, 0x70, 0x11, 0x00,
+    0x08, 0xEC, 0x11, 0x00, 0x0C, 0xE5, 0x12, 0x00, 0x10, 0x4C, 0x13, 0x00, 0x11, 0x59, 0x13, 0x00,
+    0x12, 0x67, 0x13, 0x00, 0x13, 0x16, 0x14, 0x00, 0x17, 0x23, 0x14, 0x00, 0x18, 0x30, 0x14, 0x00,
+    0x44, 0x08, 0x81, 0x11, 0x00, 0x0C, 0x9D, 0x11, 0x00, 0x0F, 0xD0, 0x11, 0x00, 0x15, 0xE4, 0x11,
+    0x00, 0x42, 0x06, 0x8A, 0x11, 0x00, 0x10, 0x3F, 0x01, 0x00, 0x0B, 0x04, 0x0C, 0x0B, 0x04, 0x08,
+    0x15, 0x89, 0x65, 0x61, 0x63, 0x68, 0x61, 0x69, 0x68, 0x61, 0x65, 0x72, 0x00, 0x44, 0x04, 0xAE,
+    0x11, 0x00, 0x11, 0x0C, 0x0D, 0x00, 0x16, 0xBD, 0x11, 0x00, 0x18, 0x6B, 0x06, 0x00, 0x19, 0x0C,
+    0x17, 0x0C, 0x12, 0x11, 0x86, 0x76, 0x61, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0B, 0x42, 0x04,
+    0xC7, 0x11, 0x00, 0x18, 0x88, 0x01, 0x00, 0x0C, 0x0A, 0x15, 0x08, 0x41, 0x04, 0xDE, 0x0D, 0x00,
+    0x08, 0x0B, 0x16, 0x12, 0x18, 0x11, 0x08, 0x16, 0x16, 0x2C, 0x88, 0x73, 0x68, 0x6F, 0x75, 0x6E,
+    0x65, 0x73, 0x73, 0x00, 0x12, 0x18, 0x16, 0x41, 0x0B, 0x5C, 0x01, 0x00, 0x48, 0x04, 0x0D, 0x12,
+    0x00, 0x07, 0x73, 0x12, 0x00, 0x0B, 0x82, 0x12, 0x00, 0x12, 0x94, 0x12, 0x00, 0x15, 0xA6, 0x12,
+    0x00, 0x16, 0xCE, 0x12, 0x00, 0x17, 0xC1, 0x05, 0x00, 0x19, 0xDF, 0x12, 0x00, 0x46, 0x04, 0x26,
+    0x12, 0x00, 0x06, 0x37, 0x12, 0x00, 0x0A, 0x46, 0x12, 0x00, 0x0F, 0x58, 0x12, 0x00, 0x13, 0x5E,
+    0x12, 0x00, 0x16, 0x6E, 0x12, 0x00, 0x42, 0x05, 0xFE, 0x00, 0x00, 0x17, 0x2F, 0x12, 0x00, 0x0F,
+    0x1C, 0x83, 0x74, 0x61, 0x6C, 0x79, 0x00, 0x0B, 0x18, 0x06, 0x18, 0x0B, 0x0C, 0x11, 0x0A, 0x84,
+    0x68, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x04, 0x15, 0x0C, 0x0A, 0x15, 0x18, 0x08, 0x07, 0x87, 0x72,
+    0x61, 0x69, 0x67, 0x72, 0x75, 0x65, 0x64, 0x00, 0x0C, 0x41, 0x09, 0x45, 0x09, 0x00, 0x12, 0x0F,
+    0x18, 0x10, 0x08, 0x11, 0x17, 0x86, 0x6C, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x41, 0x0B,
+    0x46, 0x09, 0x00, 0x0C, 0x42, 0x10, 0x06, 0x06, 0x00, 0x17, 0x7D, 0x12, 0x00, 0x41, 0x04, 0x17,
+    0x04, 0x00, 0x0C, 0x04, 0x06, 0x12, 0x18, 0x0C, 0x19, 0x08, 0x87, 0x61, 0x69, 0x63, 0x6F, 0x75,
+    0x69, 0x76, 0x65, 0x00, 0x10, 0x18, 0x09, 0x04, 0x12, 0x18, 0x16, 0x2C, 0x88, 0x6D, 0x6F, 0x75,
+    0x66, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x0A, 0xAF, 0x12, 0x00, 0x0C, 0xC7, 0x12, 0x00, 0x08,
+    0x04, 0x16, 0x17, 0x04, 0x0C, 0x17, 0x0C, 0x12, 0x11, 0x8B, 0x67, 0x72, 0x65, 0x61, 0x73, 0x74,
+    0x61, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x09, 0x04, 0x41, 0x0C, 0x47, 0x09, 0x00, 0x04, 0x0B,
+    0x08, 0x11, 0x08, 0x16, 0x16, 0x87, 0x61, 0x73, 0x68, 0x65, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x04,
+    0x41, 0x0C, 0x4C, 0x04, 0x00, 0x46, 0x04, 0xFE, 0x12, 0x00, 0x0A, 0x06, 0x13, 0x00, 0x11, 0x0C,
+    0x0D, 0x00, 0x12, 0x17, 0x13, 0x00, 0x16, 0x1F, 0x13, 0x00, 0x17, 0x3A, 0x13, 0x00, 0x11, 0x0A,
+    0x83, 0x61, 0x69, 0x6E, 0x67, 0x00, 0x15, 0x12, 0x17, 0x04, 0x0B, 0x11, 0x08, 0x16, 0x16, 0x85,
+    0x68, 0x61, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x19, 0x08, 0x83, 0x6F, 0x69, 0x76, 0x65, 0x00, 0x42,
+    0x08, 0x28, 0x13, 0x00, 0x0C, 0x2D, 0x13, 0x00, 0x41, 0x1C, 0x2C, 0x02, 0x00, 0x17, 0x04, 0x05,
+    0x0F, 0x08, 0x85, 0x74, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0B, 0x08, 0x12, 0x05, 0x18, 0x10,
+    0x08, 0x11, 0x17, 0x86, 0x62, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x12, 0x08, 0x0C, 0x19,
+    0x08, 0x85, 0x6F, 0x6D, 0x65, 0x69, 0x76, 0x65, 0x00, 0x04, 0x12, 0x12, 0x18, 0x16, 0x2C, 0x86,
+    0x61, 0x6E, 0x6F, 0x6F, 0x75, 0x73, 0x00, 0x46, 0x04, 0x80, 0x13, 0x00, 0x08, 0x9F, 0x13, 0x00,
+    0x0A, 0xA8, 0x13, 0x00, 0x0F, 0xB2, 0x13, 0x00, 0x16, 0xCA, 0x13, 0x00, 0x18, 0xE3, 0x13, 0x00,
+    0x09, 0x42, 0x12, 0x8A, 0x13, 0x00, 0x17, 0x94, 0x13, 0x00, 0x18, 0x16, 0x2C, 0x85, 0x66, 0x61,
+    0x6F, 0x75, 0x73, 0x00, 0x0C, 0x12, 0x11, 0x85, 0x66, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42,
+    0x10, 0x73, 0x06, 0x00, 0x18, 0x9B, 0x01, 0x00, 0x15, 0x42, 0x0C, 0x8F, 0x06, 0x00, 0x18, 0x47,
+    0x09, 0x00, 0x18, 0x42, 0x12, 0xBC, 0x13, 0x00, 0x1C, 0xC5, 0x13, 0x00, 0x08, 0x07, 0x84, 0x75,
+    0x6C, 0x6F, 0x65, 0x64, 0x00, 0x82, 0x75, 0x6C, 0x79, 0x00, 0x0B, 0x42, 0x04, 0x39, 0x04, 0x00,
+    0x17, 0xD4, 0x13, 0x00, 0x18, 0x12, 0x18, 0x12, 0x18, 0x16, 0x86, 0x75, 0x74, 0x6F, 0x75, 0x6F,
+    0x75, 0x73, 0x00, 0x44, 0x0C, 0x1E, 0x05, 0x00, 0x13, 0xAF, 0x0E, 0x00, 0x15, 0xF4, 0x13, 0x00,
+    0x17, 0x03, 0x14, 0x00, 0x0A, 0x18, 0x10, 0x08, 0x11, 0x17, 0x86, 0x67, 0x72, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x00, 0x16, 0x12, 0x18, 0x07, 0x08, 0x04, 0x0F, 0x1C, 0x88, 0x73, 0x74, 0x6F, 0x75,
+    0x64, 0x65, 0x61, 0x6C, 0x79, 0x00, 0x08, 0x12, 0x12, 0x18, 0x16, 0x85, 0x65, 0x70, 0x6F, 0x6F,
+    0x75, 0x73, 0x00, 0x08, 0x15, 0x08, 0x08, 0x15, 0x85, 0x65, 0x74, 0x72, 0x65, 0x65, 0x72, 0x00,
+    0x45, 0x0A, 0x45, 0x14, 0x00, 0x12, 0x89, 0x01, 0x00, 0x13, 0x4C, 0x14, 0x00, 0x16, 0x87, 0x01,
+    0x00, 0x17, 0x5A, 0x14, 0x00, 0x18, 0x12, 0x41, 0x12, 0x1B, 0x10, 0x00, 0x18, 0x0F, 0x04, 0x05,
+    0x0F, 0x08, 0x85, 0x6C, 0x75, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x42, 0x08, 0x63, 0x14, 0x00, 0x0B,
+    0x72, 0x14, 0x00, 0x12, 0x1A, 0x10, 0x08, 0x11, 0x17, 0x2C, 0x86, 0x77, 0x6F, 0x6D, 0x65, 0x6E,
+    0x74, 0x00, 0x04, 0x41, 0x0C, 0x05, 0x08, 0x00, 0x06, 0x43, 0x04, 0x86, 0x14, 0x00, 0x08, 0xEC,
+    0x14, 0x00, 0x0C, 0xF5, 0x14, 0x00, 0x44, 0x06, 0x97, 0x14, 0x00, 0x0C, 0xA9, 0x14, 0x00, 0x0F,
+    0xD4, 0x14, 0x00, 0x17, 0xDC, 0x14, 0x00, 0x04, 0x0C, 0x10, 0x08, 0x11, 0x17, 0x89, 0x63, 0x68,
+    0x61, 0x63, 0x61, 0x69, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x0B, 0xB2, 0x14, 0x00, 0x0F, 0xCB,
+    0x14, 0x00, 0x12, 0x18, 0x13, 0x04, 0x0C, 0x17, 0x0C, 0x12, 0x11, 0x8D, 0x63, 0x68, 0x61, 0x69,
+    0x68, 0x6F, 0x75, 0x70, 0x61, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x1C, 0x85, 0x63, 0x68, 0x61,
+    0x69, 0x6C, 0x79, 0x00, 0x1C, 0x84, 0x63, 0x68, 0x61, 0x6C, 0x79, 0x00, 0x0C, 0x10, 0x08, 0x11,
+    0x17, 0x88, 0x63, 0x68, 0x61, 0x74, 0x69, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0F, 0x1C, 0x84, 0x63,
+    0x68, 0x65, 0x6C, 0x79, 0x00, 0x08, 0x15, 0x84, 0x63, 0x68, 0x69, 0x65, 0x72, 0x00, 0x43, 0x05,
+    0x0B, 0x15, 0x00, 0x06, 0x1D, 0x15, 0x00, 0x09, 0x27, 0x15, 0x00, 0x0A, 0x15, 0x08, 0x11, 0x08,
+    0x16, 0x16, 0x88, 0x62, 0x69, 0x67, 0x72, 0x65, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x12, 0x18, 0x16,
+    0x84, 0x63, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x05, 0x18, 0x15, 0x12, 0x0C, 0x19, 0x08, 0x88, 0x66,
+    0x69, 0x62, 0x75, 0x72, 0x6F, 0x69, 0x76, 0x65, 0x00, 0x44, 0x05, 0x4A, 0x15, 0x00, 0x06, 0x9D,
+    0x15, 0x00, 0x07, 0xF0, 0x15, 0x00, 0x09, 0x02, 0x16, 0x00, 0x42, 0x13, 0x53, 0x15, 0x00, 0x18,
+    0x5E, 0x15, 0x00, 0x08, 0x08, 0x07, 0x85, 0x62, 0x6F, 0x70, 0x65, 0x65, 0x64, 0x00, 0x44, 0x0A,
+    0x6F, 0x15, 0x00, 0x0C, 0x7F, 0x15, 0x00, 0x0F, 0x89, 0x15, 0x00, 0x17, 0x91, 0x15, 0x00, 0x12,
+    0x17, 0x0C, 0x0F, 0x1C, 0x88, 0x62, 0x6F, 0x75, 0x67, 0x6F, 0x74, 0x69, 0x6C, 0x79, 0x00, 0x11,
+    0x0A, 0x85, 0x62, 0x6F, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x1C, 0x84, 0x62, 0x6F, 0x75, 0x6C, 0x79,
+    0x00, 0x08, 0x08, 0x07, 0x86, 0x62, 0x6F, 0x75, 0x74, 0x65, 0x65, 0x64, 0x00, 0x42, 0x11, 0xA6,
+    0x15, 0x00, 0x18, 0xB3, 0x15, 0x00, 0x04, 0x0C, 0x19, 0x08, 0x86, 0x63, 0x6F, 0x6E, 0x61, 0x69,
+    0x76, 0x65, 0x00, 0x44, 0x07, 0xC4, 0x15, 0x00, 0x08, 0xD0, 0x15, 0x00, 0x12, 0xD8, 0x15, 0x00,
+    0x17, 0xE3, 0x15, 0x00, 0x04, 0x08, 0x07, 0x86, 0x63, 0x6F, 0x75, 0x64, 0x61, 0x65, 0x64, 0x00,
+    0x07, 0x84, 0x63, 0x6F, 0x75, 0x65, 0x64, 0x00, 0x18, 0x16, 0x2C, 0x86, 0x63, 0x6F, 0x75, 0x6F,
+    0x75, 0x73, 0x00, 0x0C, 0x12, 0x11, 0x2C, 0x87, 0x63, 0x6F, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00,
+    0x18, 0x16, 0x0B, 0x12, 0x0C, 0x11, 0x0A, 0x88, 0x64, 0x6F, 0x75, 0x73, 0x68, 0x6F, 0x69, 0x6E,
+    0x67, 0x00, 0x17, 0x0B, 0x04, 0x10, 0x08, 0x11, 0x17, 0x88, 0x66, 0x6F, 0x74, 0x68, 0x61, 0x6D,
+    0x65, 0x6E, 0x74, 0x00, 0x44, 0x05, 0x25, 0x16, 0x00, 0x06, 0x3A, 0x16, 0x00, 0x07, 0x4A, 0x16,
+    0x00, 0x09, 0x7C, 0x16, 0x00, 0x15, 0x12, 0x18, 0x17, 0x04, 0x0C, 0x08, 0x07, 0x2C, 0x8A, 0x62,
+    0x75, 0x72, 0x6F, 0x75, 0x74, 0x61, 0x69, 0x65, 0x64, 0x00, 0x05, 0x04, 0x10, 0x08, 0x11, 0x17,
+    0x87, 0x63, 0x75, 0x62, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x43, 0x04, 0x57, 0x16, 0x00, 0x0B,
+    0x62, 0x16, 0x00, 0x17, 0x71, 0x16, 0x00, 0x05, 0x0F, 0x08, 0x85, 0x64, 0x75, 0x61, 0x62, 0x6C,
+    0x65, 0x00, 0x18, 0x10, 0x08, 0x11, 0x17, 0x87, 0x64, 0x75, 0x68, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x00, 0x0C, 0x12, 0x11, 0x85, 0x64, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x43, 0x06, 0x89, 0x16,
+    0x00, 0x0C, 0x9A, 0x16, 0x00, 0x16, 0xA4, 0x16, 0x00, 0x0B, 0x12, 0x10, 0x08, 0x11, 0x17, 0x88,
+    0x66, 0x75, 0x63, 0x68, 0x6F, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x19, 0x08, 0x2C, 0x85, 0x66, 0x75,
+    0x69, 0x76, 0x65, 0x00, 0x17, 0x0C, 0x05, 0x0C, 0x08, 0x07, 0x88, 0x66, 0x75, 0x73, 0x74, 0x69,
+    0x62, 0x69, 0x65, 0x64, 0x00, 0x49, 0x04, 0xDA, 0x16, 0x00, 0x05, 0xEB, 0x16, 0x00, 0x06, 0xAD,
+    0x17, 0x00, 0x07, 0xA1, 0x18, 0x00, 0x09, 0x6E, 0x19, 0x00, 0x0B, 0x04, 0x1A, 0x00, 0x0C, 0x11,
+    0x1A, 0x00, 0x12, 0x28, 0x1A, 0x00, 0x18, 0x39, 0x1A, 0x00, 0x07, 0x06, 0x18, 0x0B, 0x18, 0x08,
+    0x07, 0x87, 0x64, 0x61, 0x63, 0x75, 0x68, 0x75, 0x65, 0x64, 0x00, 0x48, 0x04, 0x0C, 0x17, 0x00,
+    0x08, 0x2B, 0x17, 0x00, 0x09, 0x50, 0x17, 0x00, 0x0C, 0x5D, 0x17, 0x00, 0x12, 0x67, 0x17, 0x00,
+    0x17, 0x83, 0x17, 0x00, 0x18, 0x05, 0x08, 0x00, 0x1A, 0x9A, 0x17, 0x00, 0x43, 0x0C, 0x19, 0x17,
+    0x00, 0x13, 0x43, 0x03, 0x00, 0x16, 0x1E, 0x17, 0x00, 0x41, 0x16, 0x04, 0x08, 0x00, 0x17, 0x05,
+    0x18, 0x08, 0x08, 0x15, 0x84, 0x75, 0x62, 0x65, 0x65, 0x72, 0x00, 0x43, 0x04, 0x38, 0x17, 0x00,
+    0x09, 0x3F, 0x17, 0x00, 0x17, 0x4B, 0x17, 0x00, 0x19, 0x12, 0x41, 0x18, 0x91, 0x03, 0x00, 0x17,
+    0x0C, 0x0C, 0x12, 0x11, 0x84, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x41, 0x0B, 0x92, 0x08, 0x00,
+    0x18, 0x08, 0x0C, 0x19, 0x08, 0x85, 0x75, 0x66, 0x65, 0x69, 0x76, 0x65, 0x00, 0x19, 0x04, 0x0C,
+    0x1A, 0x08, 0x41, 0x04, 0x05, 0x08, 0x00, 0x43, 0x0C, 0x74, 0x17, 0x00, 0x17, 0x90, 0x06, 0x00,
+    0x18, 0xBF, 0x03, 0x00, 0x0A, 0x06, 0x04, 0x0C, 0x11, 0x0A, 0x86, 0x67, 0x69, 0x63, 0x61, 0x69,
+    0x6E, 0x67, 0x00, 0x0C, 0x15, 0x04, 0x17, 0x15, 0x12, 0x17, 0x0C, 0x12, 0x11, 0x8A, 0x69, 0x74,
+    0x72, 0x61, 0x74, 0x72, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x18, 0x13, 0x0F, 0x18, 0x0C,
+    0x19, 0x08, 0x88, 0x69, 0x77, 0x75, 0x70, 0x6C, 0x75, 0x69, 0x76, 0x65, 0x00, 0x46, 0x04, 0xC6,
+    0x17, 0x00, 0x08, 0xBF, 0x03, 0x00, 0x0B, 0xF8, 0x17, 0x00, 0x12, 0x5A, 0x18, 0x00, 0x18, 0x7E,
+    0x18, 0x00, 0x1A, 0x92, 0x18, 0x00, 0x08, 0x43, 0x0C, 0x45, 0x03, 0x00, 0x11, 0xD4, 0x17, 0x00,
+    0x17, 0xE3, 0x17, 0x00, 0x08, 0x04, 0x0C, 0x19, 0x08, 0x87, 0x65, 0x61, 0x6E, 0x65, 0x61, 0x69,
+    0x76, 0x65, 0x00, 0x04, 0x15, 0x04, 0x0C, 0x10, 0x08, 0x11, 0x17, 0x8A, 0x65, 0x61, 0x74, 0x61,
+    0x72, 0x61, 0x69, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x44, 0x04, 0x09, 0x18, 0x00, 0x08, 0x0E, 0x18,
+    0x00, 0x17, 0x23, 0x18, 0x00, 0x18, 0x3A, 0x18, 0x00, 0x41, 0x0C, 0x0B, 0x0D, 0x00, 0x04, 0x42,
+    0x10, 0x18, 0x18, 0x00, 0x19, 0x1D, 0x18, 0x00, 0x41, 0x18, 0x8F, 0x06, 0x00, 0x12, 0x41, 0x18,
+    0x23, 0x09, 0x00, 0x12, 0x42, 0x08, 0x2D, 0x18, 0x00, 0x0C, 0x98, 0x0A, 0x00, 0x04, 0x12, 0x18,
+    0x16, 0x86, 0x6F, 0x74, 0x65, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x11, 0x43, 0x18, 0x00, 0x12,
+    0x4A, 0x18, 0x00, 0x04, 0x0C, 0x41, 0x09, 0x8F, 0x03, 0x00, 0x0A, 0x0C, 0x17, 0x0C, 0x12, 0x11,
+    0x87, 0x6F, 0x75, 0x67, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x10, 0x63, 0x18, 0x00, 0x17,
+    0x69, 0x18, 0x00, 0x0C, 0x41, 0x1A, 0x17, 0x04, 0x00, 0x16, 0x04, 0x06, 0x0B, 0x18, 0x10, 0x08,
+    0x11, 0x17, 0x89, 0x73, 0x74, 0x61, 0x63, 0x68, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x06,
+    0x87, 0x18, 0x00, 0x11, 0x0C, 0x0D, 0x00, 0x08, 0x12, 0x04, 0x18, 0x16, 0x83, 0x61, 0x6F, 0x75,
+    0x73, 0x00, 0x0C, 0x0C, 0x17, 0x0C, 0x12, 0x11, 0x86, 0x69, 0x77, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x46, 0x04, 0xBA, 0x18, 0x00, 0x08, 0xD5, 0x18, 0x00, 0x0C, 0x1B, 0x19, 0x00, 0x12, 0x38,
+    0x19, 0x00, 0x15, 0x61, 0x19, 0x00, 0x18, 0xBC, 0x05, 0x00, 0x43, 0x06, 0xC7, 0x18, 0x00, 0x08,
+    0x44, 0x03, 0x00, 0x11, 0x0C, 0x0D, 0x00, 0x04, 0x08, 0x09, 0x0C, 0x08, 0x15, 0x85, 0x65, 0x61,
+    0x66, 0x69, 0x65, 0x72, 0x00, 0x44, 0x04, 0xE6, 0x18, 0x00, 0x0A, 0xF8, 0x18, 0x00, 0x0F, 0xFF,
+    0x18, 0x00, 0x16, 0x14, 0x19, 0x00, 0x15, 0x12, 0x04, 0x0A, 0x0C, 0x11, 0x08, 0x16, 0x16, 0x86,
+    0x67, 0x61, 0x69, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x15, 0x0C, 0x41, 0x04, 0xFE, 0x12, 0x00, 0x42,
+    0x04, 0x18, 0x04, 0x00, 0x13, 0x08, 0x19, 0x00, 0x12, 0x18, 0x08, 0x15, 0x85, 0x70, 0x6C, 0x6F,
+    0x75, 0x65, 0x72, 0x00, 0x0B, 0x08, 0x41, 0x04, 0x47, 0x09, 0x00, 0x42, 0x06, 0x24, 0x19, 0x00,
+    0x0A, 0x33, 0x19, 0x00, 0x12, 0x06, 0x18, 0x04, 0x0C, 0x11, 0x0A, 0x85, 0x75, 0x63, 0x61, 0x69,
+    0x6E, 0x67, 0x00, 0x41, 0x08, 0x4C, 0x04, 0x00, 0x42, 0x13, 0x41, 0x19, 0x00, 0x18, 0x52, 0x19,
+    0x00, 0x0F, 0x0C, 0x04, 0x17, 0x15, 0x0C, 0x08, 0x15, 0x86, 0x61, 0x69, 0x74, 0x72, 0x69, 0x65,
+    0x72, 0x00, 0x11, 0x04, 0x09, 0x17, 0x18, 0x0C, 0x12, 0x11, 0x84, 0x75, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x12, 0x08, 0x04, 0x0F, 0x1C, 0x85, 0x6F, 0x72, 0x65, 0x61, 0x6C, 0x79, 0x00, 0x45, 0x08,
+    0x88, 0x18, 0x00, 0x0B, 0x83, 0x19, 0x00, 0x0C, 0x8E, 0x19, 0x00, 0x12, 0xBA, 0x19, 0x00, 0x18,
+    0xF1, 0x19, 0x00, 0x04, 0x08, 0x0F, 0x1C, 0x84, 0x61, 0x68, 0x65, 0x6C, 0x79, 0x00, 0x42, 0x04,
+    0x97, 0x19, 0x00, 0x16, 0xA7, 0x19, 0x00, 0x0F, 0x04, 0x17, 0x0C, 0x12, 0x11, 0x87, 0x61, 0x69,
+    0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x17, 0x07, 0x18, 0x12, 0x18, 0x10, 0x08, 0x11, 0x17,
+    0x87, 0x75, 0x64, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x43, 0x0F, 0xC7, 0x19, 0x00, 0x13,
+    0xD7, 0x19, 0x00, 0x18, 0xE3, 0x19, 0x00, 0x10, 0x18, 0x12, 0x10, 0x08, 0x11, 0x17, 0x86, 0x75,
+    0x6D, 0x6F, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0F, 0x12, 0x0C, 0x18, 0x19, 0x08, 0x83, 0x75, 0x69,
+    0x76, 0x65, 0x00, 0x08, 0x15, 0x11, 0x08, 0x08, 0x07, 0x85, 0x72, 0x65, 0x6E, 0x65, 0x65, 0x64,
+    0x00, 0x42, 0x08, 0x72, 0x06, 0x00, 0x12, 0xFA, 0x19, 0x00, 0x0C, 0x11, 0x0A, 0x84, 0x6F, 0x75,
+    0x69, 0x6E, 0x67, 0x00, 0x06, 0x0C, 0x12, 0x18, 0x16, 0x85, 0x63, 0x68, 0x69, 0x6F, 0x75, 0x73,
+    0x00, 0x05, 0x16, 0x04, 0x0A, 0x15, 0x12, 0x17, 0x0C, 0x12, 0x11, 0x8A, 0x62, 0x69, 0x73, 0x61,
+    0x67, 0x72, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x09, 0x18, 0x10, 0x08, 0x04, 0x08, 0x07, 0x87,
+    0x66, 0x6F, 0x75, 0x6D, 0x65, 0x61, 0x65, 0x64, 0x00, 0x06, 0x17, 0x18, 0x0A, 0x18, 0x0C, 0x11,
+    0x0A, 0x88, 0x63, 0x75, 0x74, 0x75, 0x67, 0x75, 0x69, 0x6E, 0x67, 0x00
+};
@@ -0,0 +1,873 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (400 entries):
+//   baabel          -> baable
+//   babaiiton:      -> babaition
+//   bachoowing      -> bachowoing
+//   badaely:        -> badealy
+//   bafabuoment     -> bafaboument
+//   bgaeaous:       -> bageaous
+//   baogument       -> bagoument
+//   bgarolument     -> bagrolument
+//   bahevetaion     -> baheveation
+//   abipleness      -> baipleness
+//   baisdeoing      -> baisedoing
+//   :baisoign       -> baisoing
+//   baithavuoness   -> baithavouness
+//   baiwaitoeur     -> baiwaitouer
+//   baeltion        -> baletion
+//   :bapeid         -> bapied
+//   bashaeed        -> basheaed
+//   :bastbueer      -> bastubeer
+//   barteaplaing    -> batreaplaing
+//   ebachoed        -> beachoed
+//   beagroduaer     -> beagroudaer
+//   beayl           -> bealy
+//   baement         -> beament
+//   ebaness:        -> beaness
+//   beasoesaness    -> beasoseaness
+//   ebatheaing      -> beatheaing
+//   beaiton         -> beation
+//   beatitraiabel:  -> beatitraiable
+//   :beavounses     -> beavouness
+//   bedarieaed      -> bedaireaed
+//   :beftiion       -> befition
+//   beiged          -> begied
+//   bgeoed          -> begoed
+//   bieve           -> beive
+//   :bethaible      -> bethiable
+//   bevoudouus:     -> bevouduous
+//   biabifily       -> bibaifily
+//   ibgreness       -> bigreness
+//   binaethouing    -> bineathouing
+//   :ibsagrotion    -> bisagrotion
+//   :btiratrotion   -> bitratrotion
+//   :bivaiweaign    -> bivaiweaing
+//   :bwiupluive     -> biwupluive
+//   :boigcaing      -> bogicaing
+//   bohivie         -> bohiive
+//   bmoent:         -> boment
+//   bonses          -> boness
+//   bouos:          -> boous
+//   obpeed          -> bopeed
+//   bosanses:       -> bosaness
+//   bothuifment     -> bothufiment
+//   :botino         -> botion
+//   botreid         -> botried
+//   buoer           -> bouer
+//   bofueed         -> boufeed
+//   bougolaeable    -> bougoleaable
+//   obugotily       -> bougotily
+//   obuing          -> bouing
+//   boluoness       -> bouloness
+//   obuly           -> bouly
+//   boumagroutoin:  -> boumagroution
+//   :bouuos         -> bouous
+//   boupleanses     -> boupleaness
+//   bousatreuos     -> bousatreous
+//   bouseasotable   -> bouseastoable
+//   boushaitiher    -> boushaithier
+//   bousatiploued   -> boustaiploued
+//   obuteed         -> bouteed
+//   boutoumive      -> boutomuive
+//   bouwonuaer      -> bouwounaer
+//   :bfueive        -> bufeive
+//   bufide          -> bufied
+//   bugaiemtion     -> bugaimetion
+//   :buign          -> buing
+//   bumnet          -> bument
+//   bunenoalbe      -> bunenoable
+//   ubroutaied:     -> buroutaied
+//   bushuiton       -> bushution
+//   cacuoment       -> cacoument
+//   cagaiiev        -> cagaiive
+//   cagouiton       -> cagoution
+//   cagustuoness    -> cagustouness
+//   acibotion       -> caibotion
+//   :caeid          -> caied
+//   caeir:          -> caier
+//   cagiraition     -> caigraition
+//   cainig          -> caiing
+//   caiiev:         -> caiive
+//   canieshuable    -> caineshuable
+//   cainomuent      -> cainoument
+//   cairemnet       -> cairement
+//   casiaive        -> caisaive
+//   caitoin         -> caition
+//   caiiwly         -> caiwily
+//   acness          -> caness
+//   caeraable       -> careaable
+//   acrouly         -> carouly
+//   castioruive     -> castirouive
+//   cavavumetn      -> cavavument
+//   caeer           -> ceaer
+//   cemaent         -> ceament
+//   :caeneaive      -> ceaneaive
+//   ceauos:         -> ceaous
+//   ceaplbuious     -> ceaplubious
+//   caesapiable     -> ceasapiable
+//   caestipeous     -> ceastipeous
+//   :caetaraiment   -> ceataraiment
+//   ceatohness      -> ceathoness
+//   caetreable:     -> ceatreable
+//   cebuemnt        -> cebument
+//   ceaciness       -> cecainess
+//   cegorous        -> cegroous
+//   cegutino        -> cegution
+//   cneess          -> ceness
+//   :ceuos          -> ceous
+//   ctehachouous    -> cethachouous
+//   cehteed         -> cetheed
+//   ection          -> cetion
+//   cahbaiable      -> chabaiable
+//   hcacaiment      -> chacaiment
+//   caher           -> chaer
+//   chaibale        -> chaiable
+//   chiadoution     -> chaidoution
+//   hcaihoupaition  -> chaihoupaition
+//   :chainig        -> chaiing
+//   hcaily          -> chaily
+//   chaipeadiaer    -> chaipeadaier
+//   chapiohaer      -> chaipohaer
+//   chaihtoly       -> chaitholy
+//   chiathucution:  -> chaithucution
+//   chaitretaion    -> chaitreation
+//   chiave          -> chaive
+//   hcaly           -> chaly
+//   chamalonig:     -> chamaloing
+//   chametn:        -> chament
+//   hcatiment       -> chatiment
+//   chatoulpaous    -> chatouplaous
+//   cahtrouvoable   -> chatrouvoable
+//   cheahceatriness -> cheacheatriness
+//   chealainses     -> chealainess
+//   :cheamutino     -> cheamution
+//   chenaeament     -> cheaneament
+//   cheashiaive     -> cheashaiive
+//   cheashweeous    -> cheasheweous
+//   :cheavoubale    -> cheavouable
+//   chebonoign      -> chebonoing
+//   cheiev          -> cheive
+//   hcely           -> chely
+//   cehmaivaied     -> chemaivaied
+//   chmeent         -> chement
+//   cheplacheauos   -> cheplacheaous
+//   cehrihation     -> cherihation
+//   chevamnet       -> chevament
+//   chbiugeaing     -> chibugeaing
+//   chichoius       -> chichious
+//   chicougaaible   -> chicougaiable
+//   hcier           -> chier
+//   cihmuness:      -> chimuness
+//   chienly:        -> chinely
+//   :hcious         -> chious
+//   chithiaer:      -> chithaier
+//   cihtion         -> chition
+//   chiveafoualbe   -> chiveafouable
+//   chivoius:       -> chivious
+//   chode           -> choed
+//   choenness       -> choneness
+//   chostitribale   -> chostitriable
+//   :chtoeaous      -> choteaous
+//   :chtoion        -> chotion
+//   chuoed          -> choued
+//   chuogipoable    -> chougipoable
+//   :chuogition     -> chougition
+//   chonuimeable    -> chounimeable
+//   cohuous:        -> chouous
+//   chuopousuing    -> choupousuing
+//   chouiton        -> choution
+//   chouvatroure    -> chouvatrouer
+//   chouavvaly      -> chouvavaly
+//   chowasatiing    -> chowastaiing
+//   chuabel:        -> chuable
+//   chuchialbe      -> chuchiable
+//   cuhed           -> chued
+//   cheur           -> chuer
+//   :chunaifeanses  -> chunaifeaness
+//   chnuess         -> chuness
+//   chuintion       -> chunition
+//   chupimnet       -> chupiment
+//   cuhtheing       -> chutheing
+//   chuthiiev       -> chuthiive
+//   chtuion:        -> chution
+//   cbiuing         -> cibuing
+//   cinig           -> ciing
+//   cinses          -> ciness
+//   icous           -> cious
+//   ciplaoble       -> ciploable
+//   cistaithiament: -> cistaithaiment
+//   cithaiogive     -> cithaigoive
+//   :cwiition       -> ciwition
+//   cocahhument     -> cochahument
+//   cofore          -> cofoer
+//   coftoion        -> cofotion
+//   cogratsuing     -> cograstuing
+//   :comiwide       -> comiwied
+//   comolpoive      -> comoploive
+//   ocnaive         -> conaive
+//   couos           -> coous
+//   coplutering     -> coplutreing
+//   :cotsachument   -> costachument
+//   ctoion:         -> cotion
+//   cotrowaaible    -> cotrowaiable
+//   ocudaed         -> coudaed
+//   ocued           -> coued
+//   cougahteaous    -> cougatheaous
+//   ocuous:         -> couous
+//   copuliing:      -> coupliing
+//   ocution:        -> coution
+//   covouanous      -> covounaous
+//   cwoaied         -> cowaied
+//   ucbament        -> cubament
+//   :cuceoaus       -> cuceaous
+//   cucetsouness    -> cucestouness
+//   cucohnouer      -> cuchonouer
+//   cucuhly:        -> cuchuly
+//   cugoteir        -> cugotier
+//   :cunig          -> cuing
+//   cuvie           -> cuive
+//   cuelatoed:      -> culeatoed
+//   cuuos           -> cuous
+//   curauos         -> curaous
+//   custishnaess    -> custishaness
+//   cusotness       -> custoness
+//   :uctuguing      -> cutuguing
+//   daalbe          -> daable
+//   :dacaefier      -> daceafier
+//   :adcuhued       -> dacuhued
+//   daibale:        -> daiable
+//   :daeid          -> daied
+//   diament         -> daiment
+//   daianilaier     -> dainailaier
+//   dianess         -> dainess
+//   :danig          -> daing
+//   adistaiive      -> daistaiive
+//   daistaeer       -> daisteaer
+//   diave           -> daive
+//   daivigraetion:  -> daivigreation
+//   dastievaly      -> dastivealy
+//   dsatouhaable    -> dastouhaable
+//   dasuudment      -> dasudument
+//   dtaion          -> dation
+//   dartiweing      -> datriweing
+//   datupounig      -> datupouing
+//   edaable         -> deaable
+//   daeble          -> deable
+//   dedairiing      -> deadiriing
+//   daeer           -> deaer
+//   daegreable      -> deagreable
+//   deaign          -> deaing
+//   daeness         -> deaness
+//   deaappleaous    -> deapapleaous
+//   :dearoaginess   -> dearogainess
+//   deaatily        -> deataily
+//   deatino         -> deation
+//   deatrcioument   -> deatricoument
+//   deaweid         -> deawied
+//   dediafament     -> dedaifament
+//   dedegravie      -> dedegraive
+//   deudness        -> deduness
+//   :degriang       -> degraing
+//   degurness       -> degruness
+//   :delade         -> delaed
+//   delpeed         -> depleed
+//   :delpouer       -> deplouer
+//   :desheare       -> desheaer
+//   desheplaitoin   -> desheplaition
+//   edthuness       -> dethuness
+//   edveshaiment    -> deveshaiment
+//   dcioment        -> dicoment
+//   :dicocuaing     -> dicoucaing
+//   didodimnet:     -> didodiment
+//   :digeiton       -> digetion
+//   diemnt          -> diment
+//   diplgeeaous     -> diplegeaous
+//   dipliung        -> dipluing
+//   diaripouly      -> diraipouly
+//   disheaalbe      -> disheaable
+//   dihtagament:    -> dithagament
+//   dithibaiiev     -> dithibaiive
+//   dtihihouive     -> dithihouive
+//   dviagraly       -> divagraly
+//   diavious        -> divaious
+//   diwoumetn:      -> diwoument
+//   dohcemeer       -> dochemeer
+//   docuoive        -> docouive
+//   dofutruuos:     -> dofutruous
+//   dloogaier       -> dologaier
+//   :dopliatrier    -> doplaitrier
+//   :droealy        -> dorealy
+//   douboign:       -> douboing
+//   douuftheaable   -> doufutheaable
+//   doiung          -> douing
+//   doulatorable    -> doulatroable
+//   doumanses:      -> doumaness
+//   :dounaftuion    -> dounafution
+//   dounesonses:    -> dounesoness
+//   duonouness      -> dounouness
+//   duoous          -> douous
+//   doupiahious:    -> doupaihious
+//   duopluness      -> doupluness
+//   dopuoly         -> doupoly
+//   duopuing        -> doupuing
+//   odushoing       -> doushoing
+//   doutino         -> doution
+//   douvuoment      -> douvoument
+//   douowument      -> douwoument
+//   udable          -> duable
+//   dubeatrtiion:   -> dubeatrition
+//   ducastere       -> ducasteer
+//   dugivie         -> dugiive
+//   udhument        -> duhument
+//   dunig           -> duing
+//   duloapily:      -> dulopaily
+//   :dumnet         -> dument
+//   dnuess          -> duness
+//   udtion          -> dution
+//   :fhaely         -> fahely
+//   fainig          -> faiing
+//   :fialation      -> failation
+//   fiang           -> faing
+//   faiuos:         -> faious
+//   faishaigreatoin -> faishaigreation
+//   faishuoness     -> faishouness
+//   faiavition      -> faivaition
+//   afladainess:    -> faladainess
+//   falehsouness:   -> faleshouness
+//   fnaoous:        -> fanoous
+//   faroushetaion   -> farousheation
+//   feaabel         -> feaable
+//   faechaihaer     -> feachaihaer
+//   feachucuhing    -> feachuchuing
+//   efachued        -> feachued
+//   feagarigrued    -> feagraigrued
+//   fealifoure      -> fealifouer
+//   faement         -> feament
+//   :feoaus         -> feaous
+//   feapolument     -> feaploument
+//   fesaheness      -> feasheness
+//   feashure        -> feashuer
+//   feaatly         -> feataly
+//   fedimetn        -> fediment
+//   feditaide       -> feditaied
+//   fergeastaition  -> fegreastaition
+//   fehiacouive     -> fehaicouive
+//   efment          -> fement
+//   feomufaous:     -> femoufaous
+//   fpeoous         -> fepoous
+//   ferifaire       -> ferifaier
+//   efsheplouness   -> fesheplouness
+//   fetoin          -> fetion
+//   ftereer         -> fetreer
+//   eftrupouly      -> fetrupouly
+//   fevaiiton       -> fevaition
+//   ifburoive       -> fiburoive
+//   figrotahness    -> figrothaness
+//   finig           -> fiing
+//   fiseyl          -> fisely
+//   fisitable       -> fistiable
+//   :fistduoument   -> fistudoument
+//   fitheobument    -> fitheboument
+//   foafous:        -> fofaous
+//   foaftion        -> fofation
+//   fogritino       -> fogrition
+//   fogrure         -> fogruer
+//   fiove           -> foive
+//   :folmuoment     -> folumoment
+//   fmoeive         -> fomeive
+//   foemnt          -> foment
+//   :foploiuve      -> foplouive
+//   foshaalbe       -> foshaable
+//   foshtuouous     -> foshutouous
+//   ofthament       -> fothament
+//   foeur           -> fouer
+//   fourgument      -> fougrument
+//   :fuoing         -> fouing
+//   fouiev          -> fouive
+//   foluoed         -> fouloed
+//   foluy           -> fouly
+//   :ofumeaed       -> foumeaed
+//   fuoness         -> founess
+//   foupumetn:      -> foupument
+//   :fouerneed      -> foureneed
+//   foutsoudealy    -> foustoudealy
+//   ufchoment       -> fuchoment
+//   fuguoous        -> fugouous
+//   ufive:          -> fuive
+//   :fuemnt         -> fument
+//   fupulable       -> fupluable
+//   fusuoness       -> fusouness
+//   ufstibied       -> fustibied
+//   futeowment:     -> futewoment
+//   futhaiign       -> futhaiing
+
+#define AUTOCORRECT_MIN_LENGTH 5 // "beayl"
+#define AUTOCORRECT_MAX_LENGTH 15 // "cheahceatriness"
+#define DICTIONARY_SIZE 7001
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x6C, 0x25, 0x00, 0x07, 0xEA, 0x03, 0x08, 0xD9, 0x05, 0x0A, 0x91, 0x0A, 0x0F, 0xEA, 0x0C, 0x11,
+    0x1C, 0x0D, 0x12, 0x31, 0x10, 0x15, 0x7A, 0x10, 0x16, 0x30, 0x12, 0x17, 0xAA, 0x16, 0x19, 0xA2,
+    0x19, 0x1C, 0xE5, 0x19, 0x00, 0x47, 0x44, 0x00, 0x08, 0x71, 0x00, 0x0A, 0xA8, 0x00, 0x0F, 0xCE,
+    0x00, 0x11, 0xED, 0x00, 0x15, 0xC2, 0x01, 0x16, 0xE0, 0x01, 0x17, 0x3C, 0x03, 0x19, 0xA2, 0x03,
+    0x1C, 0xAC, 0x03, 0x00, 0x08, 0x00, 0x4C, 0x4D, 0x00, 0x12, 0x61, 0x00, 0x00, 0x04, 0x17, 0x18,
+    0x12, 0x15, 0x05, 0x18, 0x00, 0x8A, 0x62, 0x75, 0x72, 0x6F, 0x75, 0x74, 0x61, 0x69, 0x65, 0x64,
+    0x00, 0x17, 0x04, 0x0F, 0x08, 0x18, 0x06, 0x00, 0x87, 0x6C, 0x65, 0x61, 0x74, 0x6F, 0x65, 0x64,
+    0x00, 0x4F, 0x78, 0x00, 0x19, 0x9D, 0x00, 0x00, 0x44, 0x7F, 0x00, 0x05, 0x8A, 0x00, 0x00, 0x05,
+    0x0C, 0x04, 0x07, 0x00, 0x84, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x08, 0x15, 0x17, 0x08, 0x04,
+    0x06, 0x00, 0x89, 0x65, 0x61, 0x74, 0x72, 0x65, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0C, 0x09, 0x18,
+    0x00, 0x85, 0x66, 0x75, 0x69, 0x76, 0x65, 0x00, 0x4C, 0xAF, 0x00, 0x11, 0xBD, 0x00, 0x00, 0x11,
+    0x12, 0x0F, 0x04, 0x10, 0x04, 0x0B, 0x06, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x0C, 0x0F,
+    0x18, 0x13, 0x12, 0x06, 0x00, 0x87, 0x75, 0x70, 0x6C, 0x69, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x05,
+    0x04, 0x00, 0x4C, 0xD9, 0x00, 0x18, 0xE6, 0x00, 0x00, 0x04, 0x15, 0x17, 0x0C, 0x17, 0x04, 0x08,
+    0x05, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x0B, 0x06, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x4A, 0xFA, 0x00,
+    0x0C, 0x05, 0x01, 0x12, 0x16, 0x01, 0x17, 0x9A, 0x01, 0x00, 0x0C, 0x12, 0x05, 0x18, 0x12, 0x07,
+    0x00, 0x82, 0x6E, 0x67, 0x00, 0x12, 0x17, 0x18, 0x12, 0x15, 0x0A, 0x04, 0x10, 0x18, 0x12, 0x05,
+    0x00, 0x83, 0x69, 0x6F, 0x6E, 0x00, 0x4C, 0x1D, 0x01, 0x17, 0x8D, 0x01, 0x00, 0x4C, 0x2A, 0x01,
+    0x12, 0x3A, 0x01, 0x17, 0x44, 0x01, 0x18, 0x82, 0x01, 0x00, 0x17, 0x15, 0x17, 0x04, 0x08, 0x05,
+    0x18, 0x07, 0x00, 0x85, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x17, 0x06, 0x00, 0x85, 0x6F, 0x74,
+    0x69, 0x6F, 0x6E, 0x00, 0x48, 0x4B, 0x01, 0x18, 0x5C, 0x01, 0x00, 0x04, 0x15, 0x0A, 0x0C, 0x19,
+    0x0C, 0x04, 0x07, 0x00, 0x86, 0x65, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x06, 0x00, 0x52, 0x65,
+    0x01, 0x18, 0x6E, 0x01, 0x00, 0x87, 0x63, 0x6F, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0B, 0x17,
+    0x04, 0x0C, 0x0B, 0x06, 0x00, 0x8B, 0x61, 0x69, 0x74, 0x68, 0x75, 0x63, 0x75, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x17, 0x0B, 0x06, 0x00, 0x85, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x0C, 0x04,
+    0x05, 0x04, 0x05, 0x00, 0x84, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x10, 0x00, 0x44, 0xA4, 0x01,
+    0x18, 0xAB, 0x01, 0x00, 0x0B, 0x06, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x52, 0xB2, 0x01, 0x13, 0xBA,
+    0x01, 0x00, 0x1A, 0x0C, 0x07, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x18, 0x12, 0x09, 0x00, 0x82, 0x6E,
+    0x74, 0x00, 0x48, 0xC9, 0x01, 0x0C, 0xD7, 0x01, 0x00, 0x04, 0x0C, 0x0B, 0x17, 0x0C, 0x0B, 0x06,
+    0x00, 0x84, 0x61, 0x69, 0x65, 0x72, 0x00, 0x08, 0x04, 0x06, 0x00, 0x83, 0x69, 0x65, 0x72, 0x00,
+    0x48, 0xED, 0x01, 0x12, 0x1B, 0x02, 0x16, 0x4D, 0x02, 0x18, 0xA0, 0x02, 0x00, 0x16, 0x11, 0x00,
+    0x44, 0xF7, 0x01, 0x12, 0x0F, 0x02, 0x00, 0x50, 0xFE, 0x01, 0x16, 0x07, 0x02, 0x00, 0x18, 0x12,
+    0x07, 0x00, 0x83, 0x65, 0x73, 0x73, 0x00, 0x12, 0x05, 0x00, 0x83, 0x65, 0x73, 0x73, 0x00, 0x16,
+    0x08, 0x11, 0x18, 0x12, 0x07, 0x00, 0x83, 0x65, 0x73, 0x73, 0x00, 0x18, 0x00, 0x44, 0x2A, 0x02,
+    0x0C, 0x32, 0x02, 0x12, 0x3A, 0x02, 0x18, 0x41, 0x02, 0x00, 0x08, 0x06, 0x00, 0x83, 0x6F, 0x75,
+    0x73, 0x00, 0x04, 0x09, 0x00, 0x83, 0x6F, 0x75, 0x73, 0x00, 0x05, 0x00, 0x83, 0x6F, 0x75, 0x73,
+    0x00, 0x15, 0x17, 0x18, 0x09, 0x12, 0x07, 0x00, 0x83, 0x6F, 0x75, 0x73, 0x00, 0x08, 0x11, 0x00,
+    0x44, 0x5A, 0x02, 0x0C, 0x66, 0x02, 0x18, 0x7A, 0x02, 0x00, 0x05, 0x08, 0x00, 0x87, 0x62, 0x65,
+    0x61, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x04, 0x07, 0x04, 0x0F, 0x09, 0x04, 0x00, 0x8B, 0x66, 0x61,
+    0x6C, 0x61, 0x64, 0x61, 0x69, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x50, 0x81, 0x02, 0x12, 0x8F, 0x02,
+    0x00, 0x0B, 0x0C, 0x06, 0x00, 0x88, 0x68, 0x69, 0x6D, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x16,
+    0x0B, 0x08, 0x0F, 0x04, 0x09, 0x00, 0x88, 0x73, 0x68, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00,
+    0x4C, 0xAA, 0x02, 0x12, 0xB6, 0x02, 0x18, 0x2E, 0x03, 0x00, 0x12, 0x19, 0x0C, 0x0B, 0x06, 0x00,
+    0x84, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x44, 0xC6, 0x02, 0x09, 0xEA, 0x02, 0x0C, 0xF5, 0x02, 0x12,
+    0x06, 0x03, 0x18, 0x12, 0x03, 0x00, 0x48, 0xCD, 0x02, 0x09, 0xDA, 0x02, 0x00, 0x04, 0x0A, 0x05,
+    0x00, 0x87, 0x61, 0x67, 0x65, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x18, 0x10, 0x12, 0x08, 0x09, 0x00,
+    0x88, 0x6D, 0x6F, 0x75, 0x66, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x04, 0x12, 0x09, 0x00, 0x85, 0x66,
+    0x61, 0x6F, 0x75, 0x73, 0x00, 0x0B, 0x04, 0x0C, 0x13, 0x18, 0x12, 0x07, 0x00, 0x87, 0x61, 0x69,
+    0x68, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x04, 0x11, 0x09, 0x00, 0x86, 0x61, 0x6E, 0x6F, 0x6F, 0x75,
+    0x73, 0x00, 0x46, 0x19, 0x03, 0x0B, 0x23, 0x03, 0x00, 0x12, 0x00, 0x86, 0x63, 0x6F, 0x75, 0x6F,
+    0x75, 0x73, 0x00, 0x12, 0x06, 0x00, 0x86, 0x68, 0x6F, 0x75, 0x6F, 0x75, 0x73, 0x00, 0x12, 0x07,
+    0x18, 0x12, 0x19, 0x08, 0x05, 0x00, 0x84, 0x75, 0x6F, 0x75, 0x73, 0x00, 0x48, 0x43, 0x03, 0x11,
+    0x51, 0x03, 0x00, 0x11, 0x10, 0x0C, 0x07, 0x12, 0x07, 0x0C, 0x07, 0x00, 0x83, 0x65, 0x6E, 0x74,
+    0x00, 0x08, 0x00, 0x50, 0x5A, 0x03, 0x12, 0x98, 0x03, 0x00, 0x44, 0x61, 0x03, 0x1A, 0x8A, 0x03,
+    0x00, 0x4A, 0x68, 0x03, 0x0C, 0x79, 0x03, 0x00, 0x04, 0x17, 0x0B, 0x0C, 0x07, 0x00, 0x89, 0x74,
+    0x68, 0x61, 0x67, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0B, 0x17, 0x0C, 0x04, 0x17, 0x16, 0x0C,
+    0x06, 0x00, 0x86, 0x61, 0x69, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x12, 0x08, 0x17, 0x18, 0x09, 0x00,
+    0x86, 0x77, 0x6F, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x10, 0x05, 0x00, 0x85, 0x6F, 0x6D, 0x65, 0x6E,
+    0x74, 0x00, 0x08, 0x0C, 0x0C, 0x04, 0x06, 0x00, 0x82, 0x76, 0x65, 0x00, 0x0F, 0x00, 0x48, 0xBB,
+    0x03, 0x0B, 0xC6, 0x03, 0x0C, 0xD1, 0x03, 0x11, 0xDF, 0x03, 0x00, 0x04, 0x07, 0x04, 0x05, 0x00,
+    0x84, 0x65, 0x61, 0x6C, 0x79, 0x00, 0x18, 0x06, 0x18, 0x06, 0x00, 0x84, 0x68, 0x75, 0x6C, 0x79,
+    0x00, 0x13, 0x04, 0x12, 0x0F, 0x18, 0x07, 0x00, 0x85, 0x70, 0x61, 0x69, 0x6C, 0x79, 0x00, 0x08,
+    0x0C, 0x0B, 0x06, 0x00, 0x84, 0x6E, 0x65, 0x6C, 0x79, 0x00, 0x48, 0xF1, 0x03, 0x0C, 0x9A, 0x05,
+    0x00, 0x44, 0x07, 0x04, 0x08, 0x3F, 0x04, 0x0A, 0xAC, 0x04, 0x0B, 0xB6, 0x04, 0x0C, 0xBF, 0x04,
+    0x12, 0xFC, 0x04, 0x18, 0x38, 0x05, 0x00, 0x47, 0x0E, 0x04, 0x08, 0x1B, 0x04, 0x00, 0x18, 0x06,
+    0x12, 0x00, 0x86, 0x63, 0x6F, 0x75, 0x64, 0x61, 0x65, 0x64, 0x00, 0x4C, 0x22, 0x04, 0x10, 0x30,
+    0x04, 0x00, 0x15, 0x04, 0x07, 0x08, 0x05, 0x00, 0x85, 0x69, 0x72, 0x65, 0x61, 0x65, 0x64, 0x00,
+    0x18, 0x09, 0x12, 0x2C, 0x00, 0x87, 0x66, 0x6F, 0x75, 0x6D, 0x65, 0x61, 0x65, 0x64, 0x00, 0x44,
+    0x4F, 0x04, 0x11, 0x5A, 0x04, 0x13, 0x69, 0x04, 0x17, 0x84, 0x04, 0x18, 0xA1, 0x04, 0x00, 0x0B,
+    0x16, 0x04, 0x05, 0x00, 0x83, 0x65, 0x61, 0x65, 0x64, 0x00, 0x15, 0x08, 0x18, 0x12, 0x09, 0x2C,
+    0x00, 0x85, 0x72, 0x65, 0x6E, 0x65, 0x65, 0x64, 0x00, 0x45, 0x70, 0x04, 0x0F, 0x7A, 0x04, 0x00,
+    0x12, 0x00, 0x85, 0x62, 0x6F, 0x70, 0x65, 0x65, 0x64, 0x00, 0x08, 0x07, 0x00, 0x84, 0x70, 0x6C,
+    0x65, 0x65, 0x64, 0x00, 0x4B, 0x8B, 0x04, 0x18, 0x95, 0x04, 0x00, 0x08, 0x06, 0x00, 0x84, 0x74,
+    0x68, 0x65, 0x65, 0x64, 0x00, 0x05, 0x12, 0x00, 0x86, 0x62, 0x6F, 0x75, 0x74, 0x65, 0x65, 0x64,
+    0x00, 0x09, 0x12, 0x05, 0x00, 0x84, 0x75, 0x66, 0x65, 0x65, 0x64, 0x00, 0x0C, 0x08, 0x05, 0x00,
+    0x83, 0x67, 0x69, 0x65, 0x64, 0x00, 0x18, 0x06, 0x00, 0x83, 0x68, 0x75, 0x65, 0x64, 0x00, 0x44,
+    0xC6, 0x04, 0x05, 0xEB, 0x04, 0x00, 0x52, 0xCD, 0x04, 0x19, 0xD8, 0x04, 0x00, 0x1A, 0x06, 0x00,
+    0x85, 0x6F, 0x77, 0x61, 0x69, 0x65, 0x64, 0x00, 0x0C, 0x04, 0x10, 0x0B, 0x08, 0x06, 0x00, 0x89,
+    0x68, 0x65, 0x6D, 0x61, 0x69, 0x76, 0x61, 0x69, 0x65, 0x64, 0x00, 0x0C, 0x17, 0x16, 0x09, 0x18,
+    0x00, 0x88, 0x66, 0x75, 0x73, 0x74, 0x69, 0x62, 0x69, 0x65, 0x64, 0x00, 0x48, 0x06, 0x05, 0x0B,
+    0x10, 0x05, 0x18, 0x1F, 0x05, 0x00, 0x0A, 0x05, 0x00, 0x84, 0x65, 0x67, 0x6F, 0x65, 0x64, 0x00,
+    0x06, 0x04, 0x05, 0x08, 0x00, 0x87, 0x62, 0x65, 0x61, 0x63, 0x68, 0x6F, 0x65, 0x64, 0x00, 0x4B,
+    0x26, 0x05, 0x0F, 0x2E, 0x05, 0x00, 0x06, 0x00, 0x83, 0x6F, 0x75, 0x65, 0x64, 0x00, 0x12, 0x09,
+    0x00, 0x84, 0x75, 0x6C, 0x6F, 0x65, 0x64, 0x00, 0x46, 0x45, 0x05, 0x0B, 0x4E, 0x05, 0x12, 0x72,
+    0x05, 0x15, 0x87, 0x05, 0x00, 0x12, 0x00, 0x84, 0x63, 0x6F, 0x75, 0x65, 0x64, 0x00, 0x46, 0x55,
+    0x05, 0x18, 0x63, 0x05, 0x00, 0x04, 0x09, 0x08, 0x00, 0x87, 0x66, 0x65, 0x61, 0x63, 0x68, 0x75,
+    0x65, 0x64, 0x00, 0x06, 0x07, 0x04, 0x2C, 0x00, 0x87, 0x64, 0x61, 0x63, 0x75, 0x68, 0x75, 0x65,
+    0x64, 0x00, 0x0F, 0x13, 0x0C, 0x17, 0x04, 0x16, 0x18, 0x12, 0x05, 0x00, 0x88, 0x74, 0x61, 0x69,
+    0x70, 0x6C, 0x6F, 0x75, 0x65, 0x64, 0x00, 0x0A, 0x0C, 0x15, 0x04, 0x0A, 0x04, 0x08, 0x09, 0x00,
+    0x87, 0x72, 0x61, 0x69, 0x67, 0x72, 0x75, 0x65, 0x64, 0x00, 0x08, 0x00, 0x44, 0xA9, 0x05, 0x13,
+    0xBE, 0x05, 0x15, 0xC7, 0x05, 0x1A, 0xD0, 0x05, 0x00, 0x46, 0xB0, 0x05, 0x07, 0xB7, 0x05, 0x00,
+    0x2C, 0x00, 0x82, 0x69, 0x65, 0x64, 0x00, 0x2C, 0x00, 0x82, 0x69, 0x65, 0x64, 0x00, 0x04, 0x05,
+    0x2C, 0x00, 0x82, 0x69, 0x65, 0x64, 0x00, 0x17, 0x12, 0x05, 0x00, 0x82, 0x69, 0x65, 0x64, 0x00,
+    0x04, 0x08, 0x07, 0x00, 0x82, 0x69, 0x65, 0x64, 0x00, 0x45, 0xEC, 0x05, 0x07, 0x42, 0x06, 0x0C,
+    0x81, 0x06, 0x0F, 0xB7, 0x06, 0x15, 0xA9, 0x08, 0x19, 0x1A, 0x09, 0x00, 0x0F, 0x04, 0x00, 0x44,
+    0xFC, 0x05, 0x0C, 0x1E, 0x06, 0x12, 0x29, 0x06, 0x18, 0x34, 0x06, 0x00, 0x47, 0x06, 0x06, 0x08,
+    0x0B, 0x06, 0x0B, 0x15, 0x06, 0x00, 0x82, 0x62, 0x6C, 0x65, 0x00, 0x0B, 0x16, 0x0C, 0x07, 0x00,
+    0x82, 0x62, 0x6C, 0x65, 0x00, 0x16, 0x12, 0x09, 0x00, 0x82, 0x62, 0x6C, 0x65, 0x00, 0x0B, 0x06,
+    0x18, 0x0B, 0x06, 0x00, 0x82, 0x62, 0x6C, 0x65, 0x00, 0x11, 0x08, 0x11, 0x18, 0x05, 0x00, 0x82,
+    0x62, 0x6C, 0x65, 0x00, 0x12, 0x09, 0x04, 0x08, 0x19, 0x0C, 0x0B, 0x06, 0x00, 0x82, 0x62, 0x6C,
+    0x65, 0x00, 0x44, 0x4C, 0x06, 0x0C, 0x55, 0x06, 0x12, 0x7A, 0x06, 0x00, 0x0F, 0x08, 0x07, 0x2C,
+    0x00, 0x81, 0x65, 0x64, 0x00, 0x44, 0x5F, 0x06, 0x09, 0x69, 0x06, 0x1A, 0x70, 0x06, 0x00, 0x17,
+    0x0C, 0x07, 0x08, 0x09, 0x00, 0x81, 0x65, 0x64, 0x00, 0x18, 0x05, 0x00, 0x81, 0x65, 0x64, 0x00,
+    0x0C, 0x10, 0x12, 0x06, 0x2C, 0x00, 0x81, 0x65, 0x64, 0x00, 0x0B, 0x06, 0x00, 0x81, 0x65, 0x64,
+    0x00, 0x19, 0x00, 0x44, 0x8D, 0x06, 0x0C, 0x99, 0x06, 0x18, 0xB0, 0x06, 0x00, 0x15, 0x0A, 0x08,
+    0x07, 0x08, 0x07, 0x00, 0x82, 0x69, 0x76, 0x65, 0x00, 0x4A, 0xA0, 0x06, 0x0B, 0xA8, 0x06, 0x00,
+    0x18, 0x07, 0x00, 0x82, 0x69, 0x76, 0x65, 0x00, 0x12, 0x05, 0x00, 0x82, 0x69, 0x76, 0x65, 0x00,
+    0x06, 0x00, 0x82, 0x69, 0x76, 0x65, 0x00, 0x44, 0xBE, 0x06, 0x05, 0xF3, 0x06, 0x00, 0x05, 0x00,
+    0x4C, 0xC7, 0x06, 0x18, 0xE5, 0x06, 0x00, 0x44, 0xCE, 0x06, 0x15, 0xD7, 0x06, 0x00, 0x0B, 0x06,
+    0x00, 0x83, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x17, 0x0C, 0x17, 0x16, 0x12, 0x0B, 0x06, 0x00, 0x83,
+    0x61, 0x62, 0x6C, 0x65, 0x00, 0x12, 0x19, 0x04, 0x08, 0x0B, 0x06, 0x2C, 0x00, 0x83, 0x61, 0x62,
+    0x6C, 0x65, 0x00, 0x44, 0x00, 0x07, 0x08, 0x5B, 0x08, 0x0C, 0x65, 0x08, 0x12, 0x9C, 0x08, 0x00,
+    0x44, 0x1C, 0x07, 0x07, 0x69, 0x07, 0x08, 0x73, 0x07, 0x0C, 0xAE, 0x07, 0x0F, 0xD7, 0x07, 0x12,
+    0xE4, 0x07, 0x15, 0x14, 0x08, 0x17, 0x24, 0x08, 0x18, 0x47, 0x08, 0x00, 0x47, 0x29, 0x07, 0x08,
+    0x34, 0x07, 0x0B, 0x48, 0x07, 0x15, 0x5C, 0x07, 0x00, 0x08, 0x00, 0x86, 0x64, 0x65, 0x61, 0x61,
+    0x62, 0x6C, 0x65, 0x00, 0x0B, 0x17, 0x09, 0x18, 0x18, 0x12, 0x07, 0x00, 0x89, 0x66, 0x75, 0x74,
+    0x68, 0x65, 0x61, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x18, 0x12, 0x17, 0x04, 0x16, 0x07, 0x00, 0x8A,
+    0x61, 0x73, 0x74, 0x6F, 0x75, 0x68, 0x61, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x08, 0x04, 0x06, 0x00,
+    0x86, 0x72, 0x65, 0x61, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x18, 0x00, 0x85, 0x64, 0x75, 0x61, 0x62,
+    0x6C, 0x65, 0x00, 0x44, 0x7D, 0x07, 0x10, 0x8C, 0x07, 0x15, 0x9E, 0x07, 0x00, 0x0F, 0x12, 0x0A,
+    0x18, 0x12, 0x05, 0x00, 0x85, 0x65, 0x61, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0C, 0x18, 0x11, 0x12,
+    0x0B, 0x06, 0x00, 0x88, 0x75, 0x6E, 0x69, 0x6D, 0x65, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0A, 0x08,
+    0x04, 0x07, 0x00, 0x88, 0x65, 0x61, 0x67, 0x72, 0x65, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x44, 0xB5,
+    0x07, 0x13, 0xC5, 0x07, 0x00, 0x05, 0x0B, 0x04, 0x06, 0x00, 0x88, 0x68, 0x61, 0x62, 0x61, 0x69,
+    0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x16, 0x08, 0x04, 0x06, 0x00, 0x89, 0x65, 0x61, 0x73, 0x61,
+    0x70, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x18, 0x13, 0x18, 0x09, 0x00, 0x85, 0x6C, 0x75, 0x61,
+    0x62, 0x6C, 0x65, 0x00, 0x53, 0xEB, 0x07, 0x19, 0xFE, 0x07, 0x00, 0x0C, 0x0A, 0x12, 0x18, 0x0B,
+    0x06, 0x00, 0x89, 0x6F, 0x75, 0x67, 0x69, 0x70, 0x6F, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x18, 0x12,
+    0x15, 0x17, 0x0B, 0x04, 0x06, 0x00, 0x8B, 0x68, 0x61, 0x74, 0x72, 0x6F, 0x75, 0x76, 0x6F, 0x61,
+    0x62, 0x6C, 0x65, 0x00, 0x12, 0x17, 0x04, 0x0F, 0x18, 0x12, 0x07, 0x00, 0x85, 0x72, 0x6F, 0x61,
+    0x62, 0x6C, 0x65, 0x00, 0x4C, 0x2B, 0x08, 0x12, 0x37, 0x08, 0x00, 0x16, 0x0C, 0x09, 0x00, 0x85,
+    0x74, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x16, 0x04, 0x08, 0x16, 0x18, 0x12, 0x05, 0x00, 0x85,
+    0x74, 0x6F, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0B, 0x16, 0x08, 0x0C, 0x11, 0x04, 0x06, 0x00, 0x89,
+    0x69, 0x6E, 0x65, 0x73, 0x68, 0x75, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x07, 0x00, 0x84, 0x65,
+    0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x00, 0x44, 0x6E, 0x08, 0x0B, 0x90, 0x08, 0x00, 0x4A, 0x75,
+    0x08, 0x1A, 0x83, 0x08, 0x00, 0x18, 0x12, 0x06, 0x0C, 0x0B, 0x06, 0x00, 0x84, 0x69, 0x61, 0x62,
+    0x6C, 0x65, 0x00, 0x12, 0x15, 0x17, 0x12, 0x06, 0x00, 0x84, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x00,
+    0x17, 0x08, 0x05, 0x2C, 0x00, 0x84, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x0F, 0x13, 0x0C,
+    0x06, 0x00, 0x84, 0x6F, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x44, 0xB9, 0x08, 0x08, 0xC4, 0x08, 0x0C,
+    0xCF, 0x08, 0x12, 0xDA, 0x08, 0x18, 0xE2, 0x08, 0x00, 0x08, 0x0B, 0x16, 0x08, 0x07, 0x2C, 0x00,
+    0x81, 0x65, 0x72, 0x00, 0x17, 0x16, 0x04, 0x06, 0x18, 0x07, 0x00, 0x81, 0x65, 0x72, 0x00, 0x04,
+    0x09, 0x0C, 0x15, 0x08, 0x09, 0x00, 0x81, 0x65, 0x72, 0x00, 0x09, 0x12, 0x06, 0x00, 0x81, 0x65,
+    0x72, 0x00, 0x4B, 0xEC, 0x08, 0x12, 0xF5, 0x08, 0x15, 0x12, 0x09, 0x00, 0x16, 0x04, 0x08, 0x09,
+    0x00, 0x81, 0x65, 0x72, 0x00, 0x49, 0xFC, 0x08, 0x15, 0x06, 0x09, 0x00, 0x0C, 0x0F, 0x04, 0x08,
+    0x09, 0x00, 0x81, 0x65, 0x72, 0x00, 0x17, 0x04, 0x19, 0x18, 0x12, 0x0B, 0x06, 0x00, 0x81, 0x65,
+    0x72, 0x00, 0x0A, 0x12, 0x09, 0x00, 0x81, 0x65, 0x72, 0x00, 0x44, 0x2A, 0x09, 0x08, 0x41, 0x09,
+    0x0C, 0x4A, 0x09, 0x12, 0x7A, 0x0A, 0x18, 0x83, 0x0A, 0x00, 0x0C, 0x00, 0x47, 0x33, 0x09, 0x0B,
+    0x39, 0x09, 0x00, 0x83, 0x61, 0x69, 0x76, 0x65, 0x00, 0x06, 0x00, 0x83, 0x61, 0x69, 0x76, 0x65,
+    0x00, 0x0C, 0x05, 0x00, 0x83, 0x65, 0x69, 0x76, 0x65, 0x00, 0x44, 0x60, 0x09, 0x08, 0xA5, 0x09,
+    0x0A, 0xC3, 0x09, 0x0C, 0xD2, 0x09, 0x10, 0xE5, 0x09, 0x12, 0xF3, 0x09, 0x18, 0x26, 0x0A, 0x00,
+    0x48, 0x6A, 0x09, 0x0C, 0x7A, 0x09, 0x11, 0x99, 0x09, 0x00, 0x11, 0x08, 0x04, 0x06, 0x2C, 0x00,
+    0x87, 0x65, 0x61, 0x6E, 0x65, 0x61, 0x69, 0x76, 0x65, 0x00, 0x4B, 0x81, 0x09, 0x16, 0x8E, 0x09,
+    0x00, 0x16, 0x04, 0x08, 0x0B, 0x06, 0x00, 0x84, 0x61, 0x69, 0x69, 0x76, 0x65, 0x00, 0x04, 0x06,
+    0x00, 0x85, 0x69, 0x73, 0x61, 0x69, 0x76, 0x65, 0x00, 0x06, 0x12, 0x00, 0x86, 0x63, 0x6F, 0x6E,
+    0x61, 0x69, 0x76, 0x65, 0x00, 0x52, 0xAC, 0x09, 0x18, 0xB7, 0x09, 0x00, 0x10, 0x09, 0x00, 0x85,
+    0x6F, 0x6D, 0x65, 0x69, 0x76, 0x65, 0x00, 0x09, 0x05, 0x2C, 0x00, 0x85, 0x75, 0x66, 0x65, 0x69,
+    0x76, 0x65, 0x00, 0x12, 0x0C, 0x04, 0x0B, 0x17, 0x0C, 0x06, 0x00, 0x84, 0x67, 0x6F, 0x69, 0x76,
+    0x65, 0x00, 0x04, 0x17, 0x16, 0x0C, 0x07, 0x04, 0x00, 0x89, 0x64, 0x61, 0x69, 0x73, 0x74, 0x61,
+    0x69, 0x69, 0x76, 0x65, 0x00, 0x18, 0x12, 0x17, 0x18, 0x12, 0x05, 0x00, 0x84, 0x6D, 0x75, 0x69,
+    0x76, 0x65, 0x00, 0x53, 0xFD, 0x09, 0x15, 0x0B, 0x0A, 0x18, 0x1B, 0x0A, 0x00, 0x0F, 0x12, 0x10,
+    0x12, 0x06, 0x00, 0x85, 0x70, 0x6C, 0x6F, 0x69, 0x76, 0x65, 0x00, 0x18, 0x05, 0x09, 0x0C, 0x00,
+    0x88, 0x66, 0x69, 0x62, 0x75, 0x72, 0x6F, 0x69, 0x76, 0x65, 0x00, 0x06, 0x12, 0x07, 0x00, 0x84,
+    0x6F, 0x75, 0x69, 0x76, 0x65, 0x00, 0x4F, 0x30, 0x0A, 0x12, 0x42, 0x0A, 0x15, 0x6B, 0x0A, 0x00,
+    0x13, 0x18, 0x0C, 0x1A, 0x05, 0x2C, 0x00, 0x88, 0x69, 0x77, 0x75, 0x70, 0x6C, 0x75, 0x69, 0x76,
+    0x65, 0x00, 0x46, 0x49, 0x0A, 0x0B, 0x59, 0x0A, 0x00, 0x04, 0x0C, 0x0B, 0x08, 0x09, 0x00, 0x87,
+    0x61, 0x69, 0x63, 0x6F, 0x75, 0x69, 0x76, 0x65, 0x00, 0x0C, 0x0B, 0x0C, 0x17, 0x07, 0x00, 0x89,
+    0x69, 0x74, 0x68, 0x69, 0x68, 0x6F, 0x75, 0x69, 0x76, 0x65, 0x00, 0x12, 0x0C, 0x17, 0x16, 0x04,
+    0x06, 0x00, 0x85, 0x72, 0x6F, 0x75, 0x69, 0x76, 0x65, 0x00, 0x0C, 0x09, 0x00, 0x83, 0x6F, 0x69,
+    0x76, 0x65, 0x00, 0x0C, 0x12, 0x0F, 0x13, 0x12, 0x09, 0x2C, 0x00, 0x83, 0x75, 0x69, 0x76, 0x65,
+    0x00, 0x4C, 0x98, 0x0A, 0x11, 0xFD, 0x0A, 0x00, 0x11, 0x00, 0x44, 0xA4, 0x0A, 0x0C, 0xAC, 0x0A,
+    0x18, 0xDC, 0x0A, 0x00, 0x07, 0x2C, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x44, 0xB6, 0x0A, 0x06,
+    0xD2, 0x0A, 0x09, 0xD7, 0x0A, 0x00, 0x46, 0xC0, 0x0A, 0x09, 0xC5, 0x0A, 0x0B, 0xCA, 0x0A, 0x00,
+    0x82, 0x69, 0x6E, 0x67, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x2C, 0x00, 0x82, 0x69, 0x6E,
+    0x67, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x46, 0xE6, 0x0A, 0x07,
+    0xED, 0x0A, 0x12, 0xF2, 0x0A, 0x00, 0x2C, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x82, 0x69, 0x6E,
+    0x67, 0x00, 0x13, 0x18, 0x17, 0x04, 0x07, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x44, 0x07, 0x0B,
+    0x0C, 0x21, 0x0B, 0x18, 0xCF, 0x0C, 0x00, 0x0C, 0x00, 0x49, 0x10, 0x0B, 0x15, 0x16, 0x0B, 0x00,
+    0x83, 0x61, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x08, 0x07, 0x2C, 0x00, 0x83, 0x61, 0x69, 0x6E, 0x67,
+    0x00, 0x44, 0x3A, 0x0B, 0x08, 0xA2, 0x0B, 0x0B, 0xC8, 0x0B, 0x0C, 0xD8, 0x0B, 0x12, 0xFF, 0x0B,
+    0x15, 0x31, 0x0C, 0x18, 0x40, 0x0C, 0x1A, 0xC1, 0x0C, 0x00, 0x46, 0x47, 0x0B, 0x08, 0x56, 0x0B,
+    0x0F, 0x7F, 0x0B, 0x18, 0x93, 0x0B, 0x00, 0x0A, 0x0C, 0x12, 0x05, 0x2C, 0x00, 0x86, 0x67, 0x69,
+    0x63, 0x61, 0x69, 0x6E, 0x67, 0x00, 0x4A, 0x5D, 0x0B, 0x0B, 0x6E, 0x0B, 0x00, 0x18, 0x0C, 0x05,
+    0x0B, 0x06, 0x00, 0x88, 0x69, 0x62, 0x75, 0x67, 0x65, 0x61, 0x69, 0x6E, 0x67, 0x00, 0x17, 0x04,
+    0x05, 0x08, 0x00, 0x89, 0x62, 0x65, 0x61, 0x74, 0x68, 0x65, 0x61, 0x69, 0x6E, 0x67, 0x00, 0x13,
+    0x04, 0x08, 0x17, 0x15, 0x04, 0x05, 0x00, 0x89, 0x74, 0x72, 0x65, 0x61, 0x70, 0x6C, 0x61, 0x69,
+    0x6E, 0x67, 0x00, 0x06, 0x12, 0x06, 0x0C, 0x07, 0x2C, 0x00, 0x85, 0x75, 0x63, 0x61, 0x69, 0x6E,
+    0x67, 0x00, 0x4B, 0xA9, 0x0B, 0x1A, 0xB8, 0x0B, 0x00, 0x17, 0x0B, 0x18, 0x06, 0x00, 0x87, 0x68,
+    0x75, 0x74, 0x68, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x17, 0x15, 0x04, 0x07, 0x00, 0x87, 0x74,
+    0x72, 0x69, 0x77, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x06, 0x18, 0x0B, 0x06, 0x04, 0x08, 0x09,
+    0x00, 0x84, 0x68, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x55, 0xDF, 0x0B, 0x17, 0xEF, 0x0B, 0x00, 0x0C,
+    0x04, 0x07, 0x08, 0x07, 0x00, 0x87, 0x61, 0x64, 0x69, 0x72, 0x69, 0x69, 0x6E, 0x67, 0x00, 0x04,
+    0x16, 0x04, 0x1A, 0x12, 0x0B, 0x06, 0x00, 0x85, 0x74, 0x61, 0x69, 0x69, 0x6E, 0x67, 0x00, 0x48,
+    0x09, 0x0C, 0x0B, 0x17, 0x0C, 0x18, 0x27, 0x0C, 0x00, 0x07, 0x16, 0x0C, 0x04, 0x05, 0x00, 0x85,
+    0x65, 0x64, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x16, 0x18, 0x07, 0x12, 0x00, 0x88, 0x64, 0x6F, 0x75,
+    0x73, 0x68, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x09, 0x2C, 0x00, 0x84, 0x6F, 0x75, 0x69, 0x6E, 0x67,
+    0x00, 0x08, 0x17, 0x18, 0x0F, 0x13, 0x12, 0x06, 0x00, 0x84, 0x72, 0x65, 0x69, 0x6E, 0x67, 0x00,
+    0x45, 0x53, 0x0C, 0x0A, 0x5D, 0x0C, 0x0C, 0x6E, 0x0C, 0x12, 0x79, 0x0C, 0x13, 0x8C, 0x0C, 0x16,
+    0x99, 0x0C, 0x00, 0x12, 0x00, 0x85, 0x62, 0x6F, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x17, 0x06,
+    0x18, 0x2C, 0x00, 0x88, 0x63, 0x75, 0x74, 0x75, 0x67, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x05, 0x06,
+    0x00, 0x85, 0x69, 0x62, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x0B, 0x17, 0x08, 0x04, 0x11, 0x0C, 0x05,
+    0x00, 0x88, 0x65, 0x61, 0x74, 0x68, 0x6F, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x18, 0x07, 0x00,
+    0x86, 0x6F, 0x75, 0x70, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x57, 0xA0, 0x0C, 0x18, 0xAE, 0x0C, 0x00,
+    0x04, 0x15, 0x0A, 0x12, 0x06, 0x00, 0x85, 0x73, 0x74, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x13,
+    0x12, 0x18, 0x0B, 0x06, 0x00, 0x89, 0x6F, 0x75, 0x70, 0x6F, 0x75, 0x73, 0x75, 0x69, 0x6E, 0x67,
+    0x00, 0x12, 0x12, 0x0B, 0x06, 0x04, 0x05, 0x00, 0x84, 0x77, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x0C,
+    0x00, 0x4F, 0xD8, 0x0C, 0x12, 0xE2, 0x0C, 0x00, 0x13, 0x0C, 0x07, 0x00, 0x83, 0x75, 0x69, 0x6E,
+    0x67, 0x00, 0x07, 0x00, 0x83, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x48, 0xF1, 0x0C, 0x1C, 0x06, 0x0D,
+    0x00, 0x05, 0x04, 0x04, 0x00, 0x45, 0xFC, 0x0C, 0x08, 0x00, 0x0D, 0x00, 0x81, 0x6C, 0x65, 0x00,
+    0x09, 0x00, 0x81, 0x6C, 0x65, 0x00, 0x44, 0x0D, 0x0D, 0x08, 0x14, 0x0D, 0x00, 0x08, 0x05, 0x00,
+    0x81, 0x6C, 0x79, 0x00, 0x16, 0x0C, 0x09, 0x00, 0x81, 0x6C, 0x79, 0x00, 0x4A, 0x29, 0x0D, 0x0C,
+    0x7B, 0x0D, 0x12, 0xB9, 0x0D, 0x17, 0x15, 0x10, 0x00, 0x0C, 0x00, 0x44, 0x38, 0x0D, 0x0C, 0x50,
+    0x0D, 0x12, 0x5A, 0x0D, 0x18, 0x74, 0x0D, 0x00, 0x08, 0x00, 0x47, 0x41, 0x0D, 0x1A, 0x45, 0x0D,
+    0x00, 0x81, 0x6E, 0x67, 0x00, 0x0C, 0x04, 0x19, 0x0C, 0x05, 0x2C, 0x00, 0x81, 0x6E, 0x67, 0x00,
+    0x04, 0x0B, 0x17, 0x18, 0x09, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x51, 0x61, 0x0D, 0x16, 0x6B, 0x0D,
+    0x00, 0x12, 0x05, 0x08, 0x0B, 0x06, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x0C, 0x04, 0x05, 0x2C, 0x00,
+    0x81, 0x6E, 0x67, 0x00, 0x05, 0x2C, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x12, 0x17, 0x00, 0x44, 0x88,
+    0x0D, 0x08, 0x98, 0x0D, 0x0C, 0x9F, 0x0D, 0x00, 0x08, 0x15, 0x0A, 0x0C, 0x04, 0x0B, 0x16, 0x0C,
+    0x04, 0x09, 0x00, 0x82, 0x69, 0x6F, 0x6E, 0x00, 0x09, 0x00, 0x82, 0x69, 0x6F, 0x6E, 0x00, 0x04,
+    0x00, 0x46, 0xA8, 0x0D, 0x0F, 0xAD, 0x0D, 0x00, 0x82, 0x69, 0x6F, 0x6E, 0x00, 0x13, 0x08, 0x0B,
+    0x16, 0x08, 0x07, 0x00, 0x82, 0x69, 0x6F, 0x6E, 0x00, 0x4C, 0xC0, 0x0D, 0x17, 0xBE, 0x0F, 0x00,
+    0x44, 0xD0, 0x0D, 0x0C, 0x11, 0x0E, 0x12, 0x1E, 0x0E, 0x17, 0x3B, 0x0E, 0x18, 0xAE, 0x0F, 0x00,
+    0x17, 0x00, 0x47, 0xD9, 0x0D, 0x08, 0xE0, 0x0D, 0x00, 0x84, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00,
+    0x4B, 0xEA, 0x0D, 0x15, 0xF8, 0x0D, 0x19, 0x05, 0x0E, 0x00, 0x16, 0x18, 0x12, 0x15, 0x04, 0x09,
+    0x00, 0x84, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x17, 0x0C, 0x04, 0x0B, 0x06, 0x00, 0x84, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x0B, 0x04, 0x05, 0x00, 0x84, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x17, 0x09, 0x08, 0x05, 0x2C, 0x00, 0x84, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x17, 0x00,
+    0x49, 0x27, 0x0E, 0x0B, 0x31, 0x0E, 0x00, 0x12, 0x06, 0x00, 0x84, 0x6F, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x06, 0x2C, 0x00, 0x84, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x44, 0x5D, 0x0E, 0x06, 0x85,
+    0x0E, 0x07, 0x8F, 0x0E, 0x09, 0x99, 0x0E, 0x0B, 0xA5, 0x0E, 0x0C, 0xB0, 0x0E, 0x0F, 0x30, 0x0F,
+    0x10, 0x3C, 0x0F, 0x11, 0x4B, 0x0F, 0x12, 0x58, 0x0F, 0x18, 0x9C, 0x0F, 0x00, 0x4B, 0x64, 0x0E,
+    0x0F, 0x76, 0x0E, 0x00, 0x0C, 0x15, 0x0B, 0x08, 0x06, 0x00, 0x89, 0x68, 0x65, 0x72, 0x69, 0x68,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x04, 0x0C, 0x09, 0x2C, 0x00, 0x87, 0x61, 0x69, 0x6C, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x00, 0x85, 0x63, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x18,
+    0x00, 0x85, 0x64, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x04, 0x12, 0x09, 0x00, 0x85, 0x66, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x06, 0x00, 0x85, 0x68, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00,
+    0x44, 0xBD, 0x0E, 0x0A, 0x05, 0x0F, 0x0C, 0x15, 0x0F, 0x19, 0x22, 0x0F, 0x00, 0x53, 0xC7, 0x0E,
+    0x15, 0xDF, 0x0E, 0x17, 0xEF, 0x0E, 0x00, 0x18, 0x12, 0x0B, 0x0C, 0x04, 0x06, 0x0B, 0x00, 0x8D,
+    0x63, 0x68, 0x61, 0x69, 0x68, 0x6F, 0x75, 0x70, 0x61, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C,
+    0x0A, 0x04, 0x06, 0x00, 0x88, 0x69, 0x67, 0x72, 0x61, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x16,
+    0x04, 0x08, 0x0A, 0x15, 0x08, 0x09, 0x00, 0x8B, 0x67, 0x72, 0x65, 0x61, 0x73, 0x74, 0x61, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x18, 0x0B, 0x06, 0x2C, 0x00, 0x87, 0x6F, 0x75, 0x67, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x1A, 0x06, 0x2C, 0x00, 0x86, 0x69, 0x77, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x04, 0x0C, 0x04, 0x09, 0x00, 0x86, 0x76, 0x61, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00,
+    0x08, 0x04, 0x05, 0x00, 0x85, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x0C, 0x04, 0x0A,
+    0x18, 0x05, 0x00, 0x85, 0x6D, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x18, 0x0B, 0x06, 0x00,
+    0x85, 0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x45, 0x5F, 0x0F, 0x15, 0x6E, 0x0F, 0x00, 0x0C,
+    0x06, 0x04, 0x00, 0x88, 0x63, 0x61, 0x69, 0x62, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x4A, 0x75,
+    0x0F, 0x17, 0x88, 0x0F, 0x00, 0x04, 0x16, 0x05, 0x0C, 0x2C, 0x00, 0x8A, 0x62, 0x69, 0x73, 0x61,
+    0x67, 0x72, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x04, 0x15, 0x0C, 0x17, 0x05, 0x2C, 0x00, 0x8A,
+    0x69, 0x74, 0x72, 0x61, 0x74, 0x72, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x07, 0x04, 0x0C,
+    0x0B, 0x06, 0x00, 0x88, 0x61, 0x69, 0x64, 0x6F, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x17, 0x09,
+    0x04, 0x11, 0x18, 0x12, 0x07, 0x2C, 0x00, 0x84, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x00,
+    0x44, 0xCD, 0x0F, 0x08, 0xD6, 0x0F, 0x0C, 0xE1, 0x0F, 0x18, 0xEC, 0x0F, 0x00, 0x08, 0x05, 0x00,
+    0x83, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0A, 0x0C, 0x07, 0x2C, 0x00, 0x83, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x04, 0x19, 0x08, 0x09, 0x00, 0x83, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x4B, 0xF3, 0x0F, 0x12,
+    0xFD, 0x0F, 0x00, 0x16, 0x18, 0x05, 0x00, 0x83, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x4A, 0x04, 0x10,
+    0x0B, 0x0D, 0x10, 0x00, 0x04, 0x06, 0x00, 0x83, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x06, 0x00, 0x83,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x10, 0x00, 0x4C, 0x1F, 0x10, 0x18, 0x27, 0x10, 0x00, 0x07,
+    0x08, 0x09, 0x00, 0x81, 0x6E, 0x74, 0x00, 0x19, 0x04, 0x19, 0x04, 0x06, 0x00, 0x81, 0x6E, 0x74,
+    0x00, 0x11, 0x0C, 0x17, 0x00, 0x44, 0x42, 0x10, 0x0C, 0x49, 0x10, 0x12, 0x52, 0x10, 0x18, 0x59,
+    0x10, 0x00, 0x08, 0x07, 0x00, 0x81, 0x6F, 0x6E, 0x00, 0x15, 0x0A, 0x12, 0x09, 0x00, 0x81, 0x6F,
+    0x6E, 0x00, 0x05, 0x2C, 0x00, 0x81, 0x6F, 0x6E, 0x00, 0x4A, 0x63, 0x10, 0x10, 0x6A, 0x10, 0x12,
+    0x74, 0x10, 0x00, 0x08, 0x06, 0x00, 0x81, 0x6F, 0x6E, 0x00, 0x04, 0x08, 0x0B, 0x06, 0x2C, 0x00,
+    0x81, 0x6F, 0x6E, 0x00, 0x07, 0x00, 0x81, 0x6F, 0x6E, 0x00, 0x48, 0x84, 0x10, 0x0C, 0xFC, 0x11,
+    0x18, 0x08, 0x12, 0x00, 0x44, 0x97, 0x10, 0x08, 0xFB, 0x10, 0x0B, 0x52, 0x11, 0x0C, 0x70, 0x11,
+    0x12, 0xCE, 0x11, 0x18, 0xD7, 0x11, 0x00, 0x4B, 0xA1, 0x10, 0x0C, 0xCA, 0x10, 0x18, 0xD9, 0x10,
+    0x00, 0x4C, 0xA8, 0x10, 0x12, 0xBB, 0x10, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x04, 0x09, 0x00, 0x89,
+    0x65, 0x61, 0x63, 0x68, 0x61, 0x69, 0x68, 0x61, 0x65, 0x72, 0x00, 0x0C, 0x13, 0x04, 0x0B, 0x06,
+    0x00, 0x86, 0x69, 0x70, 0x6F, 0x68, 0x61, 0x65, 0x72, 0x00, 0x07, 0x04, 0x08, 0x13, 0x0C, 0x04,
+    0x0B, 0x06, 0x00, 0x83, 0x61, 0x69, 0x65, 0x72, 0x00, 0x47, 0xE0, 0x10, 0x11, 0xEE, 0x10, 0x00,
+    0x12, 0x15, 0x0A, 0x04, 0x08, 0x05, 0x00, 0x84, 0x75, 0x64, 0x61, 0x65, 0x72, 0x00, 0x12, 0x1A,
+    0x18, 0x12, 0x05, 0x00, 0x84, 0x75, 0x6E, 0x61, 0x65, 0x72, 0x00, 0x44, 0x08, 0x11, 0x10, 0x29,
+    0x11, 0x15, 0x38, 0x11, 0x18, 0x44, 0x11, 0x00, 0x46, 0x12, 0x11, 0x07, 0x18, 0x11, 0x17, 0x1E,
+    0x11, 0x00, 0x83, 0x65, 0x61, 0x65, 0x72, 0x00, 0x83, 0x65, 0x61, 0x65, 0x72, 0x00, 0x16, 0x0C,
+    0x04, 0x07, 0x00, 0x83, 0x65, 0x61, 0x65, 0x72, 0x00, 0x08, 0x06, 0x0B, 0x12, 0x07, 0x00, 0x86,
+    0x63, 0x68, 0x65, 0x6D, 0x65, 0x65, 0x72, 0x00, 0x08, 0x17, 0x09, 0x00, 0x85, 0x65, 0x74, 0x72,
+    0x65, 0x65, 0x72, 0x00, 0x05, 0x17, 0x16, 0x04, 0x05, 0x2C, 0x00, 0x84, 0x75, 0x62, 0x65, 0x65,
+    0x72, 0x00, 0x44, 0x59, 0x11, 0x0C, 0x61, 0x11, 0x00, 0x06, 0x00, 0x83, 0x68, 0x61, 0x65, 0x72,
+    0x00, 0x17, 0x0C, 0x04, 0x0B, 0x16, 0x18, 0x12, 0x05, 0x00, 0x83, 0x68, 0x69, 0x65, 0x72, 0x00,
+    0x44, 0x7D, 0x11, 0x06, 0xA4, 0x11, 0x09, 0xAD, 0x11, 0x15, 0xBC, 0x11, 0x00, 0x4A, 0x84, 0x11,
+    0x0F, 0x93, 0x11, 0x00, 0x12, 0x12, 0x0F, 0x07, 0x00, 0x87, 0x6F, 0x6C, 0x6F, 0x67, 0x61, 0x69,
+    0x65, 0x72, 0x00, 0x0C, 0x11, 0x04, 0x0C, 0x04, 0x07, 0x00, 0x87, 0x6E, 0x61, 0x69, 0x6C, 0x61,
+    0x69, 0x65, 0x72, 0x00, 0x0B, 0x00, 0x84, 0x63, 0x68, 0x69, 0x65, 0x72, 0x00, 0x08, 0x04, 0x06,
+    0x04, 0x07, 0x2C, 0x00, 0x85, 0x65, 0x61, 0x66, 0x69, 0x65, 0x72, 0x00, 0x17, 0x04, 0x0C, 0x0F,
+    0x13, 0x12, 0x07, 0x2C, 0x00, 0x86, 0x61, 0x69, 0x74, 0x72, 0x69, 0x65, 0x72, 0x00, 0x18, 0x05,
+    0x00, 0x83, 0x6F, 0x75, 0x65, 0x72, 0x00, 0x12, 0x00, 0x51, 0xE0, 0x11, 0x13, 0xEF, 0x11, 0x00,
+    0x0B, 0x12, 0x06, 0x18, 0x06, 0x00, 0x86, 0x68, 0x6F, 0x6E, 0x6F, 0x75, 0x65, 0x72, 0x00, 0x0F,
+    0x08, 0x07, 0x2C, 0x00, 0x85, 0x70, 0x6C, 0x6F, 0x75, 0x65, 0x72, 0x00, 0x08, 0x17, 0x12, 0x0A,
+    0x18, 0x06, 0x00, 0x82, 0x69, 0x65, 0x72, 0x00, 0x08, 0x00, 0x4B, 0x11, 0x12, 0x12, 0x18, 0x12,
+    0x00, 0x06, 0x00, 0x82, 0x75, 0x65, 0x72, 0x00, 0x49, 0x1F, 0x12, 0x17, 0x24, 0x12, 0x00, 0x82,
+    0x75, 0x65, 0x72, 0x00, 0x0C, 0x04, 0x1A, 0x0C, 0x04, 0x05, 0x00, 0x82, 0x75, 0x65, 0x72, 0x00,
+    0x48, 0x3D, 0x12, 0x12, 0x97, 0x12, 0x16, 0xF8, 0x12, 0x18, 0x28, 0x15, 0x00, 0x16, 0x11, 0x00,
+    0x44, 0x4D, 0x12, 0x0C, 0x6D, 0x12, 0x12, 0x84, 0x12, 0x18, 0x8B, 0x12, 0x00, 0x08, 0x00, 0x49,
+    0x56, 0x12, 0x0F, 0x63, 0x12, 0x00, 0x0C, 0x04, 0x11, 0x18, 0x0B, 0x06, 0x2C, 0x00, 0x82, 0x65,
+    0x73, 0x73, 0x00, 0x13, 0x18, 0x12, 0x05, 0x00, 0x82, 0x65, 0x73, 0x73, 0x00, 0x44, 0x74, 0x12,
+    0x06, 0x7F, 0x12, 0x00, 0x0F, 0x04, 0x08, 0x0B, 0x06, 0x00, 0x82, 0x65, 0x73, 0x73, 0x00, 0x82,
+    0x65, 0x73, 0x73, 0x00, 0x05, 0x00, 0x82, 0x65, 0x73, 0x73, 0x00, 0x12, 0x19, 0x04, 0x08, 0x05,
+    0x2C, 0x00, 0x82, 0x65, 0x73, 0x73, 0x00, 0x18, 0x00, 0x44, 0xA6, 0x12, 0x08, 0xC3, 0x12, 0x12,
+    0xDD, 0x12, 0x18, 0xE4, 0x12, 0x00, 0x48, 0xAD, 0x12, 0x15, 0xBB, 0x12, 0x00, 0x0B, 0x06, 0x04,
+    0x0F, 0x13, 0x08, 0x0B, 0x06, 0x00, 0x82, 0x6F, 0x75, 0x73, 0x00, 0x18, 0x06, 0x00, 0x82, 0x6F,
+    0x75, 0x73, 0x00, 0x46, 0xCA, 0x12, 0x15, 0xD1, 0x12, 0x00, 0x2C, 0x00, 0x82, 0x6F, 0x75, 0x73,
+    0x00, 0x17, 0x04, 0x16, 0x18, 0x12, 0x05, 0x00, 0x82, 0x6F, 0x75, 0x73, 0x00, 0x06, 0x00, 0x82,
+    0x6F, 0x75, 0x73, 0x00, 0x46, 0xEB, 0x12, 0x12, 0xF0, 0x12, 0x00, 0x82, 0x6F, 0x75, 0x73, 0x00,
+    0x05, 0x2C, 0x00, 0x82, 0x6F, 0x75, 0x73, 0x00, 0x08, 0x00, 0x44, 0x07, 0x13, 0x08, 0x17, 0x13,
+    0x11, 0x21, 0x13, 0x18, 0x0F, 0x15, 0x00, 0x11, 0x0B, 0x16, 0x0C, 0x17, 0x16, 0x18, 0x06, 0x00,
+    0x84, 0x61, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x11, 0x06, 0x00, 0x84, 0x65, 0x6E, 0x65, 0x73, 0x73,
+    0x00, 0x44, 0x43, 0x13, 0x06, 0x64, 0x13, 0x07, 0x6E, 0x13, 0x08, 0x7A, 0x13, 0x0B, 0xC0, 0x13,
+    0x0C, 0xE3, 0x13, 0x11, 0x22, 0x14, 0x12, 0x2F, 0x14, 0x15, 0x8D, 0x14, 0x17, 0x9A, 0x14, 0x18,
+    0xA7, 0x14, 0x00, 0x4C, 0x4A, 0x13, 0x16, 0x54, 0x13, 0x00, 0x07, 0x00, 0x85, 0x61, 0x69, 0x6E,
+    0x65, 0x73, 0x73, 0x00, 0x08, 0x12, 0x16, 0x04, 0x08, 0x05, 0x00, 0x86, 0x73, 0x65, 0x61, 0x6E,
+    0x65, 0x73, 0x73, 0x00, 0x04, 0x00, 0x85, 0x63, 0x61, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x18, 0x08,
+    0x07, 0x00, 0x85, 0x64, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x44, 0x87, 0x13, 0x0B, 0x91, 0x13,
+    0x0F, 0xA0, 0x13, 0x15, 0xB1, 0x13, 0x00, 0x07, 0x00, 0x85, 0x65, 0x61, 0x6E, 0x65, 0x73, 0x73,
+    0x00, 0x04, 0x16, 0x08, 0x09, 0x00, 0x87, 0x61, 0x73, 0x68, 0x65, 0x6E, 0x65, 0x73, 0x73, 0x00,
+    0x13, 0x0C, 0x05, 0x04, 0x00, 0x89, 0x62, 0x61, 0x69, 0x70, 0x6C, 0x65, 0x6E, 0x65, 0x73, 0x73,
+    0x00, 0x0A, 0x05, 0x0C, 0x00, 0x88, 0x62, 0x69, 0x67, 0x72, 0x65, 0x6E, 0x65, 0x73, 0x73, 0x00,
+    0x44, 0xC7, 0x13, 0x12, 0xD6, 0x13, 0x00, 0x17, 0x12, 0x15, 0x0A, 0x0C, 0x09, 0x00, 0x85, 0x68,
+    0x61, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x17, 0x04, 0x08, 0x06, 0x00, 0x85, 0x68, 0x6F, 0x6E, 0x65,
+    0x73, 0x73, 0x00, 0x46, 0xED, 0x13, 0x0A, 0xFA, 0x13, 0x15, 0x0B, 0x14, 0x00, 0x04, 0x08, 0x06,
+    0x00, 0x86, 0x63, 0x61, 0x69, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x04, 0x12, 0x15, 0x04, 0x08, 0x07,
+    0x2C, 0x00, 0x86, 0x67, 0x61, 0x69, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x17, 0x04, 0x08, 0x06, 0x0B,
+    0x04, 0x08, 0x0B, 0x06, 0x00, 0x8A, 0x63, 0x68, 0x65, 0x61, 0x74, 0x72, 0x69, 0x6E, 0x65, 0x73,
+    0x73, 0x00, 0x08, 0x12, 0x0B, 0x06, 0x00, 0x85, 0x6E, 0x65, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x18,
+    0x00, 0x49, 0x44, 0x14, 0x0B, 0x4C, 0x14, 0x0F, 0x59, 0x14, 0x16, 0x65, 0x14, 0x17, 0x70, 0x14,
+    0x19, 0x7E, 0x14, 0x00, 0x85, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x16, 0x0C, 0x04, 0x09,
+    0x00, 0x85, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x12, 0x05, 0x00, 0x86, 0x75, 0x6C, 0x6F,
+    0x6E, 0x65, 0x73, 0x73, 0x00, 0x18, 0x09, 0x00, 0x85, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00,
+    0x16, 0x18, 0x0A, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x04, 0x0B,
+    0x17, 0x0C, 0x04, 0x05, 0x00, 0x85, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x18, 0x0A, 0x08,
+    0x07, 0x00, 0x85, 0x72, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x12, 0x16, 0x18, 0x06, 0x00, 0x85,
+    0x74, 0x6F, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x4B, 0xB1, 0x14, 0x0F, 0xC0, 0x14, 0x12, 0xD0, 0x14,
+    0x00, 0x17, 0x07, 0x08, 0x00, 0x88, 0x64, 0x65, 0x74, 0x68, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00,
+    0x13, 0x12, 0x18, 0x07, 0x00, 0x88, 0x6F, 0x75, 0x70, 0x6C, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00,
+    0x4F, 0xDA, 0x14, 0x11, 0xF0, 0x14, 0x16, 0xFF, 0x14, 0x00, 0x13, 0x08, 0x0B, 0x16, 0x09, 0x08,
+    0x00, 0x8C, 0x66, 0x65, 0x73, 0x68, 0x65, 0x70, 0x6C, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00,
+    0x12, 0x18, 0x07, 0x00, 0x88, 0x6F, 0x75, 0x6E, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x17,
+    0x08, 0x06, 0x18, 0x06, 0x00, 0x87, 0x73, 0x74, 0x6F, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x11,
+    0x00, 0x47, 0x18, 0x15, 0x0B, 0x1F, 0x15, 0x00, 0x84, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x06,
+    0x00, 0x84, 0x75, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x44, 0x32, 0x15, 0x0C, 0x4E, 0x15, 0x12, 0x5B,
+    0x15, 0x00, 0x12, 0x08, 0x00, 0x46, 0x3C, 0x15, 0x09, 0x46, 0x15, 0x00, 0x18, 0x06, 0x2C, 0x00,
+    0x83, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x2C, 0x00, 0x83, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x12, 0x0B,
+    0x06, 0x0C, 0x0B, 0x06, 0x00, 0x83, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x44, 0x74, 0x15, 0x06, 0xD7,
+    0x15, 0x08, 0xE0, 0x15, 0x0C, 0x0A, 0x16, 0x11, 0x3A, 0x16, 0x12, 0x48, 0x16, 0x15, 0x72, 0x16,
+    0x18, 0x7E, 0x16, 0x00, 0x48, 0x7B, 0x15, 0x13, 0xC7, 0x15, 0x00, 0x48, 0x88, 0x15, 0x0F, 0x97,
+    0x15, 0x12, 0xA9, 0x15, 0x17, 0xB7, 0x15, 0x00, 0x0A, 0x0F, 0x13, 0x0C, 0x07, 0x00, 0x86, 0x65,
+    0x67, 0x65, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x13, 0x13, 0x04, 0x04, 0x08, 0x07, 0x00, 0x88, 0x70,
+    0x61, 0x70, 0x6C, 0x65, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x17, 0x0B, 0x06, 0x2C, 0x00, 0x86, 0x6F,
+    0x74, 0x65, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x0B, 0x04, 0x0A, 0x18, 0x12, 0x06, 0x00, 0x86, 0x74,
+    0x68, 0x65, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x0F, 0x18, 0x12, 0x17, 0x04, 0x0B, 0x06, 0x00, 0x85,
+    0x70, 0x6C, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x0C, 0x00, 0x84, 0x63, 0x69, 0x6F, 0x75, 0x73, 0x00,
+    0x48, 0xE7, 0x15, 0x13, 0xF7, 0x15, 0x00, 0x1A, 0x0B, 0x16, 0x04, 0x08, 0x0B, 0x06, 0x00, 0x85,
+    0x65, 0x77, 0x65, 0x6F, 0x75, 0x73, 0x00, 0x0C, 0x17, 0x16, 0x08, 0x04, 0x06, 0x00, 0x89, 0x65,
+    0x61, 0x73, 0x74, 0x69, 0x70, 0x65, 0x6F, 0x75, 0x73, 0x00, 0x46, 0x14, 0x16, 0x18, 0x1F, 0x16,
+    0x19, 0x2E, 0x16, 0x00, 0x0B, 0x2C, 0x00, 0x85, 0x63, 0x68, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x05,
+    0x0F, 0x13, 0x04, 0x08, 0x06, 0x00, 0x85, 0x75, 0x62, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x04, 0x0C,
+    0x07, 0x00, 0x85, 0x76, 0x61, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x04, 0x18, 0x12, 0x19, 0x12, 0x06,
+    0x00, 0x84, 0x6E, 0x61, 0x6F, 0x75, 0x73, 0x00, 0x48, 0x4F, 0x16, 0x18, 0x5A, 0x16, 0x00, 0x13,
+    0x09, 0x00, 0x85, 0x65, 0x70, 0x6F, 0x6F, 0x75, 0x73, 0x00, 0x47, 0x61, 0x16, 0x0A, 0x68, 0x16,
+    0x00, 0x84, 0x6F, 0x75, 0x6F, 0x75, 0x73, 0x00, 0x18, 0x09, 0x00, 0x84, 0x6F, 0x75, 0x6F, 0x75,
+    0x73, 0x00, 0x12, 0x0A, 0x08, 0x06, 0x00, 0x84, 0x72, 0x6F, 0x6F, 0x75, 0x73, 0x00, 0x12, 0x00,
+    0x4B, 0x87, 0x16, 0x18, 0x9B, 0x16, 0x00, 0x06, 0x04, 0x0B, 0x08, 0x17, 0x06, 0x00, 0x8A, 0x65,
+    0x74, 0x68, 0x61, 0x63, 0x68, 0x6F, 0x75, 0x6F, 0x75, 0x73, 0x00, 0x17, 0x0B, 0x16, 0x12, 0x09,
+    0x00, 0x86, 0x75, 0x74, 0x6F, 0x75, 0x6F, 0x75, 0x73, 0x00, 0x48, 0xB1, 0x16, 0x11, 0xF2, 0x16,
+    0x00, 0x11, 0x10, 0x00, 0x44, 0xC1, 0x16, 0x08, 0xCB, 0x16, 0x0C, 0xD5, 0x16, 0x18, 0xDF, 0x16,
+    0x00, 0x19, 0x08, 0x0B, 0x06, 0x00, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x15, 0x0C, 0x04, 0x06, 0x00,
+    0x82, 0x65, 0x6E, 0x74, 0x00, 0x13, 0x18, 0x0B, 0x06, 0x00, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x45,
+    0xE6, 0x16, 0x07, 0xEB, 0x16, 0x00, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x2C, 0x00, 0x82, 0x65, 0x6E,
+    0x74, 0x00, 0x48, 0xF9, 0x16, 0x10, 0x6E, 0x19, 0x00, 0x44, 0x06, 0x17, 0x08, 0x11, 0x17, 0x10,
+    0x1C, 0x17, 0x18, 0x60, 0x19, 0x00, 0x10, 0x08, 0x06, 0x00, 0x84, 0x61, 0x6D, 0x65, 0x6E, 0x74,
+    0x00, 0x10, 0x0B, 0x06, 0x00, 0x84, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x44, 0x32, 0x17, 0x07,
+    0x88, 0x17, 0x08, 0x96, 0x17, 0x09, 0xAF, 0x17, 0x0C, 0xCC, 0x17, 0x12, 0x24, 0x18, 0x18, 0x88,
+    0x18, 0x00, 0x45, 0x42, 0x17, 0x08, 0x4F, 0x17, 0x09, 0x5F, 0x17, 0x0B, 0x6F, 0x17, 0x0C, 0x7E,
+    0x17, 0x00, 0x06, 0x18, 0x00, 0x87, 0x63, 0x75, 0x62, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x04,
+    0x11, 0x08, 0x0B, 0x06, 0x00, 0x87, 0x61, 0x6E, 0x65, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x04,
+    0x0C, 0x07, 0x08, 0x07, 0x00, 0x87, 0x61, 0x69, 0x66, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x17,
+    0x09, 0x12, 0x00, 0x88, 0x66, 0x6F, 0x74, 0x68, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x07, 0x00,
+    0x85, 0x61, 0x69, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x18, 0x18, 0x16, 0x04, 0x07, 0x00, 0x85, 0x64,
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x00, 0x45, 0x9F, 0x17, 0x09, 0xA7, 0x17, 0x00, 0x85,
+    0x65, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x85, 0x65, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x48,
+    0xB6, 0x17, 0x0C, 0xBE, 0x17, 0x00, 0x85, 0x66, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x18, 0x0B,
+    0x17, 0x12, 0x05, 0x00, 0x85, 0x66, 0x69, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x44, 0xD3, 0x17, 0x17,
+    0x15, 0x18, 0x00, 0x46, 0xDD, 0x17, 0x0B, 0xED, 0x17, 0x15, 0x01, 0x18, 0x00, 0x04, 0x06, 0x0B,
+    0x00, 0x89, 0x63, 0x68, 0x61, 0x63, 0x61, 0x69, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x16, 0x08, 0x19,
+    0x07, 0x08, 0x00, 0x8B, 0x64, 0x65, 0x76, 0x65, 0x73, 0x68, 0x61, 0x69, 0x6D, 0x65, 0x6E, 0x74,
+    0x00, 0x04, 0x17, 0x08, 0x04, 0x06, 0x2C, 0x00, 0x8A, 0x65, 0x61, 0x74, 0x61, 0x72, 0x61, 0x69,
+    0x6D, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x06, 0x0B, 0x00, 0x88, 0x63, 0x68, 0x61, 0x74, 0x69, 0x6D,
+    0x65, 0x6E, 0x74, 0x00, 0x4B, 0x2E, 0x18, 0x0C, 0x3D, 0x18, 0x18, 0x49, 0x18, 0x00, 0x06, 0x09,
+    0x18, 0x00, 0x88, 0x66, 0x75, 0x63, 0x68, 0x6F, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x06, 0x07, 0x00,
+    0x86, 0x69, 0x63, 0x6F, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x45, 0x56, 0x18, 0x06, 0x63, 0x18, 0x10,
+    0x6E, 0x18, 0x19, 0x7C, 0x18, 0x00, 0x04, 0x09, 0x04, 0x05, 0x00, 0x85, 0x6F, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x00, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0F, 0x12,
+    0x09, 0x2C, 0x00, 0x86, 0x75, 0x6D, 0x6F, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x18, 0x12, 0x07, 0x00,
+    0x85, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x45, 0x9B, 0x18, 0x0A, 0xAB, 0x18, 0x0B, 0xCB,
+    0x18, 0x0F, 0x03, 0x19, 0x12, 0x29, 0x19, 0x1A, 0x52, 0x19, 0x00, 0x12, 0x08, 0x0B, 0x17, 0x0C,
+    0x09, 0x00, 0x86, 0x62, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x52, 0xB2, 0x18, 0x15, 0xBE,
+    0x18, 0x00, 0x04, 0x05, 0x00, 0x86, 0x67, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x18, 0x12,
+    0x09, 0x00, 0x86, 0x67, 0x72, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x46, 0xD5, 0x18, 0x07, 0xE8,
+    0x18, 0x0B, 0xF4, 0x18, 0x00, 0x04, 0x16, 0x17, 0x12, 0x06, 0x2C, 0x00, 0x89, 0x73, 0x74, 0x61,
+    0x63, 0x68, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x18, 0x00, 0x87, 0x64, 0x75, 0x68, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x00, 0x04, 0x06, 0x12, 0x06, 0x00, 0x87, 0x68, 0x61, 0x68, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x00, 0x12, 0x00, 0x53, 0x0C, 0x19, 0x15, 0x19, 0x19, 0x00, 0x04, 0x08, 0x09, 0x00,
+    0x86, 0x6C, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x0A, 0x05, 0x00, 0x89, 0x61, 0x67,
+    0x72, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x4C, 0x30, 0x19, 0x18, 0x41, 0x19, 0x00,
+    0x06, 0x15, 0x17, 0x04, 0x08, 0x07, 0x00, 0x87, 0x69, 0x63, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x00, 0x07, 0x17, 0x16, 0x0C, 0x09, 0x2C, 0x00, 0x87, 0x75, 0x64, 0x6F, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x00, 0x12, 0x18, 0x12, 0x07, 0x00, 0x86, 0x77, 0x6F, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00,
+    0x10, 0x12, 0x11, 0x0C, 0x04, 0x06, 0x00, 0x84, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x00,
+    0x4C, 0x7A, 0x19, 0x12, 0x82, 0x19, 0x18, 0x8A, 0x19, 0x00, 0x07, 0x00, 0x83, 0x6D, 0x65, 0x6E,
+    0x74, 0x00, 0x09, 0x00, 0x83, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x45, 0x91, 0x19, 0x09, 0x9A, 0x19,
+    0x00, 0x08, 0x06, 0x00, 0x83, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x2C, 0x00, 0x83, 0x6D, 0x65, 0x6E,
+    0x74, 0x00, 0x08, 0x0C, 0x00, 0x48, 0xAF, 0x19, 0x0C, 0xB6, 0x19, 0x18, 0xDE, 0x19, 0x00, 0x0B,
+    0x06, 0x00, 0x81, 0x76, 0x65, 0x00, 0x44, 0xBD, 0x19, 0x0B, 0xD5, 0x19, 0x00, 0x45, 0xC4, 0x19,
+    0x0A, 0xCE, 0x19, 0x00, 0x0C, 0x0B, 0x17, 0x0C, 0x07, 0x00, 0x81, 0x76, 0x65, 0x00, 0x04, 0x06,
+    0x00, 0x81, 0x76, 0x65, 0x00, 0x17, 0x18, 0x0B, 0x06, 0x00, 0x81, 0x76, 0x65, 0x00, 0x12, 0x09,
+    0x00, 0x81, 0x76, 0x65, 0x00, 0x4F, 0xEC, 0x19, 0x18, 0x50, 0x1B, 0x00, 0x44, 0x02, 0x1A, 0x08,
+    0x70, 0x1A, 0x0C, 0x8B, 0x1A, 0x12, 0xD1, 0x1A, 0x17, 0xF0, 0x1A, 0x18, 0xFB, 0x1A, 0x1A, 0x45,
+    0x1B, 0x00, 0x46, 0x0F, 0x1A, 0x08, 0x18, 0x1A, 0x15, 0x3E, 0x1A, 0x19, 0x4E, 0x1A, 0x00, 0x0B,
+    0x00, 0x84, 0x63, 0x68, 0x61, 0x6C, 0x79, 0x00, 0x47, 0x1F, 0x1A, 0x12, 0x32, 0x1A, 0x00, 0x18,
+    0x12, 0x16, 0x17, 0x18, 0x12, 0x09, 0x00, 0x88, 0x73, 0x74, 0x6F, 0x75, 0x64, 0x65, 0x61, 0x6C,
+    0x79, 0x00, 0x15, 0x07, 0x2C, 0x00, 0x85, 0x6F, 0x72, 0x65, 0x61, 0x6C, 0x79, 0x00, 0x0A, 0x04,
+    0x0C, 0x19, 0x07, 0x00, 0x87, 0x69, 0x76, 0x61, 0x67, 0x72, 0x61, 0x6C, 0x79, 0x00, 0x48, 0x55,
+    0x1A, 0x19, 0x62, 0x1A, 0x00, 0x0C, 0x17, 0x16, 0x04, 0x07, 0x00, 0x84, 0x76, 0x65, 0x61, 0x6C,
+    0x79, 0x00, 0x04, 0x18, 0x12, 0x0B, 0x06, 0x00, 0x85, 0x76, 0x61, 0x76, 0x61, 0x6C, 0x79, 0x00,
+    0x44, 0x77, 0x1A, 0x06, 0x82, 0x1A, 0x00, 0x0B, 0x09, 0x2C, 0x00, 0x84, 0x61, 0x68, 0x65, 0x6C,
+    0x79, 0x00, 0x0B, 0x00, 0x84, 0x63, 0x68, 0x65, 0x6C, 0x79, 0x00, 0x44, 0x95, 0x1A, 0x09, 0xA0,
+    0x1A, 0x17, 0xAF, 0x1A, 0x00, 0x06, 0x0B, 0x00, 0x85, 0x63, 0x68, 0x61, 0x69, 0x6C, 0x79, 0x00,
+    0x0C, 0x05, 0x04, 0x0C, 0x05, 0x00, 0x86, 0x62, 0x61, 0x69, 0x66, 0x69, 0x6C, 0x79, 0x00, 0x44,
+    0xB6, 0x1A, 0x12, 0xC1, 0x1A, 0x00, 0x04, 0x08, 0x07, 0x00, 0x84, 0x74, 0x61, 0x69, 0x6C, 0x79,
+    0x00, 0x0A, 0x18, 0x05, 0x12, 0x00, 0x88, 0x62, 0x6F, 0x75, 0x67, 0x6F, 0x74, 0x69, 0x6C, 0x79,
+    0x00, 0x57, 0xD8, 0x1A, 0x18, 0xE5, 0x1A, 0x00, 0x0B, 0x0C, 0x04, 0x0B, 0x06, 0x00, 0x84, 0x74,
+    0x68, 0x6F, 0x6C, 0x79, 0x00, 0x13, 0x12, 0x07, 0x00, 0x84, 0x75, 0x70, 0x6F, 0x6C, 0x79, 0x00,
+    0x04, 0x04, 0x08, 0x09, 0x00, 0x83, 0x74, 0x61, 0x6C, 0x79, 0x00, 0x45, 0x02, 0x1B, 0x12, 0x0B,
+    0x1B, 0x00, 0x12, 0x00, 0x84, 0x62, 0x6F, 0x75, 0x6C, 0x79, 0x00, 0x53, 0x12, 0x1B, 0x15, 0x39,
+    0x1B, 0x00, 0x4C, 0x19, 0x1B, 0x18, 0x28, 0x1B, 0x00, 0x15, 0x04, 0x0C, 0x07, 0x00, 0x87, 0x72,
+    0x61, 0x69, 0x70, 0x6F, 0x75, 0x6C, 0x79, 0x00, 0x15, 0x17, 0x09, 0x08, 0x00, 0x89, 0x66, 0x65,
+    0x74, 0x72, 0x75, 0x70, 0x6F, 0x75, 0x6C, 0x79, 0x00, 0x06, 0x04, 0x00, 0x86, 0x63, 0x61, 0x72,
+    0x6F, 0x75, 0x6C, 0x79, 0x00, 0x0C, 0x0C, 0x04, 0x06, 0x00, 0x83, 0x77, 0x69, 0x6C, 0x79, 0x00,
+    0x0F, 0x12, 0x09, 0x00, 0x82, 0x75, 0x6C, 0x79, 0x00
+};
@@ -0,0 +1,185 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "autocorrect_dictionary.h"
+#include "keycodes.h"
+#include "progmem.h"
+}
+
+// The dictionaries all use the same names, so each one gets its own namespace
+namespace default_trie {
+#include "autocorrect_data_default.h"
+constexpr uint32_t size       = DICTIONARY_SIZE;
+constexpr uint8_t  max_length = AUTOCORRECT_MAX_LENGTH;
+} // namespace default_trie
+#undef AUTOCORRECT_MIN_LENGTH
+#undef AUTOCORRECT_MAX_LENGTH
+#undef DICTIONARY_SIZE
+
+namespace default_dawg {
+#include "autocorrect_data_default_dawg.h"
+constexpr uint32_t size       = DICTIONARY_SIZE;
+constexpr uint8_t  link_bytes = AUTOCORRECT_DAWG_LINK_BYTES;
+} // namespace default_dawg
+#undef AUTOCORRECT_MIN_LENGTH
+#undef AUTOCORRECT_MAX_LENGTH
+#undef AUTOCORRECT_DAWG_LINK_BYTES
+#undef DICTIONARY_SIZE
+
+namespace synthetic_trie {
+#include "autocorrect_data_synthetic_trie.h"
+constexpr uint32_t size       = DICTIONARY_SIZE;
+constexpr uint8_t  max_length = AUTOCORRECT_MAX_LENGTH;
+} // namespace synthetic_trie
+#undef AUTOCORRECT_MIN_LENGTH
+#undef AUTOCORRECT_MAX_LENGTH
+#undef DICTIONARY_SIZE
+
+namespace synthetic_dawg {
+#include "autocorrect_data_synthetic_dawg.h"
+constexpr uint32_t size       = DICTIONARY_SIZE;
+constexpr uint8_t  link_bytes = AUTOCORRECT_DAWG_LINK_BYTES;
+} // namespace synthetic_dawg
+#undef AUTOCORRECT_MIN_LENGTH
+#undef AUTOCORRECT_MAX_LENGTH
+#undef AUTOCORRECT_DAWG_LINK_BYTES
+#undef DICTIONARY_SIZE
+
+namespace {
+
+struct dictionary_t {
+    const uint8_t *    trie;
+    uint32_t           trie_size;
+    uint8_t            max_length;
+    autocorrect_dawg_t dawg;
+};
+
+const dictionary_t default_dictionary   = {default_trie::autocorrect_data, default_trie::size, default_trie::max_length, {default_dawg::autocorrect_data, default_dawg::size, default_dawg::link_bytes}};
+const dictionary_t synthetic_dictionary = {synthetic_trie::autocorrect_data, synthetic_trie::size, synthetic_trie::max_length, {synthetic_dawg::autocorrect_data, synthetic_dawg::size, synthetic_dawg::link_bytes}};
+
+// Backspace count and replacement text of a correction node
+std::string correction(const uint8_t *data, uint32_t offset) {
+    return std::to_string(data[offset] & 63) + ":" + (const char *)&data[offset + 1];
+}
+
+// Walks the DAWG from the root to a random correction, giving the keycodes of a typo in the dictionary
+std::vector<uint8_t> random_typo(const autocorrect_dawg_t &dawg, std::mt19937 &rng) {
+    std::vector<uint8_t> typo;
+    uint32_t             state = 0;
+    while (!(dawg.data[state] & 128)) {
+        uint8_t code = dawg.data[state];
+        if (!(code & 64)) {
+            typo.push_back(code);
+            ++state;
+        } else {
+            uint32_t edge = state + 1 + (rng() % (code & 63)) * (1 + dawg.link_bytes);
+            typo.push_back(dawg.data[edge]);
+            state = 0;
+            for (uint8_t i = 0; i < dawg.link_bytes; ++i) {
+                state |= (uint32_t)dawg.data[edge + 1 + i] << (8 * i);
+            }
+        }
+    }
+    return typo;
+}
+
+// Random typing: typos from the dictionary, typos cut short, and random letters, separated by spaces or not
+std::vector<uint8_t> random_text(const autocorrect_dawg_t &dawg, std::mt19937 &rng, size_t length) {
+    std::vector<uint8_t> text;
+    while (text.size() < length) {
+        switch (rng() % 4) {
+            case 0: {
+                auto typo = random_typo(dawg, rng);
+                text.insert(text.end(), typo.begin(), typo.end());
+            } break;
+            case 1: {
+                auto typo = random_typo(dawg, rng);
+                text.insert(text.end(), typo.begin(), typo.begin() + rng() % typo.size());
+            } break;
+            case 2:
+                for (int i = rng() % 8; i > 0; --i) {
+                    text.push_back(KC_A + rng() % 26);
+                }
+                break;
+            default:
+                text.push_back(KC_SPC);
+                break;
+        }
+    }
+    return text;
+}
+
+} // namespace
+
+class AutocorrectDictionary : public ::testing::TestWithParam<const dictionary_t *> {
+   protected:
+    // Types the text through both the trie, searched from scratch on every keycode, and the incremental DAWG matcher,
+    // clearing the buffer after each correction the same way process_autocorrect() does
+    int compare(const std::vector<uint8_t> &text) {
+        const dictionary_t &dict = *GetParam();
+
+        std::vector<uint32_t>      states(dict.max_length);
+        autocorrect_dawg_matcher_t matcher = {states.data(), dict.max_length, 0};
+        std::vector<uint8_t>       buffer  = {KC_SPC};
+        autocorrect_dawg_advance(&dict.dawg, &matcher, KC_SPC);
+
+        int corrections = 0;
+        for (size_t i = 0; i < text.size(); ++i) {
+            if (buffer.size() >= dict.max_length) {
+                buffer.erase(buffer.begin());
+            }
+            buffer.push_back(text[i]);
+
+            uint32_t trie = autocorrect_trie_find(dict.trie, dict.trie_size, buffer.data(), buffer.size());
+            uint32_t dawg = autocorrect_dawg_advance(&dict.dawg, &matcher, text[i]);
+            EXPECT_LT(matcher.count, dict.max_length);
+
+            EXPECT_EQ(trie == AUTOCORRECT_NO_MATCH, dawg == AUTOCORRECT_NO_MATCH) << "at keycode " << i;
+            if (trie == AUTOCORRECT_NO_MATCH || dawg == AUTOCORRECT_NO_MATCH) {
+                continue;
+            }
+
+            EXPECT_EQ(correction(dict.trie, trie), correction(dict.dawg.data, dawg)) << "at keycode " << i;
+            ++corrections;
+
+            buffer.clear();
+            autocorrect_dawg_reset(&matcher);
+            if (text[i] == KC_SPC) {
+                buffer.push_back(KC_SPC);
+                autocorrect_dawg_advance(&dict.dawg, &matcher, KC_SPC);
+            }
+        }
+        return corrections;
+    }
+};
+
+TEST_P(AutocorrectDictionary, MatchesTrieOnRandomText) {
+    std::mt19937 rng(1234);
+    auto         text = random_text(GetParam()->dawg, rng, 50000);
+    EXPECT_GT(compare(text), 1000);
+}
+
+TEST_P(AutocorrectDictionary, MatchesTrieOnRandomLetters) {
+    // Only a few letters, so that partial matches pile up
+    std::mt19937         rng(5678);
+    std::vector<uint8_t> text(50000);
+    for (auto &key : text) {
+        key = rng() % 8 == 0 ? KC_SPC : KC_A + rng() % 6;
+    }
+    compare(text);
+}
+
+INSTANTIATE_TEST_SUITE_P(Dictionaries, AutocorrectDictionary, ::testing::Values(&default_dictionary, &synthetic_dictionary), [](const ::testing::TestParamInfo<const dictionary_t *> &info) { return info.param == &default_dictionary ? "Default" : "Synthetic"; });
+
+TEST(AutocorrectDawg, SharesTypoEndings) {
+    EXPECT_LT(default_dawg::size, default_trie::size);
+    EXPECT_LT(synthetic_dawg::size, synthetic_trie::size);
+    EXPECT_EQ(synthetic_dawg::link_bytes, 3);
+}
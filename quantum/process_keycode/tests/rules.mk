@@ -0,0 +1,6 @@
+autocorrect_dictionary_DEFS := -DNO_DEBUG
+autocorrect_dictionary_INC := $(QUANTUM_PATH)/process_keycode $(QUANTUM_PATH)/process_keycode/tests
+
+autocorrect_dictionary_SRC := \
+	$(QUANTUM_PATH)/process_keycode/tests/autocorrect_dictionary_tests.cpp \
+	$(QUANTUM_PATH)/process_keycode/autocorrect_dictionary.c
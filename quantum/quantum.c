@@ -73,10 +73,13 @@
 #endif
 
 #ifdef AUDIO_ENABLE
-#    ifndef GOODBYE_SONG
-#        define GOODBYE_SONG SONG(GOODBYE_SOUND)
-#    endif
+#    ifdef GOODBYE_SONG
 float goodbye_song[][2] = GOODBYE_SONG;
+#        define PLAY_GOODBYE_SONG() PLAY_SONG(goodbye_song)
+#    else
+static const uint8_t goodbye_song[] PROGMEM = SONG_STREAM(GOODBYE_SOUND);
+#        define PLAY_GOODBYE_SONG() PLAY_SONG_STREAM(goodbye_song)
+#    endif
 #    ifdef DEFAULT_LAYER_SONGS
 float default_layer_songs[][16][2] = DEFAULT_LAYER_SONGS;
 #    endif
@@ -186,7 +189,7 @@ void shutdown_quantum(void) {
     music_all_notes_off();
 #    endif
     uint16_t timer_start = timer_read();
-    PLAY_SONG(goodbye_song);
+    PLAY_GOODBYE_SONG();
     shutdown_user();
     while (timer_elapsed(timer_start) < 250)
         wait_ms(1);
@@ -780,18 +780,18 @@ static void rgblight_layers_write(void) {
         }
         // For each segment
         while (1) {
-            rgblight_segment_t segment;
-            memcpy_P(&segment, segment_ptr, sizeof(rgblight_segment_t));
-            if (segment.index == RGBLIGHT_END_SEGMENT_INDEX) {
+            rgblight_segment_t        segment_buffer;
+            const rgblight_segment_t *segment = pgm_read_struct(&segment_buffer, segment_ptr);
+            if (segment->index == RGBLIGHT_END_SEGMENT_INDEX) {
                 break; // No more segments
             }
-            // Write segment.count LEDs
-            LED_TYPE *const limit = &led[MIN(segment.index + segment.count, RGBLED_NUM)];
-            for (LED_TYPE *led_ptr = &led[segment.index]; led_ptr < limit; led_ptr++) {
+            // Write segment->count LEDs
+            LED_TYPE *const limit = &led[MIN(segment->index + segment->count, RGBLED_NUM)];
+            for (LED_TYPE *led_ptr = &led[segment->index]; led_ptr < limit; led_ptr++) {
 #    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
-                sethsv(segment.hue, segment.sat, current_val, led_ptr);
+                sethsv(segment->hue, segment->sat, current_val, led_ptr);
 #    else
-                sethsv(segment.hue, segment.sat, segment.val, led_ptr);
+                sethsv(segment->hue, segment->sat, segment->val, led_ptr);
 #    endif
             }
             segment_ptr++;
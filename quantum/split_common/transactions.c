@@ -787,7 +787,8 @@ static void watchdog_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 
 #if defined(HAPTIC_ENABLE) && defined(SPLIT_HAPTIC_ENABLE)
 
-uint8_t                split_haptic_play = 0xFF;
+uint8_t                split_haptic_play          = 0xFF;
+uint8_t                split_haptic_play_priority = 0;
 extern haptic_config_t haptic_config;
 
 static bool haptic_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -795,7 +796,8 @@ static bool haptic_handlers_master(matrix_row_t master_matrix[], matrix_row_t sl
     split_slave_haptic_sync_t haptic_sync;
 
     memcpy(&haptic_sync.haptic_config, &haptic_config, sizeof(haptic_config_t));
-    haptic_sync.haptic_play = split_haptic_play;
+    haptic_sync.haptic_play          = split_haptic_play;
+    haptic_sync.haptic_play_priority = split_haptic_play_priority;
 
     bool okay = send_if_data_mismatch(PUT_HAPTIC, &last_update, &haptic_sync, &split_shmem->haptic_sync, sizeof(haptic_sync));
 
@@ -807,9 +809,9 @@ static bool haptic_handlers_master(matrix_row_t master_matrix[], matrix_row_t sl
 static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     memcpy(&haptic_config, &split_shmem->haptic_sync.haptic_config, sizeof(haptic_config_t));
 
+    // Queue the effect as it was played on the master, leaving the slave's mode (and EEPROM) alone
     if (split_shmem->haptic_sync.haptic_play != 0xFF) {
-        haptic_set_mode(split_shmem->haptic_sync.haptic_play);
-        haptic_play();
+        haptic_play_effect(split_shmem->haptic_sync.haptic_play, split_shmem->haptic_sync.haptic_play_priority);
     }
 }
 
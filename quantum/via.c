@@ -144,7 +144,7 @@ void via_set_layout_options(uint32_t value) {
 }
 
 #if defined(AUDIO_ENABLE)
-float via_device_indication_song[][2] = SONG(STARTUP_SOUND);
+static const uint8_t via_device_indication_song[] PROGMEM = SONG_STREAM(STARTUP_SOUND);
 #endif // AUDIO_ENABLE
 
 // Used by VIA to tell a device to flash LEDs (or do something else) when that
@@ -169,7 +169,7 @@ __attribute__((weak)) void via_set_device_indication(uint8_t value) {
 #if defined(AUDIO_ENABLE)
     if (value == 0) {
         wait_ms(10);
-        PLAY_SONG(via_device_indication_song);
+        PLAY_SONG_STREAM(via_device_indication_song);
     }
 #endif // AUDIO_ENABLE
 }
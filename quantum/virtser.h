@@ -7,3 +7,6 @@ void virtser_recv(const uint8_t ch);
 
 /* Call this to send a character over the Virtual Serial Device */
 void virtser_send(const uint8_t byte);
+
+/* Call this to send several characters at once, in as few USB transfers as they fit in */
+void virtser_send_buffer(const uint8_t *data, uint16_t length);
@@ -18,11 +18,7 @@ void MockBackingStore::reset_instance() {
     backing_max_write_count   = 0;
     backing_total_write_count = 0;
 
-    backing_init_invoke_count   = 0;
-    backing_unlock_invoke_count = 0;
-    backing_erase_invoke_count  = 0;
-    backing_write_invoke_count  = 0;
-    backing_lock_invoke_count   = 0;
+    reset_invoke_counts();
 
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
@@ -33,6 +29,28 @@ void MockBackingStore::reset_instance() {
     write_log.clear();
 }
 
+void MockBackingStore::reset_invoke_counts() {
+    backing_init_invoke_count      = 0;
+    backing_unlock_invoke_count    = 0;
+    backing_erase_invoke_count     = 0;
+    backing_write_invoke_count     = 0;
+    backing_lock_invoke_count      = 0;
+    backing_read_invoke_count      = 0;
+    backing_read_bulk_invoke_count = 0;
+}
+
+void MockBackingStore::power_cycle() {
+    locked = true;
+
+    reset_invoke_counts();
+
+    init_success_callback   = [](std::uint64_t) { return true; };
+    erase_success_callback  = [](std::uint64_t) { return true; };
+    unlock_success_callback = [](std::uint64_t) { return true; };
+    write_success_callback  = [](std::uint64_t, std::uint32_t) { return true; };
+    lock_success_callback   = [](std::uint64_t) { return true; };
+}
+
 bool MockBackingStore::init(void) {
     ++backing_init_invoke_count;
 
@@ -75,6 +93,34 @@ bool MockBackingStore::erase(void) {
     return true;
 }
 
+bool MockBackingStore::erase_range(uint32_t address, std::size_t length) {
+    ++backing_erase_invoke_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(length % BACKING_STORE_WRITE_SIZE == 0) << "Supplied length was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + length <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
+    EXPECT_FALSE(is_locked()) << "Erase was attempted without being unlocked first";
+    EXPECT_TRUE(address % BACKING_STORE_ERASE_SIZE == 0) << "Supplied address was not aligned with the backing store erase size";
+    EXPECT_TRUE(length % BACKING_STORE_ERASE_SIZE == 0) << "Supplied length was not aligned with the backing store erase size";
+
+    // Erase each slot in the range
+    for (std::size_t i = address / BACKING_STORE_WRITE_SIZE; i < (address + length) / BACKING_STORE_WRITE_SIZE; ++i) {
+        // Drop out of erase early with failure if we need to
+        if (erase_success_callback && !erase_success_callback(backing_erase_invoke_count)) {
+            append_log(true);
+            return false;
+        }
+
+        backing_storage[i].erase();
+    }
+
+    // Keep track of the erase in the write log so that we can verify during tests
+    append_log(true);
+
+    ++backing_erasure_count;
+    return true;
+}
+
 bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     ++backing_write_invoke_count;
 
@@ -114,6 +160,8 @@ bool MockBackingStore::lock(void) {
 }
 
 bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const {
+    ++backing_read_invoke_count;
+
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
     EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
@@ -125,6 +173,21 @@ bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const
     return true;
 }
 
+bool MockBackingStore::read_bulk(uint32_t address, backing_store_int_t* values, std::size_t item_count) const {
+    ++backing_read_bulk_invoke_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + (item_count * BACKING_STORE_WRITE_SIZE) <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
+
+    // Read and take the complement as we're simulating flash memory -- 0xFF means 0x00
+    std::size_t index = address / BACKING_STORE_WRITE_SIZE;
+    for (std::size_t i = 0; i < item_count; ++i) {
+        values[i] = ~backing_storage[index + i].get();
+    }
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Backing Implementation
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -141,6 +204,10 @@ extern "C" bool backing_store_erase(void) {
     return MockBackingStore::Instance().erase();
 }
 
+extern "C" bool backing_store_erase_range(uint32_t address, size_t length) {
+    return MockBackingStore::Instance().erase_range(address, length);
+}
+
 extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return MockBackingStore::Instance().write(address, value);
 }
@@ -152,3 +219,7 @@ extern "C" bool backing_store_lock(void) {
 extern "C" bool backing_store_read(uint32_t address, backing_store_int_t* value) {
     return MockBackingStore::Instance().read(address, *value);
 }
+
+extern "C" bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count) {
+    return MockBackingStore::Instance().read_bulk(address, values, item_count);
+}
@@ -96,6 +96,8 @@ class MockBackingStore {
     std::uint64_t backing_erase_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
+    mutable std::uint64_t backing_read_invoke_count;
+    mutable std::uint64_t backing_read_bulk_invoke_count;
 
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
@@ -147,6 +149,18 @@ class MockBackingStore {
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
+    std::uint64_t read_bulk_invoke_count() const {
+        return backing_read_bulk_invoke_count;
+    }
+
+    // Clear out the invocation counts, leaving the stored data intact
+    void reset_invoke_counts();
+
+    // Simulate a power cycle -- the stored data is left intact, everything else is reset
+    void power_cycle();
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -159,9 +173,11 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase_range(std::uint32_t address, std::size_t length);
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
+    bool read_bulk(std::uint32_t address, backing_store_int_t* values, std::size_t item_count) const;
 
     // Control over when init/writes/erases should succeed
     void set_init_callback(std::function<bool(std::uint64_t)> callback) {
@@ -32,6 +32,46 @@ wear_leveling_2byte_optimized_writes_SRC := \
 wear_leveling_2byte_optimized_writes_INC := \
 	$(wear_leveling_common_INC)
 
+wear_leveling_2byte_checkpoints_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=65536 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=32768 \
+	-DWEAR_LEVELING_CHECKPOINT_INTERVAL=256
+wear_leveling_2byte_checkpoints_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_2byte_checkpoints.cpp
+wear_leveling_2byte_checkpoints_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_2byte_banked_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=256 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=32 \
+	-DWEAR_LEVELING_BANKED \
+	-DWEAR_LEVELING_CONSOLIDATION_STEP_SIZE=16 \
+	-DBACKING_STORE_ERASE_SIZE=32
+wear_leveling_2byte_banked_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_banked.cpp
+wear_leveling_2byte_banked_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_8byte_banked_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=8 \
+	-DWEAR_LEVELING_BACKING_SIZE=1024 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=32 \
+	-DWEAR_LEVELING_BANKED \
+	-DWEAR_LEVELING_CONSOLIDATION_STEP_SIZE=16 \
+	-DBACKING_STORE_ERASE_SIZE=128
+wear_leveling_8byte_banked_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_banked.cpp
+wear_leveling_8byte_banked_INC := \
+	$(wear_leveling_common_INC)
+
 wear_leveling_2byte_DEFS := \
 	$(wear_leveling_common_DEFS) \
 	-DBACKING_STORE_WRITE_SIZE=2 \
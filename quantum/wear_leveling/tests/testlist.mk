@@ -1,6 +1,9 @@
 TEST_LIST += \
 	wear_leveling_general \
 	wear_leveling_2byte_optimized_writes \
+	wear_leveling_2byte_checkpoints \
+	wear_leveling_2byte_banked \
+	wear_leveling_8byte_banked \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
 	wear_leveling_8byte
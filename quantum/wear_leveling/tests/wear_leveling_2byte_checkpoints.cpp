@@ -0,0 +1,150 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLeveling2ByteCheckpoints : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    static std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+};
+
+std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> WearLeveling2ByteCheckpoints::verify_data;
+
+// Start of the write log, after the consolidated area and its FNV1a_64
+using LOG_START = std::integral_constant<std::uint32_t, WEAR_LEVELING_LOGICAL_SIZE + 8>;
+
+static wear_leveling_status_t test_write(std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>& verify_data, const uint32_t address, const void* value, size_t length) {
+    memcpy(&verify_data[address], value, length);
+    return wear_leveling_write(address, value, length);
+}
+
+/**
+ * Writes single bytes to pseudo-random addresses above the 2-byte optimized range, such that each write generates a
+ * 2-word multibyte log entry, until the requested number of bytes of the write log have been consumed.
+ */
+static void fill_log(std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>& verify_data, std::size_t log_bytes) {
+    auto&                                   inst = MockBackingStore::Instance();
+    std::mt19937                            rng(0x5EED);
+    std::uniform_int_distribution<uint32_t> dist(64, WEAR_LEVELING_LOGICAL_SIZE - 1);
+    while (inst.total_write_count() * BACKING_STORE_WRITE_SIZE < log_bytes) {
+        uint32_t address = dist(rng);
+        uint8_t  value   = verify_data[address] + 1;
+        ASSERT_EQ(test_write(verify_data, address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+}
+
+/**
+ * This test verifies that a checkpoint is appended once the write log crosses the checkpoint interval, and that it
+ * records its own offset as well as the FNV1a_32 of the preceding log writes.
+ */
+TEST_F(WearLeveling2ByteCheckpoints, CheckpointWrittenAfterInterval) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log(verify_data, WEAR_LEVELING_CHECKPOINT_INTERVAL + 16);
+
+    // Walk the write log -- every data entry is a 2-word multibyte entry, checkpoints are 4 words
+    Fnv32_t     hash   = FNV1_32A_INIT;
+    std::size_t found  = 0;
+    auto        it     = inst.log_begin();
+    uint32_t    offset = 0;
+    while (it != inst.log_end()) {
+        write_log_entry_t e;
+        e.raw16[0] = it->value;
+        if (LOG_ENTRY_GET_TYPE(e) == LOG_ENTRY_TYPE_CHECKPOINT) {
+            ASSERT_GE(std::distance(it, inst.log_end()), 4) << "Truncated checkpoint";
+            for (int i = 1; i < 4; ++i) {
+                e.raw16[i] = (it + i)->value;
+            }
+            EXPECT_EQ(it->address, LOG_START::value + offset) << "Checkpoint written at incorrect location";
+            EXPECT_GE(offset, WEAR_LEVELING_CHECKPOINT_INTERVAL) << "Checkpoint written before the interval";
+            EXPECT_EQ(LOG_ENTRY_CHECKPOINT_GET_OFFSET(e), offset) << "Invalid checkpoint offset";
+            EXPECT_EQ(LOG_ENTRY_CHECKPOINT_GET_HASH(e), hash) << "Invalid checkpoint hash";
+            ++found;
+            for (int i = 0; i < 4; ++i, ++it) {
+                hash = fnv_32a_buf(&it->value, sizeof(it->value), hash);
+            }
+            offset += 8;
+        } else {
+            EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_MULTIBYTE) << "Invalid write log entry type";
+            for (int i = 0; i < 2; ++i, ++it) {
+                hash = fnv_32a_buf(&it->value, sizeof(it->value), hash);
+            }
+            offset += 4;
+        }
+    }
+    EXPECT_EQ(found, 1) << "Incorrect number of checkpoints";
+}
+
+/**
+ * This test verifies that data written across several checkpoints is correctly played back on re-init, without any
+ * consolidation being triggered.
+ */
+TEST_F(WearLeveling2ByteCheckpoints, PlaybackAcrossCheckpoints) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log(verify_data, (WEAR_LEVELING_BACKING_SIZE - LOG_START::value) / 2);
+
+    inst.reset_invoke_counts();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Re-initialisation failed";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Playback should not have consolidated";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+
+    // Subsequent writes should continue the checkpoint sequence and still play back correctly
+    fill_log(verify_data, (WEAR_LEVELING_BACKING_SIZE - LOG_START::value) * 3 / 4);
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Re-initialisation failed";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Playback should not have consolidated";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+}
+
+/**
+ * This test verifies that a corrupted value within an otherwise well-formed log entry is detected by the following
+ * checkpoint, forcing consolidation during playback.
+ */
+TEST_F(WearLeveling2ByteCheckpoints, CorruptedEntryDetectedByCheckpoint) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log(verify_data, WEAR_LEVELING_CHECKPOINT_INTERVAL + 16);
+
+    // Flip a bit in the value byte of the second log entry, leaving the address and type intact
+    auto     element = inst.storage_begin() + ((LOG_START::value + 4 + 2) / BACKING_STORE_WRITE_SIZE);
+    uint16_t value   = ~element->get();
+    element->erase();
+    element->set(~(value ^ 0x0100));
+
+    inst.reset_invoke_counts();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Corruption was not detected";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Corruption should have forced consolidation";
+}
+
+/**
+ * This test verifies that a nearly-full write log is read back in bulk chunks rather than one backing store word at a
+ * time.
+ */
+TEST_F(WearLeveling2ByteCheckpoints, StartupReadsNearlyFullLogInBulk) {
+    auto&             inst      = MockBackingStore::Instance();
+    const std::size_t log_bytes = WEAR_LEVELING_BACKING_SIZE - LOG_START::value;
+    fill_log(verify_data, log_bytes * 95 / 100);
+
+    constexpr int iterations = 20;
+    inst.reset_invoke_counts();
+    for (int i = 0; i < iterations; ++i) {
+        ASSERT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Re-initialisation failed";
+    }
+
+    // Consolidated data + checksum are two bulk reads, the remainder are chunked log reads
+    EXPECT_EQ(inst.read_invoke_count(), 0) << "Playback should not perform per-word reads";
+    EXPECT_LE(inst.read_bulk_invoke_count(), iterations * (2 + (log_bytes / WEAR_LEVELING_PLAYBACK_CHUNK_SIZE) + 1)) << "Playback performed too many bulk reads";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+}
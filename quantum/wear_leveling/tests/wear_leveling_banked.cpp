@@ -0,0 +1,179 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingBanked : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+};
+
+using logical_data_t = std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>;
+
+static logical_data_t readback_all(void) {
+    logical_data_t readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    return readback;
+}
+
+/**
+ * Performs a deterministic sequence of single-byte writes, each of which generates a single backing store write (or a
+ * single log entry for 8-byte backing stores), optionally running the background task after each one.
+ *
+ * @param committed[out] the expected logical data as of the last successful write
+ * @param attempted[out] the expected logical data including the write that failed, if any
+ * @return false if a write or background step failed
+ */
+static bool run_scenario(std::size_t write_count, bool run_task, logical_data_t& committed, logical_data_t& attempted) {
+    committed.fill(0);
+    attempted.fill(0);
+    for (std::size_t i = 0; i < write_count; ++i) {
+        uint32_t address = (i * 7) % WEAR_LEVELING_LOGICAL_SIZE;
+        uint8_t  value   = (uint8_t)(i + 1);
+        attempted[address] = value;
+        if (wear_leveling_write(address, &value, sizeof(value)) == WEAR_LEVELING_FAILED) {
+            return false;
+        }
+        committed[address] = value;
+        if (run_task && wear_leveling_task() == WEAR_LEVELING_FAILED) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * This test verifies that with the background task running, consolidation never occurs inline within a write, and
+ * that the data survives re-initialisation after several bank switches.
+ */
+TEST_F(WearLevelingBanked, BackgroundConsolidation_NoInlineErase) {
+    auto&       inst             = MockBackingStore::Instance();
+    std::size_t bank_switches    = 0;
+    std::size_t max_task_writes  = 0;
+    std::size_t max_write_writes = 0;
+    std::size_t max_task_erases  = 0;
+    std::size_t total_erases     = 0;
+
+    logical_data_t expected;
+    expected.fill(0);
+    for (std::size_t i = 0; i < 400; ++i) {
+        uint32_t address = (i * 7) % WEAR_LEVELING_LOGICAL_SIZE;
+        uint8_t  value   = (uint8_t)(i + 1);
+        expected[address] = value;
+
+        auto erases_before = inst.erase_invoke_count();
+        auto writes_before = inst.write_invoke_count();
+        EXPECT_EQ(wear_leveling_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write should not have consolidated inline";
+        EXPECT_EQ(inst.erase_invoke_count(), erases_before) << "Write should not have erased";
+        max_write_writes = std::max<std::size_t>(max_write_writes, inst.write_invoke_count() - writes_before);
+
+        writes_before = inst.write_invoke_count();
+        erases_before = inst.erase_invoke_count();
+        if (wear_leveling_task() == WEAR_LEVELING_CONSOLIDATED) {
+            ++bank_switches;
+        }
+        max_task_writes = std::max<std::size_t>(max_task_writes, inst.write_invoke_count() - writes_before);
+        max_task_erases = std::max<std::size_t>(max_task_erases, inst.erase_invoke_count() - erases_before);
+        total_erases += inst.erase_invoke_count() - erases_before;
+    }
+
+    EXPECT_GE(bank_switches, 2) << "Expected multiple bank switches";
+    EXPECT_EQ(inst.erasure_count(), inst.erase_invoke_count()) << "Erases should only be of a single bank at a time";
+    // The alternate bank is erased one erase unit per background step
+    EXPECT_EQ(max_task_erases, 1) << "Background step erased more than one erase unit";
+    EXPECT_GE(total_erases, bank_switches * (WEAR_LEVELING_BANK_SIZE / BACKING_STORE_ERASE_SIZE)) << "Bank was not erased in erase units";
+    EXPECT_GT(WEAR_LEVELING_BANK_SIZE / BACKING_STORE_ERASE_SIZE, 1) << "Test configuration should split the bank into several erase units";
+
+    // Each background step is bounded -- either a chunk of the cache, or the checksum and sequence number
+    EXPECT_LE(max_task_writes, std::max<std::size_t>(WEAR_LEVELING_CONSOLIDATION_STEP_SIZE, 16) / BACKING_STORE_WRITE_SIZE) << "Background step performed too much work";
+    // A write during consolidation is mirrored into both logs
+    EXPECT_LE(max_write_writes, 2 * (8 / BACKING_STORE_WRITE_SIZE)) << "Write performed too much work";
+
+    EXPECT_EQ(readback_all(), expected) << "Readback did not match";
+    inst.power_cycle();
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(readback_all(), expected) << "Readback after re-init did not match";
+}
+
+/**
+ * This test verifies that if the background task is never run, consolidation still occurs inline once the log is full.
+ */
+TEST_F(WearLevelingBanked, InlineConsolidationWithoutTask) {
+    auto&          inst = MockBackingStore::Instance();
+    logical_data_t committed, attempted;
+    EXPECT_TRUE(run_scenario(400, false, committed, attempted)) << "Scenario failed";
+    EXPECT_GE(inst.erase_invoke_count(), 2) << "Expected inline consolidation";
+
+    EXPECT_EQ(readback_all(), committed) << "Readback did not match";
+    inst.power_cycle();
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(readback_all(), committed) << "Readback after re-init did not match";
+}
+
+/**
+ * This test verifies that an erase clears both banks, and that a subsequent init starts from clean data.
+ */
+TEST_F(WearLevelingBanked, EraseClearsBothBanks) {
+    auto&          inst = MockBackingStore::Instance();
+    logical_data_t committed, attempted;
+    EXPECT_TRUE(run_scenario(200, true, committed, attempted)) << "Scenario failed";
+
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase failed";
+    logical_data_t zeros;
+    zeros.fill(0);
+    EXPECT_EQ(readback_all(), zeros) << "Readback after erase was not clear";
+
+    inst.power_cycle();
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(readback_all(), zeros) << "Readback after re-init was not clear";
+}
+
+/**
+ * This test simulates a power loss at every backing store operation -- each write, and each erased element -- across a
+ * scenario covering several background consolidations. After each simulated power loss, re-initialisation must
+ * recover either the data as of the last successful write, or the data including the interrupted write.
+ */
+TEST_F(WearLevelingBanked, PowerLossAtEveryStep) {
+    auto&                 inst        = MockBackingStore::Instance();
+    constexpr std::size_t write_count = 200;
+
+    // Determine the total number of backing store operations in the scenario
+    std::uint64_t operations = 0;
+    auto          counter    = [&operations](std::uint64_t) {
+        ++operations;
+        return true;
+    };
+    inst.set_erase_callback(counter);
+    inst.set_write_callback([&counter](std::uint64_t n, std::uint32_t) { return counter(n); });
+    logical_data_t committed, attempted;
+    ASSERT_TRUE(run_scenario(write_count, true, committed, attempted)) << "Scenario failed";
+    ASSERT_GE(inst.erasure_count(), 2) << "Scenario should cover multiple consolidations";
+    const std::uint64_t total_operations = operations;
+
+    for (std::uint64_t budget = 0; budget < total_operations; ++budget) {
+        inst.reset_instance();
+        ASSERT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Initialisation failed";
+
+        // Every operation after the budget is exhausted fails, as power has been lost
+        std::uint64_t remaining = budget;
+        auto          power     = [&remaining](std::uint64_t) {
+            if (remaining == 0) {
+                return false;
+            }
+            --remaining;
+            return true;
+        };
+        inst.set_erase_callback(power);
+        inst.set_write_callback([&power](std::uint64_t n, std::uint32_t) { return power(n); });
+        EXPECT_FALSE(run_scenario(write_count, true, committed, attempted)) << "Power loss did not interrupt the scenario, budget=" << budget;
+
+        inst.power_cycle();
+        ASSERT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed, budget=" << budget;
+        auto readback = readback_all();
+        EXPECT_TRUE(readback == committed || readback == attempted) << "Data lost after power loss, budget=" << budget;
+    }
+}
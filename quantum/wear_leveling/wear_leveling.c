@@ -61,12 +61,43 @@
             to other subsystems performing reads/writes. This must be a multiple
             of the write size.
 
+        - WEAR_LEVELING_PLAYBACK_CHUNK_SIZE: The number of bytes of write log
+            read from the backing store in a single bulk read during playback.
+            This must be a multiple of the write size. Defaults to 64.
+
+        - WEAR_LEVELING_CHECKPOINT_INTERVAL: If defined, the minimum number of
+            bytes of write log between checkpoint entries. This must be a
+            multiple of the write size. Undefined by default, which disables
+            checkpoint generation.
+
+        - WEAR_LEVELING_BANKED: If defined, the backing store is split into two
+            banks, and consolidation is performed into the alternate bank in the
+            background. See "Banked mode" below.
+
+        - WEAR_LEVELING_CONSOLIDATION_STEP_SIZE: In banked mode, the maximum
+            number of bytes of the cache copied per background step. This must
+            be a multiple of the write size. Defaults to 64.
+
+        - BACKING_STORE_ERASE_SIZE: In banked mode, the number of bytes erased
+            per background step. This must be a multiple of the flash erase
+            unit, and the bank size a multiple of it. Drivers with uniform
+            sectors set it to their sector size, otherwise it defaults to the
+            bank size.
+
+        - WEAR_LEVELING_CONSOLIDATION_RESERVE: In banked mode, background
+            consolidation is started once fewer than this many bytes remain in
+            the write log. Defaults to a quarter of the write log.
+
     General algorithm:
 
         During initialization:
             * The contents of the consolidated data section are read into cache.
             * The contents of the write log are "played back" and update the
-                cache accordingly.
+                cache accordingly. The log is read in bulk, in chunks of
+                WEAR_LEVELING_PLAYBACK_CHUNK_SIZE bytes.
+            * If checkpoints are enabled, each checkpoint encountered during
+                playback is validated against the running hash of the log read
+                so far; a mismatch is treated as log corruption.
 
         During reads:
             * Logical data is served from the cache.
@@ -153,17 +184,116 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Checkpoints:
+
+        If WEAR_LEVELING_CHECKPOINT_INTERVAL is defined, a checkpoint entry is
+        appended after the log entry which crosses each interval boundary. It
+        records its own offset within the write log as well as the FNV1a_32 of
+        every backing store write made to the log before it, allowing playback
+        to validate the log segment by segment rather than trusting each entry
+        in isolation. Checkpoints occupy 8 bytes regardless of write size.
+
+        ╔ Checkpoint Entry (2, 4, 8-byte) ══════════════════════════════════════╗
+        ║11000YYY║YYYYYYYY║YYYYYYYY║HHHHHHHH║HHHHHHHH║HHHHHHHH║HHHHHHHH║00000000║
+        ║     └┬┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║        ║
+        ║  Offset║  Offset║  Offset║ Hash   ║ Hash   ║ Hash   ║ Hash   ║        ║
+        ╚════════╩════════╩════════╩════════╩════════╩════════╩════════╩════════╝
+
+    Banked mode:
+
+        If WEAR_LEVELING_BANKED is defined, the backing store is split into two
+        equally-sized banks, each with its own consolidated data, FNV1a_64 hash,
+        and write log. An additional 8 bytes following the hash hold the bank's
+        sequence number and its complement, which are only written once the
+        rest of the bank's consolidated data is complete.
+
+        Once the active write log passes the consolidation threshold, a
+        background consolidation is started, driven by wear_leveling_task():
+            * The alternate bank is erased.
+            * The cache is copied into the alternate bank, a step at a time.
+                Writes made during this time are appended to both write logs.
+            * The hash and incremented sequence number are written, and the
+                alternate bank becomes the active bank.
+
+        If the active write log fills before the background consolidation has
+        completed, the remaining steps are performed inline.
+
+        During initialization, the committed bank with the most recent sequence
+        number and a valid hash is used. A power loss at any point during
+        consolidation leaves the previously active bank intact, so it is used
+        instead. */
+
+/**
+ * Storage area for the wear-leveling cache.
+ */
+/**
+ * Write log state: the location of the next entry, as well as the checkpoint state if enabled.
+ */
+typedef struct wear_leveling_log_t {
+#ifdef WEAR_LEVELING_BANKED
+    uint32_t bank_address; // backing store address of the bank containing this log
+#endif                     // WEAR_LEVELING_BANKED
+    uint32_t write_address;
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    uint32_t next_checkpoint_address;
+    uint32_t hash; // running FNV1a_32 of the write log values written so far
+#endif             // WEAR_LEVELING_CHECKPOINT_INTERVAL
+} wear_leveling_log_t;
+
+#ifdef WEAR_LEVELING_BANKED
+/**
+ * Background consolidation state.
+ */
+typedef enum wear_leveling_consolidation_state_t {
+    CONSOLIDATION_IDLE = 0, // No consolidation in progress
+    CONSOLIDATION_ERASE,    // Alternate bank is being erased
+    CONSOLIDATION_COPY,     // Cache is being copied into the alternate bank
+    CONSOLIDATION_COMMIT,   // Copy complete, checksum and sequence number are yet to be written
+} wear_leveling_consolidation_state_t;
+#endif // WEAR_LEVELING_BANKED
 
 /**
  * Storage area for the wear-leveling cache.
  */
 static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
-    uint32_t                                                       write_address;
-    bool                                                           unlocked;
+    wear_leveling_log_t                                            log;
+#ifdef WEAR_LEVELING_BANKED
+    uint32_t sequence; // sequence number of the active bank
+    struct {
+        wear_leveling_consolidation_state_t state;
+        uint32_t                            cursor; // number of bytes of the bank erased, or of the cache copied, so far
+        uint64_t                            hash;   // running FNV1a_64 of the bytes copied so far
+        wear_leveling_log_t                 log;    // write log of the alternate bank
+    } consolidation;
+#endif // WEAR_LEVELING_BANKED
+    bool unlocked;
 } wear_leveling;
 
+/**
+ * Playback helper: a window of the write log read in bulk from the backing store.
+ */
+typedef struct wear_leveling_playback_chunk_t {
+    backing_store_int_t data[(WEAR_LEVELING_PLAYBACK_CHUNK_SIZE) / (BACKING_STORE_WRITE_SIZE)];
+    uint32_t            address; // backing store address of data[0]
+    uint32_t            count;   // number of valid items in data
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    uint32_t hash; // running FNV1a_32 of the write log values read so far
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+} wear_leveling_playback_chunk_t;
+
+#ifdef WEAR_LEVELING_BANKED
+#    define WEAR_LEVELING_BANK_ADDRESS(wlog) ((wlog)->bank_address)
+#    define WEAR_LEVELING_LOG_OFFSET ((WEAR_LEVELING_LOGICAL_SIZE) + 16) // +16 is due to the FNV1a_64 of the consolidated buffer, and the bank sequence number
+#else                                                                     // WEAR_LEVELING_BANKED
+#    define WEAR_LEVELING_BANK_ADDRESS(wlog) 0
+#    define WEAR_LEVELING_LOG_OFFSET ((WEAR_LEVELING_LOGICAL_SIZE) + 8) // +8 is due to the FNV1a_64 of the consolidated buffer
+#endif                                                                   // WEAR_LEVELING_BANKED
+#define WEAR_LEVELING_LOG_START(wlog) (WEAR_LEVELING_BANK_ADDRESS(wlog) + WEAR_LEVELING_LOG_OFFSET)
+#define WEAR_LEVELING_LOG_END(wlog) (WEAR_LEVELING_BANK_ADDRESS(wlog) + (WEAR_LEVELING_BANK_SIZE))
+
 /**
  * Locking helper: status
  */
@@ -197,23 +327,40 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
     return STATUS_SUCCESS;
 }
 
+/**
+ * Resets the write log position to the start of its bank, as well as the checkpoint state if enabled.
+ */
+static void wear_leveling_reset_log(wear_leveling_log_t *wlog) {
+    wlog->write_address = WEAR_LEVELING_LOG_START(wlog);
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    wlog->next_checkpoint_address = WEAR_LEVELING_LOG_START(wlog) + (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+    wlog->hash                    = FNV1_32A_INIT;
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+}
+
 /**
  * Resets the cache, ensuring the write address is correctly initialised.
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling_reset_log(&wear_leveling.log);
 }
 
 /**
- * Reads the consolidated data from the backing store into the cache.
+ * Reads the consolidated data from the active bank of the backing store into the cache.
  * Does not consider the write log.
+ *
+ * @param matched[out] optional, set to whether the consolidated data matched its checksum
  */
-static wear_leveling_status_t wear_leveling_read_consolidated(void) {
+static wear_leveling_status_t wear_leveling_read_consolidated(bool *matched) {
     wl_dprintf("Reading consolidated data\n");
 
-    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    const uint32_t         bank_address = WEAR_LEVELING_BANK_ADDRESS(&wear_leveling.log);
+    wear_leveling_status_t status       = WEAR_LEVELING_SUCCESS;
+    if (matched) {
+        *matched = false;
+    }
+    if (!backing_store_read_bulk(bank_address, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to read from backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -224,16 +371,19 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
         write_log_entry_t entry;
         wl_dprintf("Reading checksum\n");
 #if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
+        backing_store_read_bulk(bank_address + (WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
 #elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
+        backing_store_read_bulk(bank_address + (WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
 #elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
+        backing_store_read(bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
 #endif
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
         if (entry.raw64 == expected) {
             wl_dprintf("Checksum matches, consolidated data is correct\n");
+            if (matched) {
+                *matched = true;
+            }
         } else {
             wl_dprintf("Checksum mismatch, clearing cache\n");
             wear_leveling_clear_cache();
@@ -248,6 +398,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     return status;
 }
 
+#ifndef WEAR_LEVELING_BANKED
 /**
  * Writes the current cache to consolidated data at the beginning of the backing store.
  * Does not clear the write log.
@@ -316,10 +467,157 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling_reset_log(&wear_leveling.log);
+
+    return status;
+}
+#else // WEAR_LEVELING_BANKED
+
+/**
+ * Reads the sequence number of the supplied bank.
+ *
+ * @return true if the bank has a valid sequence number, i.e. a consolidation into the bank was committed
+ */
+static bool wear_leveling_read_sequence(uint32_t bank_address, uint32_t *sequence) {
+    write_log_entry_t entry;
+#    if BACKING_STORE_WRITE_SIZE == 2
+    bool ok = backing_store_read_bulk(bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8, entry.raw16, 4);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+    bool ok = backing_store_read_bulk(bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8, entry.raw32, 2);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+    bool ok = backing_store_read(bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &entry.raw64);
+#    endif
+    *sequence = entry.raw32[0];
+    return ok && entry.raw32[0] != 0 && entry.raw32[0] == ~entry.raw32[1];
+}
+
+/**
+ * Begins a background consolidation into the alternate bank.
+ */
+static void wear_leveling_consolidation_start(void) {
+    wl_dprintf("Starting background consolidation\n");
+    wear_leveling.consolidation.state            = CONSOLIDATION_ERASE;
+    wear_leveling.consolidation.cursor           = 0;
+    wear_leveling.consolidation.hash             = FNV1A_64_INIT;
+    wear_leveling.consolidation.log.bank_address = wear_leveling.log.bank_address == 0 ? (WEAR_LEVELING_BANK_SIZE) : 0;
+    wear_leveling_reset_log(&wear_leveling.consolidation.log);
+}
+
+/**
+ * Performs a bounded amount of work towards the in-progress consolidation.
+ *
+ * Each step either erases BACKING_STORE_ERASE_SIZE bytes of the alternate bank, copies up to WEAR_LEVELING_CONSOLIDATION_STEP_SIZE bytes of the cache
+ * into it, or commits it by writing the checksum followed by the sequence number. Writes made to the cache while
+ * copying is in progress are mirrored into the alternate bank's write log, so the copied data does not need to be a
+ * consistent snapshot. The sequence number is written last -- until then, the active bank remains authoritative.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED if the alternate bank was committed and is now the active bank
+ */
+static wear_leveling_status_t wear_leveling_consolidation_step(void) {
+    wear_leveling_log_t *target = &wear_leveling.consolidation.log;
+    switch (wear_leveling.consolidation.state) {
+        case CONSOLIDATION_IDLE:
+            return WEAR_LEVELING_SUCCESS;
+
+        case CONSOLIDATION_ERASE:
+            wl_dprintf("Erasing alternate bank at offset %d\n", (int)wear_leveling.consolidation.cursor);
+            if (!backing_store_erase_range(target->bank_address + wear_leveling.consolidation.cursor, (BACKING_STORE_ERASE_SIZE))) {
+                wl_dprintf("Failed to erase alternate bank\n");
+                break;
+            }
+            wear_leveling.consolidation.cursor += (BACKING_STORE_ERASE_SIZE);
+            if (wear_leveling.consolidation.cursor >= (WEAR_LEVELING_BANK_SIZE)) {
+                wear_leveling.consolidation.cursor = 0;
+                wear_leveling.consolidation.state  = CONSOLIDATION_COPY;
+            }
+            return WEAR_LEVELING_SUCCESS;
 
+        case CONSOLIDATION_COPY: {
+            uint32_t cursor = wear_leveling.consolidation.cursor;
+            uint32_t length = (WEAR_LEVELING_LOGICAL_SIZE) - cursor;
+            if (length > (WEAR_LEVELING_CONSOLIDATION_STEP_SIZE)) {
+                length = (WEAR_LEVELING_CONSOLIDATION_STEP_SIZE);
+            }
+            if (!backing_store_write_bulk(target->bank_address + cursor, (backing_store_int_t *)&wear_leveling.cache[cursor], length / sizeof(backing_store_int_t))) {
+                wl_dprintf("Failed to write consolidated data\n");
+                break;
+            }
+            wear_leveling.consolidation.hash   = fnv_64a_buf(&wear_leveling.cache[cursor], length, wear_leveling.consolidation.hash);
+            wear_leveling.consolidation.cursor = cursor + length;
+            if (wear_leveling.consolidation.cursor >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                wear_leveling.consolidation.state = CONSOLIDATION_COMMIT;
+            }
+            return WEAR_LEVELING_SUCCESS;
+        }
+
+        case CONSOLIDATION_COMMIT: {
+            wl_dprintf("Committing alternate bank\n");
+            write_log_entry_t checksum = {.raw64 = wear_leveling.consolidation.hash};
+            uint32_t          sequence = wear_leveling.sequence + 1;
+            if (sequence == 0) {
+                sequence = 1; // zero is never a valid sequence number
+            }
+            write_log_entry_t commit = {.raw32 = {sequence, ~sequence}};
+#    if BACKING_STORE_WRITE_SIZE == 2
+            if (!backing_store_write_bulk(target->bank_address + (WEAR_LEVELING_LOGICAL_SIZE), checksum.raw16, 4) || !backing_store_write_bulk(target->bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8, commit.raw16, 4)) {
+                break;
+            }
+#    elif BACKING_STORE_WRITE_SIZE == 4
+            if (!backing_store_write_bulk(target->bank_address + (WEAR_LEVELING_LOGICAL_SIZE), checksum.raw32, 2) || !backing_store_write_bulk(target->bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8, commit.raw32, 2)) {
+                break;
+            }
+#    elif BACKING_STORE_WRITE_SIZE == 8
+            if (!backing_store_write(target->bank_address + (WEAR_LEVELING_LOGICAL_SIZE), checksum.raw64) || !backing_store_write(target->bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8, commit.raw64)) {
+                break;
+            }
+#    endif
+            // Switch over to the alternate bank
+            wear_leveling.log                 = *target;
+            wear_leveling.sequence            = sequence;
+            wear_leveling.consolidation.state = CONSOLIDATION_IDLE;
+            return WEAR_LEVELING_CONSOLIDATED;
+        }
+    }
+
+    // Something failed -- abandon this consolidation, the active bank is still intact
+    wear_leveling.consolidation.state = CONSOLIDATION_IDLE;
+    return WEAR_LEVELING_FAILED;
+}
+
+/**
+ * Starts a background consolidation if the active write log has passed the consolidation threshold.
+ */
+static void wear_leveling_consolidation_start_if_needed(void) {
+    if (wear_leveling.consolidation.state == CONSOLIDATION_IDLE && wear_leveling.log.write_address + (WEAR_LEVELING_CONSOLIDATION_RESERVE) >= WEAR_LEVELING_LOG_END(&wear_leveling.log)) {
+        wear_leveling_consolidation_start();
+    }
+}
+
+/**
+ * Forces consolidation into the alternate bank, completing any in-progress background consolidation inline.
+ * A power loss during this operation leaves the previously active bank intact.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        return WEAR_LEVELING_FAILED;
+    }
+
+    if (wear_leveling.consolidation.state == CONSOLIDATION_IDLE) {
+        wear_leveling_consolidation_start();
+    }
+
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_consolidation_step();
+    } while (status == WEAR_LEVELING_SUCCESS);
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
     return status;
 }
+#endif // WEAR_LEVELING_BANKED
 
 /**
  * Potential write of the current cache to the backing store.
@@ -329,7 +627,7 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
+    if (wear_leveling.log.write_address >= WEAR_LEVELING_LOG_END(&wear_leveling.log)) {
         return wear_leveling_consolidate_force();
     }
 
@@ -337,26 +635,75 @@ static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
 }
 
 /**
- * Appends the supplied fixed-width entry to the write log, optionally consolidating if the log is full.
+ * Appends the supplied fixed-width entry to the write log, optionally consolidating if the active log is full.
  *
  * @return true if consolidation occurred
  */
-static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value) {
-    bool ok = backing_store_write(wear_leveling.write_address, value);
+static wear_leveling_status_t wear_leveling_append_raw(wear_leveling_log_t *wlog, backing_store_int_t value) {
+#ifdef WEAR_LEVELING_BANKED
+    // The alternate bank's log is never consolidated, so it must not overflow
+    if (wlog->write_address >= WEAR_LEVELING_LOG_END(wlog)) {
+        return WEAR_LEVELING_FAILED;
+    }
+#endif // WEAR_LEVELING_BANKED
+    bool ok = backing_store_write(wlog->write_address, value);
     if (!ok) {
         wl_dprintf("Failed to write to backing store\n");
         return WEAR_LEVELING_FAILED;
     }
-    wear_leveling.write_address += (BACKING_STORE_WRITE_SIZE);
+    wlog->write_address += (BACKING_STORE_WRITE_SIZE);
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    wlog->hash = fnv_32a_buf(&value, sizeof(value), wlog->hash);
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+#ifdef WEAR_LEVELING_BANKED
+    if (wlog != &wear_leveling.log) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+#endif // WEAR_LEVELING_BANKED
     return wear_leveling_consolidate_if_needed();
 }
 
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+/**
+ * Appends a checkpoint entry to the write log if the current write position has passed the next checkpoint boundary.
+ * Must only be invoked between log entries.
+ *
+ * @return true if consolidation occurred
+ */
+static wear_leveling_status_t wear_leveling_checkpoint_if_needed(wear_leveling_log_t *wlog) {
+    if (wlog->write_address < wlog->next_checkpoint_address) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Writing checkpoint\n");
+    const write_log_entry_t log    = LOG_ENTRY_MAKE_CHECKPOINT(wlog->write_address - WEAR_LEVELING_LOG_START(wlog), wlog->hash);
+    wear_leveling_status_t  status = WEAR_LEVELING_SUCCESS;
+    for (size_t i = 0; i < sizeof(log) / sizeof(backing_store_int_t); ++i) {
+#    if BACKING_STORE_WRITE_SIZE == 2
+        status = wear_leveling_append_raw(wlog, log.raw16[i]);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+        status = wear_leveling_append_raw(wlog, log.raw32[i]);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+        status = wear_leveling_append_raw(wlog, log.raw64);
+#    endif
+        if (status != WEAR_LEVELING_SUCCESS) {
+            // If consolidation occurred the log has been reset, no need to continue.
+            // If a failure occurred, pass it on.
+            return status;
+        }
+    }
+
+    wlog->next_checkpoint_address = wlog->write_address + (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+    return status;
+}
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+
 /**
  * Handles writing multi_byte-encoded data to the backing store.
  *
  * @return true if consolidation occurred
  */
-static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address, const void *value, size_t length) {
+static wear_leveling_status_t wear_leveling_write_raw_multibyte(wear_leveling_log_t *wlog, uint32_t address, const void *value, size_t length) {
     const uint8_t *   p   = value;
     write_log_entry_t log = LOG_ENTRY_MAKE_MULTIBYTE(address, length);
     for (size_t i = 0; i < length; ++i) {
@@ -366,43 +713,43 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
     // Write to the backing store. See the multi-byte log format in the documentation header at the top of the file.
     wear_leveling_status_t status;
 #if BACKING_STORE_WRITE_SIZE == 2
-    status = wear_leveling_append_raw(log.raw16[0]);
+    status = wear_leveling_append_raw(wlog, log.raw16[0]);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
     }
 
-    status = wear_leveling_append_raw(log.raw16[1]);
+    status = wear_leveling_append_raw(wlog, log.raw16[1]);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
     }
 
     if (length > 1) {
-        status = wear_leveling_append_raw(log.raw16[2]);
+        status = wear_leveling_append_raw(wlog, log.raw16[2]);
         if (status != WEAR_LEVELING_SUCCESS) {
             return status;
         }
     }
 
     if (length > 3) {
-        status = wear_leveling_append_raw(log.raw16[3]);
+        status = wear_leveling_append_raw(wlog, log.raw16[3]);
         if (status != WEAR_LEVELING_SUCCESS) {
             return status;
         }
     }
 #elif BACKING_STORE_WRITE_SIZE == 4
-    status = wear_leveling_append_raw(log.raw32[0]);
+    status = wear_leveling_append_raw(wlog, log.raw32[0]);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
     }
 
     if (length > 1) {
-        status = wear_leveling_append_raw(log.raw32[1]);
+        status = wear_leveling_append_raw(wlog, log.raw32[1]);
         if (status != WEAR_LEVELING_SUCCESS) {
             return status;
         }
     }
 #elif BACKING_STORE_WRITE_SIZE == 8
-    status = wear_leveling_append_raw(log.raw64);
+    status = wear_leveling_append_raw(wlog, log.raw64);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
     }
@@ -413,7 +760,7 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
 /**
  * Handles the actual writing of logical data into the write log section of the backing store.
  */
-static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const void *value, size_t length) {
+static wear_leveling_status_t wear_leveling_write_raw(wear_leveling_log_t *wlog, uint32_t address, const void *value, size_t length) {
     const uint8_t *        p         = value;
     size_t                 remaining = length;
     wear_leveling_status_t status    = WEAR_LEVELING_SUCCESS;
@@ -424,7 +771,7 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
             const uint16_t v = ((uint16_t)p[1]) << 8 | p[0]; // don't just dereference a uint16_t here -- if unaligned it generates faults on some MCUs
             if (v == 0 || v == 1) {
                 const write_log_entry_t log = LOG_ENTRY_MAKE_WORD_01(address, v);
-                status                      = wear_leveling_append_raw(log.raw16[0]);
+                status                      = wear_leveling_append_raw(wlog, log.raw16[0]);
                 if (status != WEAR_LEVELING_SUCCESS) {
                     // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                     // If a failure occurred, pass it on.
@@ -441,7 +788,7 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
         // Small-write optimizations - address<64:
         if (address < 64) {
             const write_log_entry_t log = LOG_ENTRY_MAKE_OPTIMIZED_64(address, *p);
-            status                      = wear_leveling_append_raw(log.raw16[0]);
+            status                      = wear_leveling_append_raw(wlog, log.raw16[0]);
             if (status != WEAR_LEVELING_SUCCESS) {
                 // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                 // If a failure occurred, pass it on.
@@ -455,7 +802,7 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
         }
 #endif // BACKING_STORE_WRITE_SIZE == 2
         const size_t this_length = remaining >= LOG_ENTRY_MULTIBYTE_MAX_BYTES ? LOG_ENTRY_MULTIBYTE_MAX_BYTES : remaining;
-        status                   = wear_leveling_write_raw_multibyte(address, p, this_length);
+        status                   = wear_leveling_write_raw_multibyte(wlog, address, p, this_length);
         if (status != WEAR_LEVELING_SUCCESS) {
             // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
             // If a failure occurred, pass it on.
@@ -469,18 +816,61 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+/**
+ * Reads a single value from the write log during playback.
+ * Values are served from the playback chunk, which is refilled with a bulk read from the backing store whenever the
+ * requested address falls outside of it. Chunks are aligned to WEAR_LEVELING_PLAYBACK_CHUNK_SIZE.
+ */
+static bool wear_leveling_playback_read(wear_leveling_playback_chunk_t *chunk, uint32_t address, backing_store_int_t *value) {
+    if (address < chunk->address || address >= chunk->address + (chunk->count * (BACKING_STORE_WRITE_SIZE))) {
+        uint32_t chunk_address = address - (address % (WEAR_LEVELING_PLAYBACK_CHUNK_SIZE));
+        if (chunk_address < WEAR_LEVELING_LOG_START(&wear_leveling.log)) {
+            chunk_address = WEAR_LEVELING_LOG_START(&wear_leveling.log);
+        }
+        uint32_t chunk_end = chunk_address - (chunk_address % (WEAR_LEVELING_PLAYBACK_CHUNK_SIZE)) + (WEAR_LEVELING_PLAYBACK_CHUNK_SIZE);
+        if (chunk_end > WEAR_LEVELING_LOG_END(&wear_leveling.log)) {
+            chunk_end = WEAR_LEVELING_LOG_END(&wear_leveling.log);
+        }
+        chunk->count = 0;
+        if (!backing_store_read_bulk(chunk_address, chunk->data, (chunk_end - chunk_address) / (BACKING_STORE_WRITE_SIZE))) {
+            return false;
+        }
+        chunk->address = chunk_address;
+        chunk->count   = (chunk_end - chunk_address) / (BACKING_STORE_WRITE_SIZE);
+    }
+
+    *value = chunk->data[(address - chunk->address) / (BACKING_STORE_WRITE_SIZE)];
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    chunk->hash = fnv_32a_buf(value, sizeof(*value), chunk->hash);
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+    return true;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
 static wear_leveling_status_t wear_leveling_playback_log(void) {
     wl_dprintf("Playback write log\n");
 
+    wear_leveling_playback_chunk_t chunk = {
+        .address = 0,
+        .count   = 0,
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+        .hash = FNV1_32A_INIT,
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+    };
+
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+    uint32_t               address         = WEAR_LEVELING_LOG_START(&wear_leveling.log);
+    while (!cancel_playback && address < WEAR_LEVELING_LOG_END(&wear_leveling.log)) {
+        const uint32_t entry_address = address;
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+        const uint32_t entry_hash = chunk.hash;
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = wear_leveling_playback_read(&chunk, address, &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -489,6 +879,10 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         }
         if (value == 0) {
             wl_dprintf("Found empty slot, no more log entries\n");
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+            // The empty slot isn't part of the log, so it mustn't contribute to the running hash
+            chunk.hash = entry_hash;
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
             cancel_playback = true;
             break;
         }
@@ -509,7 +903,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = wear_leveling_playback_read(&chunk, address, &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -529,7 +923,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = wear_leveling_playback_read(&chunk, address, &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -539,7 +933,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = wear_leveling_playback_read(&chunk, address, &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -550,7 +944,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = wear_leveling_playback_read(&chunk, address, &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -590,6 +984,44 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 wear_leveling.cache[a + 1] = 0;
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
+            case LOG_ENTRY_TYPE_CHECKPOINT: {
+                // Checkpoints are always 8 bytes, so read the remainder of the entry
+#if BACKING_STORE_WRITE_SIZE == 2
+                for (int i = 1; ok && i < 4; ++i) {
+                    ok = wear_leveling_playback_read(&chunk, address, &log.raw16[i]);
+                    address += (BACKING_STORE_WRITE_SIZE);
+                }
+#elif BACKING_STORE_WRITE_SIZE == 4
+                ok = wear_leveling_playback_read(&chunk, address, &log.raw32[1]);
+                address += (BACKING_STORE_WRITE_SIZE);
+#endif
+                if (!ok) {
+                    wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+
+                // The checkpoint must describe its own location within the log
+                if (LOG_ENTRY_CHECKPOINT_GET_OFFSET(log) != entry_address - WEAR_LEVELING_LOG_START(&wear_leveling.log)) {
+                    wl_dprintf("Checkpoint offset mismatch\n");
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+                // Validate everything in the log up to this point
+                if (LOG_ENTRY_CHECKPOINT_GET_HASH(log) != entry_hash) {
+                    wl_dprintf("Checkpoint hash mismatch\n");
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+
+                wear_leveling.log.next_checkpoint_address = address + (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+            } break;
             default: {
                 cancel_playback = true;
                 status          = WEAR_LEVELING_FAILED;
@@ -598,7 +1030,10 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     }
 
     // We've reached the end of the log, so we're at the new write location
-    wear_leveling.write_address = address;
+    wear_leveling.log.write_address = address;
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    wear_leveling.log.hash = chunk.hash;
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
 
     if (status == WEAR_LEVELING_FAILED) {
         // If we had a failure during readback, assume we're corrupted -- force a consolidation with the data we already have
@@ -611,12 +1046,64 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_BANKED
+/**
+ * Selects the active bank, reading its consolidated data into the cache.
+ * The committed bank with the most recent sequence number and a valid checksum is preferred. If neither bank has been
+ * committed, the first bank is used.
+ */
+static wear_leveling_status_t wear_leveling_select_bank(void) {
+    uint32_t sequence[2];
+    bool     valid[2];
+    for (int i = 0; i < 2; ++i) {
+        valid[i] = wear_leveling_read_sequence(i * (WEAR_LEVELING_BANK_SIZE), &sequence[i]);
+    }
+
+    // Sequence numbers are compared as a wrapping difference, as they will eventually overflow
+    int first = (valid[1] && (!valid[0] || (int32_t)(sequence[1] - sequence[0]) > 0)) ? 1 : 0;
+    for (int i = 0; i < 2; ++i) {
+        int bank = i == 0 ? first : (first ^ 1);
+        if (!valid[bank]) {
+            continue;
+        }
+
+        wl_dprintf("Trying bank %d\n", bank);
+        wear_leveling.log.bank_address = bank * (WEAR_LEVELING_BANK_SIZE);
+        wear_leveling_reset_log(&wear_leveling.log);
+
+        bool                   matched;
+        wear_leveling_status_t status = wear_leveling_read_consolidated(&matched);
+        if (status == WEAR_LEVELING_FAILED) {
+            return status;
+        }
+        if (matched) {
+            wear_leveling.sequence = sequence[bank];
+            return status;
+        }
+    }
+
+    // No committed bank, so start from a clean cache in the first bank -- keep the sequence number moving forward though
+    wl_dprintf("No committed bank, using bank 0\n");
+    wear_leveling.log.bank_address = 0;
+    wear_leveling_clear_cache();
+    wear_leveling.sequence = valid[first] ? sequence[first] : 0;
+    return WEAR_LEVELING_SUCCESS;
+}
+#endif // WEAR_LEVELING_BANKED
+
 /**
  * Wear-leveling initialization
  */
 wear_leveling_status_t wear_leveling_init(void) {
     wl_dprintf("Init\n");
 
+#ifdef WEAR_LEVELING_BANKED
+    // Discard any in-progress consolidation -- its bank is not yet committed, so is ignored
+    wear_leveling.consolidation.state = CONSOLIDATION_IDLE;
+    wear_leveling.log.bank_address    = 0;
+    wear_leveling.sequence            = 0;
+#endif // WEAR_LEVELING_BANKED
+
     // Reset the cache
     wear_leveling_clear_cache();
 
@@ -628,7 +1115,11 @@ wear_leveling_status_t wear_leveling_init(void) {
     }
 
     // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
-    wear_leveling_status_t status = wear_leveling_read_consolidated();
+#ifdef WEAR_LEVELING_BANKED
+    wear_leveling_status_t status = wear_leveling_select_bank();
+#else  // WEAR_LEVELING_BANKED
+    wear_leveling_status_t status = wear_leveling_read_consolidated(NULL);
+#endif // WEAR_LEVELING_BANKED
     if (status == WEAR_LEVELING_FAILED) {
         // If it failed, clear the cache and return with failure
         wear_leveling_clear_cache();
@@ -642,6 +1133,11 @@ wear_leveling_status_t wear_leveling_init(void) {
         return status;
     }
 
+#ifdef WEAR_LEVELING_BANKED
+    // If the log is already nearing capacity, get consolidation underway in the background
+    wear_leveling_consolidation_start_if_needed();
+#endif // WEAR_LEVELING_BANKED
+
     return status;
 }
 
@@ -661,6 +1157,11 @@ wear_leveling_status_t wear_leveling_erase(void) {
 
     // Perform the erase
     bool ret = backing_store_erase();
+#ifdef WEAR_LEVELING_BANKED
+    wear_leveling.consolidation.state = CONSOLIDATION_IDLE;
+    wear_leveling.log.bank_address    = 0;
+    wear_leveling.sequence            = 0;
+#endif // WEAR_LEVELING_BANKED
     wear_leveling_clear_cache();
 
     // Lock the backing store if we acquired the lock successfully
@@ -698,8 +1199,27 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return WEAR_LEVELING_FAILED;
     }
 
+#ifdef WEAR_LEVELING_BANKED
+    // If consolidation is copying into the alternate bank, mirror the write into its log first. This ensures the
+    // alternate bank is complete regardless of whether this region of the cache has been copied yet, even if the
+    // write below fills the active log and forces the consolidation to complete inline.
+    if (wear_leveling.consolidation.state >= CONSOLIDATION_COPY) {
+        wear_leveling_status_t mirror_status = wear_leveling_write_raw(&wear_leveling.consolidation.log, address, value, length);
+#    ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+        if (mirror_status == WEAR_LEVELING_SUCCESS) {
+            mirror_status = wear_leveling_checkpoint_if_needed(&wear_leveling.consolidation.log);
+        }
+#    endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+        if (mirror_status != WEAR_LEVELING_SUCCESS) {
+            // Abandon the consolidation, it'll be restarted once this write completes
+            wl_dprintf("Failed to mirror write, abandoning consolidation\n");
+            wear_leveling.consolidation.state = CONSOLIDATION_IDLE;
+        }
+    }
+#endif // WEAR_LEVELING_BANKED
+
     // Perform the actual write
-    wear_leveling_status_t status = wear_leveling_write_raw(address, value, length);
+    wear_leveling_status_t status = wear_leveling_write_raw(&wear_leveling.log, address, value, length);
     switch (status) {
         case WEAR_LEVELING_CONSOLIDATED:
         case WEAR_LEVELING_FAILED:
@@ -707,8 +1227,20 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
             break;
 
         case WEAR_LEVELING_SUCCESS:
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+            // Append a checkpoint if we've crossed the next checkpoint boundary
+            status = wear_leveling_checkpoint_if_needed(&wear_leveling.log);
+            if (status != WEAR_LEVELING_SUCCESS) {
+                break;
+            }
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
             // Consolidate the cache + write log if required
             status = wear_leveling_consolidate_if_needed();
+#ifdef WEAR_LEVELING_BANKED
+            if (status == WEAR_LEVELING_SUCCESS) {
+                wear_leveling_consolidation_start_if_needed();
+            }
+#endif // WEAR_LEVELING_BANKED
             break;
 
         default:
@@ -726,6 +1258,35 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+/**
+ * Performs a bounded amount of background consolidation work, if any is pending.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+#ifdef WEAR_LEVELING_BANKED
+    if (wear_leveling.consolidation.state == CONSOLIDATION_IDLE) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_consolidation_step();
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+#else  // WEAR_LEVELING_BANKED
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_BANKED
+}
+
 /**
  * Reads logical data from the cache.
  */
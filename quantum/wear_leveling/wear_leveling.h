@@ -52,3 +52,13 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Performs a bounded amount of background work, if any is pending.
+ *
+ * When WEAR_LEVELING_BANKED is enabled, consolidation of a filling write log is carried out into the alternate bank in
+ * small steps during this call, rather than inline during a write. Without banked mode, this is a no-op.
+ *
+ * @return Status of the request -- WEAR_LEVELING_CONSOLIDATED once the alternate bank becomes active
+ */
+wear_leveling_status_t wear_leveling_task(void);
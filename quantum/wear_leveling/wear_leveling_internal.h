@@ -27,6 +27,26 @@ typedef uint64_t backing_store_int_t;
 #    error WEAR_LEVELING_LOGICAL_SIZE was not set.
 #endif
 
+#ifndef WEAR_LEVELING_PLAYBACK_CHUNK_SIZE
+#    define WEAR_LEVELING_PLAYBACK_CHUNK_SIZE 64
+#endif // WEAR_LEVELING_PLAYBACK_CHUNK_SIZE
+
+#ifdef WEAR_LEVELING_BANKED
+#    define WEAR_LEVELING_BANK_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    ifndef WEAR_LEVELING_CONSOLIDATION_STEP_SIZE
+#        define WEAR_LEVELING_CONSOLIDATION_STEP_SIZE 64
+#    endif // WEAR_LEVELING_CONSOLIDATION_STEP_SIZE
+#    ifndef WEAR_LEVELING_CONSOLIDATION_RESERVE
+#        define WEAR_LEVELING_CONSOLIDATION_RESERVE (((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOGICAL_SIZE) - 16) / 4)
+#    endif // WEAR_LEVELING_CONSOLIDATION_RESERVE
+#else      // WEAR_LEVELING_BANKED
+#    define WEAR_LEVELING_BANK_SIZE (WEAR_LEVELING_BACKING_SIZE)
+#endif // WEAR_LEVELING_BANKED
+
+#ifndef BACKING_STORE_ERASE_SIZE
+#    define BACKING_STORE_ERASE_SIZE (WEAR_LEVELING_BANK_SIZE)
+#endif // BACKING_STORE_ERASE_SIZE
+
 #ifdef WEAR_LEVELING_DEBUG_OUTPUT
 #    include <debug.h>
 #    define bs_dprintf(...) dprintf("Backing store: " __VA_ARGS__)
@@ -65,11 +85,24 @@ typedef uint64_t backing_store_int_t;
 _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+_Static_assert(WEAR_LEVELING_PLAYBACK_CHUNK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Playback chunk size must be a multiple of write size");
+#ifdef WEAR_LEVELING_BANKED
+_Static_assert(WEAR_LEVELING_BACKING_SIZE % 2 == 0, "Total backing size must be divisible into two banks");
+_Static_assert(WEAR_LEVELING_BANK_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Bank size must be at least twice the size of the logical size");
+_Static_assert(WEAR_LEVELING_BANK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Bank size must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_CONSOLIDATION_STEP_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Consolidation step size must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_BANK_SIZE % BACKING_STORE_ERASE_SIZE == 0, "Bank size must be a multiple of erase size");
+#endif // WEAR_LEVELING_BANKED
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+_Static_assert(WEAR_LEVELING_CHECKPOINT_INTERVAL % BACKING_STORE_WRITE_SIZE == 0, "Checkpoint interval must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_CHECKPOINT_INTERVAL >= 8, "Checkpoint interval must be at least the size of a checkpoint entry");
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
 bool backing_store_erase(void);
+bool backing_store_erase_range(uint32_t address, size_t length); // only required when WEAR_LEVELING_BANKED is enabled, address and length are multiples of BACKING_STORE_ERASE_SIZE
 bool backing_store_write(uint32_t address, backing_store_int_t value);
 bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
 bool backing_store_lock(void);
@@ -101,6 +134,9 @@ enum {
     // 0x02 -- 2-byte backing store write optimization: word-encoded 0/1 values
     LOG_ENTRY_TYPE_WORD_01,
 
+    // 0x03 -- Checkpoint: log position and running FNV1a_32 of the preceding write log
+    LOG_ENTRY_TYPE_CHECKPOINT,
+
     LOG_ENTRY_TYPES
 };
 
@@ -149,3 +185,21 @@ _Static_assert(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit int
             [1] = (uint8_t)((address) >> 1), /* address */                                            \
         }                                                                                             \
     }
+
+#define LOG_ENTRY_CHECKPOINT_GET_OFFSET(entry) LOG_ENTRY_MULTIBYTE_GET_ADDRESS(entry)
+#define LOG_ENTRY_CHECKPOINT_GET_HASH(entry) ((((uint32_t)((entry).raw8[3])) << 24) | (((uint32_t)((entry).raw8[4])) << 16) | (((uint32_t)((entry).raw8[5])) << 8) | (entry).raw8[6])
+#define LOG_ENTRY_MAKE_CHECKPOINT(offset, hash)                                                          \
+    (write_log_entry_t) {                                                                                \
+        .raw8 = {                                                                                        \
+            [0] = (((((uint8_t)LOG_ENTRY_TYPE_CHECKPOINT) & BITMASK_FOR_BITCOUNT(2)) << 6) /* type */    \
+                   | ((((uint8_t)((offset) >> 16))) & BITMASK_FOR_BITCOUNT(3))             /* offset */  \
+                   ),                                                                                    \
+            [1] = (((uint8_t)((offset) >> 8)) & BITMASK_FOR_BITCOUNT(8)), /* offset */                   \
+            [2] = (((uint8_t)(offset)) & BITMASK_FOR_BITCOUNT(8)),        /* offset */                   \
+            [3] = ((uint8_t)((hash) >> 24)),                              /* hash */                     \
+            [4] = ((uint8_t)((hash) >> 16)),                              /* hash */                     \
+            [5] = ((uint8_t)((hash) >> 8)),                               /* hash */                     \
+            [6] = ((uint8_t)(hash)),                                      /* hash */                     \
+            [7] = 0,                                                                                     \
+        }                                                                                                \
+    }
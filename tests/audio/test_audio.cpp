@@ -15,11 +15,15 @@
 
 #include <cmath>
 #include <random>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "keyboard_report_util.hpp"
 #include "test_common.hpp"
 
+extern "C" void advance_time(uint32_t ms);
+
 namespace {
 
 class AudioTest : public TestFixture {
@@ -27,6 +31,30 @@ class AudioTest : public TestFixture {
     uint16_t infer_tempo() {
         return audio_ms_to_duration(1875) / 2;
     }
+
+    // Runs the audio state every `step` ms like a driver would, recording when the playing frequency changes
+    std::vector<std::pair<uint32_t, float>> record(uint32_t ms, uint32_t step = 1) {
+        std::vector<std::pair<uint32_t, float>> changes;
+        float                                   playing = -1.0f;
+        for (uint32_t t = 0; t < ms; t += step) {
+            float frequency = audio_is_playing_melody() ? audio_get_frequency(0) : -1.0f;
+            if (frequency != playing) {
+                changes.push_back({t, frequency});
+                playing = frequency;
+            }
+            advance_time(step);
+            audio_update_state();
+        }
+        return changes;
+    }
+
+    void expect_same_playback(const std::vector<std::pair<uint32_t, float>> &stream, const std::vector<std::pair<uint32_t, float>> &array) {
+        ASSERT_EQ(stream.size(), array.size());
+        for (size_t i = 0; i < stream.size(); i++) {
+            EXPECT_EQ(stream[i].first, array[i].first) << "change " << i;
+            EXPECT_NEAR(stream[i].second, array[i].second, 0.01) << "change " << i;
+        }
+    }
 };
 
 TEST_F(AudioTest, OnOffToggle) {
@@ -115,4 +143,50 @@ TEST_F(AudioTest, BpmConversion) {
     }
 }
 
+TEST_F(AudioTest, SongStreamPlaysLikeSongArray) {
+    float         ode_to_joy[][2]    = SONG(ODE_TO_JOY);
+    const uint8_t ode_to_joy_stream[] = SONG_STREAM(ODE_TO_JOY);
+    float         campanella[][2]    = SONG(CAMPANELLA);
+    const uint8_t campanella_stream[] = SONG_STREAM(CAMPANELLA);
+
+    audio_on();
+    audio_stop_all();
+    audio_set_tempo(TEMPO_DEFAULT);
+
+    // Ode to Joy repeats notes, which get a short pause in between
+    PLAY_SONG(ode_to_joy);
+    auto array = record(10000);
+    PLAY_SONG_STREAM(ode_to_joy_stream);
+    auto stream = record(10000);
+    EXPECT_GT(array.size(), NOTE_ARRAY_SIZE(ode_to_joy));
+    expect_same_playback(stream, array);
+
+    // Campanella is mostly made of repeated passages, a slow update skips notes
+    PLAY_SONG(campanella);
+    array = record(40000, 7);
+    PLAY_SONG_STREAM(campanella_stream);
+    stream = record(40000, 7);
+    expect_same_playback(stream, array);
+}
+
+TEST_F(AudioTest, SongStreamLoops) {
+    float         song[][2]     = SONG(E__NOTE(_A5), E__NOTE(_B5), E__NOTE(_A5));
+    const uint8_t song_stream[] = {0x46, 0x08, 0xC8, 0xC6, SONG_STREAM_END};
+
+    audio_on();
+    audio_stop_all();
+    audio_set_tempo(TEMPO_DEFAULT);
+
+    // Looping from the last A5 to the first one inserts a pause between them
+    PLAY_LOOP(song);
+    auto array = record(2000);
+    PLAY_LOOP_STREAM(song_stream);
+    auto stream = record(2000);
+    EXPECT_TRUE(audio_is_playing_melody());
+    audio_stop_all();
+
+    EXPECT_GT(array.size(), 3 * 4);
+    expect_same_playback(stream, array);
+}
+
 } // namespace
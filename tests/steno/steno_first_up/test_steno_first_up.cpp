@@ -0,0 +1,101 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keycode.h"
+#include "keymap_steno.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+namespace {
+
+using packet_t = std::vector<uint8_t>;
+
+std::vector<packet_t> sent_packets;
+
+extern "C" {
+void virtser_init(void) {}
+
+void virtser_send_buffer(const uint8_t *data, uint16_t length) {
+    sent_packets.emplace_back(data, data + length);
+}
+}
+
+packet_t gemini_packet(std::initializer_list<uint16_t> keycodes) {
+    packet_t packet(GEMINI_STROKE_SIZE, 0);
+    packet[0] = 0x80;
+    for (auto keycode : keycodes) {
+        uint8_t key = keycode - QK_STENO;
+        packet[key / 7] |= 1 << (6 - key % 7);
+    }
+    return packet;
+}
+
+class StenoFirstUp : public TestFixture {
+   public:
+    void SetUp() override {
+        sent_packets.clear();
+    }
+};
+
+} // namespace
+
+TEST_F(StenoFirstUp, SendsOnFirstRelease) {
+    TestDriver driver;
+    KeymapKey  key_s(0, 0, 0, STN_S1);
+    KeymapKey  key_t(0, 1, 0, STN_TL);
+    KeymapKey  key_a(0, 2, 0, STN_A);
+    set_keymap({key_s, key_t, key_a});
+    EXPECT_NO_REPORT(driver);
+
+    key_s.press();
+    run_one_scan_loop();
+    key_t.press();
+    run_one_scan_loop();
+    key_a.press();
+    run_one_scan_loop();
+    EXPECT_THAT(sent_packets, IsEmpty());
+
+    key_t.release();
+    run_one_scan_loop();
+    EXPECT_THAT(sent_packets, ElementsAre(gemini_packet({STN_S1, STN_TL, STN_A})));
+
+    // the rest of the chord was already sent
+    key_s.release();
+    run_one_scan_loop();
+    key_a.release();
+    run_one_scan_loop();
+    EXPECT_EQ(sent_packets.size(), 1);
+}
+
+TEST_F(StenoFirstUp, HeldKeysOnlyCountIfPressedAgain) {
+    TestDriver driver;
+    KeymapKey  key_t(0, 0, 0, STN_TL);
+    KeymapKey  key_o(0, 1, 0, STN_O);
+    KeymapKey  key_e(0, 2, 0, STN_E);
+    set_keymap({key_t, key_o, key_e});
+    EXPECT_NO_REPORT(driver);
+
+    key_t.press();
+    run_one_scan_loop();
+    key_o.press();
+    run_one_scan_loop();
+    key_t.release();
+    run_one_scan_loop();
+
+    // O is still held while E starts the next chord
+    key_e.press();
+    run_one_scan_loop();
+    key_o.release();
+    run_one_scan_loop();
+    key_e.release();
+    run_one_scan_loop();
+
+    EXPECT_THAT(sent_packets, ElementsAre(gemini_packet({STN_TL, STN_O}), gemini_packet({STN_E})));
+}
@@ -0,0 +1,10 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define STENO_REPEAT
+#define STENO_REPEAT_DELAY 300
+#define STENO_REPEAT_INTERVAL 50
@@ -0,0 +1,114 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keycode.h"
+#include "keymap_steno.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using ::testing::_;
+using ::testing::Each;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+namespace {
+
+using packet_t = std::vector<uint8_t>;
+
+std::vector<packet_t> sent_packets;
+
+extern "C" {
+void virtser_init(void) {}
+
+void virtser_send_buffer(const uint8_t *data, uint16_t length) {
+    sent_packets.emplace_back(data, data + length);
+}
+}
+
+packet_t gemini_packet(std::initializer_list<uint16_t> keycodes) {
+    packet_t packet(GEMINI_STROKE_SIZE, 0);
+    packet[0] = 0x80;
+    for (auto keycode : keycodes) {
+        uint8_t key = keycode - QK_STENO;
+        packet[key / 7] |= 1 << (6 - key % 7);
+    }
+    return packet;
+}
+
+class StenoRepeat : public TestFixture {
+   public:
+    void SetUp() override {
+        sent_packets.clear();
+    }
+};
+
+} // namespace
+
+TEST_F(StenoRepeat, ShortStrokeIsSentOnce) {
+    TestDriver driver;
+    KeymapKey  key_p(0, 0, 0, STN_PL);
+    KeymapKey  key_star(0, 1, 0, STN_ST1);
+    set_keymap({key_p, key_star});
+    EXPECT_NO_REPORT(driver);
+
+    key_p.press();
+    key_star.press();
+    idle_for(STENO_REPEAT_DELAY - 10);
+    key_p.release();
+    key_star.release();
+    run_one_scan_loop();
+    idle_for(STENO_REPEAT_DELAY * 2);
+
+    EXPECT_THAT(sent_packets, ElementsAre(gemini_packet({STN_PL, STN_ST1})));
+}
+
+TEST_F(StenoRepeat, HeldStrokeRepeats) {
+    TestDriver driver;
+    KeymapKey  key_p(0, 0, 0, STN_PL);
+    KeymapKey  key_star(0, 1, 0, STN_ST1);
+    set_keymap({key_p, key_star});
+    EXPECT_NO_REPORT(driver);
+
+    key_p.press();
+    run_one_scan_loop();
+    key_star.press();
+    run_one_scan_loop();
+    idle_for(STENO_REPEAT_DELAY);
+    EXPECT_EQ(sent_packets.size(), 1);
+    idle_for(STENO_REPEAT_INTERVAL * 3);
+    EXPECT_EQ(sent_packets.size(), 4);
+
+    // releasing the keys does not send the stroke once more
+    key_star.release();
+    run_one_scan_loop();
+    idle_for(STENO_REPEAT_DELAY);
+    key_p.release();
+    run_one_scan_loop();
+
+    EXPECT_EQ(sent_packets.size(), 4);
+    EXPECT_THAT(sent_packets, Each(gemini_packet({STN_PL, STN_ST1})));
+}
+
+TEST_F(StenoRepeat, AddingKeyRestartsDelay) {
+    TestDriver driver;
+    KeymapKey  key_s(0, 0, 0, STN_S1);
+    KeymapKey  key_a(0, 1, 0, STN_A);
+    set_keymap({key_s, key_a});
+    EXPECT_NO_REPORT(driver);
+
+    key_s.press();
+    idle_for(STENO_REPEAT_DELAY - 10);
+    key_a.press();
+    idle_for(STENO_REPEAT_DELAY - 10);
+    EXPECT_THAT(sent_packets, IsEmpty());
+
+    idle_for(20);
+    key_a.release();
+    key_s.release();
+    run_one_scan_loop();
+
+    EXPECT_THAT(sent_packets, ElementsAre(gemini_packet({STN_S1, STN_A})));
+}
@@ -0,0 +1,216 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+#include <vector>
+
+#include "keycode.h"
+#include "keymap_steno.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using ::testing::_;
+using ::testing::ElementsAreArray;
+
+namespace {
+
+using packet_t = std::vector<uint8_t>;
+
+struct steno_event {
+    uint16_t keycode;
+    bool     pressed;
+};
+
+using stream_t = std::vector<steno_event>;
+
+std::vector<packet_t> sent_packets;
+
+std::function<bool(steno_mode_t, uint8_t *)> send_steno_chord_user_fun;
+
+extern "C" {
+void virtser_init(void) {}
+
+void virtser_send_buffer(const uint8_t *data, uint16_t length) {
+    sent_packets.emplace_back(data, data + length);
+}
+
+bool send_steno_chord_user(steno_mode_t mode, uint8_t chord[MAX_STROKE_SIZE]) {
+    return send_steno_chord_user_fun ? send_steno_chord_user_fun(mode, chord) : true;
+}
+}
+
+// TX Bolt code of each steno key, as in process_steno.c
+const uint8_t reference_boltmap[] = {TXB_NUL, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_S_L, TXB_S_L, TXB_T_L, TXB_K_L, TXB_P_L, TXB_W_L, TXB_H_L, TXB_R_L, TXB_A_L, TXB_O_L, TXB_STR, TXB_STR, TXB_NUL, TXB_NUL, TXB_NUL, TXB_STR, TXB_STR, TXB_E_R, TXB_U_R, TXB_F_R, TXB_R_R, TXB_P_R, TXB_B_R, TXB_L_R, TXB_G_R, TXB_T_R, TXB_S_R, TXB_D_R, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_NUM, TXB_Z_R};
+
+// The packets the previous implementation sent byte by byte, once all the keys of a chord were released
+std::vector<packet_t> reference_packets(steno_mode_t mode, const stream_t &stream) {
+    std::vector<packet_t> packets;
+    uint8_t               chord[GEMINI_STROKE_SIZE] = {0};
+    int                   n_pressed_keys            = 0;
+
+    for (auto &event : stream) {
+        uint8_t key = event.keycode - QK_STENO;
+        if (event.pressed) {
+            n_pressed_keys++;
+            if (mode == STENO_MODE_GEMINI) {
+                chord[key / 7] |= 1 << (6 - key % 7);
+            } else {
+                chord[reference_boltmap[key] >> 6] |= reference_boltmap[key];
+            }
+            continue;
+        }
+        if (--n_pressed_keys > 0) {
+            continue;
+        }
+        n_pressed_keys = 0;
+
+        packet_t packet;
+        if (mode == STENO_MODE_GEMINI) {
+            chord[0] |= 0x80;
+            packet.assign(chord, chord + GEMINI_STROKE_SIZE);
+        } else {
+            for (uint8_t i = 0; i < BOLT_STROKE_SIZE; i++) {
+                if (chord[i]) {
+                    packet.push_back(chord[i]);
+                }
+            }
+            packet.push_back(0);
+        }
+        packets.push_back(packet);
+        memset(chord, 0, sizeof(chord));
+    }
+    return packets;
+}
+
+// Presses the keys in order, then releases them in order
+stream_t stroke(std::initializer_list<uint16_t> keycodes) {
+    stream_t stream;
+    for (auto keycode : keycodes) {
+        stream.push_back({keycode, true});
+    }
+    for (auto keycode : keycodes) {
+        stream.push_back({keycode, false});
+    }
+    return stream;
+}
+
+stream_t operator+(stream_t a, const stream_t &b) {
+    a.insert(a.end(), b.begin(), b.end());
+    return a;
+}
+
+const uint16_t steno_keys[] = {STN_FN, STN_N1, STN_N2, STN_S1, STN_S2, STN_TL, STN_KL, STN_PL, STN_WL, STN_HL, STN_RL, STN_A, STN_O, STN_ST1, STN_ST2, STN_RES1, STN_PWR, STN_E, STN_U, STN_FR, STN_RR, STN_PR, STN_BR, STN_LR, STN_GR, STN_TR, STN_SR, STN_DR, STN_N7, STN_ZR};
+
+// Strokes as they were typed, with the overlaps of fast writing
+const std::vector<std::pair<const char *, stream_t>> recorded_streams = {
+    {"left bank", stroke({STN_S1, STN_TL, STN_KL, STN_PL, STN_WL, STN_HL, STN_RL})},
+    {"vowels and star", stroke({STN_A, STN_O, STN_ST1, STN_E, STN_U})},
+    {"right bank", stroke({STN_FR, STN_RR, STN_PR, STN_BR, STN_LR, STN_GR, STN_TR, STN_SR, STN_DR, STN_ZR})},
+    {"first and last TX Bolt group only", stroke({STN_S2, STN_ZR})},
+    {"number bar and function keys", stroke({STN_N1, STN_FN, STN_A, STN_N7}) + stroke({STN_N2, STN_PWR})},
+    {"key without a TX Bolt code", stroke({STN_RES1})},
+    {"the quick brown", stroke({STN_TL, STN_HL, STN_E}) + stroke({STN_KL, STN_WL, STN_ST1, STN_E, STN_GR}) + stroke({STN_PL, STN_WL, STN_RL, STN_O, STN_U, STN_FR, STN_PR, STN_BR})},
+    {"rolled stroke",
+     {{STN_S1, true}, {STN_TL, true}, {STN_KL, true}, {STN_PL, true}, {STN_TL, false}, {STN_KL, false}, {STN_PL, false}, {STN_E, true}, {STN_S1, false}, {STN_E, false}}},
+    {"overlapping strokes",
+     {{STN_TL, true}, {STN_O, true}, {STN_TL, false}, {STN_ST2, true}, {STN_O, false}, {STN_ST2, false}, {STN_PL, true}, {STN_PL, false}}},
+    {"same key twice in a stroke", {{STN_S1, true}, {STN_S2, true}, {STN_A, true}, {STN_S1, false}, {STN_S2, false}, {STN_A, false}}},
+};
+
+class Steno : public TestFixture {
+   public:
+    void SetUp() override {
+        sent_packets.clear();
+        send_steno_chord_user_fun = nullptr;
+        for (uint8_t i = 0; i < sizeof(steno_keys) / sizeof(steno_keys[0]); i++) {
+            add_key(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, steno_keys[i]));
+        }
+    }
+
+    void replay(const stream_t &stream) {
+        for (auto &event : stream) {
+            KeymapKey key = *find_steno_key(event.keycode);
+            if (event.pressed) {
+                key.press();
+            } else {
+                key.release();
+            }
+            run_one_scan_loop();
+        }
+    }
+
+   private:
+    const KeymapKey *find_steno_key(uint16_t keycode) {
+        for (auto &key : keymap) {
+            if (key.code == keycode) {
+                return &key;
+            }
+        }
+        ADD_FAILURE() << "no key for steno keycode " << keycode;
+        return &keymap.front();
+    }
+};
+
+} // namespace
+
+TEST_F(Steno, GeminiPacketsMatchReference) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    steno_set_mode(STENO_MODE_GEMINI);
+
+    for (auto &[name, stream] : recorded_streams) {
+        SCOPED_TRACE(name);
+        sent_packets.clear();
+        replay(stream);
+        EXPECT_THAT(sent_packets, ElementsAreArray(reference_packets(STENO_MODE_GEMINI, stream)));
+    }
+}
+
+TEST_F(Steno, BoltPacketsMatchReference) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    steno_set_mode(STENO_MODE_BOLT);
+
+    for (auto &[name, stream] : recorded_streams) {
+        SCOPED_TRACE(name);
+        sent_packets.clear();
+        replay(stream);
+        EXPECT_THAT(sent_packets, ElementsAreArray(reference_packets(STENO_MODE_BOLT, stream)));
+    }
+}
+
+TEST_F(Steno, SendsNothingUntilAllKeysAreReleased) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    steno_set_mode(STENO_MODE_GEMINI);
+
+    replay({{STN_S1, true}, {STN_A, true}, {STN_S1, false}});
+    EXPECT_TRUE(sent_packets.empty());
+    replay({{STN_A, false}});
+    EXPECT_EQ(sent_packets.size(), 1);
+}
+
+TEST_F(Steno, UserCanAlterTheChord) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    steno_set_mode(STENO_MODE_BOLT);
+
+    // add the asterisk to every stroke
+    send_steno_chord_user_fun = [](steno_mode_t mode, uint8_t *chord) {
+        chord[TXB_STR >> 6] |= TXB_STR;
+        return true;
+    };
+    replay(stroke({STN_TL}));
+    EXPECT_THAT(sent_packets, ElementsAreArray(reference_packets(STENO_MODE_BOLT, stroke({STN_TL, STN_ST1}))));
+
+    // or send it themselves
+    send_steno_chord_user_fun = [](steno_mode_t mode, uint8_t *chord) { return false; };
+    replay(stroke({STN_TL}));
+    EXPECT_EQ(sent_packets.size(), 1);
+
+    // which leaves the next chord alone
+    send_steno_chord_user_fun = nullptr;
+    replay(stroke({STN_PL}));
+    EXPECT_THAT(sent_packets.back(), ElementsAreArray(reference_packets(STENO_MODE_BOLT, stroke({STN_PL})).back()));
+}
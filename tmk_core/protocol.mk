@@ -33,6 +33,11 @@ ifeq ($(strip $(PROGRAMMABLE_BUTTON_ENABLE)), yes)
     SHARED_EP_ENABLE = yes
 endif
 
+ifeq ($(strip $(HOST_REPORT_QUEUE_ENABLE)), yes)
+    OPT_DEFS += -DHOST_REPORT_QUEUE_ENABLE
+    SRC += $(PROTOCOL_DIR)/host_report_queue.c
+endif
+
 ifeq ($(strip $(RAW_ENABLE)), yes)
     OPT_DEFS += -DRAW_ENABLE
 endif
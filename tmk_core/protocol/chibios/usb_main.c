@@ -880,6 +880,39 @@ void send_report(uint8_t endpoint, void *report, size_t size) {
     osalSysUnlock();
 }
 
+/* check whether the endpoint used for a report type is free to start a transfer,
+ * so that callers can avoid blocking in send_report() */
+bool report_ready(host_report_type_t type) {
+    uint8_t ep;
+    switch (type) {
+        case HOST_REPORT_KEYBOARD:
+            ep = KEYBOARD_IN_EPNUM;
+#ifdef NKRO_ENABLE
+            if (keyboard_protocol && keymap_config.nkro) {
+                ep = SHARED_IN_EPNUM;
+            }
+#endif
+            break;
+#ifdef MOUSE_ENABLE
+        case HOST_REPORT_MOUSE:
+            ep = MOUSE_IN_EPNUM;
+            break;
+#endif
+#ifdef EXTRAKEY_ENABLE
+        case HOST_REPORT_EXTRA:
+            ep = SHARED_IN_EPNUM;
+            break;
+#endif
+        default:
+            return true;
+    }
+
+    osalSysLock();
+    bool ready = usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE || !usbGetTransmitStatusI(&USB_DRIVER, ep);
+    osalSysUnlock();
+    return ready;
+}
+
 /* prepare and start sending a report IN
  * not callable from ISR or locked state */
 void send_keyboard(report_keyboard_t *report) {
@@ -1034,6 +1067,10 @@ void send_midi_packet(MIDI_EventPacket_t *event) {
     chnWrite(&drivers.midi_driver.driver, (uint8_t *)event, sizeof(MIDI_EventPacket_t));
 }
 
+void send_midi_packets(MIDI_EventPacket_t *events, uint8_t count) {
+    chnWrite(&drivers.midi_driver.driver, (uint8_t *)events, count * sizeof(MIDI_EventPacket_t));
+}
+
 bool recv_midi_packet(MIDI_EventPacket_t *const event) {
     size_t size = chnReadTimeout(&drivers.midi_driver.driver, (uint8_t *)event, sizeof(MIDI_EventPacket_t), TIME_IMMEDIATE);
     return size == sizeof(MIDI_EventPacket_t);
@@ -1059,6 +1096,10 @@ void virtser_send(const uint8_t byte) {
     chnWrite(&drivers.serial_driver.driver, &byte, 1);
 }
 
+void virtser_send_buffer(const uint8_t *data, uint16_t length) {
+    chnWrite(&drivers.serial_driver.driver, data, length);
+}
+
 __attribute__((weak)) void virtser_recv(uint8_t c) {
     // Ignore by default
 }
@@ -40,6 +40,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 extern keymap_config_t keymap_config;
 #endif
 
+#ifdef HOST_REPORT_QUEUE_ENABLE
+#    include "host_report_queue.h"
+#endif
+
 static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
@@ -52,6 +56,12 @@ host_driver_t *host_get_driver(void) {
     return driver;
 }
 
+void host_task(void) {
+#ifdef HOST_REPORT_QUEUE_ENABLE
+    if (driver) host_report_queue_flush(driver);
+#endif
+}
+
 #ifdef SPLIT_KEYBOARD
 uint8_t split_led_state = 0;
 void    set_split_host_keyboard_leds(uint8_t led_state) {
@@ -81,8 +91,12 @@ void host_keyboard_send(report_keyboard_t *report) {
 #endif
 
     if (!driver) return;
+    __attribute__((unused)) bool nkro = false;
+#if defined(NKRO_ENABLE)
+    nkro = keyboard_protocol && keymap_config.nkro;
+#endif
 #if defined(NKRO_ENABLE) && defined(NKRO_SHARED_EP)
-    if (keyboard_protocol && keymap_config.nkro) {
+    if (nkro) {
         /* The callers of this function assume that report->mods is where mods go in.
          * But report->nkro.mods can be at a different offset if core keyboard does not have a report ID.
          */
@@ -95,7 +109,11 @@ void host_keyboard_send(report_keyboard_t *report) {
         report->report_id = REPORT_ID_KEYBOARD;
 #endif
     }
+#ifdef HOST_REPORT_QUEUE_ENABLE
+    host_report_queue_keyboard(driver, report, nkro);
+#else
     (*driver->send_keyboard)(report);
+#endif
 
     if (debug_keyboard) {
         dprint("keyboard_report: ");
@@ -123,7 +141,11 @@ void host_mouse_send(report_mouse_t *report) {
     report->boot_x = (report->x > 127) ? 127 : ((report->x < -127) ? -127 : report->x);
     report->boot_y = (report->y > 127) ? 127 : ((report->y < -127) ? -127 : report->y);
 #endif
+#ifdef HOST_REPORT_QUEUE_ENABLE
+    host_report_queue_mouse(driver, report);
+#else
     (*driver->send_mouse)(report);
+#endif
 }
 
 void host_system_send(uint16_t usage) {
@@ -141,7 +163,11 @@ void host_system_send(uint16_t usage) {
         .usage     = usage,
     };
 #endif
+#ifdef HOST_REPORT_QUEUE_ENABLE
+    host_report_queue_extra(driver, &report);
+#else
     (*driver->send_extra)(&report);
+#endif
 }
 
 void host_consumer_send(uint16_t usage) {
@@ -166,7 +192,11 @@ void host_consumer_send(uint16_t usage) {
         .usage     = usage,
     };
 #endif
+#ifdef HOST_REPORT_QUEUE_ENABLE
+    host_report_queue_extra(driver, &report);
+#else
     (*driver->send_extra)(&report);
+#endif
 }
 
 #ifdef JOYSTICK_ENABLE
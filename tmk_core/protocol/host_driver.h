@@ -18,16 +18,26 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "report.h"
 #ifdef MIDI_ENABLE
 #    include "midi.h"
 #endif
 
+typedef enum {
+    HOST_REPORT_KEYBOARD,
+    HOST_REPORT_MOUSE,
+    HOST_REPORT_EXTRA,
+    HOST_REPORT_TYPE_COUNT,
+} host_report_type_t;
+
 typedef struct {
     uint8_t (*keyboard_leds)(void);
     void (*send_keyboard)(report_keyboard_t *);
     void (*send_mouse)(report_mouse_t *);
     void (*send_extra)(report_extra_t *);
+    /* Optional: returns true if a report of the given type can be sent without blocking */
+    bool (*report_ready)(host_report_type_t);
 } host_driver_t;
 
 void send_joystick(report_joystick_t *report);
@@ -0,0 +1,326 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Per-endpoint queues of reports waiting to be sent to the host.
+
+Reports are only handed to the host driver once it indicates the endpoint is ready, so the
+scan loop never waits on a busy endpoint. While a report is still waiting, a following report
+may be merged into it when the host cannot observe the difference:
+
+- keyboard: when both steps only release keys, or the first step only presses modifiers and
+  the second only presses keys -- the ordering of presses relative to other presses, and of
+  a press relative to its release, is always preserved
+- mouse: when neither step changes the buttons, the motion is summed
+- extra: when the usage is identical
+
+Queued reports are never overwritten or dropped, so every transition reaches the host. If a
+queue is full, an incoming report is held back in an overflow slot until there is room for it.
+Further reports are merged into the held back one under the rules above; when one cannot be,
+the caller waits for the endpoint to accept a report, as it would without the queue.
+*/
+
+#include <string.h>
+#include "host_report_queue.h"
+
+typedef struct {
+    uint8_t                   head;
+    bool                      overflow; // A report is held back in the overflow slot, waiting for room in the queue
+    host_report_queue_stats_t stats;
+} host_report_ring_t;
+
+static host_report_ring_t rings[HOST_REPORT_TYPE_COUNT];
+
+// The last slot of each queue is the overflow slot
+#define OVERFLOW_SLOT HOST_REPORT_QUEUE_SIZE
+
+static report_keyboard_t keyboard_queue[HOST_REPORT_QUEUE_SIZE + 1];
+static bool              keyboard_nkro[HOST_REPORT_QUEUE_SIZE + 1];
+static report_mouse_t    mouse_queue[HOST_REPORT_QUEUE_SIZE + 1];
+static report_extra_t    extra_queue[HOST_REPORT_QUEUE_SIZE + 1];
+
+// The most recent reports handed to the driver, which must remain valid while they are transmitted
+static report_keyboard_t keyboard_sent;
+static bool              keyboard_sent_nkro;
+static report_mouse_t    mouse_sent;
+static report_extra_t    extra_sent;
+
+static inline uint8_t ring_index(host_report_ring_t *ring, uint8_t offset) {
+    return (ring->head + offset) % HOST_REPORT_QUEUE_SIZE;
+}
+
+static inline uint8_t ring_tail(host_report_ring_t *ring) {
+    return ring_index(ring, ring->stats.depth - 1);
+}
+
+// Returns the slot for a new report, or the overflow slot if the queue is full
+static uint8_t ring_insert(host_report_ring_t *ring) {
+    if (ring->stats.depth == HOST_REPORT_QUEUE_SIZE) {
+        ring->overflow = true;
+        return OVERFLOW_SLOT;
+    }
+    ring->stats.queued++;
+    ring->stats.depth++;
+    if (ring->stats.depth > ring->stats.max_depth) {
+        ring->stats.max_depth = ring->stats.depth;
+    }
+    return ring_tail(ring);
+}
+
+// Returns the newest waiting report, which a following report may be merged into, or -1 if there is none. The report
+// before it is returned through `previous`, -1 meaning the report last handed to the driver.
+static int16_t ring_last(host_report_ring_t *ring, int16_t *previous) {
+    if (ring->overflow) {
+        *previous = ring_tail(ring);
+        return OVERFLOW_SLOT;
+    }
+    if (ring->stats.depth == 0) {
+        return -1;
+    }
+    *previous = ring->stats.depth > 1 ? ring_index(ring, ring->stats.depth - 2) : -1;
+    return ring_tail(ring);
+}
+
+// Returns the slot for a report which could not be merged, first waiting for the endpoint if the overflow slot is taken
+static uint8_t ring_push(host_driver_t *driver, host_report_type_t type) {
+    host_report_ring_t *ring = &rings[type];
+    if (ring->overflow) {
+        ring->stats.stalled++;
+        while (ring->overflow) {
+            host_report_queue_flush(driver);
+        }
+    }
+    return ring_insert(ring);
+}
+
+static void ring_pop(host_report_ring_t *ring) {
+    ring->head = ring_index(ring, 1);
+    ring->stats.depth--;
+    ring->stats.sent++;
+}
+
+// Moves the report held back in the overflow slot into the queue, once there is room for it
+static int16_t ring_unoverflow(host_report_ring_t *ring) {
+    if (!ring->overflow || ring->stats.depth == HOST_REPORT_QUEUE_SIZE) {
+        return -1;
+    }
+    ring->overflow = false;
+    return ring_insert(ring);
+}
+
+static bool host_report_queue_ready(host_driver_t *driver, host_report_type_t type) {
+    return !driver->report_ready || driver->report_ready(type);
+}
+
+/* Keyboard */
+
+static uint8_t keyboard_mods(const report_keyboard_t *report, bool nkro) {
+#ifdef NKRO_ENABLE
+    if (nkro) {
+        return report->nkro.mods;
+    }
+#endif
+    return report->mods;
+}
+
+static bool keyboard_has_key(const report_keyboard_t *report, bool nkro, uint8_t key) {
+#ifdef NKRO_ENABLE
+    if (nkro) {
+        return (key >> 3) < KEYBOARD_REPORT_BITS && (report->nkro.bits[key >> 3] & (1 << (key & 7)));
+    }
+#endif
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns true if every key held in `a` is also held in `b`, optionally ignoring modifiers
+static bool keyboard_keys_subset(const report_keyboard_t *a, const report_keyboard_t *b, bool nkro, bool with_mods) {
+    if (with_mods && (keyboard_mods(a, nkro) & ~keyboard_mods(b, nkro))) {
+        return false;
+    }
+#ifdef NKRO_ENABLE
+    if (nkro) {
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_BITS; i++) {
+            if (a->nkro.bits[i] & ~b->nkro.bits[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+#endif
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (a->keys[i] && !keyboard_has_key(b, nkro, a->keys[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool keyboard_report_equal(const report_keyboard_t *a, const report_keyboard_t *b) {
+    return memcmp(a, b, sizeof(report_keyboard_t)) == 0;
+}
+
+// Determines whether the transition previous -> queued -> next can be sent as previous -> next
+static bool keyboard_can_coalesce(const report_keyboard_t *previous, const report_keyboard_t *queued, const report_keyboard_t *next, bool nkro) {
+    if (keyboard_report_equal(queued, next)) {
+        return true;
+    }
+    // Both steps only release
+    if (keyboard_keys_subset(queued, previous, nkro, true) && keyboard_keys_subset(next, queued, nkro, true)) {
+        return true;
+    }
+    // First step only presses modifiers, second step only presses
+    if (keyboard_keys_subset(previous, queued, nkro, true) && keyboard_keys_subset(queued, previous, nkro, false) && keyboard_keys_subset(queued, next, nkro, true)) {
+        return true;
+    }
+    return false;
+}
+
+void host_report_queue_keyboard(host_driver_t *driver, report_keyboard_t *report, bool nkro) {
+    host_report_ring_t *ring = &rings[HOST_REPORT_KEYBOARD];
+
+    int16_t previous, last = ring_last(ring, &previous);
+    if (last >= 0) {
+        const report_keyboard_t *previous_report = previous >= 0 ? &keyboard_queue[previous] : &keyboard_sent;
+        bool                     previous_nkro   = previous >= 0 ? keyboard_nkro[previous] : keyboard_sent_nkro;
+        if (keyboard_nkro[last] == nkro && previous_nkro == nkro && keyboard_can_coalesce(previous_report, &keyboard_queue[last], report, nkro)) {
+            keyboard_queue[last] = *report;
+            ring->stats.coalesced++;
+            host_report_queue_flush(driver);
+            return;
+        }
+    }
+
+    uint8_t slot         = ring_push(driver, HOST_REPORT_KEYBOARD);
+    keyboard_queue[slot] = *report;
+    keyboard_nkro[slot]  = nkro;
+    host_report_queue_flush(driver);
+}
+
+/* Mouse */
+
+static bool mouse_add_motion(mouse_xy_report_t *total, mouse_xy_report_t delta) {
+    int32_t sum = (int32_t)*total + delta;
+#ifdef MOUSE_EXTENDED_REPORT
+    if (sum < INT16_MIN || sum > INT16_MAX) {
+#else
+    if (sum < INT8_MIN || sum > INT8_MAX) {
+#endif
+        return false;
+    }
+    *total = sum;
+    return true;
+}
+
+static bool mouse_add_scroll(int8_t *total, int8_t delta) {
+    int16_t sum = (int16_t)*total + delta;
+    if (sum < INT8_MIN || sum > INT8_MAX) {
+        return false;
+    }
+    *total = sum;
+    return true;
+}
+
+void host_report_queue_mouse(host_driver_t *driver, report_mouse_t *report) {
+    host_report_ring_t *ring = &rings[HOST_REPORT_MOUSE];
+
+    int16_t previous, last = ring_last(ring, &previous);
+    if (last >= 0) {
+        const report_mouse_t *previous_report = previous >= 0 ? &mouse_queue[previous] : &mouse_sent;
+        report_mouse_t        merged          = mouse_queue[last];
+        if (previous_report->buttons == merged.buttons && merged.buttons == report->buttons && mouse_add_motion(&merged.x, report->x) && mouse_add_motion(&merged.y, report->y) && mouse_add_scroll(&merged.v, report->v) && mouse_add_scroll(&merged.h, report->h)) {
+#ifdef MOUSE_EXTENDED_REPORT
+            merged.boot_x = (merged.x > 127) ? 127 : ((merged.x < -127) ? -127 : merged.x);
+            merged.boot_y = (merged.y > 127) ? 127 : ((merged.y < -127) ? -127 : merged.y);
+#endif
+            mouse_queue[last] = merged;
+            ring->stats.coalesced++;
+            host_report_queue_flush(driver);
+            return;
+        }
+    }
+
+    mouse_queue[ring_push(driver, HOST_REPORT_MOUSE)] = *report;
+    host_report_queue_flush(driver);
+}
+
+/* Extra */
+
+void host_report_queue_extra(host_driver_t *driver, report_extra_t *report) {
+    host_report_ring_t *ring = &rings[HOST_REPORT_EXTRA];
+
+    int16_t previous, last = ring_last(ring, &previous);
+    if (last >= 0) {
+        const report_extra_t *queued = &extra_queue[last];
+        if (queued->report_id == report->report_id && queued->usage == report->usage) {
+            ring->stats.coalesced++;
+            host_report_queue_flush(driver);
+            return;
+        }
+    }
+
+    extra_queue[ring_push(driver, HOST_REPORT_EXTRA)] = *report;
+    host_report_queue_flush(driver);
+}
+
+/* Common */
+
+void host_report_queue_flush(host_driver_t *driver) {
+    int16_t slot;
+
+    host_report_ring_t *ring = &rings[HOST_REPORT_KEYBOARD];
+    while (ring->stats.depth > 0 && host_report_queue_ready(driver, HOST_REPORT_KEYBOARD)) {
+        keyboard_sent      = keyboard_queue[ring->head];
+        keyboard_sent_nkro = keyboard_nkro[ring->head];
+        ring_pop(ring);
+        if ((slot = ring_unoverflow(ring)) >= 0) {
+            keyboard_queue[slot] = keyboard_queue[OVERFLOW_SLOT];
+            keyboard_nkro[slot]  = keyboard_nkro[OVERFLOW_SLOT];
+        }
+        driver->send_keyboard(&keyboard_sent);
+    }
+
+    ring = &rings[HOST_REPORT_MOUSE];
+    while (ring->stats.depth > 0 && host_report_queue_ready(driver, HOST_REPORT_MOUSE)) {
+        mouse_sent = mouse_queue[ring->head];
+        ring_pop(ring);
+        if ((slot = ring_unoverflow(ring)) >= 0) {
+            mouse_queue[slot] = mouse_queue[OVERFLOW_SLOT];
+        }
+        driver->send_mouse(&mouse_sent);
+    }
+
+    ring = &rings[HOST_REPORT_EXTRA];
+    while (ring->stats.depth > 0 && host_report_queue_ready(driver, HOST_REPORT_EXTRA)) {
+        extra_sent = extra_queue[ring->head];
+        ring_pop(ring);
+        if ((slot = ring_unoverflow(ring)) >= 0) {
+            extra_queue[slot] = extra_queue[OVERFLOW_SLOT];
+        }
+        driver->send_extra(&extra_sent);
+    }
+}
+
+void host_report_queue_clear(void) {
+    memset(rings, 0, sizeof(rings));
+    memset(&keyboard_sent, 0, sizeof(keyboard_sent));
+    memset(&mouse_sent, 0, sizeof(mouse_sent));
+    keyboard_sent_nkro = false;
+}
+
+bool host_report_queue_is_empty(void) {
+    for (uint8_t i = 0; i < HOST_REPORT_TYPE_COUNT; i++) {
+        if (rings[i].stats.depth > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const host_report_queue_stats_t *host_report_queue_get_stats(host_report_type_t type) {
+    return &rings[type].stats;
+}
@@ -0,0 +1,48 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+#include "host_driver.h"
+
+#ifndef HOST_REPORT_QUEUE_SIZE
+#    define HOST_REPORT_QUEUE_SIZE 8
+#endif
+
+#if HOST_REPORT_QUEUE_SIZE < 1 || HOST_REPORT_QUEUE_SIZE > UINT8_MAX
+#    error HOST_REPORT_QUEUE_SIZE must be between 1 and 255
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint8_t  depth;     // Reports currently waiting
+    uint8_t  max_depth; // Highest number of reports waiting at once
+    uint32_t queued;    // Reports accepted into the queue
+    uint32_t coalesced; // Reports merged into an earlier queued report
+    uint32_t stalled;   // Reports which had to wait for the endpoint, the queue being full of reports they could not be merged into
+    uint32_t sent;      // Reports passed to the host driver
+} host_report_queue_stats_t;
+
+/* Discards all queued reports and resets the statistics */
+void host_report_queue_clear(void);
+
+/* Queue a report for transmission, then send as many queued reports as the driver will accept */
+void host_report_queue_keyboard(host_driver_t *driver, report_keyboard_t *report, bool nkro);
+void host_report_queue_mouse(host_driver_t *driver, report_mouse_t *report);
+void host_report_queue_extra(host_driver_t *driver, report_extra_t *report);
+
+/* Send as many queued reports as the driver will accept, without blocking */
+void host_report_queue_flush(host_driver_t *driver);
+
+bool                             host_report_queue_is_empty(void);
+const host_report_queue_stats_t *host_report_queue_get_stats(host_report_type_t type);
+
+#ifdef __cplusplus
+}
+#endif
@@ -714,6 +714,13 @@ void send_midi_packet(MIDI_EventPacket_t *event) {
     MIDI_Device_SendEventPacket(&USB_MIDI_Interface, event);
 }
 
+void send_midi_packets(MIDI_EventPacket_t *events, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        MIDI_Device_SendEventPacket(&USB_MIDI_Interface, &events[i]);
+    }
+    MIDI_Device_Flush(&USB_MIDI_Interface);
+}
+
 bool recv_midi_packet(MIDI_EventPacket_t *const event) {
     return MIDI_Device_ReceiveEventPacket(&USB_MIDI_Interface, event);
 }
@@ -785,6 +792,21 @@ void virtser_send(const uint8_t byte) {
         Endpoint_SelectEndpoint(ep);
     }
 }
+
+/** \brief Virtual Serial Send Buffer
+ *
+ * Sends several bytes with a single flush of the IN endpoint.
+ */
+void virtser_send_buffer(const uint8_t *data, uint16_t length) {
+    uint8_t ep = Endpoint_GetCurrentEndpoint();
+
+    if (cdc_device.State.ControlLineStates.HostToDevice & CDC_CONTROL_LINE_OUT_DTR) {
+        CDC_Device_SendData(&cdc_device, data, length);
+        CDC_Device_Flush(&cdc_device);
+    }
+
+    Endpoint_SelectEndpoint(ep);
+}
 #endif
 
 /*******************************************************************************